@@ -0,0 +1,455 @@
+#!/usr/bin/env python3
+#
+# generate_fix_db.py - Generates src/fix_db.h from the FIX dictionary in json format.
+#  Tag names are emitted as a constexpr array indexed by tag number, and the names of the
+#  enumerated values of each field as a constexpr table with a perfect hash (hash and
+#  displace), so that every lookup is O(1), with no allocation and no work at startup.
+#
+# Usage: generate_fix_db.py [input.json] [output.h]
+#
+# Written by Ryan Antkowiak
+#
+
+import json
+import re
+import sys
+
+INPUT_FILE = "../fix_messages_5_0.json"
+OUTPUT_FILE = "../src/fix_db.h"
+
+# must match fix_db::hash() in the generated header
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+MASK = 0xFFFFFFFF
+
+# the member fields of the common repeating groups, by the name of their NumInGroup field. the
+# dictionary does not say which fields belong to a group, so these are curated from the FIX
+# specification. the first member is the delimiter, the field that starts each instance. a
+# NumInGroup member is a nested group, and its members are members of the outer group too.
+# groups that are not listed here are not split into instances.
+GROUP_MEMBERS = {
+    "NoLinesOfText": ["Text", "EncodedTextLen", "EncodedText"],
+    "NoAllocs": ["AllocAccount", "AllocAcctIDSource", "AllocSettlCurrency", "IndividualAllocID",
+                 "NoNestedPartyIDs", "AllocQty"],
+    "NoExecs": ["LastQty", "ExecID", "SecondaryExecID", "LastPx", "LastParPx", "LastCapacity"],
+    "NoMiscFees": ["MiscFeeAmt", "MiscFeeCurr", "MiscFeeType", "MiscFeeBasis"],
+    "NoRelatedSym": ["Symbol", "SymbolSfx", "SecurityID", "SecurityIDSource", "NoSecurityAltID", "Product",
+                     "CFICode", "SecurityType", "SecuritySubType", "MaturityMonthYear", "MaturityDate",
+                     "StrikePrice", "PutOrCall", "ContractMultiplier", "SecurityExchange", "Issuer",
+                     "SecurityDesc", "NoUnderlyings", "NoLegs", "Currency", "QuoteRequestType", "QuoteType",
+                     "Side", "OrderQty", "TradingSessionID", "TradingSessionSubID", "NoPartyIDs"],
+    "NoIOIQualifiers": ["IOIQualifier"],
+    "NoRoutingIDs": ["RoutingType", "RoutingID"],
+    "NoStipulations": ["StipulationType", "StipulationValue"],
+    "NoMDEntryTypes": ["MDEntryType"],
+    "NoMDEntries": ["MDEntryType", "MDUpdateAction", "DeleteReason", "MDEntryID", "MDEntryRefID", "Symbol",
+                    "SecurityID", "SecurityIDSource", "MDEntryPx", "Currency", "MDEntrySize", "MDEntryDate",
+                    "MDEntryTime", "TickDirection", "MDMkt", "TradingSessionID", "TradingSessionSubID",
+                    "QuoteCondition", "TradeCondition", "MDEntryOriginator", "LocationID", "DeskID",
+                    "OpenCloseSettlFlag", "TimeInForce", "ExpireDate", "ExpireTime", "MinQty", "ExecInst",
+                    "SellerDays", "OrderID", "QuoteEntryID", "MDEntryBuyer", "MDEntrySeller", "NumberOfOrders",
+                    "MDEntryPositionNo", "Scope", "PriceDelta", "NetChgPrevDay", "MDPriceLevel", "MDQuoteType",
+                    "RptSeq", "Text", "EncodedTextLen", "EncodedText"],
+    "NoQuoteEntries": ["QuoteEntryID", "Symbol", "SymbolSfx", "SecurityID", "SecurityIDSource",
+                       "NoSecurityAltID", "NoUnderlyings", "NoLegs", "BidPx", "OfferPx", "BidSize", "OfferSize",
+                       "ValidUntilTime", "BidSpotRate", "OfferSpotRate", "BidForwardPoints", "OfferForwardPoints",
+                       "TransactTime", "TradingSessionID", "TradingSessionSubID", "Currency",
+                       "QuoteEntryRejectReason"],
+    "NoContraBrokers": ["ContraBroker", "ContraTrader", "ContraTradeQty", "ContraTradeTime", "ContraLegRefID"],
+    "NoMsgTypes": ["RefMsgType", "MsgDirection"],
+    "NoTradingSessions": ["TradingSessionID", "TradingSessionSubID"],
+    "NoPartyIDs": ["PartyID", "PartyIDSource", "PartyRole", "NoPartySubIDs"],
+    "NoPartySubIDs": ["PartySubID", "PartySubIDType"],
+    "NoSecurityAltID": ["SecurityAltID", "SecurityAltIDSource"],
+    "NoUnderlyingSecurityAltID": ["UnderlyingSecurityAltID", "UnderlyingSecurityAltIDSource"],
+    "NoContAmts": ["ContAmtType", "ContAmtValue", "ContAmtCurr"],
+    "NoAffectedOrders": ["OrigClOrdID", "AffectedOrderID", "AffectedSecondaryOrderID"],
+    "NoNestedPartyIDs": ["NestedPartyID", "NestedPartyIDSource", "NestedPartyRole", "NoNestedPartySubIDs"],
+    "NoNestedPartySubIDs": ["NestedPartySubID", "NestedPartySubIDType"],
+    "NoSides": ["Side", "OrderID", "SecondaryOrderID", "ClOrdID", "SecondaryClOrdID", "ListID", "NoPartyIDs",
+                "Account", "AcctIDSource", "AccountType", "TradeInputSource", "OrderInputDevice", "Currency",
+                "ComplianceID", "SolicitedFlag", "OrderCapacity", "OrderRestrictions", "CustOrderCapacity",
+                "OrdType", "ExecInst", "TradingSessionID", "TradingSessionSubID", "Commission", "CommType",
+                "GrossTradeAmt", "NetMoney", "SettlCurrAmt", "SettlCurrency", "PositionEffect", "Text",
+                "EncodedTextLen", "EncodedText", "SideMultiLegReportingType", "NoContAmts", "NoStipulations",
+                "NoMiscFees", "AllocID", "NoAllocs", "NoClearingInstructions", "NoSideTrdRegTS"],
+    "NoLegs": ["LegSymbol", "LegSymbolSfx", "LegSecurityID", "LegSecurityIDSource", "NoLegSecurityAltID",
+               "LegProduct", "LegCFICode", "LegSecurityType", "LegSecuritySubType", "LegMaturityMonthYear",
+               "LegMaturityDate", "LegStrikePrice", "LegOptAttribute", "LegContractMultiplier",
+               "LegSecurityExchange", "LegIssuer", "LegSecurityDesc", "LegRatioQty", "LegSide", "LegCurrency",
+               "LegPool", "LegDatedDate", "LegContractSettlMonth", "LegInterestAccrualDate", "LegQty",
+               "LegOrderQty", "LegSwapType", "NoLegStipulations", "LegPositionEffect", "LegCoveredOrUncovered",
+               "NoNestedPartyIDs", "LegRefID", "LegPrice", "LegSettlType", "LegSettlDate", "LegLastPx",
+               "LegStrikeCurrency", "NoLegAllocs"],
+    "NoClearingInstructions": ["ClearingInstruction"],
+    "NoDates": ["TradeDate", "TransactTime"],
+    "NoLegSecurityAltID": ["LegSecurityAltID", "LegSecurityAltIDSource"],
+    "NoLegAllocs": ["LegAllocAccount", "LegIndividualAllocID", "NoNested2PartyIDs", "LegAllocQty",
+                    "LegAllocAcctIDSource", "LegSettlCurrency"],
+    "NoLegStipulations": ["LegStipulationType", "LegStipulationValue"],
+    "NoPositions": ["PosType", "LongQty", "ShortQty", "PosQtyStatus", "NoNestedPartyIDs"],
+    "NoUnderlyings": ["UnderlyingSymbol", "UnderlyingSymbolSfx", "UnderlyingSecurityID",
+                      "UnderlyingSecurityIDSource", "NoUnderlyingSecurityAltID", "UnderlyingProduct",
+                      "UnderlyingCFICode", "UnderlyingSecurityType", "UnderlyingMaturityMonthYear",
+                      "UnderlyingMaturityDate", "UnderlyingStrikePrice", "UnderlyingPutOrCall",
+                      "UnderlyingContractMultiplier", "UnderlyingSecurityExchange", "UnderlyingIssuer",
+                      "UnderlyingSecurityDesc", "UnderlyingCurrency", "UnderlyingQty", "UnderlyingPx",
+                      "NoUnderlyingStips", "NoUndlyInstrumentParties"],
+    "NoQuoteQualifiers": ["QuoteQualifier"],
+    "NoPosAmt": ["PosAmtType", "PosAmt"],
+    "NoNested2PartyIDs": ["Nested2PartyID", "Nested2PartyIDSource", "Nested2PartyRole", "NoNested2PartySubIDs"],
+    "NoNested2PartySubIDs": ["Nested2PartySubID", "Nested2PartySubIDType"],
+    "NoTrdRegTimestamps": ["TrdRegTimestamp", "TrdRegTimestampType", "TrdRegTimestampOrigin"],
+    "NoSettlPartyIDs": ["SettlPartyID", "SettlPartyIDSource", "SettlPartyRole", "NoSettlPartySubIDs"],
+    "NoSettlPartySubIDs": ["SettlPartySubID", "SettlPartySubIDType"],
+    "NoAltMDSource": ["AltMDSourceID"],
+    "NoCapacities": ["OrderCapacity", "OrderRestrictions", "OrderCapacityQty"],
+    "NoEvents": ["EventType", "EventDate", "EventPx", "EventText"],
+    "NoInstrAttrib": ["InstrAttribType", "InstrAttribValue"],
+    "NoUnderlyingStips": ["UnderlyingStipType", "UnderlyingStipValue"],
+    "NoTrades": ["TradeReportID", "SecondaryTradeReportID"],
+    "NoCompIDs": ["RefCompID", "RefSubID", "LocationID", "DeskID", "StatusValue", "StatusText"],
+    "NoCollInquiryQualifier": ["CollInquiryQualifier"],
+    "NoNested3PartyIDs": ["Nested3PartyID", "Nested3PartyIDSource", "Nested3PartyRole", "NoNested3PartySubIDs"],
+    "NoNested3PartySubIDs": ["Nested3PartySubID", "Nested3PartySubIDType"],
+    "NoStrategyParameters": ["StrategyParameterName", "StrategyParameterType", "StrategyParameterValue"],
+    "NoUnderlyingAmounts": ["UnderlyingPayAmount", "UnderlyingCollectAmount", "UnderlyingSettlementDate",
+                            "UnderlyingSettlementStatus"],
+    "NoSideTrdRegTS": ["SideTrdRegTimestamp", "SideTrdRegTimestampType", "SideTrdRegTimestampSrc"],
+    "NoInstrumentParties": ["InstrumentPartyID", "InstrumentPartyIDSource", "InstrumentPartyRole",
+                            "NoInstrumentPartySubIDs"],
+    "NoInstrumentPartySubIDs": ["InstrumentPartySubID", "InstrumentPartySubIDType"],
+    "NoUndlyInstrumentParties": ["UndlyInstrumentPartyID", "UndlyInstrumentPartyIDSource",
+                                 "UndlyInstrumentPartyRole", "NoUndlyInstrumentPartySubIDs"],
+    "NoUndlyInstrumentPartySubIDs": ["UndlyInstrumentPartySubID", "UndlyInstrumentPartySubIDType"],
+    "NoRootPartyIDs": ["RootPartyID", "RootPartyIDSource", "RootPartyRole", "NoRootPartySubIDs"],
+    "NoRootPartySubIDs": ["RootPartySubID", "RootPartySubIDType"],
+}
+
+
+def fix_hash(seed, tag, value):
+    h = (FNV_OFFSET ^ seed) & MASK
+    for b in (tag & 0xFF, (tag >> 8) & 0xFF):
+        h = ((h ^ b) * FNV_PRIME) & MASK
+    for b in value.encode("utf-8"):
+        h = ((h ^ b) * FNV_PRIME) & MASK
+    h ^= h >> 15
+    h = (h * 0x2C1B3C6D) & MASK
+    h ^= h >> 12
+    h = (h * 0x297A2D39) & MASK
+    h ^= h >> 15
+    return h
+
+
+def build_perfect_hash(keys):
+    """returns (bucket seeds, slots) where slots[i] is the key at slot i (or None)"""
+    num_slots = 1
+    while num_slots < len(keys) * 5 // 4:
+        num_slots *= 2
+    num_buckets = max(1, num_slots // 4)
+
+    buckets = [[] for _ in range(num_buckets)]
+    for key in keys:
+        buckets[fix_hash(0, *key) % num_buckets].append(key)
+
+    seeds = [0] * num_buckets
+    slots = [None] * num_slots
+
+    # place the largest buckets first, while the table is emptiest
+    for index in sorted(range(num_buckets), key=lambda i: -len(buckets[i])):
+        bucket = buckets[index]
+        if not bucket:
+            continue
+
+        seed = 1
+        while True:
+            positions = [fix_hash(seed, *key) & (num_slots - 1) for key in bucket]
+            if len(set(positions)) == len(positions) and all(slots[p] is None for p in positions):
+                break
+            seed += 1
+            if seed > 0xFFFF:
+                raise RuntimeError("no perfect hash seed found for a bucket of field values")
+
+        seeds[index] = seed
+        for key, position in zip(bucket, positions):
+            slots[position] = key
+
+    return seeds, slots
+
+
+def build_groups(tags):
+    """returns [(count tag, delimiter tag, sorted member tags)] of the groups in GROUP_MEMBERS,
+    sorted by count tag. the members of nested groups are members of the outer group too."""
+    numbers = {name: tag for tag, name in tags.items()}
+
+    def tag_of(name):
+        if name not in numbers:
+            raise RuntimeError("unknown tag name in GROUP_MEMBERS: " + name)
+        return numbers[name]
+
+    def members_of(group, seen):
+        if group in seen:
+            raise RuntimeError("repeating group nested in itself: " + group)
+        members = set()
+        for name in GROUP_MEMBERS[group]:
+            members.add(tag_of(name))
+            if name in GROUP_MEMBERS:
+                members |= members_of(name, seen | {group})
+        return members
+
+    groups = []
+    for group in GROUP_MEMBERS:
+        groups.append((tag_of(group), tag_of(GROUP_MEMBERS[group][0]), sorted(members_of(group, set()))))
+
+    return sorted(groups)
+
+
+def literal(s):
+    return json.dumps(s, ensure_ascii=False)
+
+
+def generate(data):
+    tags = {int(k): v for k, v in data["tags"].items()}
+    max_tag = max(tags)
+
+    fields = {}
+    for tag, values in data["fields"].items():
+        for value, name in values.items():
+            fields[(int(tag), value)] = name
+
+    seeds, slots = build_perfect_hash(list(fields.keys()))
+
+    # the NumInGroup fields, that count the instances of a repeating group, are all named
+    # "No" and then the name of what they count (for example NoPartyIDs)
+    group_counts = sorted(tag for tag, name in tags.items() if re.match(r"No[A-Z]", name))
+    group_bits = [0] * ((max_tag + 64) // 64)
+    for tag in group_counts:
+        group_bits[tag // 64] |= 1 << (tag % 64)
+
+    groups = build_groups(tags)
+    group_members = [tag for group in groups for tag in group[2]]
+
+    out = []
+    w = out.append
+
+    w("#pragma once")
+    w("")
+    w("//")
+    w("// fix_db.h - FIX " + data["fix_version"].replace("FIX.", "") + " dictionary: the names of the tags, and of the enumerated")
+    w("//  values of fields, as compile time lookup tables.")
+    w("//")
+    w("// Generated by scripts/generate_fix_db.py from fix_messages_5_0.json. Do not edit.")
+    w("//")
+    w("")
+    w("#include <array>")
+    w("#include <cstddef>")
+    w("#include <cstdint>")
+    w("#include <string_view>")
+    w("")
+    w("namespace rda")
+    w("{")
+    w("    class fix_db")
+    w("    {")
+    w("    public:")
+    w("        // the FIX version of the dictionary")
+    w("        constexpr static const std::string_view FIX_VERSION = " + literal(data["fix_version"]) + ";")
+    w("")
+    w("        // the highest tag number in the dictionary")
+    w("        constexpr static const size_t MAX_TAG = " + str(max_tag) + ";")
+    w("")
+    w("        // number of enumerated field values in the dictionary")
+    w("        constexpr static const size_t NUM_FIELD_VALUES = " + str(len(fields)) + ";")
+    w("")
+    w("        // number of NumInGroup tags, that count the instances of a repeating group")
+    w("        constexpr static const size_t NUM_GROUP_COUNT_TAGS = " + str(len(group_counts)) + ";")
+    w("")
+    w("        // number of repeating groups whose member fields are known")
+    w("        constexpr static const size_t NUM_GROUPS = " + str(len(groups)) + ";")
+    w("")
+    w("        // number of member fields of the known repeating groups")
+    w("        constexpr static const size_t NUM_GROUP_MEMBERS = " + str(len(group_members)) + ";")
+    w("")
+    w("    private:")
+    w("        // an enumerated value of a field, and its name")
+    w("        struct field_entry")
+    w("        {")
+    w("            uint16_t tag;")
+    w("            std::string_view value;")
+    w("            std::string_view name;")
+    w("        };")
+    w("")
+    w("        // a repeating group: its NumInGroup tag, the tag of the field that starts each instance,")
+    w("        // and the position of its member tags (sorted) in GROUP_MEMBERS")
+    w("        struct group_entry")
+    w("        {")
+    w("            uint16_t count_tag;")
+    w("            uint16_t delimiter;")
+    w("            uint16_t first_member;")
+    w("            uint16_t num_members;")
+    w("        };")
+    w("")
+    w("        // number of buckets of the perfect hash of the field values")
+    w("        constexpr static const size_t NUM_FIELD_BUCKETS = " + str(len(seeds)) + ";")
+    w("")
+    w("        // number of slots in the table of field values (a power of two)")
+    w("        constexpr static const size_t NUM_FIELD_SLOTS = " + str(len(slots)) + ";")
+    w("")
+    w("        // the names of the tags, indexed by tag number (empty for unknown tags)")
+    w("        constexpr static const std::array<std::string_view, MAX_TAG + 1> TAG_NAMES = {{")
+    for tag in range(max_tag + 1):
+        w("            " + literal(tags.get(tag, "")) + ",")
+    w("        }};")
+    w("")
+    w("        // a bit for each tag number, set for the NumInGroup tags")
+    w("        constexpr static const std::array<uint64_t, " + str(len(group_bits)) + "> GROUP_COUNT_BITS = {{")
+    for i in range(0, len(group_bits), 4):
+        w("            " + " ".join("0x%016XULL," % b for b in group_bits[i:i + 4]))
+    w("        }};")
+    w("")
+    w("        // the known repeating groups, sorted by NumInGroup tag")
+    w("        constexpr static const std::array<group_entry, NUM_GROUPS> GROUPS = {{")
+    position = 0
+    for count_tag, delimiter, members in groups:
+        w("            {" + str(count_tag) + ", " + str(delimiter) + ", " + str(position) + ", " + str(len(members)) + "}, // " + tags[count_tag])
+        position += len(members)
+    w("        }};")
+    w("")
+    w("        // the member tags of each known repeating group (including those of the groups nested")
+    w("        // in it), sorted")
+    w("        constexpr static const std::array<uint16_t, NUM_GROUP_MEMBERS> GROUP_MEMBERS = {{")
+    for count_tag, delimiter, members in groups:
+        for i in range(0, len(members), 16):
+            w("            " + " ".join(str(m) + "," for m in members[i:i + 16]))
+    w("        }};")
+    w("")
+    w("        // the seed of the second hash of each bucket of field values")
+    w("        constexpr static const std::array<uint16_t, NUM_FIELD_BUCKETS> FIELD_SEEDS = {{")
+    for i in range(0, len(seeds), 16):
+        w("            " + " ".join(str(s) + "," for s in seeds[i:i + 16]))
+    w("        }};")
+    w("")
+    w("        // the field values, at the slots given by their perfect hash (tag zero when unused)")
+    w("        constexpr static const std::array<field_entry, NUM_FIELD_SLOTS> FIELD_VALUES = {{")
+    for key in slots:
+        if key is None:
+            w("            {0, {}, {}},")
+        else:
+            w("            {" + str(key[0]) + ", " + literal(key[1]) + ", " + literal(fields[key]) + "},")
+    w("        }};")
+    w("")
+    w("        // hash of a tag number and field value (32 bit FNV-1a, with a final mix)")
+    w("        constexpr static uint32_t hash(const uint32_t seed, const size_t tag, const std::string_view value)")
+    w("        {")
+    w("            uint32_t h = (" + str(FNV_OFFSET) + "u ^ seed);")
+    w("            h = (h ^ static_cast<uint32_t>(tag & 0xFF)) * " + str(FNV_PRIME) + "u;")
+    w("            h = (h ^ static_cast<uint32_t>((tag >> 8) & 0xFF)) * " + str(FNV_PRIME) + "u;")
+    w("")
+    w("            for (const char c : value)")
+    w("                h = (h ^ static_cast<unsigned char>(c)) * " + str(FNV_PRIME) + "u;")
+    w("")
+    w("            h ^= (h >> 15);")
+    w("            h *= 0x2C1B3C6Du;")
+    w("            h ^= (h >> 12);")
+    w("            h *= 0x297A2D39u;")
+    w("            h ^= (h >> 15);")
+    w("            return h;")
+    w("        }")
+    w("")
+    w("        // returns the known repeating group counted by a NumInGroup tag (nullptr if not known)")
+    w("        constexpr static const group_entry *find_group(const size_t count_tag)")
+    w("        {")
+    w("            size_t low = 0;")
+    w("            size_t high = NUM_GROUPS;")
+    w("")
+    w("            while (low < high)")
+    w("            {")
+    w("                const size_t mid = (low + high) / 2;")
+    w("                if (GROUPS[mid].count_tag < count_tag)")
+    w("                    low = mid + 1;")
+    w("                else")
+    w("                    high = mid;")
+    w("            }")
+    w("")
+    w("            return ((low < NUM_GROUPS && GROUPS[low].count_tag == count_tag) ? &GROUPS[low] : nullptr);")
+    w("        }")
+    w("")
+    w("    public:")
+    w("        // returns the name of a FIX tag (empty if the tag is not known)")
+    w("        constexpr static std::string_view tag_name(const size_t tag)")
+    w("        {")
+    w("            return (tag <= MAX_TAG ? TAG_NAMES[tag] : std::string_view());")
+    w("        }")
+    w("")
+    w("        // returns true if a tag counts the instances of a repeating group (NumInGroup)")
+    w("        constexpr static bool is_group_count(const size_t tag)")
+    w("        {")
+    w("            return (tag <= MAX_TAG && ((GROUP_COUNT_BITS[tag / 64] >> (tag % 64)) & 1) != 0);")
+    w("        }")
+    w("")
+    w("        // returns the tag of the field that starts each instance of a repeating group, given its")
+    w("        // NumInGroup tag (zero if the members of the group are not known)")
+    w("        constexpr static size_t group_delimiter(const size_t count_tag)")
+    w("        {")
+    w("            const group_entry *g = find_group(count_tag);")
+    w("            return (g != nullptr ? g->delimiter : 0);")
+    w("        }")
+    w("")
+    w("        // returns true if a tag is a member of the repeating group with a NumInGroup tag, or of a")
+    w("        // group nested in it (false if the members of the group are not known)")
+    w("        constexpr static bool is_group_member(const size_t count_tag, const size_t tag)")
+    w("        {")
+    w("            const group_entry *g = find_group(count_tag);")
+    w("            if (g == nullptr)")
+    w("                return false;")
+    w("")
+    w("            size_t low = g->first_member;")
+    w("            size_t high = low + g->num_members;")
+    w("")
+    w("            while (low < high)")
+    w("            {")
+    w("                const size_t mid = (low + high) / 2;")
+    w("                if (GROUP_MEMBERS[mid] < tag)")
+    w("                    low = mid + 1;")
+    w("                else")
+    w("                    high = mid;")
+    w("            }")
+    w("")
+    w("            return (low < static_cast<size_t>(g->first_member + g->num_members) && GROUP_MEMBERS[low] == tag);")
+    w("        }")
+    w("")
+    w("        // returns the name of an enumerated value of a FIX field (empty if not known)")
+    w("        constexpr static std::string_view field_name(const size_t tag, const std::string_view value)")
+    w("        {")
+    w("            if (tag == 0 || tag > MAX_TAG)")
+    w("                return std::string_view();")
+    w("")
+    w("            const uint32_t seed = FIELD_SEEDS[hash(0, tag, value) % NUM_FIELD_BUCKETS];")
+    w("            const field_entry &entry = FIELD_VALUES[hash(seed, tag, value) & (NUM_FIELD_SLOTS - 1)];")
+    w("")
+    w("            if (entry.tag != tag || entry.value != value)")
+    w("                return std::string_view();")
+    w("")
+    w("            return entry.name;")
+    w("        }")
+    w("")
+    w("    }; // class fix_db")
+    w("")
+    w("} // namespace rda")
+    w("")
+
+    return "\n".join(out)
+
+
+def main():
+    input_file = sys.argv[1] if len(sys.argv) > 1 else INPUT_FILE
+    output_file = sys.argv[2] if len(sys.argv) > 2 else OUTPUT_FILE
+
+    with open(input_file, encoding="utf-8") as f:
+        data = json.load(f)
+
+    with open(output_file, "w", encoding="utf-8", newline="\n") as f:
+        f.write(generate(data))
+
+
+if __name__ == "__main__":
+    main()
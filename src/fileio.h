@@ -157,6 +157,13 @@ namespace rda
             return path;
         }
 
+        // return a pointer to the file data (nullptr if no data is loaded). the data is
+        // followed by a null byte.
+        virtual const byte *get_data() const
+        {
+            return data;
+        }
+
         // return string representation of file data
         virtual std::string to_string() const
         {
@@ -1,2360 +1,3548 @@
-
 #pragma once
 
-#include <sstream>
-#include <string>
+//
+// fix_db.h - FIX 5.0 dictionary: the names of the tags, and of the enumerated
+//  values of fields, as compile time lookup tables.
+//
+// Generated by scripts/generate_fix_db.py from fix_messages_5_0.json. Do not edit.
+//
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
 
 namespace rda
 {
     class fix_db
     {
     public:
-        static std::string get()
+        // the FIX version of the dictionary
+        constexpr static const std::string_view FIX_VERSION = "FIX.5.0";
+
+        // the highest tag number in the dictionary
+        constexpr static const size_t MAX_TAG = 1139;
+
+        // number of enumerated field values in the dictionary
+        constexpr static const size_t NUM_FIELD_VALUES = 1019;
+
+        // number of NumInGroup tags, that count the instances of a repeating group
+        constexpr static const size_t NUM_GROUP_COUNT_TAGS = 70;
+
+        // number of repeating groups whose member fields are known
+        constexpr static const size_t NUM_GROUPS = 57;
+
+        // number of member fields of the known repeating groups
+        constexpr static const size_t NUM_GROUP_MEMBERS = 628;
+
+    private:
+        // an enumerated value of a field, and its name
+        struct field_entry
+        {
+            uint16_t tag;
+            std::string_view value;
+            std::string_view name;
+        };
+
+        // a repeating group: its NumInGroup tag, the tag of the field that starts each instance,
+        // and the position of its member tags (sorted) in GROUP_MEMBERS
+        struct group_entry
         {
-            static std::stringstream ss;
-            if (ss.str().empty())
+            uint16_t count_tag;
+            uint16_t delimiter;
+            uint16_t first_member;
+            uint16_t num_members;
+        };
+
+        // number of buckets of the perfect hash of the field values
+        constexpr static const size_t NUM_FIELD_BUCKETS = 512;
+
+        // number of slots in the table of field values (a power of two)
+        constexpr static const size_t NUM_FIELD_SLOTS = 2048;
+
+        // the names of the tags, indexed by tag number (empty for unknown tags)
+        constexpr static const std::array<std::string_view, MAX_TAG + 1> TAG_NAMES = {{
+            "",
+            "Account",
+            "AdvId",
+            "AdvRefID",
+            "AdvSide",
+            "AdvTransType",
+            "AvgPx",
+            "BeginSeqNo",
+            "BeginString",
+            "BodyLength",
+            "CheckSum",
+            "ClOrdID",
+            "Commission",
+            "CommType",
+            "CumQty",
+            "Currency",
+            "EndSeqNo",
+            "ExecID",
+            "ExecInst",
+            "ExecRefID",
+            "ExecTransType",
+            "HandlInst",
+            "SecurityIDSource",
+            "IOIID",
+            "IOIOthSvc (no longer used)",
+            "IOIQltyInd",
+            "IOIRefID",
+            "IOIQty",
+            "IOITransType",
+            "LastCapacity",
+            "LastMkt",
+            "LastPx",
+            "LastQty",
+            "NoLinesOfText",
+            "MsgSeqNum",
+            "MsgType",
+            "NewSeqNo",
+            "OrderID",
+            "OrderQty",
+            "OrdStatus",
+            "OrdType",
+            "OrigClOrdID",
+            "OrigTime",
+            "PossDupFlag",
+            "Price",
+            "RefSeqNum",
+            "RelatdSym (no longer used)",
+            "Rule80A(No Longer Used)",
+            "SecurityID",
+            "SenderCompID",
+            "SenderSubID",
+            "SendingDate (no longer used)",
+            "SendingTime",
+            "Quantity",
+            "Side",
+            "Symbol",
+            "TargetCompID",
+            "TargetSubID",
+            "Text",
+            "TimeInForce",
+            "TransactTime",
+            "Urgency",
+            "ValidUntilTime",
+            "SettlType",
+            "SettlDate",
+            "SymbolSfx",
+            "ListID",
+            "ListSeqNo",
+            "TotNoOrders",
+            "ListExecInst",
+            "AllocID",
+            "AllocTransType",
+            "RefAllocID",
+            "NoOrders",
+            "AvgPxPrecision",
+            "TradeDate",
+            "ExecBroker",
+            "PositionEffect",
+            "NoAllocs",
+            "AllocAccount",
+            "AllocQty",
+            "ProcessCode",
+            "NoRpts",
+            "RptSeq",
+            "CxlQty",
+            "NoDlvyInst",
+            "DlvyInst",
+            "AllocStatus",
+            "AllocRejCode",
+            "Signature",
+            "SecureDataLen",
+            "SecureData",
+            "BrokerOfCredit",
+            "SignatureLength",
+            "EmailType",
+            "RawDataLength",
+            "RawData",
+            "PossResend",
+            "EncryptMethod",
+            "StopPx",
+            "ExDestination",
+            "",
+            "CxlRejReason",
+            "OrdRejReason",
+            "IOIQualifier",
+            "WaveNo",
+            "Issuer",
+            "SecurityDesc",
+            "HeartBtInt",
+            "ClientID",
+            "MinQty",
+            "MaxFloor",
+            "TestReqID",
+            "ReportToExch",
+            "LocateReqd",
+            "OnBehalfOfCompID",
+            "OnBehalfOfSubID",
+            "QuoteID",
+            "NetMoney",
+            "SettlCurrAmt",
+            "SettlCurrency",
+            "ForexReq",
+            "OrigSendingTime",
+            "GapFillFlag",
+            "NoExecs",
+            "CxlType",
+            "ExpireTime",
+            "DKReason",
+            "DeliverToCompID",
+            "DeliverToSubID",
+            "IOINaturalFlag",
+            "QuoteReqID",
+            "BidPx",
+            "OfferPx",
+            "BidSize",
+            "OfferSize",
+            "NoMiscFees",
+            "MiscFeeAmt",
+            "MiscFeeCurr",
+            "MiscFeeType",
+            "PrevClosePx",
+            "ResetSeqNumFlag",
+            "SenderLocationID",
+            "TargetLocationID",
+            "OnBehalfOfLocationID",
+            "DeliverToLocationID",
+            "NoRelatedSym",
+            "Subject",
+            "Headline",
+            "URLLink",
+            "ExecType",
+            "LeavesQty",
+            "CashOrderQty",
+            "AllocAvgPx",
+            "AllocNetMoney",
+            "SettlCurrFxRate",
+            "SettlCurrFxRateCalc",
+            "NumDaysInterest",
+            "AccruedInterestRate",
+            "AccruedInterestAmt",
+            "SettlInstMode",
+            "AllocText",
+            "SettlInstID",
+            "SettlInstTransType",
+            "EmailThreadID",
+            "SettlInstSource",
+            "SettlLocation",
+            "SecurityType",
+            "EffectiveTime",
+            "StandInstDbType",
+            "StandInstDbName",
+            "StandInstDbID",
+            "SettlDeliveryType",
+            "SettlDepositoryCode",
+            "SettlBrkrCode",
+            "SettlInstCode",
+            "SecuritySettlAgentName",
+            "SecuritySettlAgentCode",
+            "SecuritySettlAgentAcctNum",
+            "SecuritySettlAgentAcctName",
+            "SecuritySettlAgentContactName",
+            "SecuritySettlAgentContactPhone",
+            "CashSettlAgentName",
+            "CashSettlAgentCode",
+            "CashSettlAgentAcctNum",
+            "CashSettlAgentAcctName",
+            "CashSettlAgentContactName",
+            "CashSettlAgentContactPhone",
+            "BidSpotRate",
+            "BidForwardPoints",
+            "OfferSpotRate",
+            "OfferForwardPoints",
+            "OrderQty2",
+            "SettlDate2",
+            "LastSpotRate",
+            "LastForwardPoints",
+            "AllocLinkID",
+            "AllocLinkType",
+            "SecondaryOrderID",
+            "NoIOIQualifiers",
+            "MaturityMonthYear",
+            "PutOrCall",
+            "StrikePrice",
+            "CoveredOrUncovered",
+            "CustomerOrFirm",
+            "MaturityDay",
+            "OptAttribute",
+            "SecurityExchange",
+            "NotifyBrokerOfCredit",
+            "AllocHandlInst",
+            "MaxShow",
+            "PegOffsetValue",
+            "XmlDataLen",
+            "XmlData",
+            "SettlInstRefID",
+            "NoRoutingIDs",
+            "RoutingType",
+            "RoutingID",
+            "Spread",
+            "Benchmark",
+            "BenchmarkCurveCurrency",
+            "BenchmarkCurveName",
+            "BenchmarkCurvePoint",
+            "CouponRate",
+            "CouponPaymentDate",
+            "IssueDate",
+            "RepurchaseTerm",
+            "RepurchaseRate",
+            "Factor",
+            "TradeOriginationDate",
+            "ExDate",
+            "ContractMultiplier",
+            "NoStipulations",
+            "StipulationType",
+            "StipulationValue",
+            "YieldType",
+            "Yield",
+            "TotalTakedown",
+            "Concession",
+            "RepoCollateralSecurityType",
+            "RedemptionDate",
+            "UnderlyingCouponPaymentDate",
+            "UnderlyingIssueDate",
+            "UnderlyingRepoCollateralSecurityType",
+            "UnderlyingRepurchaseTerm",
+            "UnderlyingRepurchaseRate",
+            "UnderlyingFactor",
+            "UnderlyingRedemptionDate",
+            "LegCouponPaymentDate",
+            "LegIssueDate",
+            "LegRepoCollateralSecurityType",
+            "LegRepurchaseTerm",
+            "LegRepurchaseRate",
+            "LegFactor",
+            "LegRedemptionDate",
+            "CreditRating",
+            "UnderlyingCreditRating",
+            "LegCreditRating",
+            "TradedFlatSwitch",
+            "BasisFeatureDate",
+            "BasisFeaturePrice",
+            "Reserved/Allocated to the Fixed Income proposal",
+            "MDReqID",
+            "SubscriptionRequestType",
+            "MarketDepth",
+            "MDUpdateType",
+            "AggregatedBook",
+            "NoMDEntryTypes",
+            "NoMDEntries",
+            "MDEntryType",
+            "MDEntryPx",
+            "MDEntrySize",
+            "MDEntryDate",
+            "MDEntryTime",
+            "TickDirection",
+            "MDMkt",
+            "QuoteCondition",
+            "TradeCondition",
+            "MDEntryID",
+            "MDUpdateAction",
+            "MDEntryRefID",
+            "MDReqRejReason",
+            "MDEntryOriginator",
+            "LocationID",
+            "DeskID",
+            "DeleteReason",
+            "OpenCloseSettlFlag",
+            "SellerDays",
+            "MDEntryBuyer",
+            "MDEntrySeller",
+            "MDEntryPositionNo",
+            "FinancialStatus",
+            "CorporateAction",
+            "DefBidSize",
+            "DefOfferSize",
+            "NoQuoteEntries",
+            "NoQuoteSets",
+            "QuoteStatus",
+            "QuoteCancelType",
+            "QuoteEntryID",
+            "QuoteRejectReason",
+            "QuoteResponseLevel",
+            "QuoteSetID",
+            "QuoteRequestType",
+            "TotNoQuoteEntries",
+            "UnderlyingSecurityIDSource",
+            "UnderlyingIssuer",
+            "UnderlyingSecurityDesc",
+            "UnderlyingSecurityExchange",
+            "UnderlyingSecurityID",
+            "UnderlyingSecurityType",
+            "UnderlyingSymbol",
+            "UnderlyingSymbolSfx",
+            "UnderlyingMaturityMonthYear",
+            "UnderlyingMaturityDay",
+            "UnderlyingPutOrCall",
+            "UnderlyingStrikePrice",
+            "UnderlyingOptAttribute",
+            "UnderlyingCurrency",
+            "RatioQty",
+            "SecurityReqID",
+            "SecurityRequestType",
+            "SecurityResponseID",
+            "SecurityResponseType",
+            "SecurityStatusReqID",
+            "UnsolicitedIndicator",
+            "SecurityTradingStatus",
+            "HaltReason",
+            "InViewOfCommon",
+            "DueToRelated",
+            "BuyVolume",
+            "SellVolume",
+            "HighPx",
+            "LowPx",
+            "Adjustment",
+            "TradSesReqID",
+            "TradingSessionID",
+            "ContraTrader",
+            "TradSesMethod",
+            "TradSesMode",
+            "TradSesStatus",
+            "TradSesStartTime",
+            "TradSesOpenTime",
+            "TradSesPreCloseTime",
+            "TradSesCloseTime",
+            "TradSesEndTime",
+            "NumberOfOrders",
+            "MessageEncoding",
+            "EncodedIssuerLen",
+            "EncodedIssuer",
+            "EncodedSecurityDescLen",
+            "EncodedSecurityDesc",
+            "EncodedListExecInstLen",
+            "EncodedListExecInst",
+            "EncodedTextLen",
+            "EncodedText",
+            "EncodedSubjectLen",
+            "EncodedSubject",
+            "EncodedHeadlineLen",
+            "EncodedHeadline",
+            "EncodedAllocTextLen",
+            "EncodedAllocText",
+            "EncodedUnderlyingIssuerLen",
+            "EncodedUnderlyingIssuer",
+            "EncodedUnderlyingSecurityDescLen",
+            "EncodedUnderlyingSecurityDesc",
+            "AllocPrice",
+            "QuoteSetValidUntilTime",
+            "QuoteEntryRejectReason",
+            "LastMsgSeqNumProcessed",
+            "OnBehalfOfSendingTime",
+            "RefTagID",
+            "RefMsgType",
+            "SessionRejectReason",
+            "BidRequestTransType",
+            "ContraBroker",
+            "ComplianceID",
+            "SolicitedFlag",
+            "ExecRestatementReason",
+            "BusinessRejectRefID",
+            "BusinessRejectReason",
+            "GrossTradeAmt",
+            "NoContraBrokers",
+            "MaxMessageSize",
+            "NoMsgTypes",
+            "MsgDirection",
+            "NoTradingSessions",
+            "TotalVolumeTraded",
+            "DiscretionInst",
+            "DiscretionOffsetValue",
+            "BidID",
+            "ClientBidID",
+            "ListName",
+            "TotNoRelatedSym",
+            "BidType",
+            "NumTickets",
+            "SideValue1",
+            "SideValue2",
+            "NoBidDescriptors",
+            "BidDescriptorType",
+            "BidDescriptor",
+            "SideValueInd",
+            "LiquidityPctLow",
+            "LiquidityPctHigh",
+            "LiquidityValue",
+            "EFPTrackingError",
+            "FairValue",
+            "OutsideIndexPct",
+            "ValueOfFutures",
+            "LiquidityIndType",
+            "WtAverageLiquidity",
+            "ExchangeForPhysical",
+            "OutMainCntryUIndex",
+            "CrossPercent",
+            "ProgRptReqs",
+            "ProgPeriodInterval",
+            "IncTaxInd",
+            "NumBidders",
+            "BidTradeType",
+            "BasisPxType",
+            "NoBidComponents",
+            "Country",
+            "TotNoStrikes",
+            "PriceType",
+            "DayOrderQty",
+            "DayCumQty",
+            "DayAvgPx",
+            "GTBookingInst",
+            "NoStrikes",
+            "ListStatusType",
+            "NetGrossInd",
+            "ListOrderStatus",
+            "ExpireDate",
+            "ListExecInstType",
+            "CxlRejResponseTo",
+            "UnderlyingCouponRate",
+            "UnderlyingContractMultiplier",
+            "ContraTradeQty",
+            "ContraTradeTime",
+            "ClearingFirm",
+            "ClearingAccount",
+            "LiquidityNumSecurities",
+            "MultiLegReportingType",
+            "StrikeTime",
+            "ListStatusText",
+            "EncodedListStatusTextLen",
+            "EncodedListStatusText",
+            "PartyIDSource",
+            "PartyID",
+            "TotalVolumeTradedDate",
+            "TotalVolumeTraded Time",
+            "NetChgPrevDay",
+            "PartyRole",
+            "NoPartyIDs",
+            "NoSecurityAltID",
+            "SecurityAltID",
+            "SecurityAltIDSource",
+            "NoUnderlyingSecurityAltID",
+            "UnderlyingSecurityAltID",
+            "UnderlyingSecurityAltIDSource",
+            "Product",
+            "CFICode",
+            "UnderlyingProduct",
+            "UnderlyingCFICode",
+            "TestMessageIndicator",
+            "QuantityType",
+            "BookingRefID",
+            "IndividualAllocID",
+            "RoundingDirection",
+            "RoundingModulus",
+            "CountryOfIssue",
+            "StateOrProvinceOfIssue",
+            "LocaleOfIssue",
+            "NoRegistDtls",
+            "MailingDtls",
+            "InvestorCountryOfResidence",
+            "PaymentRef",
+            "DistribPaymentMethod",
+            "CashDistribCurr",
+            "CommCurrency",
+            "CancellationRights",
+            "MoneyLaunderingStatus",
+            "MailingInst",
+            "TransBkdTime",
+            "ExecPriceType",
+            "ExecPriceAdjustment",
+            "DateOfBirth",
+            "TradeReportTransType",
+            "CardHolderName",
+            "CardNumber",
+            "CardExpDate",
+            "CardIssNum",
+            "PaymentMethod",
+            "RegistAcctType",
+            "Designation",
+            "TaxAdvantageType",
+            "RegistRejReasonText",
+            "FundRenewWaiv",
+            "CashDistribAgentName",
+            "CashDistribAgentCode",
+            "CashDistribAgentAcctNumber",
+            "CashDistribPayRef",
+            "CashDistribAgentAcctName",
+            "CardStartDate",
+            "PaymentDate",
+            "PaymentRemitterID",
+            "RegistStatus",
+            "RegistRejReasonCode",
+            "RegistRefID",
+            "RegistDtls",
+            "NoDistribInsts",
+            "RegistEmail",
+            "DistribPercentage",
+            "RegistID",
+            "RegistTransType",
+            "ExecValuationPoint",
+            "OrderPercent",
+            "OwnershipType",
+            "NoContAmts",
+            "ContAmtType",
+            "ContAmtValue",
+            "ContAmtCurr",
+            "OwnerType",
+            "PartySubID",
+            "NestedPartyID",
+            "NestedPartyIDSource",
+            "SecondaryClOrdID",
+            "SecondaryExecID",
+            "OrderCapacity",
+            "OrderRestrictions",
+            "MassCancelRequestType",
+            "MassCancelResponse",
+            "MassCancelRejectReason",
+            "TotalAffectedOrders",
+            "NoAffectedOrders",
+            "AffectedOrderID",
+            "AffectedSecondaryOrderID",
+            "QuoteType",
+            "NestedPartyRole",
+            "NoNestedPartyIDs",
+            "TotalAccruedInterestAmt",
+            "MaturityDate",
+            "UnderlyingMaturityDate",
+            "InstrRegistry",
+            "CashMargin",
+            "NestedPartySubID",
+            "Scope",
+            "MDImplicitDelete",
+            "CrossID",
+            "CrossType",
+            "CrossPrioritization",
+            "OrigCrossID",
+            "NoSides",
+            "Username",
+            "Password",
+            "NoLegs",
+            "LegCurrency",
+            "TotNoSecurityTypes",
+            "NoSecurityTypes",
+            "SecurityListRequestType",
+            "SecurityRequestResult",
+            "RoundLot",
+            "MinTradeVol",
+            "MultiLegRptTypeReq",
+            "LegPositionEffect",
+            "LegCoveredOrUncovered",
+            "LegPrice",
+            "TradSesStatusRejReason",
+            "TradeRequestID",
+            "TradeRequestType",
+            "PreviouslyReported",
+            "TradeReportID",
+            "TradeReportRefID",
+            "MatchStatus",
+            "MatchType",
+            "OddLot",
+            "NoClearingInstructions",
+            "ClearingInstruction",
+            "TradeInputSource",
+            "TradeInputDevice",
+            "NoDates",
+            "AccountType",
+            "CustOrderCapacity",
+            "ClOrdLinkID",
+            "MassStatusReqID",
+            "MassStatusReqType",
+            "OrigOrdModTime",
+            "LegSettlType",
+            "LegSettlDate",
+            "DayBookingInst",
+            "BookingUnit",
+            "PreallocMethod",
+            "UnderlyingCountryOfIssue",
+            "UnderlyingStateOrProvinceOfIssue",
+            "UnderlyingLocaleOfIssue",
+            "UnderlyingInstrRegistry",
+            "LegCountryOfIssue",
+            "LegStateOrProvinceOfIssue",
+            "LegLocaleOfIssue",
+            "LegInstrRegistry",
+            "LegSymbol",
+            "LegSymbolSfx",
+            "LegSecurityID",
+            "LegSecurityIDSource",
+            "NoLegSecurityAltID",
+            "LegSecurityAltID",
+            "LegSecurityAltIDSource",
+            "LegProduct",
+            "LegCFICode",
+            "LegSecurityType",
+            "LegMaturityMonthYear",
+            "LegMaturityDate",
+            "LegStrikePrice",
+            "LegOptAttribute",
+            "LegContractMultiplier",
+            "LegCouponRate",
+            "LegSecurityExchange",
+            "LegIssuer",
+            "EncodedLegIssuerLen",
+            "EncodedLegIssuer",
+            "LegSecurityDesc",
+            "EncodedLegSecurityDescLen",
+            "EncodedLegSecurityDesc",
+            "LegRatioQty",
+            "LegSide",
+            "TradingSessionSubID",
+            "AllocType",
+            "NoHops",
+            "HopCompID",
+            "HopSendingTime",
+            "HopRefID",
+            "MidPx",
+            "BidYield",
+            "MidYield",
+            "OfferYield",
+            "ClearingFeeIndicator",
+            "WorkingIndicator",
+            "LegLastPx",
+            "PriorityIndicator",
+            "PriceImprovement",
+            "Price2",
+            "LastForwardPoints2",
+            "BidForwardPoints2",
+            "OfferForwardPoints2",
+            "RFQReqID",
+            "MktBidPx",
+            "MktOfferPx",
+            "MinBidSize",
+            "MinOfferSize",
+            "QuoteStatusReqID",
+            "LegalConfirm",
+            "UnderlyingLastPx",
+            "UnderlyingLastQty",
+            "SecDefStatus",
+            "LegRefID",
+            "ContraLegRefID",
+            "SettlCurrBidFxRate",
+            "SettlCurrOfferFxRate",
+            "QuoteRequestRejectReason",
+            "SideComplianceID",
+            "AcctIDSource",
+            "AllocAcctIDSource",
+            "BenchmarkPrice",
+            "BenchmarkPriceType",
+            "ConfirmID",
+            "ConfirmStatus",
+            "ConfirmTransType",
+            "ContractSettlMonth",
+            "DeliveryForm",
+            "LastParPx",
+            "NoLegAllocs",
+            "LegAllocAccount",
+            "LegIndividualAllocID",
+            "LegAllocQty",
+            "LegAllocAcctIDSource",
+            "LegSettlCurrency",
+            "LegBenchmarkCurveCurrency",
+            "LegBenchmarkCurveName",
+            "LegBenchmarkCurvePoint",
+            "LegBenchmarkPrice",
+            "LegBenchmarkPriceType",
+            "LegBidPx",
+            "LegIOIQty",
+            "NoLegStipulations",
+            "LegOfferPx",
+            "LegOrderQty",
+            "LegPriceType",
+            "LegQty",
+            "LegStipulationType",
+            "LegStipulationValue",
+            "LegSwapType",
+            "Pool",
+            "QuotePriceType",
+            "QuoteRespID",
+            "QuoteRespType",
+            "QuoteQualifier",
+            "YieldRedemptionDate",
+            "YieldRedemptionPrice",
+            "YieldRedemptionPriceType",
+            "BenchmarkSecurityID",
+            "ReversalIndicator",
+            "YieldCalcDate",
+            "NoPositions",
+            "PosType",
+            "LongQty",
+            "ShortQty",
+            "PosQtyStatus",
+            "PosAmtType",
+            "PosAmt",
+            "PosTransType",
+            "PosReqID",
+            "NoUnderlyings",
+            "PosMaintAction",
+            "OrigPosReqRefID",
+            "PosMaintRptRefID",
+            "ClearingBusinessDate",
+            "SettlSessID",
+            "SettlSessSubID",
+            "AdjustmentType",
+            "ContraryInstructionIndicator",
+            "PriorSpreadIndicator",
+            "PosMaintRptID",
+            "PosMaintStatus",
+            "PosMaintResult",
+            "PosReqType",
+            "ResponseTransportType",
+            "ResponseDestination",
+            "TotalNumPosReports",
+            "PosReqResult",
+            "PosReqStatus",
+            "SettlPrice",
+            "SettlPriceType",
+            "UnderlyingSettlPrice",
+            "UnderlyingSettlPriceType",
+            "PriorSettlPrice",
+            "NoQuoteQualifiers",
+            "AllocSettlCurrency",
+            "AllocSettlCurrAmt",
+            "InterestAtMaturity",
+            "LegDatedDate",
+            "LegPool",
+            "AllocInterestAtMaturity",
+            "AllocAccruedInterestAmt",
+            "DeliveryDate",
+            "AssignmentMethod",
+            "AssignmentUnit",
+            "OpenInterest",
+            "ExerciseMethod",
+            "TotNumTradeReports",
+            "TradeRequestResult",
+            "TradeRequestStatus",
+            "TradeReportRejectReason",
+            "SideMultiLegReportingType",
+            "NoPosAmt",
+            "AutoAcceptIndicator",
+            "AllocReportID",
+            "NoNested2PartyIDs",
+            "Nested2PartyID",
+            "Nested2PartyIDSource",
+            "Nested2PartyRole",
+            "Nested2PartySubID",
+            "BenchmarkSecurityIDSource",
+            "SecuritySubType",
+            "UnderlyingSecuritySubType",
+            "LegSecuritySubType",
+            "AllowableOneSidednessPct",
+            "AllowableOneSidednessValue",
+            "AllowableOneSidednessCurr",
+            "NoTrdRegTimestamps",
+            "TrdRegTimestamp",
+            "TrdRegTimestampType",
+            "TrdRegTimestampOrigin",
+            "ConfirmRefID",
+            "ConfirmType",
+            "ConfirmRejReason",
+            "BookingType",
+            "IndividualAllocRejCode",
+            "SettlInstMsgID",
+            "NoSettlInst",
+            "LastUpdateTime",
+            "AllocSettlInstType",
+            "NoSettlPartyIDs",
+            "SettlPartyID",
+            "SettlPartyIDSource",
+            "SettlPartyRole",
+            "SettlPartySubID",
+            "SettlPartySubIDType",
+            "DlvyInstType",
+            "TerminationType",
+            "NextExpectedMsgSeqNum",
+            "OrdStatusReqID",
+            "SettlInstReqID",
+            "SettlInstReqRejCode",
+            "SecondaryAllocID",
+            "AllocReportType",
+            "AllocReportRefID",
+            "AllocCancReplaceReason",
+            "CopyMsgIndicator",
+            "AllocAccountType",
+            "OrderAvgPx",
+            "OrderBookingQty",
+            "NoSettlPartySubIDs",
+            "NoPartySubIDs",
+            "PartySubIDType",
+            "NoNestedPartySubIDs",
+            "NestedPartySubIDType",
+            "NoNested2PartySubIDs",
+            "Nested2PartySubIDType",
+            "AllocIntermedReqType",
+            "(Not Defined)",
+            "UnderlyingPx",
+            "PriceDelta",
+            "ApplQueueMax",
+            "ApplQueueDepth",
+            "ApplQueueResolution",
+            "ApplQueueAction",
+            "NoAltMDSource",
+            "AltMDSourceID",
+            "SecondaryTradeReportID",
+            "AvgPxIndicator",
+            "TradeLinkID",
+            "OrderInputDevice",
+            "UnderlyingTradingSessionID",
+            "UnderlyingTradingSessionSubID",
+            "TradeLegRefID",
+            "ExchangeRule",
+            "TradeAllocIndicator",
+            "ExpirationCycle",
+            "TrdType",
+            "TrdSubType",
+            "TransferReason",
+            "AsgnReqID",
+            "TotNumAssignmentReports",
+            "AsgnRptID",
+            "ThresholdAmount",
+            "PegMoveType",
+            "PegOffsetType",
+            "PegLimitType",
+            "PegRoundDirection",
+            "PeggedPrice",
+            "PegScope",
+            "DiscretionMoveType",
+            "DiscretionOffsetType",
+            "DiscretionLimitType",
+            "DiscretionRoundDirection",
+            "DiscretionPrice",
+            "DiscretionScope",
+            "TargetStrategy",
+            "TargetStrategyParameters",
+            "ParticipationRate",
+            "TargetStrategyPerformance",
+            "LastLiquidityInd",
+            "PublishTrdIndicator",
+            "ShortSaleReason",
+            "QtyType",
+            "SecondaryTrdType",
+            "TradeReportType",
+            "AllocNoOrdersType",
+            "SharedCommission",
+            "ConfirmReqID",
+            "AvgParPx",
+            "ReportedPx",
+            "NoCapacities",
+            "OrderCapacityQty",
+            "NoEvents",
+            "EventType",
+            "EventDate",
+            "EventPx",
+            "EventText",
+            "PctAtRisk",
+            "NoInstrAttrib",
+            "InstrAttribType",
+            "InstrAttribValue",
+            "DatedDate",
+            "InterestAccrualDate",
+            "CPProgram",
+            "CPRegType",
+            "UnderlyingCPProgram",
+            "UnderlyingCPRegType",
+            "UnderlyingQty",
+            "TrdMatchID",
+            "SecondaryTradeReportRefID",
+            "UnderlyingDirtyPrice",
+            "UnderlyingEndPrice",
+            "UnderlyingStartValue",
+            "UnderlyingCurrentValue",
+            "UnderlyingEndValue",
+            "NoUnderlyingStips",
+            "UnderlyingStipType",
+            "UnderlyingStipValue",
+            "MaturityNetMoney",
+            "MiscFeeBasis",
+            "TotNoAllocs",
+            "LastFragment",
+            "CollReqID",
+            "CollAsgnReason",
+            "CollInquiryQualifier",
+            "NoTrades",
+            "MarginRatio",
+            "MarginExcess",
+            "TotalNetValue",
+            "CashOutstanding",
+            "CollAsgnID",
+            "CollAsgnTransType",
+            "CollRespID",
+            "CollAsgnRespType",
+            "CollAsgnRejectReason",
+            "CollAsgnRefID",
+            "CollRptID",
+            "CollInquiryID",
+            "CollStatus",
+            "TotNumReports",
+            "LastRptRequested",
+            "AgreementDesc",
+            "AgreementID",
+            "AgreementDate",
+            "StartDate",
+            "EndDate",
+            "AgreementCurrency",
+            "DeliveryType",
+            "EndAccruedInterestAmt",
+            "StartCash",
+            "EndCash",
+            "UserRequestID",
+            "UserRequestType",
+            "NewPassword",
+            "UserStatus",
+            "UserStatusText",
+            "StatusValue",
+            "StatusText",
+            "RefCompID",
+            "RefSubID",
+            "NetworkResponseID",
+            "NetworkRequestID",
+            "LastNetworkResponseID",
+            "NetworkRequestType",
+            "NoCompIDs",
+            "NetworkStatusResponseType",
+            "NoCollInquiryQualifier",
+            "TrdRptStatus",
+            "AffirmStatus",
+            "UnderlyingStrikeCurrency",
+            "LegStrikeCurrency",
+            "TimeBracket",
+            "CollAction",
+            "CollInquiryStatus",
+            "CollInquiryResult",
+            "StrikeCurrency",
+            "NoNested3PartyIDs",
+            "Nested3PartyID",
+            "Nested3PartyIDSource",
+            "Nested3PartyRole",
+            "NoNested3PartySubIDs",
+            "Nested3PartySubID",
+            "Nested3PartySubIDType",
+            "LegContractSettlMonth",
+            "LegInterestAccrualDate",
+            "NoStrategyParameters",
+            "StrategyParameterName",
+            "StrategyParameterType",
+            "StrategyParameterValue",
+            "HostCrossID",
+            "SideTimeInForce",
+            "MDReportID",
+            "SecurityReportID",
+            "SecurityStatus",
+            "SettleOnOpenFlag",
+            "StrikeMultiplier",
+            "StrikeValue",
+            "MinPriceIncrement",
+            "PositionLimit",
+            "NTPositionLimit",
+            "UnderlyingAllocationPercent",
+            "UnderlyingCashAmount",
+            "UnderlyingCashType",
+            "UnderlyingSettlementType",
+            "QuantityDate",
+            "ContIntRptID",
+            "LateIndicator",
+            "InputSource",
+            "SecurityUpdateAction",
+            "NoExpiration",
+            "ExpType",
+            "ExpQty",
+            "NoUnderlyingAmounts",
+            "UnderlyingPayAmount",
+            "UnderlyingCollectAmount",
+            "UnderlyingSettlementDate",
+            "UnderlyingSettlementStatus",
+            "SecondaryIndividualAllocID",
+            "LegReportID",
+            "RndPx",
+            "IndividualAllocType",
+            "AllocCustomerCapacity",
+            "TierCode",
+            "",
+            "UnitofMeasure",
+            "TimeUnit",
+            "UnderlyingUnitofMeasure",
+            "LegUnitofMeasure",
+            "UnderlyingTimeUnit",
+            "LegTimeUnit",
+            "AllocMethod",
+            "TradeID",
+            "",
+            "SideTradeReportID",
+            "SideFillStationCd",
+            "SideReasonCd",
+            "SideTrdSubTyp",
+            "SideQty",
+            "",
+            "MessageEventSource",
+            "SideTrdRegTimestamp",
+            "SideTrdRegTimestampType",
+            "SideTrdRegTimestampSrc",
+            "AsOfIndicator",
+            "NoSideTrdRegTS",
+            "LegOptionRatio",
+            "NoInstrumentParties",
+            "InstrumentPartyID",
+            "TradeVolume",
+            "MDBookType",
+            "MDFeedType",
+            "MDPriceLevel",
+            "MDOriginType",
+            "FirstPx",
+            "MDEntrySpotRate",
+            "MDEntryForwardPoints",
+            "ManualOrderIndicator",
+            "CustDirectedOrder",
+            "ReceivedDeptID",
+            "CustOrderHandlingInst",
+            "OrderHandlingInstSource",
+            "DeskType",
+            "DeskTypeSource",
+            "DeskOrderHandlingInst",
+            "ExecAckStatus",
+            "UnderlyingDeliveryAmount",
+            "UnderlyingCapValue",
+            "UnderlyingSettlMethod",
+            "SecondaryTradeID",
+            "FirmTradeID",
+            "SecondaryFirmTradeID",
+            "CollApplType",
+            "UnderlyingAdjustedQuantity",
+            "UnderlyingFXRate",
+            "UnderlyingFXRateCalc",
+            "AllocPositionEffect",
+            "DealingCapacity",
+            "InstrmtAssignmentMethod",
+            "InstrumentPartyIDSource",
+            "InstrumentPartyRole",
+            "NoInstrumentPartySubIDs",
+            "InstrumentPartySubID",
+            "InstrumentPartySubIDType",
+            "PositionCurrency",
+            "CalculatedCcyLastQty",
+            "AggressorIndicator",
+            "NoUndlyInstrumentParties",
+            "UndlyInstrumentPartyID",
+            "UndlyInstrumentPartyIDSource",
+            "UndlyInstrumentPartyRole",
+            "NoUndlyInstrumentPartySubIDs",
+            "UndlyInstrumentPartySubID",
+            "UndlyInstrumentPartySubIDType",
+            "BidSwapPoints",
+            "OfferSwapPoints",
+            "LegBidForwardPoints",
+            "LegOfferForwardPoints",
+            "SwapPoints",
+            "MDQuoteType",
+            "LastSwapPoints",
+            "SideGrossTradeAmt",
+            "LegLastForwardPoints",
+            "LegCalculatedCcyLastQty",
+            "LegGrossTradeAmt",
+            "",
+            "",
+            "",
+            "MaturityTime",
+            "RefOrderID",
+            "RefOrderIDSource",
+            "SecondaryDisplayQty",
+            "DisplayWhen",
+            "DisplayMethod",
+            "DisplayLowQty",
+            "DisplayHighQty",
+            "DisplayMinIncr",
+            "RefreshQty",
+            "MatchIncrement",
+            "MaxPriceLevels",
+            "PreTradeAnonymity",
+            "PriceProtectionScope",
+            "LotType",
+            "PegPriceType",
+            "PeggedRefPrice",
+            "PegSecurityIDSource",
+            "PegSecurityID",
+            "PegSymbol",
+            "PegSecurityDesc",
+            "TriggerType",
+            "TriggerAction",
+            "TriggerPrice",
+            "TriggerSymbol",
+            "TriggerSecurityID",
+            "TriggerSecurityIDSource",
+            "TriggerSecurityDesc",
+            "TriggerPriceType",
+            "TriggerPriceTypeScope",
+            "TriggerPriceDirection",
+            "TriggerNewPrice",
+            "TriggerOrderType",
+            "TriggerNewQty",
+            "TriggerTradingSessionID",
+            "TriggerTradingSessionSubID",
+            "OrderCategory",
+            "NoRootPartyIDs",
+            "RootPartyID",
+            "RootPartyIDSource",
+            "RootPartyRole",
+            "NoRootPartySubIDs",
+            "RootPartySubID",
+            "RootPartySubIDType",
+            "TradeHandlingInstr",
+            "OrigTradeHandlingInstr",
+            "OrigTradeDate",
+            "OrigTradeID",
+            "OrigSecondaryTradeID",
+            "ApplVerID",
+            "CstmApplVerID",
+            "RefApplVerID",
+            "RefCstmApplVerID",
+            "TZTransactTime",
+            "ExDestinationIDSource",
+            "ReportedPxDiff",
+            "RptSys",
+            "AllocClearingFeeIndicator",
+            "DefaultApplVerID",
+            "DisplayQty",
+            "ExchangeSpecialInstructions",
+        }};
+
+        // a bit for each tag number, set for the NumInGroup tags
+        constexpr static const std::array<uint64_t, 18> GROUP_COUNT_BITS = {{
+            0x0000000200000000ULL, 0x1000000000244200ULL, 0x0000000000040100ULL, 0x0000010000800080ULL,
+            0x0000018000001800ULL, 0x4000000000000000ULL, 0x0000101000004005ULL, 0x4000000002000260ULL,
+            0x0000490008400040ULL, 0x0008000010000011ULL, 0x4000080040000000ULL, 0x0012000080000080ULL,
+            0x0001005600002401ULL, 0x0080004140000000ULL, 0x2110050000000002ULL, 0x0500000001200000ULL,
+            0x0000004410000000ULL, 0x0000000110000000ULL,
+        }};
+
+        // the known repeating groups, sorted by NumInGroup tag
+        constexpr static const std::array<group_entry, NUM_GROUPS> GROUPS = {{
+            {33, 58, 0, 3}, // NoLinesOfText
+            {78, 79, 3, 12}, // NoAllocs
+            {124, 32, 15, 6}, // NoExecs
+            {136, 137, 21, 4}, // NoMiscFees
+            {146, 55, 25, 126}, // NoRelatedSym
+            {199, 104, 151, 1}, // NoIOIQualifiers
+            {215, 216, 152, 2}, // NoRoutingIDs
+            {232, 233, 154, 2}, // NoStipulations
+            {267, 269, 156, 1}, // NoMDEntryTypes
+            {268, 269, 157, 44}, // NoMDEntries
+            {295, 299, 201, 115}, // NoQuoteEntries
+            {382, 375, 316, 5}, // NoContraBrokers
+            {384, 372, 321, 2}, // NoMsgTypes
+            {386, 336, 323, 2}, // NoTradingSessions
+            {453, 448, 325, 6}, // NoPartyIDs
+            {454, 455, 331, 2}, // NoSecurityAltID
+            {457, 458, 333, 2}, // NoUnderlyingSecurityAltID
+            {518, 519, 335, 3}, // NoContAmts
+            {534, 41, 338, 3}, // NoAffectedOrders
+            {539, 524, 341, 6}, // NoNestedPartyIDs
+            {552, 54, 347, 71}, // NoSides
+            {555, 600, 418, 60}, // NoLegs
+            {576, 577, 478, 1}, // NoClearingInstructions
+            {580, 75, 479, 2}, // NoDates
+            {604, 605, 481, 2}, // NoLegSecurityAltID
+            {670, 671, 483, 12}, // NoLegAllocs
+            {683, 688, 495, 2}, // NoLegStipulations
+            {702, 703, 497, 11}, // NoPositions
+            {711, 311, 508, 31}, // NoUnderlyings
+            {735, 695, 539, 1}, // NoQuoteQualifiers
+            {753, 707, 540, 2}, // NoPosAmt
+            {756, 757, 542, 6}, // NoNested2PartyIDs
+            {768, 769, 548, 3}, // NoTrdRegTimestamps
+            {781, 782, 551, 6}, // NoSettlPartyIDs
+            {801, 785, 557, 2}, // NoSettlPartySubIDs
+            {802, 523, 559, 2}, // NoPartySubIDs
+            {804, 545, 561, 2}, // NoNestedPartySubIDs
+            {806, 760, 563, 2}, // NoNested2PartySubIDs
+            {816, 817, 565, 1}, // NoAltMDSource
+            {862, 528, 566, 3}, // NoCapacities
+            {864, 865, 569, 4}, // NoEvents
+            {870, 871, 573, 2}, // NoInstrAttrib
+            {887, 888, 575, 2}, // NoUnderlyingStips
+            {897, 571, 577, 2}, // NoTrades
+            {936, 930, 579, 6}, // NoCompIDs
+            {938, 896, 585, 1}, // NoCollInquiryQualifier
+            {948, 949, 586, 6}, // NoNested3PartyIDs
+            {952, 953, 592, 2}, // NoNested3PartySubIDs
+            {957, 958, 594, 3}, // NoStrategyParameters
+            {984, 985, 597, 4}, // NoUnderlyingAmounts
+            {1016, 1012, 601, 3}, // NoSideTrdRegTS
+            {1018, 1019, 604, 6}, // NoInstrumentParties
+            {1052, 1053, 610, 2}, // NoInstrumentPartySubIDs
+            {1058, 1059, 612, 6}, // NoUndlyInstrumentParties
+            {1062, 1063, 618, 2}, // NoUndlyInstrumentPartySubIDs
+            {1116, 1117, 620, 6}, // NoRootPartyIDs
+            {1120, 1121, 626, 2}, // NoRootPartySubIDs
+        }};
+
+        // the member tags of each known repeating group (including those of the groups nested
+        // in it), sorted
+        constexpr static const std::array<uint16_t, NUM_GROUP_MEMBERS> GROUP_MEMBERS = {{
+            58, 354, 355,
+            79, 80, 467, 524, 525, 538, 539, 545, 661, 736, 804, 805,
+            17, 29, 31, 32, 527, 669,
+            137, 138, 139, 891,
+            15, 22, 38, 48, 54, 55, 65, 106, 107, 167, 200, 201, 202, 207, 231, 303,
+            305, 306, 307, 308, 309, 310, 311, 312, 313, 315, 316, 318, 336, 436, 447, 448,
+            452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 523, 524, 525, 537,
+            538, 539, 541, 542, 545, 555, 556, 564, 565, 566, 587, 588, 600, 601, 602, 603,
+            604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 616, 617, 620, 623, 624,
+            625, 637, 654, 670, 671, 672, 673, 674, 675, 683, 685, 687, 688, 689, 690, 711,
+            739, 740, 756, 757, 758, 759, 760, 762, 764, 802, 803, 804, 805, 806, 807, 810,
+            879, 887, 888, 889, 942, 955, 956, 1058, 1059, 1060, 1061, 1062, 1063, 1064,
+            104,
+            216, 217,
+            233, 234,
+            269,
+            15, 18, 22, 37, 48, 55, 58, 59, 83, 110, 126, 269, 270, 271, 272, 273,
+            274, 275, 276, 277, 278, 279, 280, 282, 283, 284, 285, 286, 287, 288, 289, 290,
+            299, 336, 346, 354, 355, 432, 451, 546, 625, 811, 1023, 1070,
+            15, 22, 48, 55, 60, 62, 65, 132, 133, 134, 135, 188, 189, 190, 191, 299,
+            305, 306, 307, 308, 309, 310, 311, 312, 313, 315, 316, 318, 336, 368, 436, 454,
+            455, 456, 457, 458, 459, 462, 463, 524, 525, 538, 539, 542, 545, 555, 556, 564,
+            565, 566, 587, 588, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611,
+            612, 613, 614, 616, 617, 620, 623, 624, 625, 637, 654, 670, 671, 672, 673, 674,
+            675, 683, 685, 687, 688, 689, 690, 711, 739, 740, 756, 757, 758, 759, 760, 764,
+            804, 805, 806, 807, 810, 879, 887, 888, 889, 942, 955, 956, 1058, 1059, 1060, 1061,
+            1062, 1063, 1064,
+            337, 375, 437, 438, 655,
+            372, 385,
+            336, 625,
+            447, 448, 452, 523, 802, 803,
+            455, 456,
+            458, 459,
+            519, 520, 521,
+            41, 535, 536,
+            524, 525, 538, 545, 804, 805,
+            1, 11, 12, 13, 15, 18, 37, 40, 54, 58, 66, 70, 77, 78, 79, 80,
+            118, 119, 120, 136, 137, 138, 139, 198, 232, 233, 234, 336, 354, 355, 376, 377,
+            381, 447, 448, 452, 453, 467, 518, 519, 520, 521, 523, 524, 525, 526, 528, 529,
+            538, 539, 545, 576, 577, 578, 581, 582, 625, 660, 661, 736, 752, 802, 803, 804,
+            805, 821, 891, 1012, 1013, 1014, 1016,
+            524, 525, 538, 539, 545, 556, 564, 565, 566, 587, 588, 600, 601, 602, 603, 604,
+            605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 616, 617, 620, 623, 624, 637,
+            654, 670, 671, 672, 673, 674, 675, 683, 685, 687, 688, 689, 690, 739, 740, 756,
+            757, 758, 759, 760, 764, 804, 805, 806, 807, 942, 955, 956,
+            577,
+            60, 75,
+            605, 606,
+            671, 672, 673, 674, 675, 756, 757, 758, 759, 760, 806, 807,
+            688, 689,
+            524, 525, 538, 539, 545, 703, 704, 705, 706, 804, 805,
+            305, 306, 307, 308, 309, 310, 311, 312, 313, 315, 316, 318, 436, 457, 458, 459,
+            462, 463, 542, 810, 879, 887, 888, 889, 1058, 1059, 1060, 1061, 1062, 1063, 1064,
+            695,
+            707, 708,
+            757, 758, 759, 760, 806, 807,
+            769, 770, 771,
+            782, 783, 784, 785, 786, 801,
+            785, 786,
+            523, 803,
+            545, 805,
+            760, 807,
+            817,
+            528, 529, 863,
+            865, 866, 867, 868,
+            871, 872,
+            888, 889,
+            571, 818,
+            283, 284, 928, 929, 930, 931,
+            896,
+            949, 950, 951, 952, 953, 954,
+            953, 954,
+            958, 959, 960,
+            985, 986, 987, 988,
+            1012, 1013, 1014,
+            1019, 1050, 1051, 1052, 1053, 1054,
+            1053, 1054,
+            1059, 1060, 1061, 1062, 1063, 1064,
+            1063, 1064,
+            1117, 1118, 1119, 1120, 1121, 1122,
+            1121, 1122,
+        }};
+
+        // the seed of the second hash of each bucket of field values
+        constexpr static const std::array<uint16_t, NUM_FIELD_BUCKETS> FIELD_SEEDS = {{
+            1, 0, 3, 1, 2, 3, 1, 2, 1, 2, 6, 1, 1, 2, 2, 1,
+            1, 1, 4, 3, 1, 2, 2, 3, 0, 1, 1, 1, 2, 2, 1, 1,
+            1, 3, 0, 3, 0, 1, 2, 2, 3, 0, 1, 5, 4, 1, 2, 0,
+            1, 1, 1, 1, 3, 1, 1, 0, 5, 2, 4, 2, 3, 0, 1, 0,
+            1, 3, 0, 3, 2, 1, 1, 1, 1, 2, 2, 1, 2, 1, 2, 1,
+            1, 1, 1, 1, 2, 0, 1, 1, 2, 1, 4, 1, 1, 1, 1, 1,
+            1, 6, 1, 1, 1, 1, 5, 1, 4, 1, 0, 4, 1, 1, 2, 3,
+            2, 4, 2, 3, 3, 1, 1, 1, 2, 0, 1, 1, 1, 1, 1, 2,
+            3, 1, 2, 2, 1, 3, 1, 3, 1, 2, 0, 0, 0, 1, 4, 2,
+            1, 1, 1, 3, 1, 5, 1, 3, 2, 0, 0, 1, 3, 1, 1, 1,
+            2, 2, 1, 1, 1, 2, 1, 1, 1, 1, 1, 4, 1, 1, 2, 1,
+            1, 2, 1, 1, 1, 1, 2, 2, 5, 0, 0, 1, 2, 2, 1, 1,
+            7, 0, 4, 1, 1, 1, 6, 1, 3, 1, 1, 0, 1, 1, 0, 1,
+            1, 1, 3, 0, 2, 1, 5, 4, 3, 4, 4, 1, 3, 1, 2, 1,
+            2, 1, 1, 6, 1, 0, 3, 1, 1, 6, 5, 2, 0, 1, 2, 1,
+            1, 2, 0, 1, 1, 1, 1, 0, 3, 0, 2, 2, 2, 1, 1, 1,
+            1, 1, 2, 2, 1, 0, 2, 2, 1, 2, 0, 0, 1, 1, 4, 1,
+            8, 1, 1, 0, 1, 0, 1, 1, 1, 1, 3, 3, 1, 2, 3, 6,
+            1, 2, 0, 0, 1, 1, 2, 1, 1, 0, 3, 0, 1, 5, 4, 1,
+            2, 2, 2, 0, 4, 1, 2, 1, 1, 1, 1, 4, 0, 0, 1, 3,
+            2, 0, 1, 1, 0, 1, 1, 2, 1, 4, 4, 3, 8, 0, 4, 1,
+            2, 0, 3, 1, 2, 6, 1, 1, 1, 2, 2, 1, 10, 1, 3, 1,
+            1, 3, 3, 2, 3, 1, 4, 3, 3, 0, 1, 0, 1, 2, 6, 1,
+            1, 2, 4, 5, 1, 1, 1, 1, 3, 1, 0, 1, 0, 1, 12, 1,
+            2, 1, 3, 1, 5, 4, 2, 10, 1, 7, 2, 1, 3, 1, 1, 2,
+            2, 2, 3, 3, 1, 2, 7, 0, 2, 5, 1, 1, 0, 7, 1, 2,
+            2, 6, 1, 4, 1, 1, 2, 3, 1, 1, 1, 2, 1, 3, 4, 2,
+            1, 1, 8, 1, 2, 1, 4, 1, 2, 2, 1, 0, 0, 2, 2, 3,
+            1, 1, 3, 1, 1, 1, 1, 0, 1, 2, 1, 0, 0, 19, 4, 4,
+            8, 3, 1, 2, 7, 2, 1, 3, 2, 2, 0, 4, 2, 4, 5, 5,
+            2, 0, 2, 1, 0, 5, 7, 1, 4, 4, 3, 0, 1, 0, 1, 1,
+            3, 2, 0, 1, 0, 3, 2, 0, 3, 3, 2, 0, 18, 1, 0, 2,
+        }};
+
+        // the field values, at the slots given by their perfect hash (tag zero when unused)
+        constexpr static const std::array<field_entry, NUM_FIELD_SLOTS> FIELD_VALUES = {{
+            {130, "N", "Not Natural"},
+            {0, {}, {}},
+            {269, "9", "Trading Session VWAP Price"},
+            {35, "H", "Order Status Request"},
+            {0, {}, {}},
+            {139, "7", "Other"},
+            {77, "F", "FIFO"},
+            {156, "M", "Multiply"},
+            {0, {}, {}},
+            {4, "B", "Buy"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {39, "2", "Filled"},
+            {326, "13", "No Market on Close Imbalance"},
+            {167, "TRAN", "Tax Revenue Anticipation Note"},
+            {0, {}, {}},
+            {18, "U", "Customer Display Instruction (Rule 11Ac1-1/4)"},
+            {104, "A", "All or None (AON)"},
+            {0, {}, {}},
+            {300, "6", "Duplicate Quote <S>"},
+            {269, "M", "Prior Settle Price"},
+            {167, "DEFLTED", "Defaulted"},
+            {0, {}, {}},
+            {35, "BP", "Security Definition Update Report"},
+            {266, "Y", "book entries to be aggregated"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "P", "Allocation Instruction Ack"},
+            {0, {}, {}},
+            {219, "2", "5YR"},
+            {97, "N", "Original Transmission"},
+            {277, "b", "Direct Plus"},
+            {103, "3", "Order exceeds limit"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {233, "TRDVAR", "Trade Variance (value in percent maximum over- or under-allocation allowed)"},
+            {221, "SWAP", "SWAP"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {40, "H", "Forex Previously Quoted (No longer used)"},
+            {167, "TBILL", "US Treasury Bill"},
+            {167, "BRIDGE", "Bridge Loan"},
+            {0, {}, {}},
+            {40, "J", "Market If Touched (MIT)"},
+            {0, {}, {}},
+            {139, "10", "Per transaction"},
+            {0, {}, {}},
+            {47, "R", "Transactions for the account of a non-member compting market-maker (was incorrectly identified in the FIX spec as 'Competing dealer trades')"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "PEF", "Private Export Funding *"},
+            {0, {}, {}},
+            {167, "SECLOAN", "Securities Loan"},
+            {281, "6", "Unsupported MDUpdateType"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {326, "8", "Market Imbalance Sell"},
+            {301, "2", "Acknowledge each quote messages"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {54, "D", "Subscribe (e.g. CIV)"},
+            {0, {}, {}},
+            {167, "SPCLA", "Special Assessment"},
+            {35, "BB", "Collateral Inquiry"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {235, "PUT", "Yield to Next Put"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {40, "C", "Forex Market (No longer used)"},
+            {35, "N", "List Status"},
+            {0, {}, {}},
+            {167, "YCD", "Yankee Certificate Of Deposit"},
+            {233, "CUSTOMDATE", "Custom start/end date"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {325, "Y", "Message is being secnt unsolicited"},
+            {269, "K", "Settle High Price"},
+            {0, {}, {}},
+            {54, "B", "'As Defined' (for use with multileg instruments)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {25, "H", "High"},
+            {167, "STRUCT", "Structured Notes"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {13, "4", "Percentage waived - cash discount (for CIV buy orders)"},
+            {277, "G", "Rule 127 Trade (NYSE)"},
+            {277, "p", "Cancel Open"},
+            {323, "2", "Accept security proposal with revisions as indicated in the message"},
+            {35, "BA", "Collateral Report"},
+            {54, "G", "Borrow (FINANCING - identifies direction of collateral)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {297, "9", "Quote Not Found"},
+            {71, "3", "Preliminary (without MiscFees and NetMoney) (Removed/Replaced)"},
+            {277, "A", "Cash (only) Market"},
+            {0, {}, {}},
+            {233, "ISSUER", "Issuer's ticker"},
+            {326, "17", "Ready to trade (start of session)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {197, "0", "FX Netting"},
+            {47, "W", "All other orders as agent for other member"},
+            {22, "I", "ISDA/FpML Product Specification (XML in EncodedSecurityDesc)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "EUCD", "Euro Certificate Of Deposit"},
+            {0, {}, {}},
+            {103, "5", "Unknown order"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "C", "Cash Trade (same day clearing)"},
+            {300, "99", "Other"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "i", "Rotation ETH"},
+            {167, "WAR", "Warrant"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {13, "5", "Percentage waived -= enhanced units (for CIV buy orders)"},
+            {167, "REPO", "Repurchase"},
+            {0, {}, {}},
+            {63, "5", "T+4"},
+            {0, {}, {}},
+            {167, "CL", "Call Loans"},
+            {269, "J", "Empty Book"},
+            {0, {}, {}},
+            {292, "C", "Ex-Rights"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "MPP", "Mortgage Private Placement"},
+            {233, "SMM", "Single Monthly Mortality"},
+            {208, "N", "Details shoult not be communicated"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "L", "Manual/Slow Quote"},
+            {163, "R", "Replace"},
+            {172, "0", "'Versus. Payment': Deliver (if Sell) or Receive (if Buy) vs. (Against) Payment"},
+            {277, "D", "Next Day (only)Market"},
+            {219, "3", "OLD5"},
+            {0, {}, {}},
+            {167, "LOFC", "Letter Of Credit"},
+            {39, "3", "Done for day"},
+            {285, "1", "Error"},
+            {297, "8", "Query"},
+            {104, "R", "Ready to Trade"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {235, "LONGAVGLIFE", "Yield to Longest Average Life"},
+            {0, {}, {}},
+            {277, "T", "Converted Price Indicator"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "WITHDRN", "Withdrawn"},
+            {167, "XLINKD", "Indexed Linked"},
+            {0, {}, {}},
+            {269, "4", "Opening Price"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "NONE", "No Security Type"},
+            {292, "D", "New"},
+            {18, "3", "Go along"},
+            {0, {}, {}},
+            {269, "D", "Composite Underlying Price"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {39, "A", "Pending New"},
+            {0, {}, {}},
+            {235, "CURRENT", "Current Yield"},
+            {0, {}, {}},
+            {326, "10", "Market on Close Imbalance Sell"},
+            {0, {}, {}},
+            {167, "USTB", "US Treasury Bill (Deprecated Value Use TBILL)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {104, "M", "More Behind"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "TPRN", "Principal Strip From A Non-Callable Bond Or Note"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {233, "REDEMPTION", "Type Of Redemption - values are: NonCallable, Prefunded, EscrowedToMaturity, Putable, Convertible"},
+            {0, {}, {}},
+            {167, "RAN", "Revenue Anticipation Note"},
+            {35, "8", "Execution Report"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {87, "5", "rejected by intermediary"},
+            {18, "0", "Stay on offer side"},
+            {0, {}, {}},
+            {277, "Y", "Trades resulting from manual/slow quote"},
+            {277, "AS", "Basket Index"},
+            {0, {}, {}},
+            {277, "AM", "Stopped Out of Sequence"},
+            {167, "OOF", "Options on Futures"},
+            {160, "0", "Default (Replaced)"},
+            {0, {}, {}},
+            {219, "7", "OLD30"},
+            {40, "5", "Market On Close (No longer used)"},
+            {139, "2", "Tax"},
+            {326, "14", "ITS Pre-opening"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {81, "1", "Soft Dollar"},
+            {0, {}, {}},
+            {279, "2", "Delete"},
+            {233, "MATURITY", "Maturity range"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {29, "2", "Cross as agent"},
+            {0, {}, {}},
+            {167, "REPLACD", "Replaced"},
+            {35, "x", "Security List Request"},
+            {0, {}, {}},
+            {35, "BK", "Security List Update Report"},
+            {0, {}, {}},
+            {4, "X", "Cross"},
+            {233, "LOTVAR", "Lot Variance (value in percent maximum over- or under-allocation allowed)"},
+            {276, "P", "News Dissemination"},
+            {35, "3", "Reject"},
+            {18, "a", "Trailing Stop Peg"},
+            {277, "AD", "Straddle ETH"},
+            {0, {}, {}},
+            {163, "N", "New"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {102, "6", "Duplicate ClOrdID (11) received"},
+            {102, "5", "OrigOrdModTime (586) did not match last TransactTime (60) of order"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {54, "3", "Buy minus"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {300, "3", "Quote <S> exceeds limit"},
+            {233, "MININCR", "Minimum increment"},
+            {0, {}, {}},
+            {88, "13", "Warehouse request rejected"},
+            {276, "D", "Consolidated Best"},
+            {0, {}, {}},
+            {5, "N", "New"},
+            {276, "r", "Bid Offer Specialist"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {21, "3", "Manual order, best execution"},
+            {0, {}, {}},
+            {18, "M", "Mid-price peg (midprice of inside quote)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {281, "8", "Unsupported MDEntryType"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "N", "Stopped Stock (guarantee of price but does not execute the order)"},
+            {0, {}, {}},
+            {297, "4", "Canceled All"},
+            {18, "b", "Strict Limit (No price improvement)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {233, "YIELD", "Yield Range"},
+            {27, "L", "Large"},
+            {0, {}, {}},
+            {300, "5", "Unknown Quote <S>"},
+            {233, "PPM", "Pools per Million"},
+            {233, "MINQTY", "Minimum quantity"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {301, "0", "No Acknowledgement (default)"},
+            {35, "2", "Resend Request"},
+            {88, "10", "Unknown or stale ExecID"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "n", "Cancel Last"},
+            {94, "0", "New"},
+            {0, {}, {}},
+            {167, "MATURED", "Matured"},
+            {150, "C", "Expired"},
+            {40, "6", "With Or Without"},
+            {98, "1", "PKCS (Proprietary)"},
+            {326, "3", "Resume"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "y", "Adjusted"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {269, "7", "Trading Session High Price"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {235, "COMPOUND", "Compound Yield"},
+            {0, {}, {}},
+            {233, "CURRENCY", "ISO Currency Code"},
+            {0, {}, {}},
+            {27, "M", "Medium"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {121, "N", "Do Not Execute Forex After Security Trade"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {59, "1", "Good Till Cancel (GTC)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {279, "0", "New"},
+            {209, "3", "Forward and Match"},
+            {0, {}, {}},
+            {35, "AA", "Derivative Security List"},
+            {167, "REV", "Revenue Bonds"},
+            {0, {}, {}},
+            {167, "TBOND", "US Treasury Bond"},
+            {0, {}, {}},
+            {35, "R", "Quote Request"},
+            {277, "h", "Cancel Stopped"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "PZFJ", "Plazos Fijos"},
+            {0, {}, {}},
+            {258, "N", "Not Traded Flat"},
+            {277, "L", "Seller"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "CORP", "Corporate Bond"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {233, "SECTYPE", "Security Type included or excluded"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {18, "X", "Trade Along"},
+            {0, {}, {}},
+            {269, "5", "Closing Price"},
+            {22, "E", "Sicovam"},
+            {277, "I", "Sold Last (late reporting)"},
+            {277, "v", "Auto Execution ETH"},
+            {203, "1", "Uncovered"},
+            {281, "5", "Unsupported MarketDepth"},
+            {63, "9", "T+5"},
+            {18, "J", "Reinstate on Trading Halt (mutually exclusive with K)"},
+            {0, {}, {}},
+            {35, "e", "Security Status Request"},
+            {63, "2", "Next Day (TOM / T+1)"},
+            {39, "8", "Rejected"},
+            {233, "ISSUESIZE", "issue size range"},
+            {276, "V", "Additional Info due to related"},
+            {40, "1", "Market"},
+            {0, {}, {}},
+            {233, "PXSOURCE", "Benchmark price source"},
+            {35, "v", "Security Type Request"},
+            {0, {}, {}},
+            {233, "STRUCT", "Structure"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {18, "A", "No cross (cross is forbidden)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {54, "2", "Sell"},
+            {156, "D", "Divide"},
+            {167, "ABS", "Asset-backed Securities"},
+            {292, "J", "Standard-Integer Stock Split"},
+            {0, {}, {}},
+            {54, "6", "Sell short exempt"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "f", "Fast Market ETH"},
+            {61, "1", "Flash"},
+            {81, "3", "Step-Out"},
+            {300, "8", "Invalid price"},
+            {88, "1", "Incorrect quantity"},
+            {18, "V", "Netting (for Forex)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {323, "1", "Accept security proposal as-is"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "BOX", "Bill Of Exchanges"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {281, "9", "Unsupported TradingSessionID"},
+            {297, "2", "Canceled for Security Type(s)"},
+            {0, {}, {}},
+            {326, "20", "Unknown or Invalid"},
+            {163, "C", "Cancel"},
+            {0, {}, {}},
+            {298, "5", "Cancel quote specified in QuoteID"},
+            {327, "I", "Order Imbalance"},
+            {35, "BI", "Trading Session List Request"},
+            {169, "4", "AccountNet"},
+            {104, "I", "In touch with"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "CMO", "Collateralized Mortgage Obligation"},
+            {98, "4", "PGP / DES (Defunct)"},
+            {0, {}, {}},
+            {216, "3", "Block Firm"},
+            {35, "AG", "Quote Request Reject"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {22, "C", "Dutch"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "R", "Order Influx"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {233, "SUBSLEFT", "Substitutions left (Repo)"},
+            {235, "MATURITY", "Yield to Maturity"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "TAN", "Tax Anticipation Note"},
+            {0, {}, {}},
+            {22, "G", "'Common' (Clearstream and Euroclear)'"},
+            {233, "AUTOREINV", "Auto Reinvestment at or better"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {321, "3", "Request List Securities (can be qualified with Symbol, SecurityType, TradingSessionID, SecurityExchange. If provided then only list Securities for the specific type.)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "AL", "Stopped Sold Last"},
+            {0, {}, {}},
+            {219, "8", "3MOLIBOR"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "u", "Cross Order Cancel Request"},
+            {0, {}, {}},
+            {166, "CED", "CEDEL"},
+            {0, {}, {}},
+            {35, "5", "Logout"},
+            {235, "LASTQUARTER", "Closing Yield Most Recent Quarter"},
+            {277, "e", "Distribution"},
+            {327, "P", "New Pending"},
+            {94, "2", "Admin Reply"},
+            {269, "P", "Early Prices"},
+            {102, "18", "Invalid price increment"},
+            {0, {}, {}},
+            {35, "Q", "Don't Know Trade (DK)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "E", "Locked"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {27, "S", "Small"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "XCN", "Extended Comm Note"},
+            {303, "2", "Automatic"},
+            {18, "Q", "Cancel on system failure (mutually exclusive with H)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {87, "3", "received (received, not yet processed)"},
+            {0, {}, {}},
+            {167, "TBA", "To Be Announced"},
+            {0, {}, {}},
+            {233, "WAM", "Weighted Average Maturity - value in months (exact or range)"},
+            {63, "4", "T+3"},
+            {13, "6", "Points per bond or contract (supply ContractMultiplier (231) in the component block if the object security is denominated in a size other than the industry default - 1000 par for bonds)"},
+            {54, "E", "Redeem (e.g. CIV)"},
+            {0, {}, {}},
+            {235, "CLOSE", "Closing Yield"},
+            {326, "15", "New Price Indication"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {326, "18", "Not available for trading (end of session)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {40, "2", "Limit"},
+            {47, "H", "Short exempt transaction (refer to I type)"},
+            {326, "11", "(not assigned)"},
+            {277, "F", "Intraday Trade Detail"},
+            {0, {}, {}},
+            {277, "x", "Reopen ETH"},
+            {233, "PROD", "Production Year"},
+            {103, "9", "Trade along required"},
+            {0, {}, {}},
+            {35, "AY", "Collateral Assignment"},
+            {47, "A", "Agency single order"},
+            {0, {}, {}},
+            {219, "1", "CURVE"},
+            {0, {}, {}},
+            {292, "P", "Spinoff"},
+            {281, "1", "Duplicate MDReqID"},
+            {150, "4", "Canceled"},
+            {0, {}, {}},
+            {77, "R", "Rolled"},
+            {0, {}, {}},
+            {88, "9", "Calculation difference"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {22, "B", "Wertpapier"},
+            {0, {}, {}},
+            {297, "12", "Locked Market Warning"},
+            {277, "t", "Cancel Only ETH"},
+            {326, "2", "Trading halt"},
+            {0, {}, {}},
+            {71, "1", "Replace"},
+            {35, "Y", "Market Data Request Reject"},
+            {104, "B", "Market On Close (MOC) (held to close)"},
+            {0, {}, {}},
+            {233, "CPR", "Constant Prepayment Rate"},
+            {0, {}, {}},
+            {71, "0", "New"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {269, "E", "Simulated Sell Price"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {150, "B", "Calculated"},
+            {264, "2", "Book Depth (number of levels)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "S", "Quote"},
+            {0, {}, {}},
+            {169, "3", "A Global Custodian (StandInstDBName (70) must be provided)"},
+            {35, "D", "New Order - Single"},
+            {0, {}, {}},
+            {221, "Pfandbriefe", "Pfandbriefe"},
+            {35, "AB", "New Order - Multileg"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {103, "18", "Invalid price increment"},
+            {167, "AMENDED", "Amended &amp; Restated"},
+            {0, {}, {}},
+            {292, "I", "Reverse Stock Split"},
+            {167, "DINP", "Debtor In Possession"},
+            {40, "4", "Stop Limit"},
+            {59, "5", "Good Till Crossing (GTX)"},
+            {0, {}, {}},
+            {22, "1", "CUSIP"},
+            {323, "5", "Reject security proposal"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {235, "MARK", "Mark to Market Yield"},
+            {167, "FAC", "Federal Agency Coupon"},
+            {0, {}, {}},
+            {298, "2", "Cancel for Security Type(s)"},
+            {0, {}, {}},
+            {166, "ISO_Country_Code", "Local Market Settle Location"},
+            {18, "2", "Work"},
+            {277, "X", "Crossed"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "N", "Depth on Bid"},
+            {0, {}, {}},
+            {40, "P", "Pegged"},
+            {0, {}, {}},
+            {88, "3", "Unknown executing broker mnemonic"},
+            {233, "PPT", "Pools per Trade"},
+            {77, "O", "Open"},
+            {292, "U", "CUSIP / Name Change"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {98, "5", "PGP / DES-MD5 (See app note on FIX web site)"},
+            {150, "L", "Triggered or Activated by System"},
+            {276, "k", "Halt ETH"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "SPCLO", "Special Obligation"},
+            {35, "BO", "Contrary Intention Report"},
+            {87, "6", "allocation pending"},
+            {0, {}, {}},
+            {18, "h", "External Routing Not Allowed"},
+            {18, "W", "Peg to VWAP"},
+            {61, "0", "Normal"},
+            {123, "N", "Sequence Reset, Ignore Msg Seq Num (N/A For FIXML - Not Used)"},
+            {0, {}, {}},
+            {47, "N", "Program Order, non-index arb, for other member"},
+            {40, "8", "Limit With Or Without"},
+            {127, "E", "Price Exceeds Limit"},
+            {0, {}, {}},
+            {18, "Y", "Try To Stop"},
+            {0, {}, {}},
+            {233, "MHP", "Percent of Manufactured Housing Prepayment Curve"},
+            {63, "6", "Future"},
+            {166, "PNY", "Physical"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "P", "Imbalance More Buyers (cannot be used in combination with Q)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {166, "FED", "Federal Book Entry"},
+            {71, "6", "Reversal"},
+            {167, "RVLVTRM", "Revolver/Term Loan"},
+            {326, "19", "Not traded on this market"},
+            {0, {}, {}},
+            {40, "7", "Limit Or Better"},
+            {326, "12", "No Market Imbalance"},
+            {277, "AC", "Straddle"},
+            {0, {}, {}},
+            {263, "1", "Snapshot + Updates (Subscribe)"},
+            {0, {}, {}},
+            {35, "AR", "Trade Capture Report Ack"},
+            {297, "3", "Canceled for Underlying"},
+            {276, "d", "Automatic Execution"},
+            {0, {}, {}},
+            {167, "DN", "Deposit Notes"},
+            {35, "F", "Order Cancel Request"},
+            {235, "NEXTREFUND", "Yield to Next Refund (Sinking Fund Bonds)"},
+            {233, "MAT", "Maturity Year And Month"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {47, "Y", "Program Order, non-index arb, for other agency"},
+            {139, "12", "Agent"},
+            {221, "LIBOR", "LIBOR (London Inter-Bank Offer)"},
+            {103, "15", "Unknown account(s)"},
+            {0, {}, {}},
+            {276, "0", "Reserved SAM"},
+            {0, {}, {}},
+            {167, "CB", "Convertible Bond"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "FADN", "Federal Agency Discount Note"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {269, "2", "Trade"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {269, "B", "Trade Volume"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {150, "H", "Trade Cancel"},
+            {221, "SONIA", "SONIA"},
+            {18, "I", "Institutions only"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {286, "1", "Session Open / Close / Settlement entry"},
+            {291, "3", "Restricted"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {39, "9", "Suspended"},
+            {279, "4", "Delete From"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {150, "G", "Trade Correct"},
+            {167, "TCAL", "Principal Strip Of A Callable Bond Or Note"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "AF", "Order Mass Status Request"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {204, "1", "Firm"},
+            {327, "D", "News Dissemination"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {233, "MAXSUBS", "Maximum substitutions (Repo)"},
+            {35, "BH", "Confirmation Request"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {130, "Y", "Natural"},
+            {104, "T", "Through the Day"},
+            {235, "CALL", "Yield to Next Call"},
+            {277, "AB", "Spread ETH"},
+            {167, "CASH", "Cash"},
+            {209, "1", "Match"},
+            {172, "1", "'Free': Deliver (if Sell) or Receive (if Buy) Free"},
+            {0, {}, {}},
+            {35, "BN", "Execution Acknowledgement"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "EUCP", "Euro Commercial Paper"},
+            {0, {}, {}},
+            {22, "L", "Letter of Credit"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {18, "i", "Imbalance Only"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {139, "6", "Levy"},
+            {277, "f", "Bunched Sale"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "UST", "US Treasury Note (Deprecated Value Use TNOTE)"},
+            {150, "8", "Rejected"},
+            {35, "f", "Security Status"},
+            {276, "b", "No Open / No Resume"},
+            {160, "4", "Specific Order for a single account (for CIV)"},
+            {300, "7", "Invalid bid/ask spread"},
+            {300, "1", "Unknown Symbol (security)"},
+            {233, "MPR", "Monthly Prepayment Rate"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "c", "Regular ETH"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {221, "Treasury", "Treasury"},
+            {233, "CPP", "Constant Prepayment Penalty"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "s", "End of Day SAM"},
+            {0, {}, {}},
+            {221, "LIBID", "LIBID"},
+            {35, "w", "Security Types"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {219, "6", "30YR"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "a", "Quote Status Request"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {59, "4", "Fill Or Kill (FOK)"},
+            {0, {}, {}},
+            {292, "V", "Leap Rollover"},
+            {150, "J", "Trade in a Clearing Hold"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {150, "6", "Pending Cancel (e.g. result of Order Cancel Request <F>)"},
+            {21, "2", "Automated execution order, public, Broker intervention OK"},
+            {292, "A", "Ex-Dividend"},
+            {0, {}, {}},
+            {167, "VRDN", "Variable Rate Demand Note"},
+            {0, {}, {}},
+            {274, "0", "Plus Tick"},
+            {269, "G", "Margin Rate"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {221, "OTHER", "OTHER"},
+            {0, {}, {}},
+            {150, "I", "Order Status"},
+            {0, {}, {}},
+            {18, "d", "Peg to Limit Price"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {326, "1", "Opening delay"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {219, "9", "6MOLIBOR"},
+            {0, {}, {}},
+            {40, "M", "Next Fund Valuation Point (Forward pricing; for CIV)"},
+            {88, "12", "Unknown ClOrdID"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {47, "J", "Program Order, index arb, for individual customer"},
+            {276, "p", "Bid Specialist"},
+            {167, "EUSUPRA", "Euro Supranational Coupons *"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {87, "0", "accepted (successfully processed)"},
+            {165, "2", "Institution's Instructions"},
+            {35, "c", "Security Definition Request"},
+            {286, "5", "Theoretical Price value"},
+            {233, "PMAX", "Pools Maximum"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "AO", "Crossed Trade"},
+            {0, {}, {}},
+            {167, "SECPLEDGE", "Securities Pledge"},
+            {276, "G", "Depth"},
+            {276, "I", "Non-Firm"},
+            {0, {}, {}},
+            {281, "C", "Unsupported MDImplicitDelete"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {139, "13", "Transfer Fee"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {87, "2", "account level reject"},
+            {87, "4", "incomplete"},
+            {0, {}, {}},
+            {167, "BA", "Bankers Acceptance"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {233, "HEP", "final CPR of Home Equity Prepayment Curve"},
+            {47, "C", "Program order, non-index arb, for Member firm/org"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {160, "1", "Standing Instructions Provided"},
+            {18, "Z", "Cancel if not best"},
+            {167, "TD", "Time Deposit"},
+            {0, {}, {}},
+            {88, "4", "Commission difference"},
+            {326, "5", "Price indication"},
+            {0, {}, {}},
+            {233, "ABS", "Absolute Prepayment Speed"},
+            {235, "SIMPLE", "Simple Yield"},
+            {0, {}, {}},
+            {277, "K", "Opened (late report of opened trade)"},
+            {167, "COFP", "Certificate Of Participation"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "AR", "Form T"},
+            {102, "0", "Too late to cancel"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {18, "P", "Market peg"},
+            {54, "1", "Buy"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {29, "4", "Principal"},
+            {274, "2", "Minus Tick"},
+            {127, "A", "Unknown Symbol"},
+            {35, "Z", "Quote Cancel"},
+            {235, "VALUE1_32", "Yield Value Of 1/32"},
+            {263, "0", "Snapshot"},
+            {291, "2", "Pending delisting"},
+            {277, "H", "Rule 155 Trade (AMEX)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {4, "T", "Trade"},
+            {0, {}, {}},
+            {167, "MT", "Mandatory Tender"},
+            {139, "4", "Exchange Fees"},
+            {43, "Y", "Possible duplicate"},
+            {265, "0", "Full refresh"},
+            {166, "EUR", "Euro clear"},
+            {0, {}, {}},
+            {281, "0", "Unknown symbol"},
+            {141, "N", "No"},
+            {269, "C", "Open Interest"},
+            {264, "0", "Full Book depth"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {88, "7", "Other (further in Text (58))"},
+            {277, "S", "Bargain Condition (LSE)"},
+            {235, "TENDER", "Yield to Tender Date"},
+            {0, {}, {}},
+            {35, "i", "Mass Quote"},
+            {281, "7", "Unsupported AggregatedBook"},
+            {47, "I", "Individual Investor, single order"},
+            {269, "1", "Offer"},
+            {141, "Y", "Yes, reset sequence numbers"},
+            {35, "AV", "Settlement Instruction Request"},
+            {276, "T", "News Pending"},
+            {0, {}, {}},
+            {276, "C", "Exchange Best"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {235, "WORST", "Yield To Worst"},
+            {285, "0", "Cancellation / Trade Bust"},
+            {0, {}, {}},
+            {59, "7", "At the Close"},
+            {276, "t", "Forbidden SAM"},
+            {18, "k", "Best Execution"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {39, "1", "Partially filled"},
+            {104, "S", "Portfolio Shown"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {139, "14", "Security Lending"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {88, "2", "Incorrect averageg price"},
+            {276, "m", "Due to News Pending"},
+            {139, "11", "Conversion"},
+            {0, {}, {}},
+            {233, "PAYFREQ", "Payment frequency, calendar"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {20, "0", "New"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "0", "Cancel"},
+            {103, "2", "Exchange closed"},
+            {0, {}, {}},
+            {292, "S", "Special Action"},
+            {40, "E", "Previously Indicated"},
+            {201, "0", "Put"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "2", "Restricted"},
+            {172, "3", "Hold In Custody"},
+            {22, "8", "Exchange Symbol"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "n", "Trading Resume"},
+            {35, "A", "Logon"},
+            {35, "AL", "Position Maintenance Request"},
+            {103, "7", "Duplicate of a verbally communicated order"},
+            {300, "4", "Too late to enter"},
+            {197, "1", "FX Swap"},
+            {0, {}, {}},
+            {35, "C", "Email"},
+            {0, {}, {}},
+            {35, "AE", "Trade Capture Report"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {18, "8", "Try to scale"},
+            {277, "AE", "Stopped"},
+            {0, {}, {}},
+            {281, "B", "Unsupported OpenCloseSettleFlag"},
+            {166, "PTC", "Participant Trust Company"},
+            {39, "B", "Calculated"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {25, "L", "Low"},
+            {0, {}, {}},
+            {22, "5", "RIC code"},
+            {0, {}, {}},
+            {18, "4", "Over the day"},
+            {13, "3", "Absolute (total monetary amount)"},
+            {0, {}, {}},
+            {104, "Z", "Pre-open"},
+            {150, "A", "Pending New"},
+            {0, {}, {}},
+            {269, "8", "Trading Session Low Price"},
+            {0, {}, {}},
+            {35, "1", "Test Request"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {150, "E", "Pending Replace (e.g. result of Order Cancel/Replace Request <G>)"},
+            {0, {}, {}},
+            {29, "3", "Cross as principal"},
+            {0, {}, {}},
+            {235, "GROSS", "True Gross Yield"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {233, "SECTOR", "Market Sector"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {160, "2", "Specific Allocation Account Overriding (Replaced)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "F", "Crossed"},
+            {277, "z", "Adjusted ETH"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {258, "Y", "Traded Flat"},
+            {233, "CPY", "Constant Prepayment Yield"},
+            {104, "O", "At the Open"},
+            {277, "d", "Bunched"},
+            {277, "W", "Ex-pit"},
+            {18, "F", "Do not reduce - DNR"},
+            {21, "1", "Automated execution order, private, no Broker intervention"},
+            {47, "T", "Transactions for the account of an unaffiliated member's competing market-maker (was incorrectly identified in the FIX spec as 'Competing dealer trades')"},
+            {0, {}, {}},
+            {88, "5", "Unknown OrderID (37)"},
+            {204, "0", "Customer"},
+            {172, "2", "Tri-Party"},
+            {35, "E", "New Order - List"},
+            {35, "M", "List Status Request"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "AT", "Burst Basket"},
+            {0, {}, {}},
+            {277, "AP", "Fast Market"},
+            {292, "K", "Position Consolidation"},
+            {277, "AG", "Regular ETH"},
+            {104, "Q", "At the Market (previously called Current Quote)"},
+            {167, "MTN", "Medium Term Notes"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "L", "List Execute"},
+            {167, "BN", "Bank Notes"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {298, "4", "Cancel All Quotes"},
+            {167, "TINT", "Interest Strip From Any Bond Or Note"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {127, "F", "Calculation Difference"},
+            {22, "D", "Valoren"},
+            {297, "11", "Pass"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "z", "Derivative Security List Request"},
+            {61, "2", "Background"},
+            {276, "w", "Opening SAM"},
+            {0, {}, {}},
+            {35, "h", "Trading Session Status"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "m", "Sold Last Sale ETH"},
+            {0, {}, {}},
+            {235, "TRUE", "True Yield"},
+            {233, "PIECES", "Number Of Pieces"},
+            {277, "i", "Cancel ETH"},
+            {0, {}, {}},
+            {98, "3", "PKCS / DES (Proprietary)"},
+            {35, "s", "New Order - Cross"},
+            {0, {}, {}},
+            {269, "6", "Settlement Price"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "V", "Final Price of Session"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {150, "3", "Done for day"},
+            {0, {}, {}},
+            {18, "6", "Participate don't initiate"},
+            {0, {}, {}},
+            {233, "SUBSFREQ", "Substitutions frequency (Repo)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "CD", "Certificate Of Deposit"},
+            {279, "1", "Change"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "j", "Cancel Stopped ETH"},
+            {104, "D", "VWAP (Volume Weighted Average Price)"},
+            {0, {}, {}},
+            {18, "C", "Call first"},
+            {0, {}, {}},
+            {22, "4", "ISIN number"},
+            {35, "r", "Order Mass Cancel Report"},
+            {286, "4", "Entry from previous business day"},
+            {233, "PSA", "Percent of BMA Prepayment Curve"},
+            {0, {}, {}},
+            {167, "ONITE", "Overnight"},
+            {47, "U", "Program Order, index arb, for other agency"},
+            {209, "2", "Forward"},
+            {22, "A", "Bloomberg Symbol"},
+            {127, "Z", "Other"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "AH", "Combo"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {40, "A", "On Close (No longer used)"},
+            {18, "g", "External Routing Allowed"},
+            {113, "Y", "Indicates the party receiving message must report trade"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {150, "D", "Restated (Execution Report <8> sent unsolicited by sellside, with ExecRestatementReason <378> set)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {54, "5", "Sell short"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "J", "Next Day Trade (next day clearing)"},
+            {0, {}, {}},
+            {20, "2", "Correct"},
+            {139, "1", "Regulatory (e.g. SEC)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {298, "1", "Cancel for Symbol(s)"},
+            {216, "1", "Target Firm"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {40, "K", "Market With Left Over as Limit (market order with unexecuted quantity becoming limit order at last price)"},
+            {59, "3", "Immediate Or Cancel (IOC)"},
+            {103, "6", "Duplicate Order (e.g. dupe ClOrdID)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {81, "4", "Soft-dollar Step-In"},
+            {35, "AJ", "Quote Response"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {326, "6", "Trading Range Indication"},
+            {0, {}, {}},
+            {139, "3", "Local Commission"},
+            {277, "AK", "Prior Reference Price"},
+            {167, "TECP", "Tax Exempt Commercial Paper"},
+            {18, "T", "Fixed Peg to Local best bid or offer at time of order"},
+            {0, {}, {}},
+            {277, "u", "Late Open ETH"},
+            {54, "8", "Cross (orders where counterparty is an exchange, valid for all messages except IOIs)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "AN", "Offical Closing Price"},
+            {235, "INVERSEFLOATER", "Inverse Floater Bond Yield"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "BE", "User Request"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "B", "News"},
+            {27, "U", "Undisclosed Quantity"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {298, "3", "Cancel for Underlying Symbol"},
+            {277, "q", "Cancel Open ETH"},
+            {71, "2", "Cancel"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {54, "F", "Lend (FINANCING - identifies direction of collateral)"},
+            {274, "1", "Zero-Plus Tick"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {103, "1", "Unknown symbol"},
+            {47, "S", "Specialist trades"},
+            {216, "4", "Block List"},
+            {0, {}, {}},
+            {35, "BM", "Allocation Instruction Alert"},
+            {276, "j", "Halt"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {39, "C", "Expired"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "RVLV", "Revolver Loan"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {233, "INSURED", "Insured (Y/N)"},
+            {0, {}, {}},
+            {40, "3", "Stop / Stop Loss"},
+            {39, "E", "Pending Replace (i.e. result of Order Cancel/Replace Request <G>)"},
+            {276, "Q", "Trading Range"},
+            {326, "4", "No Open / No Resume"},
+            {81, "2", "Step-In"},
+            {0, {}, {}},
+            {40, "L", "Previous Fund Valuation Point (Historic pricing; for CIV)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "J", "Allocation Instruction"},
+            {22, "J", "Option Price Reporting Authority"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {18, "5", "Held"},
+            {167, "EUSOV", "Euro Sovereigns *"},
+            {0, {}, {}},
+            {277, "k", "Out of Sequence ETH"},
+            {40, "Q", "Counter-Order Selection"},
+            {104, "C", "At the close (around/not held to close)"},
+            {0, {}, {}},
+            {233, "PRICE", "Price Range"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "CMBS", "Corp. Mortgage-backed Securities"},
+            {0, {}, {}},
+            {97, "Y", "Possible Resend"},
+            {0, {}, {}},
+            {40, "9", "On Basis"},
+            {233, "BANKQUAL", "Bank qualified (Y/N)"},
+            {292, "M", "Merger Reorganization"},
+            {235, "INFLATION", "Yield with Inflation Assumption"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {281, "A", "Unsupported Scope"},
+            {276, "g", "Inactive ETH"},
+            {0, {}, {}},
+            {292, "O", "Shareholder Meeting"},
+            {35, "AW", "Assignment Report"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "V", "Market Data Request"},
+            {167, "MLEG", "Multileg Instrument"},
+            {0, {}, {}},
+            {104, "P", "Taking a Position"},
+            {0, {}, {}},
+            {35, "BD", "Network Counterparty System Status Response"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "YANK", "Yankee Corporate Bond"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {18, "E", "Do not increase - DNI"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {274, "3", "Zero-Minus Tick"},
+            {326, "16", "Trade Dissemination Time"},
+            {71, "4", "Calculated (includes MiscFees and NetMoney) (Removed/Replaced)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {39, "6", "Pending Cancel (i.e. result of Order Cancel Request <F>)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {88, "11", "Mismatched data"},
+            {0, {}, {}},
+            {269, "H", "Mid Price"},
+            {87, "1", "block level reject"},
+            {0, {}, {}},
+            {63, "3", "T+2"},
+            {47, "K", "Program Order, non-index arb, for individual customer"},
+            {47, "B", "Short exempt transaction (refer to A type)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {269, "N", "Session High Bid"},
+            {219, "5", "OLD10"},
+            {266, "N", "book entries should not be aggregated"},
+            {0, {}, {}},
+            {35, "AT", "Allocation Report Ack (a.k.a. Allocation Claim Ack)"},
+            {0, {}, {}},
+            {233, "PROTECT", "Call protection"},
+            {81, "5", "Soft-dollar Step-Out"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "s", "Cancel Only"},
+            {233, "WHOLE", "Whole Pool (Y/N)"},
+            {326, "21", "Pre-open"},
+            {0, {}, {}},
+            {160, "3", "Specific Allocation Account Standing (Replaced)"},
+            {47, "Z", "Short exempt transaction for non-member competing market-maker (refer to A and R types)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {71, "5", "Calculated without Preliminary (sent unsolicited by broker, includes MiscFees and NetMoney) (Removed/Replaced)"},
+            {18, "B", "OK to cross"},
+            {265, "1", "Incremental refresh"},
+            {233, "PRICEFREQ", "Pricing frequency"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {59, "2", "At the Opening (OPG)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {321, "0", "Request Security identity and specifications"},
+            {276, "K", "Implied Price"},
+            {233, "TEXT", "Freeform Text"},
+            {0, {}, {}},
+            {63, "0", "Regular / FX Spot settlement (T+1 or T+2 depending on currency)"},
+            {0, {}, {}},
+            {167, "MPT", "Miscellaneous Pass-through"},
+            {0, {}, {}},
+            {28, "N", "New"},
+            {63, "1", "Cash (TOD / T+0)"},
+            {0, {}, {}},
+            {114, "Y", "Indicates the broker is responsible for locating the stock"},
+            {0, {}, {}},
+            {276, "u", "Frozen SAM"},
+            {269, "Q", "Auction Clearing Price"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {28, "C", "Cancel"},
+            {0, {}, {}},
+            {35, "AU", "Confirmation Ack (a.k.a. Affirmation)"},
+            {167, "PN", "Promissory Note"},
+            {0, {}, {}},
+            {276, "S", "Due to Related"},
+            {233, "GEOG", "Geographics and % range (ex. 234=CA 0-80 [minimum of 80% California assets])"},
+            {235, "AFTERTAX", "After Tax Yield (Municipals)"},
+            {233, "RESTRICTED", "Restricted (Y/N)"},
+            {0, {}, {}},
+            {102, "1", "Unknown order"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {20, "1", "Cancel"},
+            {35, "AM", "Position Maintenance Report"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {104, "L", "Limit"},
+            {327, "M", "Additional Information"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "AN", "Request For Positions"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "y", "Security List"},
+            {233, "COUPON", "Coupon range"},
+            {0, {}, {}},
+            {40, "B", "Limit On Close (No longer used)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {235, "LASTMONTH", "Closing Yield Most Recent Month"},
+            {47, "P", "Principal"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "o", "Out of Sequence"},
+            {18, "N", "Non-negotiable"},
+            {35, "X", "Market Data - Incremental Refresh"},
+            {326, "23", "Fast Market"},
+            {0, {}, {}},
+            {88, "6", "Unknown ListID (66)"},
+            {54, "C", "'Opposite' (for use with multileg instruments)"},
+            {0, {}, {}},
+            {35, "l", "Bid Response (lowercase L)"},
+            {160, "5", "Request reject"},
+            {167, "TAXA", "Tax Allocation"},
+            {35, "BJ", "Trading Session List"},
+            {103, "13", "Incorrect quantity"},
+            {277, "B", "Average Price Trade"},
+            {167, "BRADY", "Brady Bond"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {98, "0", "None / Other"},
+            {0, {}, {}},
+            {292, "G", "Stock Dividend"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {150, "K", "Trade has been released to Clearing"},
+            {40, "G", "Forex Swap"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "z", "Suspended SAM"},
+            {167, "DUAL", "Dual Currency"},
+            {0, {}, {}},
+            {166, "DTC", "Depository Trust Company"},
+            {127, "C", "Quantity Exceeds Order"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {235, "CHANGE", "Yield Change Since Close"},
+            {0, {}, {}},
+            {103, "11", "Unsupported order characteristic"},
+            {22, "9", "Consolidated Tape Association (CTA) Symbol (SIAC CTS/CQS line format)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {4, "S", "Sell"},
+            {167, "SPCLT", "Special Tax"},
+            {5, "R", "Replace"},
+            {235, "ANNUAL", "Annual Yield"},
+            {35, "W", "Market Data - Snapshot/Full Refresh"},
+            {63, "B", "Broken date - for FX expressing non-standard tenor, SettlDate (64) must be specified"},
+            {167, "CP", "Commercial Paper"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {297, "13", "Cross Market Warning"},
+            {0, {}, {}},
+            {47, "O", "Proprietary transactions for competing market-maker that is affiliated with the clearing member (was incorrectly identified in the FIX spec as 'Competing dealer trades')"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {63, "7", "When And If Issued"},
+            {221, "EUREPO", "EUREPO"},
+            {323, "4", "List of securities returned per request"},
+            {0, {}, {}},
+            {277, "Q", "Imbalance More Sellers (cannot be used in combination with P)"},
+            {0, {}, {}},
+            {279, "3", "Delete Thru"},
+            {0, {}, {}},
+            {276, "q", "Offer Specialist"},
+            {323, "3", "List of security types returned per request"},
+            {0, {}, {}},
+            {277, "R", "Opening Price"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {22, "F", "Belgian"},
+            {0, {}, {}},
+            {276, "U", "Additional Info"},
+            {18, "L", "Last peg (last sale)"},
+            {88, "0", "Unknown account(s)"},
+            {22, "3", "QUIK"},
+            {167, "RETIRED", "Retired"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "PFAND", "Pfandbriefe *"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {103, "12", "Surveillence Option"},
+            {40, "F", "Forex Limit (No longer used)"},
+            {167, "TIPS", "Treasury Inflation Protected Securities"},
+            {103, "8", "Stale order"},
+            {167, "MBS", "Mortgage-backed Securities"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {297, "1", "Cancel for Symbol(s)"},
+            {165, "1", "Broker's Instructions"},
+            {0, {}, {}},
+            {300, "2", "Exchange (Security) closed"},
+            {0, {}, {}},
+            {235, "GOVTEQUIV", "Gvnt Equivalent Yield"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {281, "3", "Insufficient Permissions"},
+            {94, "1", "Reply"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {18, "9", "Stay on bid side"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {81, "6", "Plan Sponsor"},
+            {35, "BF", "User Response"},
+            {0, {}, {}},
+            {167, "FOR", "Foreign Exchange Contract"},
+            {18, "G", "All or none - AON"},
+            {35, "BG", "Collateral Inquiry Ack"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {326, "7", "Market Imbalance Buy"},
+            {0, {}, {}},
+            {281, "2", "Insufficient Bandwidth"},
+            {0, {}, {}},
+            {167, "TERM", "Term Loan"},
+            {0, {}, {}},
+            {47, "X", "Short exempt transaction for member competing market-maker not affiliated with the firm clearing the trade (refer to W and T types)"},
+            {150, "5", "Replaced"},
+            {216, "2", "Target List"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {169, "2", "Thomson ALERT"},
+            {233, "PURPOSE", "Purpose"},
+            {0, {}, {}},
+            {321, "1", "Request Security identity for the specifications provided (name of the security is not supplied)"},
+            {286, "2", "Delivery Settlement entry"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "AA", "Spread"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {18, "H", "Reinstate on System Failue (mutually exclusive with Q)"},
+            {0, {}, {}},
+            {47, "F", "Short exempt transaction (refer to W type)"},
+            {0, {}, {}},
+            {297, "0", "Accepted"},
+            {47, "M", "Program Order, index arb, for other member"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "c", "Acquisition"},
+            {0, {}, {}},
+            {35, "AX", "Collateral Request"},
+            {0, {}, {}},
+            {233, "ISSUE", "Year Or Year/Month of Issue (ex. 234=2002/09)"},
+            {0, {}, {}},
+            {43, "N", "Original transmission"},
+            {263, "2", "Disable previous Snapshot + Update Request (Unsubscribe)"},
+            {35, "AH", "RFQ Request"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {18, "R", "Primary peg (primary market - buy at bid/sell at offer)"},
+            {233, "RATING", "Rating source and range"},
+            {277, "AJ", "Official Closing Price"},
+            {98, "6", "PEM / DES-MD5 (see app note on FIX web site)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "r", "Opened Sale ETH"},
+            {303, "1", "Manual"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "MF", "Mutual Fund"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "a", "Equipment Changeover"},
+            {81, "0", "Regular"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {169, "1", "DTC SID"},
+            {35, "AC", "Multileg Order Cancel/Replace (a.k.a. Multileg Order Modification Request)"},
+            {233, "WALA", "Weighted Average Loan Age - value in months (exact or range)"},
+            {276, "O", "Closing"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {18, "7", "Strict scale"},
+            {0, {}, {}},
+            {54, "7", "Undisclosed (valid for IOI and List Order messages only)"},
+            {87, "7", "reversed"},
+            {292, "H", "Non-Integer Stock Split"},
+            {35, "m", "List Strike Price"},
+            {35, "b", "Mass Quote Acknowledgement"},
+            {18, "D", "Percent of volume (indicates that the sender does not want to be all of the volume on the floor vs. a specific percentage)"},
+            {150, "7", "Stopped"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {22, "6", "ISO Currency Code"},
+            {297, "5", "Rejected"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {123, "Y", "Gap Fill Message, Msg Seq Num Field Valid"},
+            {165, "3", "Investor (e.g. CIV use)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "d", "Security Definition"},
+            {0, {}, {}},
+            {277, "E", "Opening/Reopening Trade Detail"},
+            {276, "e", "Automatic Execution ETH"},
+            {0, {}, {}},
+            {167, "AN", "Other Anticipation Notes (BAN, GAN, etc.)"},
+            {0, {}, {}},
+            {277, "a", "Volume Only"},
+            {22, "H", "Clearing House / Clearing Organization"},
+            {0, {}, {}},
+            {63, "C", "FX Spot Next settlement (Spot+1, aka next day)"},
+            {235, "BOOK", "Book Yield"},
+            {0, {}, {}},
+            {167, "STN", "Short Term Loan Note"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "o", "Registration Instructions"},
+            {0, {}, {}},
+            {139, "9", "Consumption Tax"},
+            {104, "X", "Crossing Opportunity"},
+            {163, "T", "Restate"},
+            {203, "0", "Covered"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "M", "Sold (out of sequence)"},
+            {235, "ATISSUE", "Yield At Issue (Municipals)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "Z", "Trades resulting from intermarket sweep"},
+            {235, "LASTYEAR", "Closing Yield Most Recent Year"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {18, "j", "Single execution requested for block trade"},
+            {121, "Y", "Execute Forex After Security Trade"},
+            {18, "1", "Not held"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {40, "D", "Previously Quoted"},
+            {276, "A", "Open/Active"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {292, "B", "Ex-Distribution"},
+            {167, "SUPRA", "USD Supranational Coupons *"},
+            {167, "IET", "IOETTE Mortgage"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "OOP", "Options on Physical"},
+            {169, "0", "Other"},
+            {0, {}, {}},
+            {18, "S", "Suspend"},
+            {127, "B", "Wrong Side"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "B", "Closed/Inactive"},
+            {0, {}, {}},
+            {235, "SEMIANNUAL", "Semi-annual Yield"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {297, "15", "Canceled Due To Cross Market"},
+            {0, {}, {}},
+            {150, "9", "Suspended"},
+            {18, "O", "Opening peg"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "Y", "Volume Alert"},
+            {27, "0", "1000000000"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {235, "OPENAVG", "Open Average Yield"},
+            {167, "COFO", "Certificate Of Obligation"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "w", "Reopen"},
+            {39, "5", "Replaced (No longer used)"},
+            {167, "FUT", "Future"},
+            {0, {}, {}},
+            {321, "2", "Request List Security Types"},
+            {167, "PS", "Preferred Stock"},
+            {0, {}, {}},
+            {29, "1", "Agent"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "AZ", "Collateral Response"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {139, "8", "Markup"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {292, "E", "Ex-Interest"},
+            {0, {}, {}},
+            {40, "I", "Funari (Limit day order with unexecuted portion handles as Market On Close. E.g. Japan)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "AQ", "Automatic Execution"},
+            {0, {}, {}},
+            {269, "3", "Index Value"},
+            {0, {}, {}},
+            {167, "EUCORP", "Euro Corporate Bond"},
+            {291, "1", "Bankrupt"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {297, "14", "Canceled Due To Lock Market"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "TNOTE", "US Treasury Note"},
+            {35, "AQ", "Trade Capture Report Request Ack"},
+            {0, {}, {}},
+            {292, "L", "Liquidation Reorganization"},
+            {113, "N", "Indicates the party sending message will report trade"},
+            {102, "3", "Order already in Pending Cancel or Pending Replace status"},
+            {208, "Y", "Details should be communicated"},
+            {65, "WI", "'When Issued' for a security to be reissued under an old CUSIP or ISIN"},
+            {35, "AS", "Allocation Report (a.k.a. Allocation Claim)"},
+            {277, "U", "Exchange Last"},
+            {0, {}, {}},
+            {297, "6", "Removed from Market"},
+            {0, {}, {}},
+            {104, "Y", "At the Midpoint"},
+            {276, "x", "Open SAM"},
+            {0, {}, {}},
+            {276, "1", "No Active SAM"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {22, "7", "ISO Country Code"},
+            {269, "0", "Bid"},
+            {0, {}, {}},
+            {167, "SWING", "Swing Line Facility"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {104, "V", "Versus"},
+            {276, "Z", "Order Imbalance"},
+            {0, {}, {}},
+            {292, "R", "Warrant"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "W", "Resume"},
+            {0, {}, {}},
+            {35, "k", "Bid Request"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "GO", "General Obligation Bonds"},
+            {326, "9", "Market on Close Imbalance Buy"},
+            {59, "6", "Good Till Date (GTD)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "t", "Cross Order Cancel/Replace Request (a.k.a. Cross Order Modification Request)"},
+            {25, "M", "Medium"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {323, "6", "Cannot match selection criteria"},
+            {233, "PPC", "Percent of Prospectus Prepayment Curve"},
+            {102, "99", "Other"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "j", "Business Message Reject"},
+            {269, "L", "Settle Low Price"},
+            {0, {}, {}},
+            {150, "F", "Trade (partial fill or fill)"},
+            {0, {}, {}},
+            {167, "MIO", "Mortgage Interest Only"},
+            {327, "E", "Order Influx"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {276, "X", "View of Common"},
+            {0, {}, {}},
+            {65, "CD", "EUCP with lump-sum interest rather than discount price"},
+            {35, "4", "Sequence Reset"},
+            {221, "EONIA", "EONIA"},
+            {0, {}, {}},
+            {114, "N", "Indicates the broker is not required to locate"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {233, "LOOKBACK", "Lookback Days"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {98, "2", "DES (ECB Mode)"},
+            {167, "LQN", "Liquidity Note"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "AF", "Stopped ETH"},
+            {167, "CS", "Common Stock"},
+            {77, "C", "Close"},
+            {167, "OPT", "Option"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {277, "AI", "Combo ETH"},
+            {0, {}, {}},
+            {277, "l", "Cancel Last ETH"},
+            {0, {}, {}},
+            {292, "Q", "Tender Offer"},
+            {0, {}, {}},
+            {167, "CPP", "Corporate Private Placement"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {233, "WAC", "Weighted Average Coupon - value in percent (exact or range) plus 'Gross' or 'Net' of servicing spread (the default) (ex. 234=6.5-Net [minimum of 6.5% net of servicing fee])"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {88, "8", "Incorrect allocated quantity"},
+            {221, "Euribor", "Euribor"},
+            {0, {}, {}},
+            {35, "AO", "Request For Positions Ack"},
+            {300, "9", "Not authorized to quote security"},
+            {0, {}, {}},
+            {219, "4", "10YR"},
+            {35, "AK", "Confirmation"},
+            {276, "y", "Surveillance SAM"},
+            {235, "LASTCLOSE", "Most Recent Closing Yield"},
+            {233, "PPL", "Pools per Lot"},
+            {0, {}, {}},
+            {233, "AMT", "Alternative Minimum Tax (Y/N)"},
+            {35, "q", "Order Mass Cancel Request"},
+            {276, "M", "Depth on Offer"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {39, "7", "Stopped"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {39, "0", "New"},
+            {0, {}, {}},
+            {103, "14", "Incorrect allocated quantity"},
+            {0, {}, {}},
+            {103, "0", "Broker / Exchange option"},
+            {0, {}, {}},
+            {167, "MPO", "Mortgage Principal Only"},
+            {292, "F", "Cash Dividend"},
+            {221, "MuniAAA", "MuniAAA"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {59, "0", "Day (or session)"},
+            {54, "A", "Cross short exempt"},
+            {167, "WLD", "Wildcard Entry (was '?' in 4.4, used on Security Definition Request message)"},
+            {277, "o", "Sold Last Sale"},
+            {35, "6", "Indication of Interest"},
+            {0, {}, {}},
+            {5, "C", "Cancel"},
+            {0, {}, {}},
+            {277, "g", "Split Trade"},
+            {235, "AVGMATURITY", "Yield To Avg Maturity"},
+            {35, "T", "Settlement Instructions"},
+            {20, "3", "Status"},
+            {18, "e", "Work to Target Strategy"},
+            {102, "2", "Broker / Exchange Option"},
+            {233, "WAL", "Weighted Average Life Coupon - value in percent (exact or range)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {292, "T", "Symbol Conversion"},
+            {276, "J", "Outright Price"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {297, "7", "Expired"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {264, "1", "Top of Book"},
+            {103, "99", "Other"},
+            {0, {}, {}},
+            {18, "c", "Ignore Price Validity Checks"},
+            {104, "W", "Indidcation - Working Away"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {235, "PROCEEDS", "Proceeds Yield"},
+            {269, "O", "Session Low Offer"},
+            {35, "g", "Trading Session Status Request"},
+            {235, "SHORTAVGLIFE", "Yield to Shortest Average Life"},
+            {35, "n", "XML message (e.g. non FIX Msg Type)"},
+            {286, "0", "Daily Open / Close / Settlement entry"},
+            {235, "PREVCLOSE", "Previous Close Yield"},
+            {0, {}, {}},
+            {35, "BL", "Adjusted Position Report"},
+            {13, "1", "Per Unit (implying shares, par, currency, etc.)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {139, "5", "Stamp"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {233, "BGNCON", "Bargain conditions (see StipulationValue (234) for values)"},
+            {39, "4", "Canceled"},
+            {167, "FORWARD", "Forward"},
+            {0, {}, {}},
+            {276, "H", "Fast Trading"},
+            {301, "1", "Acknowledge only negative or erroneous quotes"},
+            {0, {}, {}},
+            {47, "D", "Program order, index arb, for Member firm/org"},
+            {0, {}, {}},
+            {35, "9", "Order Cancel Reject"},
+            {39, "D", "Accepted for Bidding"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "7", "Advertisement"},
+            {326, "22", "Opening Rotation"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {150, "0", "New"},
+            {54, "4", "Sell plus"},
+            {35, "G", "Order Cancel/Replace Request (a.k.a. Order Modification Request)"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {47, "L", "Short exempt transaction for member competing market-maker affliated with the firm clearing the trade (refer to P and O types)"},
+            {0, {}, {}},
+            {35, "AD", "Trade Capture Report Request"},
+            {233, "MINDNOM", "Minimum denomination"},
+            {0, {}, {}},
+            {47, "E", "Short Exempt Transaction for Principal (was incorrectly identified in the FIX spec as 'Registered Equity Market Maker trades')"},
+            {35, "BC", "Network Counterparty System Status Request"},
+            {269, "F", "Simulated Buy Price"},
+            {0, {}, {}},
+            {276, "v", "PreOpening SAM"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {22, "2", "SEDOL"},
+            {0, {}, {}},
+            {127, "D", "No Matching Order"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {103, "4", "Too late to enter"},
+            {0, {}, {}},
+            {22, "K", "ISDA/FpML Product URL (URL in SecurityID)"},
+            {0, {}, {}},
+            {327, "X", "Equipment Changeover"},
+            {35, "AI", "Quote Status Report"},
+            {0, {}, {}},
+            {235, "TAXEQUIV", "Tax Equivalent Yield"},
+            {63, "8", "Sellers Option"},
+            {201, "1", "Call"},
+            {18, "f", "Intermarket Sweep"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {297, "10", "Pending"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {269, "A", "Imbalance"},
+            {54, "9", "Cross short"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {103, "10", "Invalid Investor ID"},
+            {13, "2", "Percent"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {102, "4", "Unable to process Order Mass Cancel Request"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {18, "K", "Cancel on Trading Halt (mutually exclusive with J)"},
+            {0, {}, {}},
+            {281, "4", "Unsupported SubscriptionRequestType"},
+            {35, "K", "List Cancel Request"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {281, "D", "Insufficient credit"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "AP", "Position Report"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {233, "HAIRCUT", "Valuation Discount"},
+            {325, "N", "Message is being sent as a result of a prior request"},
+            {0, {}, {}},
+            {292, "N", "Rights Offering"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {286, "3", "Expected entry"},
+            {0, {}, {}},
+            {233, "LOT", "Explicit lot identifier"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {167, "BUYSELL", "Buy Sellback"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {0, {}, {}},
+            {28, "R", "Replace"},
+            {276, "h", "Rotation"},
+            {0, {}, {}},
+            {0, {}, {}},
+            {35, "0", "Heartbeat"},
+            {35, "p", "Registration Instructions Response"},
+            {221, "FutureSWAP", "FutureSWAP"},
+            {0, {}, {}},
+            {276, "l", "Due to News Dissemination"},
+        }};
+
+        // hash of a tag number and field value (32 bit FNV-1a, with a final mix)
+        constexpr static uint32_t hash(const uint32_t seed, const size_t tag, const std::string_view value)
+        {
+            uint32_t h = (2166136261u ^ seed);
+            h = (h ^ static_cast<uint32_t>(tag & 0xFF)) * 16777619u;
+            h = (h ^ static_cast<uint32_t>((tag >> 8) & 0xFF)) * 16777619u;
+
+            for (const char c : value)
+                h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+
+            h ^= (h >> 15);
+            h *= 0x2C1B3C6Du;
+            h ^= (h >> 12);
+            h *= 0x297A2D39u;
+            h ^= (h >> 15);
+            return h;
+        }
+
+        // returns the known repeating group counted by a NumInGroup tag (nullptr if not known)
+        constexpr static const group_entry *find_group(const size_t count_tag)
+        {
+            size_t low = 0;
+            size_t high = NUM_GROUPS;
+
+            while (low < high)
             {
-                ss << R"RAW_DELIM(
-{
-"fix_version": "FIX.5.0",
-"tags": {
-"1": "Account",
-"2": "AdvId",
-"3": "AdvRefID",
-"4": "AdvSide",
-"5": "AdvTransType",
-"6": "AvgPx",
-"7": "BeginSeqNo",
-"8": "BeginString",
-"9": "BodyLength",
-"10": "CheckSum",
-"11": "ClOrdID",
-"12": "Commission",
-"13": "CommType",
-"14": "CumQty",
-"15": "Currency",
-"16": "EndSeqNo",
-"17": "ExecID",
-"18": "ExecInst",
-"19": "ExecRefID",
-"20": "ExecTransType",
-"21": "HandlInst",
-"22": "SecurityIDSource",
-"23": "IOIID",
-"24": "IOIOthSvc (no longer used)",
-"25": "IOIQltyInd",
-"26": "IOIRefID",
-"27": "IOIQty",
-"28": "IOITransType",
-"29": "LastCapacity",
-"30": "LastMkt",
-"31": "LastPx",
-"32": "LastQty",
-"33": "NoLinesOfText",
-"34": "MsgSeqNum",
-"35": "MsgType",
-"36": "NewSeqNo",
-"37": "OrderID",
-"38": "OrderQty",
-"39": "OrdStatus",
-"40": "OrdType",
-"41": "OrigClOrdID",
-"42": "OrigTime",
-"43": "PossDupFlag",
-"44": "Price",
-"45": "RefSeqNum",
-"46": "RelatdSym (no longer used)",
-"47": "Rule80A(No Longer Used)",
-"48": "SecurityID",
-"49": "SenderCompID",
-"50": "SenderSubID",
-"51": "SendingDate (no longer used)",
-"52": "SendingTime",
-"53": "Quantity",
-"54": "Side",
-"55": "Symbol",
-"56": "TargetCompID",
-"57": "TargetSubID",
-"58": "Text",
-"59": "TimeInForce",
-"60": "TransactTime",
-"61": "Urgency",
-"62": "ValidUntilTime",
-"63": "SettlType",
-"64": "SettlDate",
-"65": "SymbolSfx",
-"66": "ListID",
-"67": "ListSeqNo",
-"68": "TotNoOrders",
-"69": "ListExecInst",
-"70": "AllocID",
-"71": "AllocTransType",
-"72": "RefAllocID",
-"73": "NoOrders",
-"74": "AvgPxPrecision",
-"75": "TradeDate",
-"76": "ExecBroker",
-"77": "PositionEffect",
-"78": "NoAllocs",
-"79": "AllocAccount",
-"80": "AllocQty",
-"81": "ProcessCode",
-"82": "NoRpts",
-"83": "RptSeq",
-"84": "CxlQty",
-"85": "NoDlvyInst",
-"86": "DlvyInst",
-"87": "AllocStatus",
-"88": "AllocRejCode",
-"89": "Signature",
-"90": "SecureDataLen",
-"91": "SecureData",
-"92": "BrokerOfCredit",
-"93": "SignatureLength",
-"94": "EmailType",
-"95": "RawDataLength",
-"96": "RawData",
-"97": "PossResend",
-"98": "EncryptMethod",
-"99": "StopPx",
-"100": "ExDestination",
-"102": "CxlRejReason",
-"103": "OrdRejReason",
-"104": "IOIQualifier",
-"105": "WaveNo",
-"106": "Issuer",
-"107": "SecurityDesc",
-"108": "HeartBtInt",
-"109": "ClientID",
-"110": "MinQty",
-"111": "MaxFloor",
-"112": "TestReqID",
-"113": "ReportToExch",
-"114": "LocateReqd",
-"115": "OnBehalfOfCompID",
-"116": "OnBehalfOfSubID",
-"117": "QuoteID",
-"118": "NetMoney",
-"119": "SettlCurrAmt",
-"120": "SettlCurrency",
-"121": "ForexReq",
-"122": "OrigSendingTime",
-"123": "GapFillFlag",
-"124": "NoExecs",
-"125": "CxlType",
-"126": "ExpireTime",
-"127": "DKReason",
-"128": "DeliverToCompID",
-"129": "DeliverToSubID",
-"130": "IOINaturalFlag",
-"131": "QuoteReqID",
-"132": "BidPx",
-"133": "OfferPx",
-"134": "BidSize",
-"135": "OfferSize",
-"136": "NoMiscFees",
-"137": "MiscFeeAmt",
-"138": "MiscFeeCurr",
-"139": "MiscFeeType",
-"140": "PrevClosePx",
-"141": "ResetSeqNumFlag",
-"142": "SenderLocationID",
-"143": "TargetLocationID",
-"144": "OnBehalfOfLocationID",
-"145": "DeliverToLocationID",
-"146": "NoRelatedSym",
-"147": "Subject",
-"148": "Headline",
-"149": "URLLink",
-"150": "ExecType",
-"151": "LeavesQty",
-"152": "CashOrderQty",
-"153": "AllocAvgPx",
-"154": "AllocNetMoney",
-"155": "SettlCurrFxRate",
-"156": "SettlCurrFxRateCalc",
-"157": "NumDaysInterest",
-"158": "AccruedInterestRate",
-"159": "AccruedInterestAmt",
-"160": "SettlInstMode",
-"161": "AllocText",
-"162": "SettlInstID",
-"163": "SettlInstTransType",
-"164": "EmailThreadID",
-"165": "SettlInstSource",
-"166": "SettlLocation",
-"167": "SecurityType",
-"168": "EffectiveTime",
-"169": "StandInstDbType",
-"170": "StandInstDbName",
-"171": "StandInstDbID",
-"172": "SettlDeliveryType",
-"173": "SettlDepositoryCode",
-"174": "SettlBrkrCode",
-"175": "SettlInstCode",
-"176": "SecuritySettlAgentName",
-"177": "SecuritySettlAgentCode",
-"178": "SecuritySettlAgentAcctNum",
-"179": "SecuritySettlAgentAcctName",
-"180": "SecuritySettlAgentContactName",
-"181": "SecuritySettlAgentContactPhone",
-"182": "CashSettlAgentName",
-"183": "CashSettlAgentCode",
-"184": "CashSettlAgentAcctNum",
-"185": "CashSettlAgentAcctName",
-"186": "CashSettlAgentContactName",
-"187": "CashSettlAgentContactPhone",
-"188": "BidSpotRate",
-"189": "BidForwardPoints",
-"190": "OfferSpotRate",
-"191": "OfferForwardPoints",
-"192": "OrderQty2",
-"193": "SettlDate2",
-"194": "LastSpotRate",
-"195": "LastForwardPoints",
-"196": "AllocLinkID",
-"197": "AllocLinkType",
-"198": "SecondaryOrderID",
-"199": "NoIOIQualifiers",
-"200": "MaturityMonthYear",
-"201": "PutOrCall",
-"202": "StrikePrice",
-"203": "CoveredOrUncovered",
-"204": "CustomerOrFirm",
-"205": "MaturityDay",
-"206": "OptAttribute",
-"207": "SecurityExchange",
-"208": "NotifyBrokerOfCredit",
-"209": "AllocHandlInst",
-"210": "MaxShow",
-"211": "PegOffsetValue",
-"212": "XmlDataLen",
-"213": "XmlData",
-"214": "SettlInstRefID",
-"215": "NoRoutingIDs",
-"216": "RoutingType",
-"217": "RoutingID",
-"218": "Spread",
-"219": "Benchmark",
-"220": "BenchmarkCurveCurrency",
-"221": "BenchmarkCurveName",
-"222": "BenchmarkCurvePoint",
-"223": "CouponRate",
-"224": "CouponPaymentDate",
-"225": "IssueDate",
-"226": "RepurchaseTerm",
-"227": "RepurchaseRate",
-"228": "Factor",
-"229": "TradeOriginationDate",
-"230": "ExDate",
-"231": "ContractMultiplier",
-"232": "NoStipulations",
-"233": "StipulationType",
-"234": "StipulationValue",
-"235": "YieldType",
-"236": "Yield",
-"237": "TotalTakedown",
-"238": "Concession",
-"239": "RepoCollateralSecurityType",
-"240": "RedemptionDate",
-"241": "UnderlyingCouponPaymentDate",
-"242": "UnderlyingIssueDate",
-"243": "UnderlyingRepoCollateralSecurityType",
-"244": "UnderlyingRepurchaseTerm",
-"245": "UnderlyingRepurchaseRate",
-"246": "UnderlyingFactor",
-"247": "UnderlyingRedemptionDate",
-"248": "LegCouponPaymentDate",
-"249": "LegIssueDate",
-"250": "LegRepoCollateralSecurityType",
-"251": "LegRepurchaseTerm",
-"252": "LegRepurchaseRate",
-"253": "LegFactor",
-"254": "LegRedemptionDate",
-"255": "CreditRating",
-"256": "UnderlyingCreditRating",
-"257": "LegCreditRating",
-"258": "TradedFlatSwitch",
-"259": "BasisFeatureDate",
-"260": "BasisFeaturePrice",
-"261": "Reserved/Allocated to the Fixed Income proposal",
-"262": "MDReqID",
-"263": "SubscriptionRequestType",
-"264": "MarketDepth",
-"265": "MDUpdateType",
-"266": "AggregatedBook",
-"267": "NoMDEntryTypes",
-"268": "NoMDEntries",
-"269": "MDEntryType",
-"270": "MDEntryPx",
-"271": "MDEntrySize",
-"272": "MDEntryDate",
-"273": "MDEntryTime",
-"274": "TickDirection",
-"275": "MDMkt",
-"276": "QuoteCondition",
-"277": "TradeCondition",
-"278": "MDEntryID",
-"279": "MDUpdateAction",
-"280": "MDEntryRefID",
-"281": "MDReqRejReason",
-"282": "MDEntryOriginator",
-"283": "LocationID",
-"284": "DeskID",
-"285": "DeleteReason",
-"286": "OpenCloseSettlFlag",
-"287": "SellerDays",
-"288": "MDEntryBuyer",
-"289": "MDEntrySeller",
-"290": "MDEntryPositionNo",
-"291": "FinancialStatus",
-"292": "CorporateAction",
-"293": "DefBidSize",
-"294": "DefOfferSize",
-"295": "NoQuoteEntries",
-"296": "NoQuoteSets",
-"297": "QuoteStatus",
-"298": "QuoteCancelType",
-"299": "QuoteEntryID",
-"300": "QuoteRejectReason",
-"301": "QuoteResponseLevel",
-"302": "QuoteSetID",
-"303": "QuoteRequestType",
-"304": "TotNoQuoteEntries",
-"305": "UnderlyingSecurityIDSource",
-"306": "UnderlyingIssuer",
-"307": "UnderlyingSecurityDesc",
-"308": "UnderlyingSecurityExchange",
-"309": "UnderlyingSecurityID",
-"310": "UnderlyingSecurityType",
-"311": "UnderlyingSymbol",
-"312": "UnderlyingSymbolSfx",
-"313": "UnderlyingMaturityMonthYear",
-"314": "UnderlyingMaturityDay",
-"315": "UnderlyingPutOrCall",
-"316": "UnderlyingStrikePrice",
-"317": "UnderlyingOptAttribute",
-"318": "UnderlyingCurrency",
-"319": "RatioQty",
-"320": "SecurityReqID",
-"321": "SecurityRequestType",
-"322": "SecurityResponseID",
-"323": "SecurityResponseType",
-"324": "SecurityStatusReqID",
-"325": "UnsolicitedIndicator",
-"326": "SecurityTradingStatus",
-"327": "HaltReason",
-"328": "InViewOfCommon",
-"329": "DueToRelated",
-"330": "BuyVolume",
-"331": "SellVolume",
-"332": "HighPx",
-"333": "LowPx",
-"334": "Adjustment",
-"335": "TradSesReqID",
-"336": "TradingSessionID",
-"337": "ContraTrader",
-"338": "TradSesMethod",
-"339": "TradSesMode",
-"340": "TradSesStatus",
-"341": "TradSesStartTime",
-"342": "TradSesOpenTime",
-"343": "TradSesPreCloseTime",
-"344": "TradSesCloseTime",
-"345": "TradSesEndTime",
-"346": "NumberOfOrders",
-"347": "MessageEncoding",
-"348": "EncodedIssuerLen",
-"349": "EncodedIssuer",
-"350": "EncodedSecurityDescLen",
-"351": "EncodedSecurityDesc",
-"352": "EncodedListExecInstLen",
-"353": "EncodedListExecInst",
-"354": "EncodedTextLen",
-"355": "EncodedText",
-"356": "EncodedSubjectLen",
-"357": "EncodedSubject",
-"358": "EncodedHeadlineLen",
-"359": "EncodedHeadline",
-"360": "EncodedAllocTextLen",
-"361": "EncodedAllocText",
-"362": "EncodedUnderlyingIssuerLen",
-"363": "EncodedUnderlyingIssuer",
-"364": "EncodedUnderlyingSecurityDescLen",
-"365": "EncodedUnderlyingSecurityDesc",
-"366": "AllocPrice",
-"367": "QuoteSetValidUntilTime",
-"368": "QuoteEntryRejectReason",
-"369": "LastMsgSeqNumProcessed",
-"370": "OnBehalfOfSendingTime",
-"371": "RefTagID",
-"372": "RefMsgType",
-"373": "SessionRejectReason",
-"374": "BidRequestTransType",
-"375": "ContraBroker",
-"376": "ComplianceID",
-"377": "SolicitedFlag",
-"378": "ExecRestatementReason",
-"379": "BusinessRejectRefID",
-"380": "BusinessRejectReason",
-"381": "GrossTradeAmt",
-"382": "NoContraBrokers",
-"383": "MaxMessageSize",
-"384": "NoMsgTypes",
-"385": "MsgDirection",
-"386": "NoTradingSessions",
-"387": "TotalVolumeTraded",
-"388": "DiscretionInst",
-"389": "DiscretionOffsetValue",
-"390": "BidID",
-"391": "ClientBidID",
-"392": "ListName",
-"393": "TotNoRelatedSym",
-"394": "BidType",
-"395": "NumTickets",
-"396": "SideValue1",
-"397": "SideValue2",
-"398": "NoBidDescriptors",
-"399": "BidDescriptorType",
-"400": "BidDescriptor",
-"401": "SideValueInd",
-"402": "LiquidityPctLow",
-"403": "LiquidityPctHigh",
-"404": "LiquidityValue",
-"405": "EFPTrackingError",
-"406": "FairValue",
-"407": "OutsideIndexPct",
-"408": "ValueOfFutures",
-"409": "LiquidityIndType",
-"410": "WtAverageLiquidity",
-"411": "ExchangeForPhysical",
-"412": "OutMainCntryUIndex",
-"413": "CrossPercent",
-"414": "ProgRptReqs",
-"415": "ProgPeriodInterval",
-"416": "IncTaxInd",
-"417": "NumBidders",
-"418": "BidTradeType",
-"419": "BasisPxType",
-"420": "NoBidComponents",
-"421": "Country",
-"422": "TotNoStrikes",
-"423": "PriceType",
-"424": "DayOrderQty",
-"425": "DayCumQty",
-"426": "DayAvgPx",
-"427": "GTBookingInst",
-"428": "NoStrikes",
-"429": "ListStatusType",
-"430": "NetGrossInd",
-"431": "ListOrderStatus",
-"432": "ExpireDate",
-"433": "ListExecInstType",
-"434": "CxlRejResponseTo",
-"435": "UnderlyingCouponRate",
-"436": "UnderlyingContractMultiplier",
-"437": "ContraTradeQty",
-"438": "ContraTradeTime",
-"439": "ClearingFirm",
-"440": "ClearingAccount",
-"441": "LiquidityNumSecurities",
-"442": "MultiLegReportingType",
-"443": "StrikeTime",
-"444": "ListStatusText",
-"445": "EncodedListStatusTextLen",
-"446": "EncodedListStatusText",
-"447": "PartyIDSource",
-"448": "PartyID",
-"449": "TotalVolumeTradedDate",
-"450": "TotalVolumeTraded Time",
-"451": "NetChgPrevDay",
-"452": "PartyRole",
-"453": "NoPartyIDs",
-"454": "NoSecurityAltID",
-"455": "SecurityAltID",
-"456": "SecurityAltIDSource",
-"457": "NoUnderlyingSecurityAltID",
-"458": "UnderlyingSecurityAltID",
-"459": "UnderlyingSecurityAltIDSource",
-"460": "Product",
-"461": "CFICode",
-"462": "UnderlyingProduct",
-"463": "UnderlyingCFICode",
-"464": "TestMessageIndicator",
-"465": "QuantityType",
-"466": "BookingRefID",
-"467": "IndividualAllocID",
-"468": "RoundingDirection",
-"469": "RoundingModulus",
-"470": "CountryOfIssue",
-"471": "StateOrProvinceOfIssue",
-"472": "LocaleOfIssue",
-"473": "NoRegistDtls",
-"474": "MailingDtls",
-"475": "InvestorCountryOfResidence",
-"476": "PaymentRef",
-"477": "DistribPaymentMethod",
-"478": "CashDistribCurr",
-"479": "CommCurrency",
-"480": "CancellationRights",
-"481": "MoneyLaunderingStatus",
-"482": "MailingInst",
-"483": "TransBkdTime",
-"484": "ExecPriceType",
-"485": "ExecPriceAdjustment",
-"486": "DateOfBirth",
-"487": "TradeReportTransType",
-"488": "CardHolderName",
-"489": "CardNumber",
-"490": "CardExpDate",
-"491": "CardIssNum",
-"492": "PaymentMethod",
-"493": "RegistAcctType",
-"494": "Designation",
-"495": "TaxAdvantageType",
-"496": "RegistRejReasonText",
-"497": "FundRenewWaiv",
-                )RAW_DELIM";
-                ss << R"RAW_DELIM(
-"498": "CashDistribAgentName",
-"499": "CashDistribAgentCode",
-"500": "CashDistribAgentAcctNumber",
-"501": "CashDistribPayRef",
-"502": "CashDistribAgentAcctName",
-"503": "CardStartDate",
-"504": "PaymentDate",
-"505": "PaymentRemitterID",
-"506": "RegistStatus",
-"507": "RegistRejReasonCode",
-"508": "RegistRefID",
-"509": "RegistDtls",
-"510": "NoDistribInsts",
-"511": "RegistEmail",
-"512": "DistribPercentage",
-"513": "RegistID",
-"514": "RegistTransType",
-"515": "ExecValuationPoint",
-"516": "OrderPercent",
-"517": "OwnershipType",
-"518": "NoContAmts",
-"519": "ContAmtType",
-"520": "ContAmtValue",
-"521": "ContAmtCurr",
-"522": "OwnerType",
-"523": "PartySubID",
-"524": "NestedPartyID",
-"525": "NestedPartyIDSource",
-"526": "SecondaryClOrdID",
-"527": "SecondaryExecID",
-"528": "OrderCapacity",
-"529": "OrderRestrictions",
-"530": "MassCancelRequestType",
-"531": "MassCancelResponse",
-"532": "MassCancelRejectReason",
-"533": "TotalAffectedOrders",
-"534": "NoAffectedOrders",
-"535": "AffectedOrderID",
-"536": "AffectedSecondaryOrderID",
-"537": "QuoteType",
-"538": "NestedPartyRole",
-"539": "NoNestedPartyIDs",
-"540": "TotalAccruedInterestAmt",
-"541": "MaturityDate",
-"542": "UnderlyingMaturityDate",
-"543": "InstrRegistry",
-"544": "CashMargin",
-"545": "NestedPartySubID",
-"546": "Scope",
-"547": "MDImplicitDelete",
-"548": "CrossID",
-"549": "CrossType",
-"550": "CrossPrioritization",
-"551": "OrigCrossID",
-"552": "NoSides",
-"553": "Username",
-"554": "Password",
-"555": "NoLegs",
-"556": "LegCurrency",
-"557": "TotNoSecurityTypes",
-"558": "NoSecurityTypes",
-"559": "SecurityListRequestType",
-"560": "SecurityRequestResult",
-"561": "RoundLot",
-"562": "MinTradeVol",
-"563": "MultiLegRptTypeReq",
-"564": "LegPositionEffect",
-"565": "LegCoveredOrUncovered",
-"566": "LegPrice",
-"567": "TradSesStatusRejReason",
-"568": "TradeRequestID",
-"569": "TradeRequestType",
-"570": "PreviouslyReported",
-"571": "TradeReportID",
-"572": "TradeReportRefID",
-"573": "MatchStatus",
-"574": "MatchType",
-"575": "OddLot",
-"576": "NoClearingInstructions",
-"577": "ClearingInstruction",
-"578": "TradeInputSource",
-"579": "TradeInputDevice",
-"580": "NoDates",
-"581": "AccountType",
-"582": "CustOrderCapacity",
-"583": "ClOrdLinkID",
-"584": "MassStatusReqID",
-"585": "MassStatusReqType",
-"586": "OrigOrdModTime",
-"587": "LegSettlType",
-"588": "LegSettlDate",
-"589": "DayBookingInst",
-"590": "BookingUnit",
-"591": "PreallocMethod",
-"592": "UnderlyingCountryOfIssue",
-"593": "UnderlyingStateOrProvinceOfIssue",
-"594": "UnderlyingLocaleOfIssue",
-"595": "UnderlyingInstrRegistry",
-"596": "LegCountryOfIssue",
-"597": "LegStateOrProvinceOfIssue",
-"598": "LegLocaleOfIssue",
-"599": "LegInstrRegistry",
-"600": "LegSymbol",
-"601": "LegSymbolSfx",
-"602": "LegSecurityID",
-"603": "LegSecurityIDSource",
-"604": "NoLegSecurityAltID",
-"605": "LegSecurityAltID",
-"606": "LegSecurityAltIDSource",
-"607": "LegProduct",
-"608": "LegCFICode",
-"609": "LegSecurityType",
-"610": "LegMaturityMonthYear",
-"611": "LegMaturityDate",
-"612": "LegStrikePrice",
-"613": "LegOptAttribute",
-"614": "LegContractMultiplier",
-"615": "LegCouponRate",
-"616": "LegSecurityExchange",
-"617": "LegIssuer",
-"618": "EncodedLegIssuerLen",
-"619": "EncodedLegIssuer",
-"620": "LegSecurityDesc",
-"621": "EncodedLegSecurityDescLen",
-"622": "EncodedLegSecurityDesc",
-"623": "LegRatioQty",
-"624": "LegSide",
-"625": "TradingSessionSubID",
-"626": "AllocType",
-"627": "NoHops",
-"628": "HopCompID",
-"629": "HopSendingTime",
-"630": "HopRefID",
-"631": "MidPx",
-"632": "BidYield",
-"633": "MidYield",
-"634": "OfferYield",
-"635": "ClearingFeeIndicator",
-"636": "WorkingIndicator",
-"637": "LegLastPx",
-"638": "PriorityIndicator",
-"639": "PriceImprovement",
-"640": "Price2",
-"641": "LastForwardPoints2",
-"642": "BidForwardPoints2",
-"643": "OfferForwardPoints2",
-"644": "RFQReqID",
-"645": "MktBidPx",
-"646": "MktOfferPx",
-"647": "MinBidSize",
-"648": "MinOfferSize",
-"649": "QuoteStatusReqID",
-"650": "LegalConfirm",
-"651": "UnderlyingLastPx",
-"652": "UnderlyingLastQty",
-"653": "SecDefStatus",
-"654": "LegRefID",
-"655": "ContraLegRefID",
-"656": "SettlCurrBidFxRate",
-"657": "SettlCurrOfferFxRate",
-"658": "QuoteRequestRejectReason",
-"659": "SideComplianceID",
-"660": "AcctIDSource",
-"661": "AllocAcctIDSource",
-"662": "BenchmarkPrice",
-"663": "BenchmarkPriceType",
-"664": "ConfirmID",
-"665": "ConfirmStatus",
-"666": "ConfirmTransType",
-"667": "ContractSettlMonth",
-"668": "DeliveryForm",
-"669": "LastParPx",
-"670": "NoLegAllocs",
-"671": "LegAllocAccount",
-"672": "LegIndividualAllocID",
-"673": "LegAllocQty",
-"674": "LegAllocAcctIDSource",
-"675": "LegSettlCurrency",
-"676": "LegBenchmarkCurveCurrency",
-"677": "LegBenchmarkCurveName",
-"678": "LegBenchmarkCurvePoint",
-"679": "LegBenchmarkPrice",
-"680": "LegBenchmarkPriceType",
-"681": "LegBidPx",
-"682": "LegIOIQty",
-"683": "NoLegStipulations",
-"684": "LegOfferPx",
-"685": "LegOrderQty",
-"686": "LegPriceType",
-"687": "LegQty",
-"688": "LegStipulationType",
-"689": "LegStipulationValue",
-"690": "LegSwapType",
-"691": "Pool",
-"692": "QuotePriceType",
-"693": "QuoteRespID",
-"694": "QuoteRespType",
-"695": "QuoteQualifier",
-"696": "YieldRedemptionDate",
-"697": "YieldRedemptionPrice",
-"698": "YieldRedemptionPriceType",
-"699": "BenchmarkSecurityID",
-"700": "ReversalIndicator",
-"701": "YieldCalcDate",
-"702": "NoPositions",
-"703": "PosType",
-"704": "LongQty",
-"705": "ShortQty",
-"706": "PosQtyStatus",
-"707": "PosAmtType",
-"708": "PosAmt",
-"709": "PosTransType",
-"710": "PosReqID",
-"711": "NoUnderlyings",
-"712": "PosMaintAction",
-"713": "OrigPosReqRefID",
-"714": "PosMaintRptRefID",
-"715": "ClearingBusinessDate",
-"716": "SettlSessID",
-"717": "SettlSessSubID",
-"718": "AdjustmentType",
-"719": "ContraryInstructionIndicator",
-"720": "PriorSpreadIndicator",
-"721": "PosMaintRptID",
-"722": "PosMaintStatus",
-"723": "PosMaintResult",
-"724": "PosReqType",
-"725": "ResponseTransportType",
-"726": "ResponseDestination",
-"727": "TotalNumPosReports",
-"728": "PosReqResult",
-"729": "PosReqStatus",
-"730": "SettlPrice",
-"731": "SettlPriceType",
-"732": "UnderlyingSettlPrice",
-"733": "UnderlyingSettlPriceType",
-"734": "PriorSettlPrice",
-"735": "NoQuoteQualifiers",
-"736": "AllocSettlCurrency",
-"737": "AllocSettlCurrAmt",
-"738": "InterestAtMaturity",
-"739": "LegDatedDate",
-"740": "LegPool",
-"741": "AllocInterestAtMaturity",
-"742": "AllocAccruedInterestAmt",
-"743": "DeliveryDate",
-"744": "AssignmentMethod",
-"745": "AssignmentUnit",
-"746": "OpenInterest",
-"747": "ExerciseMethod",
-"748": "TotNumTradeReports",
-"749": "TradeRequestResult",
-"750": "TradeRequestStatus",
-"751": "TradeReportRejectReason",
-"752": "SideMultiLegReportingType",
-"753": "NoPosAmt",
-"754": "AutoAcceptIndicator",
-"755": "AllocReportID",
-"756": "NoNested2PartyIDs",
-"757": "Nested2PartyID",
-"758": "Nested2PartyIDSource",
-"759": "Nested2PartyRole",
-"760": "Nested2PartySubID",
-"761": "BenchmarkSecurityIDSource",
-"762": "SecuritySubType",
-"763": "UnderlyingSecuritySubType",
-"764": "LegSecuritySubType",
-"765": "AllowableOneSidednessPct",
-"766": "AllowableOneSidednessValue",
-"767": "AllowableOneSidednessCurr",
-"768": "NoTrdRegTimestamps",
-"769": "TrdRegTimestamp",
-"770": "TrdRegTimestampType",
-"771": "TrdRegTimestampOrigin",
-"772": "ConfirmRefID",
-"773": "ConfirmType",
-"774": "ConfirmRejReason",
-"775": "BookingType",
-"776": "IndividualAllocRejCode",
-"777": "SettlInstMsgID",
-"778": "NoSettlInst",
-"779": "LastUpdateTime",
-"780": "AllocSettlInstType",
-"781": "NoSettlPartyIDs",
-"782": "SettlPartyID",
-"783": "SettlPartyIDSource",
-"784": "SettlPartyRole",
-"785": "SettlPartySubID",
-"786": "SettlPartySubIDType",
-"787": "DlvyInstType",
-"788": "TerminationType",
-"789": "NextExpectedMsgSeqNum",
-"790": "OrdStatusReqID",
-"791": "SettlInstReqID",
-"792": "SettlInstReqRejCode",
-"793": "SecondaryAllocID",
-"794": "AllocReportType",
-"795": "AllocReportRefID",
-"796": "AllocCancReplaceReason",
-"797": "CopyMsgIndicator",
-"798": "AllocAccountType",
-"799": "OrderAvgPx",
-"800": "OrderBookingQty",
-"801": "NoSettlPartySubIDs",
-"802": "NoPartySubIDs",
-"803": "PartySubIDType",
-"804": "NoNestedPartySubIDs",
-"805": "NestedPartySubIDType",
-"806": "NoNested2PartySubIDs",
-"807": "Nested2PartySubIDType",
-"808": "AllocIntermedReqType",
-"809": "(Not Defined)",
-"810": "UnderlyingPx",
-"811": "PriceDelta",
-"812": "ApplQueueMax",
-"813": "ApplQueueDepth",
-"814": "ApplQueueResolution",
-"815": "ApplQueueAction",
-"816": "NoAltMDSource",
-"817": "AltMDSourceID",
-"818": "SecondaryTradeReportID",
-"819": "AvgPxIndicator",
-"820": "TradeLinkID",
-"821": "OrderInputDevice",
-"822": "UnderlyingTradingSessionID",
-"823": "UnderlyingTradingSessionSubID",
-"824": "TradeLegRefID",
-"825": "ExchangeRule",
-"826": "TradeAllocIndicator",
-"827": "ExpirationCycle",
-"828": "TrdType",
-"829": "TrdSubType",
-"830": "TransferReason",
-"831": "AsgnReqID",
-"832": "TotNumAssignmentReports",
-"833": "AsgnRptID",
-"834": "ThresholdAmount",
-"835": "PegMoveType",
-"836": "PegOffsetType",
-"837": "PegLimitType",
-"838": "PegRoundDirection",
-"839": "PeggedPrice",
-"840": "PegScope",
-"841": "DiscretionMoveType",
-"842": "DiscretionOffsetType",
-"843": "DiscretionLimitType",
-"844": "DiscretionRoundDirection",
-"845": "DiscretionPrice",
-"846": "DiscretionScope",
-"847": "TargetStrategy",
-"848": "TargetStrategyParameters",
-"849": "ParticipationRate",
-"850": "TargetStrategyPerformance",
-"851": "LastLiquidityInd",
-"852": "PublishTrdIndicator",
-"853": "ShortSaleReason",
-"854": "QtyType",
-"855": "SecondaryTrdType",
-"856": "TradeReportType",
-"857": "AllocNoOrdersType",
-"858": "SharedCommission",
-"859": "ConfirmReqID",
-"860": "AvgParPx",
-"861": "ReportedPx",
-"862": "NoCapacities",
-"863": "OrderCapacityQty",
-"864": "NoEvents",
-"865": "EventType",
-"866": "EventDate",
-"867": "EventPx",
-"868": "EventText",
-"869": "PctAtRisk",
-"870": "NoInstrAttrib",
-"871": "InstrAttribType",
-"872": "InstrAttribValue",
-"873": "DatedDate",
-"874": "InterestAccrualDate",
-"875": "CPProgram",
-"876": "CPRegType",
-"877": "UnderlyingCPProgram",
-"878": "UnderlyingCPRegType",
-"879": "UnderlyingQty",
-"880": "TrdMatchID",
-"881": "SecondaryTradeReportRefID",
-"882": "UnderlyingDirtyPrice",
-"883": "UnderlyingEndPrice",
-"884": "UnderlyingStartValue",
-"885": "UnderlyingCurrentValue",
-"886": "UnderlyingEndValue",
-"887": "NoUnderlyingStips",
-"888": "UnderlyingStipType",
-"889": "UnderlyingStipValue",
-"890": "MaturityNetMoney",
-"891": "MiscFeeBasis",
-"892": "TotNoAllocs",
-"893": "LastFragment",
-"894": "CollReqID",
-"895": "CollAsgnReason",
-"896": "CollInquiryQualifier",
-"897": "NoTrades",
-"898": "MarginRatio",
-"899": "MarginExcess",
-"900": "TotalNetValue",
-"901": "CashOutstanding",
-"902": "CollAsgnID",
-"903": "CollAsgnTransType",
-"904": "CollRespID",
-"905": "CollAsgnRespType",
-"906": "CollAsgnRejectReason",
-"907": "CollAsgnRefID",
-"908": "CollRptID",
-"909": "CollInquiryID",
-"910": "CollStatus",
-"911": "TotNumReports",
-"912": "LastRptRequested",
-"913": "AgreementDesc",
-"914": "AgreementID",
-"915": "AgreementDate",
-"916": "StartDate",
-"917": "EndDate",
-"918": "AgreementCurrency",
-"919": "DeliveryType",
-"920": "EndAccruedInterestAmt",
-"921": "StartCash",
-"922": "EndCash",
-"923": "UserRequestID",
-"924": "UserRequestType",
-"925": "NewPassword",
-"926": "UserStatus",
-"927": "UserStatusText",
-"928": "StatusValue",
-"929": "StatusText",
-"930": "RefCompID",
-"931": "RefSubID",
-"932": "NetworkResponseID",
-"933": "NetworkRequestID",
-"934": "LastNetworkResponseID",
-"935": "NetworkRequestType",
-"936": "NoCompIDs",
-"937": "NetworkStatusResponseType",
-"938": "NoCollInquiryQualifier",
-"939": "TrdRptStatus",
-"940": "AffirmStatus",
-"941": "UnderlyingStrikeCurrency",
-"942": "LegStrikeCurrency",
-"943": "TimeBracket",
-"944": "CollAction",
-"945": "CollInquiryStatus",
-"946": "CollInquiryResult",
-"947": "StrikeCurrency",
-"948": "NoNested3PartyIDs",
-"949": "Nested3PartyID",
-"950": "Nested3PartyIDSource",
-"951": "Nested3PartyRole",
-"952": "NoNested3PartySubIDs",
-"953": "Nested3PartySubID",
-"954": "Nested3PartySubIDType",
-"955": "LegContractSettlMonth",
-"956": "LegInterestAccrualDate",
-"957": "NoStrategyParameters",
-"958": "StrategyParameterName",
-"959": "StrategyParameterType",
-"960": "StrategyParameterValue",
-"961": "HostCrossID",
-"962": "SideTimeInForce",
-"963": "MDReportID",
-"964": "SecurityReportID",
-"965": "SecurityStatus",
-"966": "SettleOnOpenFlag",
-"967": "StrikeMultiplier",
-"968": "StrikeValue",
-"969": "MinPriceIncrement",
-"970": "PositionLimit",
-"971": "NTPositionLimit",
-"972": "UnderlyingAllocationPercent",
-"973": "UnderlyingCashAmount",
-"974": "UnderlyingCashType",
-"975": "UnderlyingSettlementType",
-"976": "QuantityDate",
-"977": "ContIntRptID",
-"978": "LateIndicator",
-"979": "InputSource",
-"980": "SecurityUpdateAction",
-"981": "NoExpiration",
-"982": "ExpType",
-"983": "ExpQty",
-"984": "NoUnderlyingAmounts",
-"985": "UnderlyingPayAmount",
-"986": "UnderlyingCollectAmount",
-"987": "UnderlyingSettlementDate",
-"988": "UnderlyingSettlementStatus",
-"989": "SecondaryIndividualAllocID",
-"990": "LegReportID",
-"991": "RndPx",
-"992": "IndividualAllocType",
-"993": "AllocCustomerCapacity",
-"994": "TierCode",
-"996": "UnitofMeasure",
-"997": "TimeUnit",
-"998": "UnderlyingUnitofMeasure",
-                )RAW_DELIM";
-                ss << R"RAW_DELIM(
-"999": "LegUnitofMeasure",
-"1000": "UnderlyingTimeUnit",
-"1001": "LegTimeUnit",
-"1002": "AllocMethod",
-"1003": "TradeID",
-"1005": "SideTradeReportID",
-"1006": "SideFillStationCd",
-"1007": "SideReasonCd",
-"1008": "SideTrdSubTyp",
-"1009": "SideQty",
-"1011": "MessageEventSource",
-"1012": "SideTrdRegTimestamp",
-"1013": "SideTrdRegTimestampType",
-"1014": "SideTrdRegTimestampSrc",
-"1015": "AsOfIndicator",
-"1016": "NoSideTrdRegTS",
-"1017": "LegOptionRatio",
-"1018": "NoInstrumentParties",
-"1019": "InstrumentPartyID",
-"1020": "TradeVolume",
-"1021": "MDBookType",
-"1022": "MDFeedType",
-"1023": "MDPriceLevel",
-"1024": "MDOriginType",
-"1025": "FirstPx",
-"1026": "MDEntrySpotRate",
-"1027": "MDEntryForwardPoints",
-"1028": "ManualOrderIndicator",
-"1029": "CustDirectedOrder",
-"1030": "ReceivedDeptID",
-"1031": "CustOrderHandlingInst",
-"1032": "OrderHandlingInstSource",
-"1033": "DeskType",
-"1034": "DeskTypeSource",
-"1035": "DeskOrderHandlingInst",
-"1036": "ExecAckStatus",
-"1037": "UnderlyingDeliveryAmount",
-"1038": "UnderlyingCapValue",
-"1039": "UnderlyingSettlMethod",
-"1040": "SecondaryTradeID",
-"1041": "FirmTradeID",
-"1042": "SecondaryFirmTradeID",
-"1043": "CollApplType",
-"1044": "UnderlyingAdjustedQuantity",
-"1045": "UnderlyingFXRate",
-"1046": "UnderlyingFXRateCalc",
-"1047": "AllocPositionEffect",
-"1048": "DealingCapacity",
-"1049": "InstrmtAssignmentMethod",
-"1050": "InstrumentPartyIDSource",
-"1051": "InstrumentPartyRole",
-"1052": "NoInstrumentPartySubIDs",
-"1053": "InstrumentPartySubID",
-"1054": "InstrumentPartySubIDType",
-"1055": "PositionCurrency",
-"1056": "CalculatedCcyLastQty",
-"1057": "AggressorIndicator",
-"1058": "NoUndlyInstrumentParties",
-"1059": "UndlyInstrumentPartyID",
-"1060": "UndlyInstrumentPartyIDSource",
-"1061": "UndlyInstrumentPartyRole",
-"1062": "NoUndlyInstrumentPartySubIDs",
-"1063": "UndlyInstrumentPartySubID",
-"1064": "UndlyInstrumentPartySubIDType",
-"1065": "BidSwapPoints",
-"1066": "OfferSwapPoints",
-"1067": "LegBidForwardPoints",
-"1068": "LegOfferForwardPoints",
-"1069": "SwapPoints",
-"1070": "MDQuoteType",
-"1071": "LastSwapPoints",
-"1072": "SideGrossTradeAmt",
-"1073": "LegLastForwardPoints",
-"1074": "LegCalculatedCcyLastQty",
-"1075": "LegGrossTradeAmt",
-"1079": "MaturityTime",
-"1080": "RefOrderID",
-"1081": "RefOrderIDSource",
-"1082": "SecondaryDisplayQty",
-"1083": "DisplayWhen",
-"1084": "DisplayMethod",
-"1085": "DisplayLowQty",
-"1086": "DisplayHighQty",
-"1087": "DisplayMinIncr",
-"1088": "RefreshQty",
-"1089": "MatchIncrement",
-"1090": "MaxPriceLevels",
-"1091": "PreTradeAnonymity",
-"1092": "PriceProtectionScope",
-"1093": "LotType",
-"1094": "PegPriceType",
-"1095": "PeggedRefPrice",
-"1096": "PegSecurityIDSource",
-"1097": "PegSecurityID",
-"1098": "PegSymbol",
-"1099": "PegSecurityDesc",
-"1100": "TriggerType",
-"1101": "TriggerAction",
-"1102": "TriggerPrice",
-"1103": "TriggerSymbol",
-"1104": "TriggerSecurityID",
-"1105": "TriggerSecurityIDSource",
-"1106": "TriggerSecurityDesc",
-"1107": "TriggerPriceType",
-"1108": "TriggerPriceTypeScope",
-"1109": "TriggerPriceDirection",
-"1110": "TriggerNewPrice",
-"1111": "TriggerOrderType",
-"1112": "TriggerNewQty",
-"1113": "TriggerTradingSessionID",
-"1114": "TriggerTradingSessionSubID",
-"1115": "OrderCategory",
-"1116": "NoRootPartyIDs",
-"1117": "RootPartyID",
-"1118": "RootPartyIDSource",
-"1119": "RootPartyRole",
-"1120": "NoRootPartySubIDs",
-"1121": "RootPartySubID",
-"1122": "RootPartySubIDType",
-"1123": "TradeHandlingInstr",
-"1124": "OrigTradeHandlingInstr",
-"1125": "OrigTradeDate",
-"1126": "OrigTradeID",
-"1127": "OrigSecondaryTradeID",
-"1128": "ApplVerID",
-"1129": "CstmApplVerID",
-"1130": "RefApplVerID",
-"1131": "RefCstmApplVerID",
-"1132": "TZTransactTime",
-"1133": "ExDestinationIDSource",
-"1134": "ReportedPxDiff",
-"1135": "RptSys",
-"1136": "AllocClearingFeeIndicator",
-"1137": "DefaultApplVerID",
-"1138": "DisplayQty",
-"1139": "ExchangeSpecialInstructions"
-},
-"fields": {
-"4": {
-"B": "Buy",
-"S": "Sell",
-"T": "Trade",
-"X": "Cross"
-},
-"5": {
-"C": "Cancel",
-"N": "New",
-"R": "Replace"
-},
-"13": {
-"1": "Per Unit (implying shares, par, currency, etc.)",
-"2": "Percent",
-"3": "Absolute (total monetary amount)",
-"4": "Percentage waived - cash discount (for CIV buy orders)",
-"5": "Percentage waived -= enhanced units (for CIV buy orders)",
-"6": "Points per bond or contract (supply ContractMultiplier (231) in the component block if the object security is denominated in a size other than the industry default - 1000 par for bonds)"
-},
-"18": {
-"0": "Stay on offer side",
-"1": "Not held",
-"2": "Work",
-"3": "Go along",
-"4": "Over the day",
-"5": "Held",
-"6": "Participate don't initiate",
-"7": "Strict scale",
-"8": "Try to scale",
-"9": "Stay on bid side",
-"A": "No cross (cross is forbidden)",
-"B": "OK to cross",
-"C": "Call first",
-"D": "Percent of volume (indicates that the sender does not want to be all of the volume on the floor vs. a specific percentage)",
-"E": "Do not increase - DNI",
-"F": "Do not reduce - DNR",
-"G": "All or none - AON",
-"H": "Reinstate on System Failue (mutually exclusive with Q)",
-"I": "Institutions only",
-"J": "Reinstate on Trading Halt (mutually exclusive with K)",
-"K": "Cancel on Trading Halt (mutually exclusive with J)",
-"L": "Last peg (last sale)",
-"M": "Mid-price peg (midprice of inside quote)",
-"N": "Non-negotiable",
-"O": "Opening peg",
-"P": "Market peg",
-"Q": "Cancel on system failure (mutually exclusive with H)",
-"R": "Primary peg (primary market - buy at bid/sell at offer)",
-"S": "Suspend",
-"T": "Fixed Peg to Local best bid or offer at time of order",
-"U": "Customer Display Instruction (Rule 11Ac1-1/4)",
-"V": "Netting (for Forex)",
-"W": "Peg to VWAP",
-"X": "Trade Along",
-"Y": "Try To Stop",
-"Z": "Cancel if not best",
-"a": "Trailing Stop Peg",
-"b": "Strict Limit (No price improvement)",
-"c": "Ignore Price Validity Checks",
-"d": "Peg to Limit Price",
-"e": "Work to Target Strategy",
-"f": "Intermarket Sweep",
-"g": "External Routing Allowed",
-"h": "External Routing Not Allowed",
-"i": "Imbalance Only",
-"j": "Single execution requested for block trade",
-"k": "Best Execution"
-},
-"20": {
-"0": "New",
-"1": "Cancel",
-"2": "Correct",
-"3": "Status"
-},
-"21": {
-"1": "Automated execution order, private, no Broker intervention",
-"2": "Automated execution order, public, Broker intervention OK",
-"3": "Manual order, best execution"
-},
-"22": {
-"1": "CUSIP",
-"2": "SEDOL",
-"3": "QUIK",
-"4": "ISIN number",
-"5": "RIC code",
-"6": "ISO Currency Code",
-"7": "ISO Country Code",
-"8": "Exchange Symbol",
-"9": "Consolidated Tape Association (CTA) Symbol (SIAC CTS/CQS line format)",
-"A": "Bloomberg Symbol",
-"B": "Wertpapier",
-"C": "Dutch",
-"D": "Valoren",
-"E": "Sicovam",
-"F": "Belgian",
-"G": "'Common' (Clearstream and Euroclear)'",
-"H": "Clearing House / Clearing Organization",
-"I": "ISDA/FpML Product Specification (XML in EncodedSecurityDesc)",
-"J": "Option Price Reporting Authority",
-"K": "ISDA/FpML Product URL (URL in SecurityID)",
-"L": "Letter of Credit"
-},
-"25": {
-"H": "High",
-"L": "Low",
-"M": "Medium"
-},
-"27": {
-"0": "1000000000",
-"L": "Large",
-"M": "Medium",
-"S": "Small",
-"U": "Undisclosed Quantity"
-},
-"28": {
-"C": "Cancel",
-"N": "New",
-"R": "Replace"
-},
-"29": {
-"1": "Agent",
-"2": "Cross as agent",
-"3": "Cross as principal",
-"4": "Principal"
-},
-"35": {
-"0": "Heartbeat",
-"1": "Test Request",
-"2": "Resend Request",
-"3": "Reject",
-"4": "Sequence Reset",
-"5": "Logout",
-"6": "Indication of Interest",
-"7": "Advertisement",
-"8": "Execution Report",
-"9": "Order Cancel Reject",
-"A": "Logon",
-"AA": "Derivative Security List",
-"AB": "New Order - Multileg",
-"AC": "Multileg Order Cancel/Replace (a.k.a. Multileg Order Modification Request)",
-"AD": "Trade Capture Report Request",
-"AE": "Trade Capture Report",
-"AF": "Order Mass Status Request",
-"AG": "Quote Request Reject",
-"AH": "RFQ Request",
-"AI": "Quote Status Report",
-"AJ": "Quote Response",
-"AK": "Confirmation",
-"AL": "Position Maintenance Request",
-"AM": "Position Maintenance Report",
-"AN": "Request For Positions",
-"AO": "Request For Positions Ack",
-"AP": "Position Report",
-"AQ": "Trade Capture Report Request Ack",
-"AR": "Trade Capture Report Ack",
-"AS": "Allocation Report (a.k.a. Allocation Claim)",
-"AT": "Allocation Report Ack (a.k.a. Allocation Claim Ack)",
-"AU": "Confirmation Ack (a.k.a. Affirmation)",
-"AV": "Settlement Instruction Request",
-"AW": "Assignment Report",
-"AX": "Collateral Request",
-"AY": "Collateral Assignment",
-"AZ": "Collateral Response",
-"B": "News",
-"BA": "Collateral Report",
-"BB": "Collateral Inquiry",
-"BC": "Network Counterparty System Status Request",
-"BD": "Network Counterparty System Status Response",
-"BE": "User Request",
-"BF": "User Response",
-"BG": "Collateral Inquiry Ack",
-"BH": "Confirmation Request",
-"BI": "Trading Session List Request",
-"BJ": "Trading Session List",
-"BK": "Security List Update Report",
-"BL": "Adjusted Position Report",
-"BM": "Allocation Instruction Alert",
-"BN": "Execution Acknowledgement",
-"BO": "Contrary Intention Report",
-"BP": "Security Definition Update Report",
-"C": "Email",
-"D": "New Order - Single",
-"E": "New Order - List",
-"F": "Order Cancel Request",
-"G": "Order Cancel/Replace Request (a.k.a. Order Modification Request)",
-"H": "Order Status Request",
-"J": "Allocation Instruction",
-"K": "List Cancel Request",
-"L": "List Execute",
-"M": "List Status Request",
-"N": "List Status",
-"P": "Allocation Instruction Ack",
-"Q": "Don't Know Trade (DK)",
-"R": "Quote Request",
-"S": "Quote",
-"T": "Settlement Instructions",
-"V": "Market Data Request",
-"W": "Market Data - Snapshot/Full Refresh",
-"X": "Market Data - Incremental Refresh",
-"Y": "Market Data Request Reject",
-"Z": "Quote Cancel",
-"a": "Quote Status Request",
-"b": "Mass Quote Acknowledgement",
-"c": "Security Definition Request",
-"d": "Security Definition",
-"e": "Security Status Request",
-"f": "Security Status",
-"g": "Trading Session Status Request",
-"h": "Trading Session Status",
-"i": "Mass Quote",
-"j": "Business Message Reject",
-"k": "Bid Request",
-"l": "Bid Response (lowercase L)",
-"m": "List Strike Price",
-"n": "XML message (e.g. non FIX Msg Type)",
-"o": "Registration Instructions",
-"p": "Registration Instructions Response",
-"q": "Order Mass Cancel Request",
-"r": "Order Mass Cancel Report",
-"s": "New Order - Cross",
-"t": "Cross Order Cancel/Replace Request (a.k.a. Cross Order Modification Request)",
-"u": "Cross Order Cancel Request",
-"v": "Security Type Request",
-"w": "Security Types",
-"x": "Security List Request",
-"y": "Security List",
-"z": "Derivative Security List Request"
-},
-"39": {
-"0": "New",
-"1": "Partially filled",
-"2": "Filled",
-"3": "Done for day",
-"4": "Canceled",
-"5": "Replaced (No longer used)",
-"6": "Pending Cancel (i.e. result of Order Cancel Request <F>)",
-"7": "Stopped",
-"8": "Rejected",
-"9": "Suspended",
-"A": "Pending New",
-"B": "Calculated",
-"C": "Expired",
-"D": "Accepted for Bidding",
-"E": "Pending Replace (i.e. result of Order Cancel/Replace Request <G>)"
-},
-"40": {
-"1": "Market",
-"2": "Limit",
-"3": "Stop / Stop Loss",
-"4": "Stop Limit",
-"5": "Market On Close (No longer used)",
-"6": "With Or Without",
-"7": "Limit Or Better",
-"8": "Limit With Or Without",
-"9": "On Basis",
-"A": "On Close (No longer used)",
-"B": "Limit On Close (No longer used)",
-"C": "Forex Market (No longer used)",
-"D": "Previously Quoted",
-"E": "Previously Indicated",
-"F": "Forex Limit (No longer used)",
-"G": "Forex Swap",
-"H": "Forex Previously Quoted (No longer used)",
-"I": "Funari (Limit day order with unexecuted portion handles as Market On Close. E.g. Japan)",
-"J": "Market If Touched (MIT)",
-"K": "Market With Left Over as Limit (market order with unexecuted quantity becoming limit order at last price)",
-"L": "Previous Fund Valuation Point (Historic pricing; for CIV)",
-"M": "Next Fund Valuation Point (Forward pricing; for CIV)",
-"P": "Pegged",
-"Q": "Counter-Order Selection"
-},
-"43": {
-"N": "Original transmission",
-"Y": "Possible duplicate"
-},
-"47": {
-"A": "Agency single order",
-"B": "Short exempt transaction (refer to A type)",
-"C": "Program order, non-index arb, for Member firm/org",
-"D": "Program order, index arb, for Member firm/org",
-"E": "Short Exempt Transaction for Principal (was incorrectly identified in the FIX spec as 'Registered Equity Market Maker trades')",
-"F": "Short exempt transaction (refer to W type)",
-"H": "Short exempt transaction (refer to I type)",
-"I": "Individual Investor, single order",
-"J": "Program Order, index arb, for individual customer",
-"K": "Program Order, non-index arb, for individual customer",
-"L": "Short exempt transaction for member competing market-maker affliated with the firm clearing the trade (refer to P and O types)",
-"M": "Program Order, index arb, for other member",
-"N": "Program Order, non-index arb, for other member",
-"O": "Proprietary transactions for competing market-maker that is affiliated with the clearing member (was incorrectly identified in the FIX spec as 'Competing dealer trades')",
-"P": "Principal",
-"R": "Transactions for the account of a non-member compting market-maker (was incorrectly identified in the FIX spec as 'Competing dealer trades')",
-"S": "Specialist trades",
-"T": "Transactions for the account of an unaffiliated member's competing market-maker (was incorrectly identified in the FIX spec as 'Competing dealer trades')",
-"U": "Program Order, index arb, for other agency",
-"W": "All other orders as agent for other member",
-"X": "Short exempt transaction for member competing market-maker not affiliated with the firm clearing the trade (refer to W and T types)",
-"Y": "Program Order, non-index arb, for other agency",
-"Z": "Short exempt transaction for non-member competing market-maker (refer to A and R types)"
-},
-"54": {
-"1": "Buy",
-"2": "Sell",
-"3": "Buy minus",
-"4": "Sell plus",
-"5": "Sell short",
-"6": "Sell short exempt",
-"7": "Undisclosed (valid for IOI and List Order messages only)",
-"8": "Cross (orders where counterparty is an exchange, valid for all messages except IOIs)",
-"9": "Cross short",
-"A": "Cross short exempt",
-"B": "'As Defined' (for use with multileg instruments)",
-"C": "'Opposite' (for use with multileg instruments)",
-"D": "Subscribe (e.g. CIV)",
-"E": "Redeem (e.g. CIV)",
-"F": "Lend (FINANCING - identifies direction of collateral)",
-"G": "Borrow (FINANCING - identifies direction of collateral)"
-},
-"59": {
-"0": "Day (or session)",
-"1": "Good Till Cancel (GTC)",
-"2": "At the Opening (OPG)",
-"3": "Immediate Or Cancel (IOC)",
-"4": "Fill Or Kill (FOK)",
-"5": "Good Till Crossing (GTX)",
-"6": "Good Till Date (GTD)",
-"7": "At the Close"
-},
-"61": {
-"0": "Normal",
-"1": "Flash",
-"2": "Background"
-},
-"63": {
-"0": "Regular / FX Spot settlement (T+1 or T+2 depending on currency)",
-"1": "Cash (TOD / T+0)",
-"2": "Next Day (TOM / T+1)",
-"3": "T+2",
-"4": "T+3",
-"5": "T+4",
-"6": "Future",
-"7": "When And If Issued",
-"8": "Sellers Option",
-"9": "T+5",
-"B": "Broken date - for FX expressing non-standard tenor, SettlDate (64) must be specified",
-"C": "FX Spot Next settlement (Spot+1, aka next day)"
-},
-"65": {
-"CD": "EUCP with lump-sum interest rather than discount price",
-"WI": "'When Issued' for a security to be reissued under an old CUSIP or ISIN"
-},
-"71": {
-"0": "New",
-"1": "Replace",
-"2": "Cancel",
-"3": "Preliminary (without MiscFees and NetMoney) (Removed/Replaced)",
-"4": "Calculated (includes MiscFees and NetMoney) (Removed/Replaced)",
-"5": "Calculated without Preliminary (sent unsolicited by broker, includes MiscFees and NetMoney) (Removed/Replaced)",
-"6": "Reversal"
-},
-"77": {
-"C": "Close",
-                )RAW_DELIM";
-                ss << R"RAW_DELIM(
-"F": "FIFO",
-"O": "Open",
-"R": "Rolled"
-},
-"81": {
-"0": "Regular",
-"1": "Soft Dollar",
-"2": "Step-In",
-"3": "Step-Out",
-"4": "Soft-dollar Step-In",
-"5": "Soft-dollar Step-Out",
-"6": "Plan Sponsor"
-},
-"87": {
-"0": "accepted (successfully processed)",
-"1": "block level reject",
-"2": "account level reject",
-"3": "received (received, not yet processed)",
-"4": "incomplete",
-"5": "rejected by intermediary",
-"6": "allocation pending",
-"7": "reversed"
-},
-"88": {
-"0": "Unknown account(s)",
-"1": "Incorrect quantity",
-"10": "Unknown or stale ExecID",
-"11": "Mismatched data",
-"12": "Unknown ClOrdID",
-"13": "Warehouse request rejected",
-"2": "Incorrect averageg price",
-"3": "Unknown executing broker mnemonic",
-"4": "Commission difference",
-"5": "Unknown OrderID (37)",
-"6": "Unknown ListID (66)",
-"7": "Other (further in Text (58))",
-"8": "Incorrect allocated quantity",
-"9": "Calculation difference"
-},
-"94": {
-"0": "New",
-"1": "Reply",
-"2": "Admin Reply"
-},
-"97": {
-"N": "Original Transmission",
-"Y": "Possible Resend"
-},
-"98": {
-"0": "None / Other",
-"1": "PKCS (Proprietary)",
-"2": "DES (ECB Mode)",
-"3": "PKCS / DES (Proprietary)",
-"4": "PGP / DES (Defunct)",
-"5": "PGP / DES-MD5 (See app note on FIX web site)",
-"6": "PEM / DES-MD5 (see app note on FIX web site)"
-},
-"102": {
-"0": "Too late to cancel",
-"1": "Unknown order",
-"18": "Invalid price increment",
-"2": "Broker / Exchange Option",
-"3": "Order already in Pending Cancel or Pending Replace status",
-"4": "Unable to process Order Mass Cancel Request",
-"5": "OrigOrdModTime (586) did not match last TransactTime (60) of order",
-"6": "Duplicate ClOrdID (11) received",
-"99": "Other"
-},
-"103": {
-"0": "Broker / Exchange option",
-"1": "Unknown symbol",
-"10": "Invalid Investor ID",
-"11": "Unsupported order characteristic",
-"12": "Surveillence Option",
-"13": "Incorrect quantity",
-"14": "Incorrect allocated quantity",
-"15": "Unknown account(s)",
-"18": "Invalid price increment",
-"2": "Exchange closed",
-"3": "Order exceeds limit",
-"4": "Too late to enter",
-"5": "Unknown order",
-"6": "Duplicate Order (e.g. dupe ClOrdID)",
-"7": "Duplicate of a verbally communicated order",
-"8": "Stale order",
-"9": "Trade along required",
-"99": "Other"
-},
-"104": {
-"A": "All or None (AON)",
-"B": "Market On Close (MOC) (held to close)",
-"C": "At the close (around/not held to close)",
-"D": "VWAP (Volume Weighted Average Price)",
-"I": "In touch with",
-"L": "Limit",
-"M": "More Behind",
-"O": "At the Open",
-"P": "Taking a Position",
-"Q": "At the Market (previously called Current Quote)",
-"R": "Ready to Trade",
-"S": "Portfolio Shown",
-"T": "Through the Day",
-"V": "Versus",
-"W": "Indidcation - Working Away",
-"X": "Crossing Opportunity",
-"Y": "At the Midpoint",
-"Z": "Pre-open"
-},
-"113": {
-"N": "Indicates the party sending message will report trade",
-"Y": "Indicates the party receiving message must report trade"
-},
-"114": {
-"N": "Indicates the broker is not required to locate",
-"Y": "Indicates the broker is responsible for locating the stock"
-},
-"121": {
-"N": "Do Not Execute Forex After Security Trade",
-"Y": "Execute Forex After Security Trade"
-},
-"123": {
-"N": "Sequence Reset, Ignore Msg Seq Num (N/A For FIXML - Not Used)",
-"Y": "Gap Fill Message, Msg Seq Num Field Valid"
-},
-"127": {
-"A": "Unknown Symbol",
-"B": "Wrong Side",
-"C": "Quantity Exceeds Order",
-"D": "No Matching Order",
-"E": "Price Exceeds Limit",
-"F": "Calculation Difference",
-"Z": "Other"
-},
-"130": {
-"N": "Not Natural",
-"Y": "Natural"
-},
-"139": {
-"1": "Regulatory (e.g. SEC)",
-"10": "Per transaction",
-"11": "Conversion",
-"12": "Agent",
-"13": "Transfer Fee",
-"14": "Security Lending",
-"2": "Tax",
-"3": "Local Commission",
-"4": "Exchange Fees",
-"5": "Stamp",
-"6": "Levy",
-"7": "Other",
-"8": "Markup",
-"9": "Consumption Tax"
-},
-"141": {
-"N": "No",
-"Y": "Yes, reset sequence numbers"
-},
-"150": {
-"0": "New",
-"3": "Done for day",
-"4": "Canceled",
-"5": "Replaced",
-"6": "Pending Cancel (e.g. result of Order Cancel Request <F>)",
-"7": "Stopped",
-"8": "Rejected",
-"9": "Suspended",
-"A": "Pending New",
-"B": "Calculated",
-"C": "Expired",
-"D": "Restated (Execution Report <8> sent unsolicited by sellside, with ExecRestatementReason <378> set)",
-"E": "Pending Replace (e.g. result of Order Cancel/Replace Request <G>)",
-"F": "Trade (partial fill or fill)",
-"G": "Trade Correct",
-"H": "Trade Cancel",
-"I": "Order Status",
-"J": "Trade in a Clearing Hold",
-"K": "Trade has been released to Clearing",
-"L": "Triggered or Activated by System"
-},
-"156": {
-"D": "Divide",
-"M": "Multiply"
-},
-"160": {
-"0": "Default (Replaced)",
-"1": "Standing Instructions Provided",
-"2": "Specific Allocation Account Overriding (Replaced)",
-"3": "Specific Allocation Account Standing (Replaced)",
-"4": "Specific Order for a single account (for CIV)",
-"5": "Request reject"
-},
-"163": {
-"C": "Cancel",
-"N": "New",
-"R": "Replace",
-"T": "Restate"
-},
-"165": {
-"1": "Broker's Instructions",
-"2": "Institution's Instructions",
-"3": "Investor (e.g. CIV use)"
-},
-"166": {
-"CED": "CEDEL",
-"DTC": "Depository Trust Company",
-"EUR": "Euro clear",
-"FED": "Federal Book Entry",
-"ISO_Country_Code": "Local Market Settle Location",
-"PNY": "Physical",
-"PTC": "Participant Trust Company"
-},
-"167": {
-"ABS": "Asset-backed Securities",
-"AMENDED": "Amended &amp; Restated",
-"AN": "Other Anticipation Notes (BAN, GAN, etc.)",
-"BA": "Bankers Acceptance",
-"BN": "Bank Notes",
-"BOX": "Bill Of Exchanges",
-"BRADY": "Brady Bond",
-"BRIDGE": "Bridge Loan",
-"BUYSELL": "Buy Sellback",
-"CASH": "Cash",
-"CB": "Convertible Bond",
-"CD": "Certificate Of Deposit",
-"CL": "Call Loans",
-"CMBS": "Corp. Mortgage-backed Securities",
-"CMO": "Collateralized Mortgage Obligation",
-"COFO": "Certificate Of Obligation",
-"COFP": "Certificate Of Participation",
-"CORP": "Corporate Bond",
-"CP": "Commercial Paper",
-"CPP": "Corporate Private Placement",
-"CS": "Common Stock",
-"DEFLTED": "Defaulted",
-"DINP": "Debtor In Possession",
-"DN": "Deposit Notes",
-"DUAL": "Dual Currency",
-"EUCD": "Euro Certificate Of Deposit",
-"EUCORP": "Euro Corporate Bond",
-"EUCP": "Euro Commercial Paper",
-"EUSOV": "Euro Sovereigns *",
-"EUSUPRA": "Euro Supranational Coupons *",
-"FAC": "Federal Agency Coupon",
-"FADN": "Federal Agency Discount Note",
-"FOR": "Foreign Exchange Contract",
-"FORWARD": "Forward",
-"FUT": "Future",
-"GO": "General Obligation Bonds",
-"IET": "IOETTE Mortgage",
-"LOFC": "Letter Of Credit",
-"LQN": "Liquidity Note",
-"MATURED": "Matured",
-"MBS": "Mortgage-backed Securities",
-"MF": "Mutual Fund",
-"MIO": "Mortgage Interest Only",
-"MLEG": "Multileg Instrument",
-"MPO": "Mortgage Principal Only",
-"MPP": "Mortgage Private Placement",
-"MPT": "Miscellaneous Pass-through",
-"MT": "Mandatory Tender",
-"MTN": "Medium Term Notes",
-"NONE": "No Security Type",
-"ONITE": "Overnight",
-"OOF": "Options on Futures",
-"OOP": "Options on Physical",
-"OPT": "Option",
-"PEF": "Private Export Funding *",
-"PFAND": "Pfandbriefe *",
-"PN": "Promissory Note",
-"PS": "Preferred Stock",
-"PZFJ": "Plazos Fijos",
-"RAN": "Revenue Anticipation Note",
-"REPLACD": "Replaced",
-"REPO": "Repurchase",
-"RETIRED": "Retired",
-"REV": "Revenue Bonds",
-"RVLV": "Revolver Loan",
-"RVLVTRM": "Revolver/Term Loan",
-"SECLOAN": "Securities Loan",
-"SECPLEDGE": "Securities Pledge",
-"SPCLA": "Special Assessment",
-"SPCLO": "Special Obligation",
-"SPCLT": "Special Tax",
-"STN": "Short Term Loan Note",
-"STRUCT": "Structured Notes",
-"SUPRA": "USD Supranational Coupons *",
-"SWING": "Swing Line Facility",
-"TAN": "Tax Anticipation Note",
-"TAXA": "Tax Allocation",
-"TBA": "To Be Announced",
-"TBILL": "US Treasury Bill",
-"TBOND": "US Treasury Bond",
-"TCAL": "Principal Strip Of A Callable Bond Or Note",
-"TD": "Time Deposit",
-"TECP": "Tax Exempt Commercial Paper",
-"TERM": "Term Loan",
-"TINT": "Interest Strip From Any Bond Or Note",
-"TIPS": "Treasury Inflation Protected Securities",
-"TNOTE": "US Treasury Note",
-"TPRN": "Principal Strip From A Non-Callable Bond Or Note",
-"TRAN": "Tax Revenue Anticipation Note",
-"UST": "US Treasury Note (Deprecated Value Use TNOTE)",
-"USTB": "US Treasury Bill (Deprecated Value Use TBILL)",
-"VRDN": "Variable Rate Demand Note",
-"WAR": "Warrant",
-"WITHDRN": "Withdrawn",
-"WLD": "Wildcard Entry (was '?' in 4.4, used on Security Definition Request message)",
-"XCN": "Extended Comm Note",
-"XLINKD": "Indexed Linked",
-"YANK": "Yankee Corporate Bond",
-"YCD": "Yankee Certificate Of Deposit"
-},
-"169": {
-"0": "Other",
-"1": "DTC SID",
-"2": "Thomson ALERT",
-"3": "A Global Custodian (StandInstDBName (70) must be provided)",
-"4": "AccountNet"
-},
-"172": {
-"0": "'Versus. Payment': Deliver (if Sell) or Receive (if Buy) vs. (Against) Payment",
-"1": "'Free': Deliver (if Sell) or Receive (if Buy) Free",
-"2": "Tri-Party",
-"3": "Hold In Custody"
-},
-"197": {
-"0": "FX Netting",
-"1": "FX Swap"
-},
-"201": {
-"0": "Put",
-"1": "Call"
-},
-"203": {
-"0": "Covered",
-"1": "Uncovered"
-},
-"204": {
-"0": "Customer",
-"1": "Firm"
-},
-"208": {
-"N": "Details shoult not be communicated",
-"Y": "Details should be communicated"
-},
-"209": {
-"1": "Match",
-"2": "Forward",
-"3": "Forward and Match"
-},
-"216": {
-"1": "Target Firm",
-"2": "Target List",
-"3": "Block Firm",
-"4": "Block List"
-},
-"219": {
-"1": "CURVE",
-"2": "5YR",
-"3": "OLD5",
-"4": "10YR",
-"5": "OLD10",
-"6": "30YR",
-"7": "OLD30",
-"8": "3MOLIBOR",
-"9": "6MOLIBOR"
-},
-"221": {
-"EONIA": "EONIA",
-"EUREPO": "EUREPO",
-"Euribor": "Euribor",
-"FutureSWAP": "FutureSWAP",
-"LIBID": "LIBID",
-"LIBOR": "LIBOR (London Inter-Bank Offer)",
-"MuniAAA": "MuniAAA",
-"OTHER": "OTHER",
-"Pfandbriefe": "Pfandbriefe",
-"SONIA": "SONIA",
-"SWAP": "SWAP",
-"Treasury": "Treasury"
-},
-"233": {
-"ABS": "Absolute Prepayment Speed",
-"AMT": "Alternative Minimum Tax (Y/N)",
-"AUTOREINV": "Auto Reinvestment at or better",
-"BANKQUAL": "Bank qualified (Y/N)",
-"BGNCON": "Bargain conditions (see StipulationValue (234) for values)",
-"COUPON": "Coupon range",
-"CPP": "Constant Prepayment Penalty",
-"CPR": "Constant Prepayment Rate",
-"CPY": "Constant Prepayment Yield",
-"CURRENCY": "ISO Currency Code",
-"CUSTOMDATE": "Custom start/end date",
-"GEOG": "Geographics and % range (ex. 234=CA 0-80 [minimum of 80% California assets])",
-"HAIRCUT": "Valuation Discount",
-"HEP": "final CPR of Home Equity Prepayment Curve",
-"INSURED": "Insured (Y/N)",
-"ISSUE": "Year Or Year/Month of Issue (ex. 234=2002/09)",
-"ISSUER": "Issuer's ticker",
-"ISSUESIZE": "issue size range",
-"LOOKBACK": "Lookback Days",
-"LOT": "Explicit lot identifier",
-"LOTVAR": "Lot Variance (value in percent maximum over- or under-allocation allowed)",
-"MAT": "Maturity Year And Month",
-"MATURITY": "Maturity range",
-"MAXSUBS": "Maximum substitutions (Repo)",
-"MHP": "Percent of Manufactured Housing Prepayment Curve",
-"MINDNOM": "Minimum denomination",
-"MININCR": "Minimum increment",
-"MINQTY": "Minimum quantity",
-"MPR": "Monthly Prepayment Rate",
-"PAYFREQ": "Payment frequency, calendar",
-"PIECES": "Number Of Pieces",
-"PMAX": "Pools Maximum",
-"PPC": "Percent of Prospectus Prepayment Curve",
-"PPL": "Pools per Lot",
-"PPM": "Pools per Million",
-"PPT": "Pools per Trade",
-"PRICE": "Price Range",
-"PRICEFREQ": "Pricing frequency",
-"PROD": "Production Year",
-"PROTECT": "Call protection",
-"PSA": "Percent of BMA Prepayment Curve",
-"PURPOSE": "Purpose",
-"PXSOURCE": "Benchmark price source",
-"RATING": "Rating source and range",
-"REDEMPTION": "Type Of Redemption - values are: NonCallable, Prefunded, EscrowedToMaturity, Putable, Convertible",
-"RESTRICTED": "Restricted (Y/N)",
-"SECTOR": "Market Sector",
-"SECTYPE": "Security Type included or excluded",
-"SMM": "Single Monthly Mortality",
-"STRUCT": "Structure",
-"SUBSFREQ": "Substitutions frequency (Repo)",
-"SUBSLEFT": "Substitutions left (Repo)",
-"TEXT": "Freeform Text",
-"TRDVAR": "Trade Variance (value in percent maximum over- or under-allocation allowed)",
-"WAC": "Weighted Average Coupon - value in percent (exact or range) plus 'Gross' or 'Net' of servicing spread (the default) (ex. 234=6.5-Net [minimum of 6.5% net of servicing fee])",
-"WAL": "Weighted Average Life Coupon - value in percent (exact or range)",
-"WALA": "Weighted Average Loan Age - value in months (exact or range)",
-"WAM": "Weighted Average Maturity - value in months (exact or range)",
-"WHOLE": "Whole Pool (Y/N)",
-"YIELD": "Yield Range"
-},
-"235": {
-"AFTERTAX": "After Tax Yield (Municipals)",
-"ANNUAL": "Annual Yield",
-"ATISSUE": "Yield At Issue (Municipals)",
-"AVGMATURITY": "Yield To Avg Maturity",
-"BOOK": "Book Yield",
-"CALL": "Yield to Next Call",
-"CHANGE": "Yield Change Since Close",
-"CLOSE": "Closing Yield",
-"COMPOUND": "Compound Yield",
-"CURRENT": "Current Yield",
-"GOVTEQUIV": "Gvnt Equivalent Yield",
-"GROSS": "True Gross Yield",
-"INFLATION": "Yield with Inflation Assumption",
-"INVERSEFLOATER": "Inverse Floater Bond Yield",
-"LASTCLOSE": "Most Recent Closing Yield",
-"LASTMONTH": "Closing Yield Most Recent Month",
-"LASTQUARTER": "Closing Yield Most Recent Quarter",
-"LASTYEAR": "Closing Yield Most Recent Year",
-"LONGAVGLIFE": "Yield to Longest Average Life",
-"MARK": "Mark to Market Yield",
-"MATURITY": "Yield to Maturity",
-"NEXTREFUND": "Yield to Next Refund (Sinking Fund Bonds)",
-"OPENAVG": "Open Average Yield",
-"PREVCLOSE": "Previous Close Yield",
-"PROCEEDS": "Proceeds Yield",
-"PUT": "Yield to Next Put",
-"SEMIANNUAL": "Semi-annual Yield",
-"SHORTAVGLIFE": "Yield to Shortest Average Life",
-"SIMPLE": "Simple Yield",
-"TAXEQUIV": "Tax Equivalent Yield",
-"TENDER": "Yield to Tender Date",
-"TRUE": "True Yield",
-"VALUE1_32": "Yield Value Of 1/32",
-"WORST": "Yield To Worst"
-},
-"258": {
-"N": "Not Traded Flat",
-"Y": "Traded Flat"
-},
-"263": {
-"0": "Snapshot",
-"1": "Snapshot + Updates (Subscribe)",
-"2": "Disable previous Snapshot + Update Request (Unsubscribe)"
-},
-"264": {
-"0": "Full Book depth",
-"1": "Top of Book",
-"2": "Book Depth (number of levels)"
-},
-"265": {
-"0": "Full refresh",
-"1": "Incremental refresh"
-},
-"266": {
-"N": "book entries should not be aggregated",
-"Y": "book entries to be aggregated"
-                )RAW_DELIM";
-                ss << R"RAW_DELIM(
-},
-"269": {
-"0": "Bid",
-"1": "Offer",
-"2": "Trade",
-"3": "Index Value",
-"4": "Opening Price",
-"5": "Closing Price",
-"6": "Settlement Price",
-"7": "Trading Session High Price",
-"8": "Trading Session Low Price",
-"9": "Trading Session VWAP Price",
-"A": "Imbalance",
-"B": "Trade Volume",
-"C": "Open Interest",
-"D": "Composite Underlying Price",
-"E": "Simulated Sell Price",
-"F": "Simulated Buy Price",
-"G": "Margin Rate",
-"H": "Mid Price",
-"J": "Empty Book",
-"K": "Settle High Price",
-"L": "Settle Low Price",
-"M": "Prior Settle Price",
-"N": "Session High Bid",
-"O": "Session Low Offer",
-"P": "Early Prices",
-"Q": "Auction Clearing Price"
-},
-"274": {
-"0": "Plus Tick",
-"1": "Zero-Plus Tick",
-"2": "Minus Tick",
-"3": "Zero-Minus Tick"
-},
-"276": {
-"0": "Reserved SAM",
-"1": "No Active SAM",
-"2": "Restricted",
-"A": "Open/Active",
-"B": "Closed/Inactive",
-"C": "Exchange Best",
-"D": "Consolidated Best",
-"E": "Locked",
-"F": "Crossed",
-"G": "Depth",
-"H": "Fast Trading",
-"I": "Non-Firm",
-"J": "Outright Price",
-"K": "Implied Price",
-"L": "Manual/Slow Quote",
-"M": "Depth on Offer",
-"N": "Depth on Bid",
-"O": "Closing",
-"P": "News Dissemination",
-"Q": "Trading Range",
-"R": "Order Influx",
-"S": "Due to Related",
-"T": "News Pending",
-"U": "Additional Info",
-"V": "Additional Info due to related",
-"W": "Resume",
-"X": "View of Common",
-"Y": "Volume Alert",
-"Z": "Order Imbalance",
-"a": "Equipment Changeover",
-"b": "No Open / No Resume",
-"c": "Regular ETH",
-"d": "Automatic Execution",
-"e": "Automatic Execution ETH",
-"f": "Fast Market ETH",
-"g": "Inactive ETH",
-"h": "Rotation",
-"i": "Rotation ETH",
-"j": "Halt",
-"k": "Halt ETH",
-"l": "Due to News Dissemination",
-"m": "Due to News Pending",
-"n": "Trading Resume",
-"o": "Out of Sequence",
-"p": "Bid Specialist",
-"q": "Offer Specialist",
-"r": "Bid Offer Specialist",
-"s": "End of Day SAM",
-"t": "Forbidden SAM",
-"u": "Frozen SAM",
-"v": "PreOpening SAM",
-"w": "Opening SAM",
-"x": "Open SAM",
-"y": "Surveillance SAM",
-"z": "Suspended SAM"
-},
-"277": {
-"0": "Cancel",
-"A": "Cash (only) Market",
-"AA": "Spread",
-"AB": "Spread ETH",
-"AC": "Straddle",
-"AD": "Straddle ETH",
-"AE": "Stopped",
-"AF": "Stopped ETH",
-"AG": "Regular ETH",
-"AH": "Combo",
-"AI": "Combo ETH",
-"AJ": "Official Closing Price",
-"AK": "Prior Reference Price",
-"AL": "Stopped Sold Last",
-"AM": "Stopped Out of Sequence",
-"AN": "Offical Closing Price",
-"AO": "Crossed Trade",
-"AP": "Fast Market",
-"AQ": "Automatic Execution",
-"AR": "Form T",
-"AS": "Basket Index",
-"AT": "Burst Basket",
-"B": "Average Price Trade",
-"C": "Cash Trade (same day clearing)",
-"D": "Next Day (only)Market",
-"E": "Opening/Reopening Trade Detail",
-"F": "Intraday Trade Detail",
-"G": "Rule 127 Trade (NYSE)",
-"H": "Rule 155 Trade (AMEX)",
-"I": "Sold Last (late reporting)",
-"J": "Next Day Trade (next day clearing)",
-"K": "Opened (late report of opened trade)",
-"L": "Seller",
-"M": "Sold (out of sequence)",
-"N": "Stopped Stock (guarantee of price but does not execute the order)",
-"P": "Imbalance More Buyers (cannot be used in combination with Q)",
-"Q": "Imbalance More Sellers (cannot be used in combination with P)",
-"R": "Opening Price",
-"S": "Bargain Condition (LSE)",
-"T": "Converted Price Indicator",
-"U": "Exchange Last",
-"V": "Final Price of Session",
-"W": "Ex-pit",
-"X": "Crossed",
-"Y": "Trades resulting from manual/slow quote",
-"Z": "Trades resulting from intermarket sweep",
-"a": "Volume Only",
-"b": "Direct Plus",
-"c": "Acquisition",
-"d": "Bunched",
-"e": "Distribution",
-"f": "Bunched Sale",
-"g": "Split Trade",
-"h": "Cancel Stopped",
-"i": "Cancel ETH",
-"j": "Cancel Stopped ETH",
-"k": "Out of Sequence ETH",
-"l": "Cancel Last ETH",
-"m": "Sold Last Sale ETH",
-"n": "Cancel Last",
-"o": "Sold Last Sale",
-"p": "Cancel Open",
-"q": "Cancel Open ETH",
-"r": "Opened Sale ETH",
-"s": "Cancel Only",
-"t": "Cancel Only ETH",
-"u": "Late Open ETH",
-"v": "Auto Execution ETH",
-"w": "Reopen",
-"x": "Reopen ETH",
-"y": "Adjusted",
-"z": "Adjusted ETH"
-},
-"279": {
-"0": "New",
-"1": "Change",
-"2": "Delete",
-"3": "Delete Thru",
-"4": "Delete From"
-},
-"281": {
-"0": "Unknown symbol",
-"1": "Duplicate MDReqID",
-"2": "Insufficient Bandwidth",
-"3": "Insufficient Permissions",
-"4": "Unsupported SubscriptionRequestType",
-"5": "Unsupported MarketDepth",
-"6": "Unsupported MDUpdateType",
-"7": "Unsupported AggregatedBook",
-"8": "Unsupported MDEntryType",
-"9": "Unsupported TradingSessionID",
-"A": "Unsupported Scope",
-"B": "Unsupported OpenCloseSettleFlag",
-"C": "Unsupported MDImplicitDelete",
-"D": "Insufficient credit"
-},
-"285": {
-"0": "Cancellation / Trade Bust",
-"1": "Error"
-},
-"286": {
-"0": "Daily Open / Close / Settlement entry",
-"1": "Session Open / Close / Settlement entry",
-"2": "Delivery Settlement entry",
-"3": "Expected entry",
-"4": "Entry from previous business day",
-"5": "Theoretical Price value"
-},
-"291": {
-"1": "Bankrupt",
-"2": "Pending delisting",
-"3": "Restricted"
-},
-"292": {
-"A": "Ex-Dividend",
-"B": "Ex-Distribution",
-"C": "Ex-Rights",
-"D": "New",
-"E": "Ex-Interest",
-"F": "Cash Dividend",
-"G": "Stock Dividend",
-"H": "Non-Integer Stock Split",
-"I": "Reverse Stock Split",
-"J": "Standard-Integer Stock Split",
-"K": "Position Consolidation",
-"L": "Liquidation Reorganization",
-"M": "Merger Reorganization",
-"N": "Rights Offering",
-"O": "Shareholder Meeting",
-"P": "Spinoff",
-"Q": "Tender Offer",
-"R": "Warrant",
-"S": "Special Action",
-"T": "Symbol Conversion",
-"U": "CUSIP / Name Change",
-"V": "Leap Rollover"
-},
-"297": {
-"0": "Accepted",
-"1": "Cancel for Symbol(s)",
-"10": "Pending",
-"11": "Pass",
-"12": "Locked Market Warning",
-"13": "Cross Market Warning",
-"14": "Canceled Due To Lock Market",
-"15": "Canceled Due To Cross Market",
-"2": "Canceled for Security Type(s)",
-"3": "Canceled for Underlying",
-"4": "Canceled All",
-"5": "Rejected",
-"6": "Removed from Market",
-"7": "Expired",
-"8": "Query",
-"9": "Quote Not Found"
-},
-"298": {
-"1": "Cancel for Symbol(s)",
-"2": "Cancel for Security Type(s)",
-"3": "Cancel for Underlying Symbol",
-"4": "Cancel All Quotes",
-"5": "Cancel quote specified in QuoteID"
-},
-"300": {
-"1": "Unknown Symbol (security)",
-"2": "Exchange (Security) closed",
-"3": "Quote <S> exceeds limit",
-"4": "Too late to enter",
-"5": "Unknown Quote <S>",
-"6": "Duplicate Quote <S>",
-"7": "Invalid bid/ask spread",
-"8": "Invalid price",
-"9": "Not authorized to quote security",
-"99": "Other"
-},
-"301": {
-"0": "No Acknowledgement (default)",
-"1": "Acknowledge only negative or erroneous quotes",
-"2": "Acknowledge each quote messages"
-},
-"303": {
-"1": "Manual",
-"2": "Automatic"
-},
-"321": {
-"0": "Request Security identity and specifications",
-"1": "Request Security identity for the specifications provided (name of the security is not supplied)",
-"2": "Request List Security Types",
-"3": "Request List Securities (can be qualified with Symbol, SecurityType, TradingSessionID, SecurityExchange. If provided then only list Securities for the specific type.)"
-},
-"323": {
-"1": "Accept security proposal as-is",
-"2": "Accept security proposal with revisions as indicated in the message",
-"3": "List of security types returned per request",
-"4": "List of securities returned per request",
-"5": "Reject security proposal",
-"6": "Cannot match selection criteria"
-},
-"325": {
-"N": "Message is being sent as a result of a prior request",
-"Y": "Message is being secnt unsolicited"
-},
-"326": {
-"1": "Opening delay",
-"10": "Market on Close Imbalance Sell",
-"11": "(not assigned)",
-"12": "No Market Imbalance",
-"13": "No Market on Close Imbalance",
-"14": "ITS Pre-opening",
-"15": "New Price Indication",
-"16": "Trade Dissemination Time",
-"17": "Ready to trade (start of session)",
-"18": "Not available for trading (end of session)",
-"19": "Not traded on this market",
-"2": "Trading halt",
-"20": "Unknown or Invalid",
-"21": "Pre-open",
-"22": "Opening Rotation",
-"23": "Fast Market",
-"3": "Resume",
-"4": "No Open / No Resume",
-"5": "Price indication",
-"6": "Trading Range Indication",
-"7": "Market Imbalance Buy",
-"8": "Market Imbalance Sell",
-"9": "Market on Close Imbalance Buy"
-},
-"327": {
-"D": "News Dissemination",
-"E": "Order Influx",
-"I": "Order Imbalance",
-"M": "Additional Information",
-"P": "New Pending",
-"X": "Equipment Changeover"
-}
-}
-}
-                )RAW_DELIM";
+                const size_t mid = (low + high) / 2;
+                if (GROUPS[mid].count_tag < count_tag)
+                    low = mid + 1;
+                else
+                    high = mid;
             }
 
-            return ss.str();
+            return ((low < NUM_GROUPS && GROUPS[low].count_tag == count_tag) ? &GROUPS[low] : nullptr);
         }
-    };
+
+    public:
+        // returns the name of a FIX tag (empty if the tag is not known)
+        constexpr static std::string_view tag_name(const size_t tag)
+        {
+            return (tag <= MAX_TAG ? TAG_NAMES[tag] : std::string_view());
+        }
+
+        // returns true if a tag counts the instances of a repeating group (NumInGroup)
+        constexpr static bool is_group_count(const size_t tag)
+        {
+            return (tag <= MAX_TAG && ((GROUP_COUNT_BITS[tag / 64] >> (tag % 64)) & 1) != 0);
+        }
+
+        // returns the tag of the field that starts each instance of a repeating group, given its
+        // NumInGroup tag (zero if the members of the group are not known)
+        constexpr static size_t group_delimiter(const size_t count_tag)
+        {
+            const group_entry *g = find_group(count_tag);
+            return (g != nullptr ? g->delimiter : 0);
+        }
+
+        // returns true if a tag is a member of the repeating group with a NumInGroup tag, or of a
+        // group nested in it (false if the members of the group are not known)
+        constexpr static bool is_group_member(const size_t count_tag, const size_t tag)
+        {
+            const group_entry *g = find_group(count_tag);
+            if (g == nullptr)
+                return false;
+
+            size_t low = g->first_member;
+            size_t high = low + g->num_members;
+
+            while (low < high)
+            {
+                const size_t mid = (low + high) / 2;
+                if (GROUP_MEMBERS[mid] < tag)
+                    low = mid + 1;
+                else
+                    high = mid;
+            }
+
+            return (low < static_cast<size_t>(g->first_member + g->num_members) && GROUP_MEMBERS[low] == tag);
+        }
+
+        // returns the name of an enumerated value of a FIX field (empty if not known)
+        constexpr static std::string_view field_name(const size_t tag, const std::string_view value)
+        {
+            if (tag == 0 || tag > MAX_TAG)
+                return std::string_view();
+
+            const uint32_t seed = FIELD_SEEDS[hash(0, tag, value) % NUM_FIELD_BUCKETS];
+            const field_entry &entry = FIELD_VALUES[hash(seed, tag, value) & (NUM_FIELD_SLOTS - 1)];
+
+            if (entry.tag != tag || entry.value != value)
+                return std::string_view();
+
+            return entry.name;
+        }
+
+    }; // class fix_db
+
 } // namespace rda
@@ -0,0 +1,416 @@
+#pragma once
+
+//
+// fix_framer.h - Splits a FIX byte stream (as read from a TCP session, or a recorded session
+//  file) into messages. Each message is found from its header, "8=BeginString" followed by
+//  "9=BodyLength", and checked against its "10=CheckSum" trailer. The stream can arrive in
+//  pieces of any size: bytes are read straight into the framer's buffer (or fed to it), and
+//  each message is returned as a view of that buffer, or of the caller's data, without being
+//  copied. The buffer is re-used, so no memory is allocated for each message.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace rda
+{
+    // statistics of the stream read by a fix_framer
+    struct fix_framer_stats
+    {
+        // number of messages framed
+        size_t messages = 0;
+
+        // number of bytes in the messages framed
+        size_t message_bytes = 0;
+
+        // number of bytes skipped, that were not part of a valid message
+        size_t skipped_bytes = 0;
+
+        // number of times a header or trailer was not valid, and the stream was re-synced
+        size_t framing_errors = 0;
+
+        // number of messages dropped because their checksum did not match
+        size_t checksum_errors = 0;
+    };
+
+    class fix_framer
+    {
+    public:
+        // called with each message framed. the view is only valid during the call.
+        typedef std::function<void(std::string_view)> message_callback;
+
+        // default largest message that can be framed (longer ones are skipped)
+        constexpr static const size_t DEFAULT_MAX_MESSAGE_SIZE = 64 * 1024;
+
+        // default number of bytes read from a stream at a time
+        constexpr static const size_t DEFAULT_READ_SIZE = 64 * 1024;
+
+        // the FIX field delimiter
+        constexpr static const char SOH = 0x01;
+
+    private:
+        // the result of looking for a message at the start of some data
+        enum class frame_result
+        {
+            // a whole message was found
+            FR_MESSAGE,
+
+            // there is not enough data yet to tell
+            FR_INCOMPLETE,
+
+            // the data does not start with a valid message
+            FR_INVALID
+        };
+
+        // length of the trailer: "10=" + three digits + delimiter
+        constexpr static const size_t TRAILER_SIZE = 7;
+
+        // longest "8=BeginString" field that is looked for
+        constexpr static const size_t MAX_BEGIN_STRING = 32;
+
+        // bytes received, but not framed yet, are in [begin, end)
+        std::vector<char> buffer;
+        size_t begin = 0;
+        size_t end = 0;
+
+        // largest message that can be framed
+        size_t max_message_size = DEFAULT_MAX_MESSAGE_SIZE;
+
+        // the field delimiter
+        char delimiter = SOH;
+
+        // true if messages with a wrong checksum are dropped
+        bool verify_checksum = true;
+
+        // statistics of the stream
+        fix_framer_stats stats;
+
+    public:
+        // constructor. the delimiter is SOH on the wire, but '|' can be used for messages
+        // written out as text.
+        explicit fix_framer(const size_t max_message_size_ = DEFAULT_MAX_MESSAGE_SIZE, const char delimiter_ = SOH,
+                            const bool verify_checksum_ = true)
+            : max_message_size(std::max(max_message_size_, static_cast<size_t>(32))), delimiter(delimiter_),
+              verify_checksum(verify_checksum_)
+        {
+            buffer.resize(max_message_size);
+        }
+
+        // returns the statistics of the stream
+        const fix_framer_stats &get_stats() const
+        {
+            return stats;
+        }
+
+        // returns the number of bytes received that are not part of a message framed yet
+        size_t pending() const
+        {
+            return end - begin;
+        }
+
+        // forget any partial message, and the statistics, to read a new stream
+        void reset()
+        {
+            begin = end = 0;
+            stats = fix_framer_stats();
+        }
+
+        // returns space in the buffer for at least size more bytes of the stream, to read
+        // into directly (for example, with recv()). call commit() with the number of bytes
+        // read. views of messages returned before are no longer valid.
+        std::pair<char *, size_t> prepare(const size_t size)
+        {
+            if (buffer.size() - end < size)
+            {
+                // move the partial message to the front of the buffer
+                if (begin != 0)
+                {
+                    std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+                    end -= begin;
+                    begin = 0;
+                }
+
+                if (buffer.size() - end < size)
+                    buffer.resize(end + size);
+            }
+
+            return std::make_pair(buffer.data() + end, buffer.size() - end);
+        }
+
+        // add bytes that were read into the space returned by prepare()
+        void commit(const size_t size)
+        {
+            end = std::min(end + size, buffer.size());
+        }
+
+        // returns the next message in the buffer as a view of it, valid until the next call
+        // to prepare() or feed(). returns false if there is no whole message yet.
+        bool next(std::string_view &message)
+        {
+            while (begin < end)
+            {
+                const std::string_view data(buffer.data() + begin, end - begin);
+                size_t length = 0;
+
+                switch (frame(data, length))
+                {
+                    case frame_result::FR_MESSAGE:
+                        message = data.substr(0, length);
+                        begin += length;
+                        return true;
+                    case frame_result::FR_INVALID:
+                        begin += length;
+                        break;
+                    case frame_result::FR_INCOMPLETE:
+                        return false;
+                }
+            }
+
+            begin = end = 0;
+            return false;
+        }
+
+        // add some bytes of the stream, and call op with each message they complete. messages
+        // that are whole in data are viewed in place, and only the bytes of a partial message
+        // are copied into the buffer, to be completed by the next call.
+        void feed(const std::string_view data, const message_callback &op)
+        {
+            std::string_view rest = data;
+            std::string_view message;
+
+            // complete the partial message in the buffer first
+            while (begin != end && !rest.empty())
+            {
+                const size_t size = std::min(rest.size(), bytes_wanted());
+                std::memcpy(prepare(size).first, rest.data(), size);
+                commit(size);
+                rest.remove_prefix(size);
+
+                while (next(message))
+                    op(message);
+            }
+
+            // then frame the rest of the data where it is
+            while (!rest.empty())
+            {
+                size_t length = 0;
+                const frame_result result = frame(rest, length);
+
+                if (result == frame_result::FR_INCOMPLETE)
+                {
+                    std::memcpy(prepare(rest.size()).first, rest.data(), rest.size());
+                    commit(rest.size());
+                    break;
+                }
+
+                if (result == frame_result::FR_MESSAGE)
+                    op(rest.substr(0, length));
+
+                rest.remove_prefix(length);
+            }
+        }
+
+        // read a stream to its end, size bytes at a time, straight into the buffer, and call op
+        // with each message
+        void read(std::istream &is, const message_callback &op, const size_t size = DEFAULT_READ_SIZE)
+        {
+            std::string_view message;
+
+            while (is)
+            {
+                const auto space = prepare(size);
+                is.read(space.first, static_cast<std::streamsize>(std::min(space.second, size)));
+                commit(static_cast<size_t>(is.gcount()));
+
+                while (next(message))
+                    op(message);
+            }
+        }
+
+        // returns the FIX checksum of some data: the sum of its bytes, modulo 256
+        static unsigned int checksum(const std::string_view data)
+        {
+            unsigned int sum = 0;
+
+            for (const char c : data)
+                sum += static_cast<unsigned char>(c);
+
+            return (sum % 256);
+        }
+
+    private:
+        // returns the number of bytes still needed to complete the partial message in the
+        // buffer (or a small number, if its length is not known yet)
+        size_t bytes_wanted() const
+        {
+            const std::string_view data(buffer.data() + begin, end - begin);
+            size_t body_start = 0;
+            size_t body_length = 0;
+
+            if (read_header(data, body_start, body_length) == frame_result::FR_MESSAGE)
+            {
+                const size_t total = body_start + body_length + TRAILER_SIZE;
+                if (total > data.size())
+                    return total - data.size();
+            }
+
+            return 64;
+        }
+
+        // read the "8=...|9=...|" header at the start of data. sets body_start to the position
+        // after it, and body_length to the length given. returns FR_MESSAGE if the header is
+        // whole and valid.
+        frame_result read_header(const std::string_view data, size_t &body_start, size_t &body_length) const
+        {
+            if (data.size() < 2)
+                return (data.empty() || data[0] == '8') ? frame_result::FR_INCOMPLETE : frame_result::FR_INVALID;
+
+            if (data[0] != '8' || data[1] != '=')
+                return frame_result::FR_INVALID;
+
+            // the BeginString value (no longer than MAX_BEGIN_STRING)
+            const size_t begin_string_end = data.find(delimiter, 2);
+            if (begin_string_end == std::string_view::npos)
+                return (data.size() < MAX_BEGIN_STRING ? frame_result::FR_INCOMPLETE : frame_result::FR_INVALID);
+
+            // the BodyLength field must come next
+            size_t pos = begin_string_end + 1;
+            for (const char c : std::string_view("9="))
+            {
+                if (pos == data.size())
+                    return frame_result::FR_INCOMPLETE;
+                if (data[pos++] != c)
+                    return frame_result::FR_INVALID;
+            }
+
+            body_length = 0;
+            const size_t digits_start = pos;
+
+            for (;; ++pos)
+            {
+                if (pos == data.size())
+                    return frame_result::FR_INCOMPLETE;
+
+                const char c = data[pos];
+
+                if (c == delimiter)
+                    break;
+
+                if (c < '0' || c > '9' || pos - digits_start >= 9)
+                    return frame_result::FR_INVALID;
+
+                body_length = body_length * 10 + static_cast<size_t>(c - '0');
+            }
+
+            if (pos == digits_start)
+                return frame_result::FR_INVALID;
+
+            body_start = pos + 1;
+
+            if (body_start + body_length + TRAILER_SIZE > max_message_size)
+                return frame_result::FR_INVALID;
+
+            return frame_result::FR_MESSAGE;
+        }
+
+        // look for a message at the start of data. sets length to the length of the message,
+        // or to the number of bytes to skip if the data does not start with one.
+        frame_result frame(const std::string_view data, size_t &length)
+        {
+            size_t body_start = 0;
+            size_t body_length = 0;
+
+            frame_result result = read_header(data, body_start, body_length);
+
+            if (result == frame_result::FR_MESSAGE)
+            {
+                const size_t total = body_start + body_length + TRAILER_SIZE;
+
+                if (total > data.size())
+                    return frame_result::FR_INCOMPLETE;
+
+                // the trailer must follow the body exactly
+                const std::string_view trailer = data.substr(body_start + body_length, TRAILER_SIZE);
+
+                if (trailer[0] != '1' || trailer[1] != '0' || trailer[2] != '=' || !is_digit(trailer[3]) ||
+                    !is_digit(trailer[4]) || !is_digit(trailer[5]) || trailer[6] != delimiter)
+                {
+                    result = frame_result::FR_INVALID;
+                }
+                else
+                {
+                    length = total;
+
+                    const unsigned int expected =
+                        static_cast<unsigned int>((trailer[3] - '0') * 100 + (trailer[4] - '0') * 10 + (trailer[5] - '0'));
+
+                    // a message that is whole, but corrupt, is skipped
+                    if (verify_checksum && checksum(data.substr(0, body_start + body_length)) != expected)
+                    {
+                        ++stats.checksum_errors;
+                        stats.skipped_bytes += total;
+                        return frame_result::FR_INVALID;
+                    }
+
+                    ++stats.messages;
+                    stats.message_bytes += total;
+                    return frame_result::FR_MESSAGE;
+                }
+            }
+
+            if (result == frame_result::FR_INCOMPLETE)
+                return result;
+
+            // skip to the next place a message could start
+            ++stats.framing_errors;
+            length = resync(data);
+            return frame_result::FR_INVALID;
+        }
+
+        // returns the number of bytes before the next "8=" (or a final '8'), where a message
+        // could start. a false match inside a field just fails its header check in turn.
+        size_t resync(const std::string_view data)
+        {
+            size_t pos = 1;
+
+            while (pos < data.size())
+            {
+                const size_t found = data.find('8', pos);
+                if (found == std::string_view::npos)
+                {
+                    pos = data.size();
+                    break;
+                }
+
+                if (found + 1 == data.size() || data[found + 1] == '=')
+                {
+                    pos = found;
+                    break;
+                }
+
+                pos = found + 1;
+            }
+
+            stats.skipped_bytes += pos;
+            return pos;
+        }
+
+        // returns true if the character is a decimal digit
+        static bool is_digit(const char c)
+        {
+            return (c >= '0' && c <= '9');
+        }
+
+    }; // class fix_framer
+
+} // namespace rda
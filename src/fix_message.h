@@ -8,24 +8,631 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
+
+#include "fix_db.h"
+#include "simd_rda.h"
 
 namespace rda
 {
+    // an exact decimal value of a FIX field (such as a price or quantity): mantissa * 10^exponent.
+    // the value is kept as written, so "1.50" has mantissa 150 and exponent -2.
+    struct fix_decimal
+    {
+        // the digits of the value, as an integer
+        int64_t mantissa = 0;
+
+        // the power of ten the mantissa is scaled by (zero or negative)
+        int32_t exponent = 0;
+
+        // returns the value as a double (which may not be exact)
+        double to_double() const
+        {
+            double scale = 1.0;
+            for (int32_t i = exponent; i < 0; ++i)
+                scale *= 10.0;
+
+            return static_cast<double>(mantissa) / scale;
+        }
+    };
+
+    // a FIX UTCTimestamp (YYYYMMDD-HH:MM:SS, with an optional fraction of a second)
+    struct fix_timestamp
+    {
+        int32_t year = 1970;
+        int32_t month = 1;
+        int32_t day = 1;
+        int32_t hour = 0;
+        int32_t minute = 0;
+        int32_t second = 0;
+        int32_t nanosecond = 0;
+
+        // returns the number of nanoseconds since 1970-01-01 00:00:00 UTC
+        int64_t to_epoch_nanoseconds() const
+        {
+            // days since the epoch of the civil date (march based years make leap days last)
+            const int32_t y = year - (month <= 2 ? 1 : 0);
+            const int32_t era = (y >= 0 ? y : y - 399) / 400;
+            const int32_t year_of_era = y - era * 400;
+            const int32_t day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+            const int32_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+            const int64_t days = static_cast<int64_t>(era) * 146097 + day_of_era - 719468;
+
+            const int64_t seconds = days * 86400 + hour * 3600 + minute * 60 + second;
+            return seconds * 1000000000 + nanosecond;
+        }
+    };
+
+    // helpers for reading FIX messages
+    namespace fix_helpers
+    {
+        // number of bytes classified at a time
+        constexpr static const size_t BLOCK_SIZE = 64;
+
+        // classification of a block of bytes of a FIX message. bit n of each mask is set if
+        // byte n of the block is of that class.
+        struct block_masks
+        {
+            // equals signs
+            uint64_t equals = 0;
+
+            // delimiters: SOH, NUL, '|' and '^'
+            uint64_t delimiter = 0;
+        };
+
+        // classify up to BLOCK_SIZE bytes, one byte at a time
+        void classify_scalar(const char *data, const size_t size, block_masks &masks)
+        {
+            masks = block_masks();
+
+            for (size_t i = 0; i < size && i < BLOCK_SIZE; ++i)
+            {
+                const uint64_t bit = (static_cast<uint64_t>(1) << i);
+
+                switch (data[i])
+                {
+                    case '=':
+                        masks.equals |= bit;
+                        break;
+                    case 0x01:
+                    case 0x00:
+                    case '|':
+                    case '^':
+                        masks.delimiter |= bit;
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+
+#if defined(RDA_SIMD_X86)
+        // classify exactly BLOCK_SIZE bytes, 16 at a time
+        RDA_TARGET_SSE2 void classify_sse2(const char *data, block_masks &masks)
+        {
+            masks = block_masks();
+
+            for (size_t i = 0; i < BLOCK_SIZE; i += 16)
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+
+                const __m128i equals = _mm_cmpeq_epi8(v, _mm_set1_epi8('='));
+                const __m128i delimiter =
+                    _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(0x01)), _mm_cmpeq_epi8(v, _mm_setzero_si128())),
+                                 _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('|')), _mm_cmpeq_epi8(v, _mm_set1_epi8('^'))));
+
+                masks.equals |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(equals))) << i;
+                masks.delimiter |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(delimiter))) << i;
+            }
+        }
+
+        // classify exactly BLOCK_SIZE bytes, 32 at a time
+        RDA_TARGET_AVX2 void classify_avx2(const char *data, block_masks &masks)
+        {
+            masks = block_masks();
+
+            for (size_t i = 0; i < BLOCK_SIZE; i += 32)
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+
+                const __m256i equals = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('='));
+                const __m256i delimiter =
+                    _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(0x01)), _mm256_cmpeq_epi8(v, _mm256_setzero_si256())),
+                                    _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('|')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('^'))));
+
+                masks.equals |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(equals))) << i;
+                masks.delimiter |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(delimiter))) << i;
+            }
+        }
+#endif
+
+        // classify up to BLOCK_SIZE bytes, using the given instruction set. data must be
+        // readable for BLOCK_SIZE bytes, but bytes past size are not in any class.
+        void classify(const char *data, const size_t size, block_masks &masks, const simd::instruction_set is)
+        {
+#if defined(RDA_SIMD_X86)
+            if (is != simd::instruction_set::IS_SCALAR)
+            {
+                if (is == simd::instruction_set::IS_AVX2)
+                    classify_avx2(data, masks);
+                else
+                    classify_sse2(data, masks);
+
+                if (size < BLOCK_SIZE)
+                {
+                    const uint64_t valid = (static_cast<uint64_t>(1) << size) - 1;
+                    masks.equals &= valid;
+                    masks.delimiter &= valid;
+                }
+
+                return;
+            }
+#endif
+            static_cast<void>(is); // unused without simd
+            classify_scalar(data, size, masks);
+        }
+
+        // returns the tag number of the leading digits of a tag, of up to nine digits (the
+        // same as the tag read one character at a time)
+        uint32_t decode_tag_digits(const char *p, const size_t length)
+        {
+            uint32_t tag = 0;
+
+            for (size_t i = 0; i < length && p[i] >= '0' && p[i] <= '9' && tag < 100000000; ++i)
+                tag = tag * 10 + static_cast<uint32_t>(p[i] - '0');
+
+            return tag;
+        }
+
+        // returns the tag number of a tag of a known length. a tag of up to eight digits is
+        // decoded all at once, as the eight bytes of an integer. p must be readable for eight
+        // bytes.
+        uint32_t decode_tag(const char *p, const size_t length)
+        {
+#if !(defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+            if (length > 0 && length <= 8)
+            {
+                constexpr uint64_t ZEROS = 0x3030303030303030ULL;
+
+                // the tag, right aligned, with '0' characters in front of it
+                uint64_t x;
+                std::memcpy(&x, p, sizeof(x));
+
+                const unsigned int shift = static_cast<unsigned int>(8 - length) * 8;
+                x <<= shift;
+                if (shift != 0)
+                    x |= (ZEROS >> (64 - shift));
+
+                // every byte must be a digit
+                if ((x & 0xF0F0F0F0F0F0F0F0ULL) == ZEROS && ((x + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) == ZEROS)
+                {
+                    x -= ZEROS;
+
+                    // combine pairs of digits, then pairs of those, then the two halves
+                    x = (x * 10 + (x >> 8)) & 0x00FF00FF00FF00FFULL;
+                    x = (x * 100 + (x >> 16)) & 0x0000FFFF0000FFFFULL;
+                    x = (x * 10000 + (x >> 32)) & 0x00000000FFFFFFFFULL;
+                    return static_cast<uint32_t>(x);
+                }
+            }
+#endif
+            return decode_tag_digits(p, length);
+        }
+
+        // read an integer value (an optional '-' and digits). returns false if the value is
+        // empty, has any other characters, or does not fit in 64 bits.
+        bool parse_int(const char *p, const size_t length, int64_t &value)
+        {
+            size_t i = 0;
+            const bool negative = (length > 0 && p[0] == '-');
+            if (negative)
+                ++i;
+
+            if (i == length)
+                return false;
+
+            // accumulate as a negative number, which has room for the most negative value
+            int64_t result = 0;
+            for (; i < length; ++i)
+            {
+                if (p[i] < '0' || p[i] > '9')
+                    return false;
+
+                const int64_t digit = p[i] - '0';
+                if (result < (INT64_MIN + digit) / 10)
+                    return false;
+
+                result = result * 10 - digit;
+            }
+
+            if (!negative && result == INT64_MIN)
+                return false;
+
+            value = (negative ? result : -result);
+            return true;
+        }
+
+        // read a decimal value (an optional sign, digits, and an optional '.' and more digits)
+        // exactly, without converting it to binary floating point. returns false if the value
+        // is not a decimal number, or has more digits than fit in 64 bits.
+        bool parse_decimal(const char *p, const size_t length, fix_decimal &value)
+        {
+            size_t i = 0;
+            const bool sign = (length > 0 && (p[0] == '-' || p[0] == '+'));
+            const bool negative = (sign && p[0] == '-');
+            if (sign)
+                ++i;
+
+            int64_t mantissa = 0;
+            int32_t exponent = 0;
+            bool point = false;
+            bool digits = false;
+
+            for (; i < length; ++i)
+            {
+                const char c = p[i];
+
+                if (c == '.' && !point)
+                {
+                    point = true;
+                    continue;
+                }
+
+                if (c < '0' || c > '9')
+                    return false;
+
+                if (mantissa > (INT64_MAX - (c - '0')) / 10)
+                    return false;
+
+                mantissa = mantissa * 10 + (c - '0');
+                digits = true;
+
+                if (point)
+                    --exponent;
+            }
+
+            if (!digits)
+                return false;
+
+            value.mantissa = (negative ? -mantissa : mantissa);
+            value.exponent = exponent;
+            return true;
+        }
+
+        // read a fixed number of digits as a number. returns false if any is not a digit.
+        bool parse_digits(const char *p, const size_t count, int32_t &value)
+        {
+            int32_t result = 0;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (p[i] < '0' || p[i] > '9')
+                    return false;
+
+                result = result * 10 + (p[i] - '0');
+            }
+
+            value = result;
+            return true;
+        }
+
+        // read a UTCTimestamp value: YYYYMMDD-HH:MM:SS, with an optional fraction of a second
+        // of up to nine digits (usually milliseconds, microseconds or nanoseconds). returns
+        // false if the value is not a valid timestamp.
+        bool parse_utc_timestamp(const char *p, const size_t length, fix_timestamp &value)
+        {
+            constexpr size_t SECONDS_LENGTH = 17;
+
+            if (length < SECONDS_LENGTH || p[8] != '-' || p[11] != ':' || p[14] != ':')
+                return false;
+
+            fix_timestamp t;
+
+            if (!parse_digits(p, 4, t.year) || !parse_digits(p + 4, 2, t.month) || !parse_digits(p + 6, 2, t.day) ||
+                !parse_digits(p + 9, 2, t.hour) || !parse_digits(p + 12, 2, t.minute) || !parse_digits(p + 15, 2, t.second))
+                return false;
+
+            // the number of days in each month (february is checked for leap years below)
+            constexpr int32_t DAYS_IN_MONTH[12] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+            if (t.month < 1 || t.month > 12 || t.day < 1 || t.day > DAYS_IN_MONTH[t.month - 1] || t.hour > 23 || t.minute > 59 ||
+                t.second > 60)
+                return false;
+
+            const bool leap = ((t.year % 4 == 0 && t.year % 100 != 0) || t.year % 400 == 0);
+            if (t.month == 2 && t.day == 29 && !leap)
+                return false;
+
+            // the fraction of a second, scaled to nanoseconds
+            if (length > SECONDS_LENGTH)
+            {
+                const size_t fraction = length - SECONDS_LENGTH - 1;
+
+                if (p[SECONDS_LENGTH] != '.' || fraction == 0 || fraction > 9 ||
+                    !parse_digits(p + SECONDS_LENGTH + 1, fraction, t.nanosecond))
+                    return false;
+
+                for (size_t i = fraction; i < 9; ++i)
+                    t.nanosecond *= 10;
+            }
+
+            value = t;
+            return true;
+        }
+
+        // a vector that keeps its first N elements inline, and only allocates beyond that
+        template <typename T, size_t N>
+        class inline_vector
+        {
+        private:
+            // storage for the first N elements
+            T local[N];
+
+            // storage for all of the elements, once there are more than N
+            std::vector<T> heap;
+
+            // the elements (in local or heap)
+            T *items = local;
+
+            // number of elements
+            size_t count = 0;
+
+        public:
+            inline_vector() = default;
+            inline_vector(const inline_vector &) = delete;
+            inline_vector &operator=(const inline_vector &) = delete;
+
+            // add an element to the end
+            void push_back(const T &t)
+            {
+                if (count < N)
+                {
+                    local[count++] = t;
+                    return;
+                }
+
+                // move the elements to the heap, once there are more than fit inline
+                if (count == N)
+                    heap.assign(local, local + N);
+
+                heap.push_back(t);
+                items = heap.data();
+                ++count;
+            }
+
+            // remove the elements past the first n
+            void truncate(const size_t n)
+            {
+                if (n < count)
+                {
+                    count = n;
+                    if (items != local)
+                        heap.resize(n);
+                }
+            }
+
+            T &operator[](const size_t i)
+            {
+                return items[i];
+            }
+
+            const T &operator[](const size_t i) const
+            {
+                return items[i];
+            }
+
+            T &back()
+            {
+                return items[count - 1];
+            }
+
+            const T &back() const
+            {
+                return items[count - 1];
+            }
+
+            T *data()
+            {
+                return items;
+            }
+
+            const T *data() const
+            {
+                return items;
+            }
+
+            size_t size() const
+            {
+                return count;
+            }
+
+            bool empty() const
+            {
+                return (count == 0);
+            }
+        };
+
+    } // namespace fix_helpers
+
     class fix_message
     {
     public:
-        // maximum FIX field id number
+        // highest tag number in the FIX dictionary (messages may have fields with higher tags)
         constexpr static const size_t MAX_FIX_ID = 1139;
 
+        // the position of one field in the message
+        struct field
+        {
+            // the tag number
+            uint32_t tag;
+
+            // offset of the (null terminated) value from the start of the message
+            uint32_t offset;
+
+            // length of the value
+            uint32_t length;
+        };
+
+        // the fields of one instance of a repeating group, in message order (including the
+        // fields of the groups nested in it)
+        class group_instance
+        {
+        private:
+            // the message
+            const fix_message *message = nullptr;
+
+            // the message data
+            const char *buffer = nullptr;
+
+            // the position in the message's groups of the group, and of the instance in the group
+            uint32_t group_index = 0;
+            uint32_t index = 0;
+
+            // the fields of the instance
+            const field *first = nullptr;
+            const field *last = nullptr;
+
+        public:
+            // constructor, of an empty instance
+            group_instance() = default;
+
+            // constructor
+            group_instance(const fix_message *message_, const uint32_t group_index_, const uint32_t index_, const field *first_,
+                           const field *last_)
+                : message(message_), buffer(message_->buffer), group_index(group_index_), index(index_), first(first_), last(last_)
+            {
+            }
+
+            // returns an instance of a repeating group nested in this instance (for example,
+            // group(453, 1).get_field(448) is the PartyID of the second party of a side).
+            // returns an empty instance if there is no such group or instance.
+            group_instance group(const size_t count_tag, const size_t i) const
+            {
+                return (message != nullptr ? message->instance_of(message->find_group(count_tag, group_index, index), i) : group_instance());
+            }
+
+            // returns the number of instances found of a repeating group nested in this instance
+            size_t group_size(const size_t count_tag) const
+            {
+                if (message == nullptr)
+                    return 0;
+
+                const group_entry *g = message->find_group(count_tag, group_index, index);
+                return (g != nullptr ? g->num_instances : 0);
+            }
+
+            // retrieve the first field of the instance with a tag number (nullptr if none)
+            const char *get_field(const size_t tag) const
+            {
+                const field *f = find_field(tag);
+                return (f != nullptr ? buffer + f->offset : nullptr);
+            }
+
+            // retrieve a field as an integer. returns false if the instance does not have the
+            // field, or it is not an integer.
+            bool get_int(const size_t tag, int64_t &value) const
+            {
+                const field *f = find_field(tag);
+                return (f != nullptr && fix_helpers::parse_int(buffer + f->offset, f->length, value));
+            }
+
+            // retrieve a field as an exact decimal (such as a price or quantity)
+            bool get_decimal(const size_t tag, fix_decimal &value) const
+            {
+                const field *f = find_field(tag);
+                return (f != nullptr && fix_helpers::parse_decimal(buffer + f->offset, f->length, value));
+            }
+
+            // retrieve a field of a single character
+            bool get_char(const size_t tag, char &value) const
+            {
+                const field *f = find_field(tag);
+                if (f == nullptr || f->length != 1)
+                    return false;
+
+                value = buffer[f->offset];
+                return true;
+            }
+
+            // retrieve a field as a UTCTimestamp (such as SendingTime or TransactTime)
+            bool get_utc_timestamp(const size_t tag, fix_timestamp &value) const
+            {
+                const field *f = find_field(tag);
+                return (f != nullptr && fix_helpers::parse_utc_timestamp(buffer + f->offset, f->length, value));
+            }
+
+            // returns true if the instance has a field with the tag number
+            bool has_field(const size_t tag) const
+            {
+                return (get_field(tag) != nullptr);
+            }
+
+            // returns the value of a field of this instance
+            const char *value_of(const field &f) const
+            {
+                return buffer + f.offset;
+            }
+
+            // returns the number of fields in the instance
+            size_t size() const
+            {
+                return static_cast<size_t>(last - first);
+            }
+
+            // returns true if the instance has no fields (or does not exist)
+            bool empty() const
+            {
+                return (first == last);
+            }
+
+            // const begin iterator over the fields, in message order
+            const field *begin() const
+            {
+                return first;
+            }
+
+            // const end iterator over the fields, in message order
+            const field *end() const
+            {
+                return last;
+            }
+
+        private:
+            // returns the first field of the instance with a tag number (nullptr if none)
+            const field *find_field(const size_t tag) const
+            {
+                for (const field *f = first; f != last; ++f)
+                    if (f->tag == tag)
+                        return f;
+
+                return nullptr;
+            }
+        };
+
     private:
-        // buffer size to hold content of a fix message
-        const size_t MAX_FIX_BUFFER = 255;
+        // tags below this number are found by a direct lookup (higher tags by a binary search)
+        constexpr static const size_t DENSE_TAGS = 256;
+
+        // number of fields that can be indexed without allocating
+        constexpr static const size_t INLINE_FIELDS = 32;
+
+        // number of fields, instances and repeating groups that can be recorded without allocating
+        constexpr static const size_t INLINE_GROUP_FIELDS = 64;
+        constexpr static const size_t INLINE_INSTANCES = 16;
+        constexpr static const size_t INLINE_GROUPS = 8;
+
+        // the parent of a group that is not nested in another
+        constexpr static const uint32_t NO_GROUP = UINT32_MAX;
+
+        // the CheckSum tag, which always ends a message (and any group in it)
+        constexpr static const uint32_t CHECKSUM_TAG = 10;
 
         // FIX delimiter characters
         const static char SOH = 0x01;
@@ -34,11 +641,57 @@ namespace rda
         const static char CARRET = '^';
         const static char EQUALS = '=';
 
+        // a repeating group, and the position of its instances
+        struct group_entry
+        {
+            // the NumInGroup tag of the group
+            uint32_t count_tag;
+
+            // the number of instances the NumInGroup field gives
+            uint32_t expected;
+
+            // the tag of the first field of each instance
+            uint32_t delimiter;
+
+            // the position in groups of the group this one is nested in (NO_GROUP if none), and
+            // of the instance of that group it is nested in
+            uint32_t parent_group;
+            uint32_t parent_index;
+
+            // position in instances of the first instance, and the number of instances found
+            uint32_t first_instance;
+            uint32_t num_instances;
+
+            // position in instances of the instance being read
+            uint32_t current_instance;
+        };
+
+        // the position in group_fields of the fields of an instance of a repeating group, and
+        // the position in groups of the group
+        struct instance_entry
+        {
+            uint32_t first;
+            uint32_t last;
+            uint32_t group;
+        };
+
         // buffer to store the fix message data
         char *buffer = nullptr;
 
-        // array to index fields of the fix message
-        std::array<const char *, MAX_FIX_ID + 1> data{nullptr};
+        // the fields of the message, sorted by tag number
+        fix_helpers::inline_vector<field, INLINE_FIELDS> fields;
+
+        // one more than the position in fields of each tag below DENSE_TAGS (zero if the tag
+        // is not in the message). the fields are sorted, so these positions are below 256.
+        std::array<uint8_t, DENSE_TAGS> dense{};
+
+        // the fields of the repeating groups, in message order, and the instances and groups
+        fix_helpers::inline_vector<field, INLINE_GROUP_FIELDS> group_fields;
+        fix_helpers::inline_vector<instance_entry, INLINE_INSTANCES> instances;
+        fix_helpers::inline_vector<group_entry, INLINE_GROUPS> groups;
+
+        // the position in groups of the innermost group being read (NO_GROUP if none)
+        uint32_t current_group = NO_GROUP;
 
     public:
         // no default constructor
@@ -53,13 +706,13 @@ namespace rda
         // construct fix_message with string
         fix_message(const std::string &input)
         {
-            init(input.c_str());
+            init(input.c_str(), input.size());
         }
 
         // construct fix_message with const char *
         fix_message(const char *input)
         {
-            init(input);
+            init(input, input != nullptr ? std::strlen(input) : 0);
         }
 
         // destructor
@@ -70,34 +723,102 @@ namespace rda
                 std::free(buffer);
         }
 
-        // retrieve a field
+        // retrieve a field (the last value, if the tag is repeated)
         inline const char *get_field(const size_t field) const
         {
-            if (field > 0 && field <= MAX_FIX_ID)
-                return data[field];
-            return nullptr;
+            const struct field *f = find_field(field);
+            return (f != nullptr ? buffer + f->offset : nullptr);
+        }
+
+        // retrieve a field as an integer, read straight from the message. returns false if the
+        // field is not in the message, or is not an integer.
+        bool get_int(const size_t tag, int64_t &value) const
+        {
+            const field *f = find_field(tag);
+            return (f != nullptr && fix_helpers::parse_int(buffer + f->offset, f->length, value));
+        }
+
+        // retrieve a field as an exact decimal (such as a price or quantity). returns false if
+        // the field is not in the message, or is not a decimal number.
+        bool get_decimal(const size_t tag, fix_decimal &value) const
+        {
+            const field *f = find_field(tag);
+            return (f != nullptr && fix_helpers::parse_decimal(buffer + f->offset, f->length, value));
+        }
+
+        // retrieve a field of a single character (such as Side or OrdType). returns false if
+        // the field is not in the message, or is not one character long.
+        bool get_char(const size_t tag, char &value) const
+        {
+            const field *f = find_field(tag);
+            if (f == nullptr || f->length != 1)
+                return false;
+
+            value = buffer[f->offset];
+            return true;
+        }
+
+        // retrieve a field as a UTCTimestamp (such as SendingTime or TransactTime). returns false
+        // if the field is not in the message, or is not a valid timestamp.
+        bool get_utc_timestamp(const size_t tag, fix_timestamp &value) const
+        {
+            const field *f = find_field(tag);
+            return (f != nullptr && fix_helpers::parse_utc_timestamp(buffer + f->offset, f->length, value));
+        }
+
+        // returns an instance of the repeating group counted by a NumInGroup tag (for example,
+        // group(453, 1).get_field(448) is the PartyID of the second party). returns an empty
+        // instance if there is no such group or instance. a group nested in another (such as
+        // the parties of a side) is found from the instance it is in: group(552, 0).group(453, 1).
+        group_instance group(const size_t count_tag, const size_t index) const
+        {
+            return instance_of(find_group(count_tag, NO_GROUP, 0), index);
+        }
+
+        // returns the number of instances found of the repeating group counted by a NumInGroup tag
+        size_t group_size(const size_t count_tag) const
+        {
+            const group_entry *g = find_group(count_tag, NO_GROUP, 0);
+            return (g != nullptr ? g->num_instances : 0);
+        }
+
+        // returns the number of fields in the message (a repeated tag is counted once)
+        size_t size() const
+        {
+            return fields.size();
+        }
+
+        // returns the value of a field of this message
+        const char *value_of(const field &f) const
+        {
+            return buffer + f.offset;
+        }
+
+        // const begin iterator over the fields, in order of tag number
+        const field *begin() const
+        {
+            return fields.data();
+        }
+
+        // const end iterator over the fields, in order of tag number
+        const field *end() const
+        {
+            return fields.data() + fields.size();
         }
 
         // return string representation of this fix message. caution: not for use in production.
         // this is very slow.
         std::string to_string() const
         {
-            // vector to hold tags and pointers to values
-            std::vector<std::pair<size_t, const char *>> char_ptrs;
-
-            // add all tags and values to the vector
-            for (size_t i = 1; i <= MAX_FIX_ID; ++i)
-                if (data[i] != nullptr)
-                    char_ptrs.emplace_back(std::pair<size_t, const char *>(i, data[i]));
-
-            // sort based on the pointers (to retain original order of the tags)
-            std::sort(char_ptrs.begin(), char_ptrs.end(), [](auto &e1, auto &e2) { return e1.second < e2.second; });
+            // sort the fields based on their offsets (to retain original order of the tags)
+            std::vector<field> ordered(begin(), end());
+            std::sort(ordered.begin(), ordered.end(), [](auto &e1, auto &e2) { return e1.offset < e2.offset; });
 
             std::stringstream ss;
 
             // for each of the tags, build up a fix message string
-            for (auto e : char_ptrs)
-                ss << std::to_string(e.first) << "=" << std::string(e.second) << "|";
+            for (auto &e : ordered)
+                ss << std::to_string(e.tag) << "=" << value_of(e) << "|";
 
             return ss.str();
         }
@@ -115,25 +836,183 @@ namespace rda
             return c == EQUALS;
         }
 
-        // initialize the fix message object
-        inline void init(const char *input)
+        // returns the field with a tag number (nullptr if not found)
+        inline const field *find_field(const size_t tag) const
         {
-            // if input is invalid, bail out immediately
-            if (input == nullptr || is_delim(*input) || is_equals(*input))
+            if (tag < DENSE_TAGS)
+                return (dense[tag] != 0 ? &fields[dense[tag] - 1] : nullptr);
+
+            return find(tag);
+        }
+
+        // returns the field with a tag number, by a binary search (nullptr if not found)
+        const field *find(const size_t tag) const
+        {
+            const field *f = std::lower_bound(begin(), end(), tag, [](const field &e, const size_t t) { return e.tag < t; });
+            return ((f != end() && f->tag == tag) ? f : nullptr);
+        }
+
+        // returns the first repeating group counted by a NumInGroup tag, that is nested in an
+        // instance of another group (or in none, if parent_group is NO_GROUP). returns nullptr
+        // if not found.
+        const group_entry *find_group(const size_t count_tag, const uint32_t parent_group, const uint32_t parent_index) const
+        {
+            for (size_t i = 0; i < groups.size(); ++i)
+                if (groups[i].count_tag == count_tag && groups[i].parent_group == parent_group && groups[i].parent_index == parent_index)
+                    return &groups[i];
+
+            return nullptr;
+        }
+
+        // returns an instance of a repeating group (empty if there is no such group or instance)
+        group_instance instance_of(const group_entry *g, const size_t index) const
+        {
+            if (g == nullptr || index >= g->num_instances)
+                return group_instance();
+
+            const instance_entry &i = instances[g->first_instance + index];
+            return group_instance(this, static_cast<uint32_t>(g - groups.data()), static_cast<uint32_t>(index),
+                                  group_fields.data() + i.first, group_fields.data() + i.last);
+        }
+
+        // returns true if a field with a tag number belongs to a repeating group being read. an
+        // instance starts at each field with the delimiter tag (the first member of the group),
+        // and the group ends at the first tag that is not one of its members (see fix_db).
+        static bool continues_group(const group_entry &g, const uint32_t tag)
+        {
+            if (tag == CHECKSUM_TAG || !fix_db::is_group_member(g.count_tag, tag))
+                return false;
+
+            if (tag == g.delimiter)
+                return (g.num_instances < g.expected);
+
+            return (g.num_instances > 0);
+        }
+
+        // record a field in the repeating groups (the fields are given in message order)
+        inline void add_group_field(const field &f)
+        {
+            // end the groups that the field does not belong to, the innermost first
+            while (current_group != NO_GROUP && !continues_group(groups[current_group], f.tag))
+                current_group = groups[current_group].parent_group;
+
+            if (current_group != NO_GROUP)
+            {
+                group_entry &g = groups[current_group];
+
+                if (f.tag == g.delimiter)
+                {
+                    const uint32_t position = static_cast<uint32_t>(group_fields.size());
+                    g.current_instance = static_cast<uint32_t>(instances.size());
+                    instances.push_back(instance_entry{position, position, current_group});
+                    ++g.num_instances;
+                }
+
+                group_fields.push_back(f);
+
+                // the field is in the current instance of the group, and of each group it is in
+                for (uint32_t i = current_group; i != NO_GROUP; i = groups[i].parent_group)
+                    instances[groups[i].current_instance].last = static_cast<uint32_t>(group_fields.size());
+            }
+
+            // a NumInGroup field, with a count, starts a repeating group (if its members are
+            // known), nested in the instance being read
+            const uint32_t delimiter = static_cast<uint32_t>(fix_db::group_delimiter(f.tag));
+
+            if (delimiter != 0)
+            {
+                uint32_t expected = 0;
+                for (const char *p = buffer + f.offset; *p >= '0' && *p <= '9' && expected < 100000000; ++p)
+                    expected = expected * 10 + static_cast<uint32_t>(*p - '0');
+
+                if (expected > 0)
+                {
+                    const uint32_t parent_index = (current_group != NO_GROUP ? groups[current_group].num_instances - 1 : 0);
+                    groups.push_back(group_entry{f.tag, expected, delimiter, current_group, parent_index,
+                                                 static_cast<uint32_t>(instances.size()), 0, 0});
+                    current_group = static_cast<uint32_t>(groups.size() - 1);
+                }
+            }
+        }
+
+        // the instances of a group are read in message order, so the instances of a group nested
+        // in it come between them. put the instances of each group next to each other.
+        inline void build_group_index()
+        {
+            bool nested = false;
+            for (size_t i = 0; i < groups.size(); ++i)
+                nested = nested || groups[i].parent_group != NO_GROUP;
+
+            if (!nested)
                 return;
 
-            // the length of the fix message data (capped at MAX_FIX_BUFFER)
-            const size_t length = std::min(std::strlen(input), MAX_FIX_BUFFER);
+            std::sort(instances.data(), instances.data() + instances.size(), [](const instance_entry &e1, const instance_entry &e2) {
+                return (e1.group != e2.group ? e1.group < e2.group : e1.first < e2.first);
+            });
 
-            // allocate memory for holding a copy of the message data
-            buffer = static_cast<char *>(std::malloc(length + 1));
+            uint32_t position = 0;
+            for (size_t i = 0; i < groups.size(); ++i)
+            {
+                groups[i].first_instance = position;
+                position += groups[i].num_instances;
+            }
+        }
 
-            // copy the fix mesage data
-            std::memcpy(buffer, input, length);
+        // sort the fields by tag number (keeping the last value of a repeated tag), and index
+        // the low tags
+        inline void build_index(const bool sorted)
+        {
+            const size_t num_fields = fields.size();
+
+            if (!sorted)
+            {
+                field *const f = fields.data();
+
+                // an insertion sort, without allocating, for the usual short message
+                if (num_fields <= INLINE_FIELDS)
+                {
+                    for (size_t i = 1; i < num_fields; ++i)
+                    {
+                        const field e = f[i];
+                        size_t j = i;
+                        for (; j > 0 && f[j - 1].tag > e.tag; --j)
+                            f[j] = f[j - 1];
+                        f[j] = e;
+                    }
+                }
+                else
+                    std::stable_sort(f, f + num_fields, [](const field &e1, const field &e2) { return e1.tag < e2.tag; });
 
-            // null terminate the fix message
-            buffer[length] = '\0';
+                size_t out = 0;
+                for (size_t i = 0; i < num_fields; ++i)
+                {
+                    if (out > 0 && f[out - 1].tag == f[i].tag)
+                        f[out - 1] = f[i];
+                    else
+                        f[out++] = f[i];
+                }
 
+                fields.truncate(out);
+            }
+
+            for (size_t i = 0; i < fields.size() && fields[i].tag < DENSE_TAGS; ++i)
+                dense[fields[i].tag] = static_cast<uint8_t>(i + 1);
+        }
+
+        // record a field read from the message
+        inline void add_parsed_field(const uint32_t tag, const char *dataStart, const char *dataEnd, bool &sorted)
+        {
+            if (!fields.empty() && fields.back().tag >= tag)
+                sorted = false;
+
+            const field f{tag, static_cast<uint32_t>(dataStart - buffer), static_cast<uint32_t>(dataEnd - dataStart)};
+            fields.push_back(f);
+            add_group_field(f);
+        }
+
+        // read the fields of the message one character at a time
+        inline void read_fields_scalar(const size_t length, bool &sorted)
+        {
             // pointer to the end of the data buffer
             const char *const end = buffer + length;
 
@@ -155,9 +1034,17 @@ namespace rda
                 // first character should be the start of a field
                 fieldEnd = fieldStart;
 
-                // increment fieldEnd until the '=' is found, to find the end of the field
-                while (!is_equals(*fieldEnd) && fieldEnd < end)
+                // increment fieldEnd until the '=' is found, converting the leading digits of the
+                // field to an integer on the way
+                uint32_t field = 0;
+                bool digits = true;
+                while (fieldEnd < end && !is_equals(*fieldEnd))
+                {
+                    digits = digits && *fieldEnd >= '0' && *fieldEnd <= '9' && field < 100000000;
+                    if (digits)
+                        field = field * 10 + static_cast<uint32_t>(*fieldEnd - '0');
                     ++fieldEnd;
+                }
 
                 if (fieldEnd < end)
                     *fieldEnd = EOL;
@@ -167,25 +1054,104 @@ namespace rda
                 dataEnd = dataStart;
 
                 // increment the dataEnd until the next FIX delimiter is found
-                while (!is_delim(*dataEnd) && dataEnd < end)
+                while (dataEnd < end && !is_delim(*dataEnd))
                     ++dataEnd;
 
                 // change the delimiter to a "end of line" terminator (for quicker access of string lookups when retrieving fields)
                 if (dataEnd < end)
                     *dataEnd = EOL;
 
-                // conver the field to an integer type
-                auto field = static_cast<size_t>(atoi(fieldStart));
-
-                // if the field number is a valid FIX field ID number
-                if (field > 0 && field <= MAX_FIX_ID)
-                    // store the address of the start of data, in the data at the 'field' idnex
-                    data[field] = dataStart;
+                // if the field number is valid (and the field has an '='), store the position of its data
+                if (field > 0 && dataStart <= end)
+                    add_parsed_field(field, dataStart, dataEnd, sorted);
 
                 // increment the pointer, for the next time through the loop
                 fieldStart = dataEnd + 1;
             }
         }
+
+        // read the fields of the message a block at a time: each block is classified with simd
+        // instructions, and the '=' and delimiter positions are found from the bits of its masks
+        inline void read_fields_blocks(const size_t length, const simd::instruction_set is, bool &sorted)
+        {
+            fix_helpers::block_masks masks;
+            size_t block = length;
+
+            // returns the position of the next '=' (or delimiter) at or after pos (or length)
+            const auto next = [&](size_t pos, const bool equals) {
+                while (pos < length)
+                {
+                    const size_t start = pos - (pos % fix_helpers::BLOCK_SIZE);
+                    if (start != block)
+                    {
+                        fix_helpers::classify(buffer + start, std::min(fix_helpers::BLOCK_SIZE, length - start), masks, is);
+                        block = start;
+                    }
+
+                    const uint64_t bits = (equals ? masks.equals : masks.delimiter) >> (pos - start);
+                    if (bits != 0)
+                        return pos + simd::trailing_zeros(bits);
+
+                    pos = start + fix_helpers::BLOCK_SIZE;
+                }
+
+                return length;
+            };
+
+            size_t fieldStart = 0;
+
+            while (fieldStart < length)
+            {
+                const size_t fieldEnd = next(fieldStart, true);
+
+                // a field without an '=' ends the message
+                if (fieldEnd == length)
+                    break;
+
+                const uint32_t field = fix_helpers::decode_tag(buffer + fieldStart, fieldEnd - fieldStart);
+                const size_t dataEnd = next(fieldEnd + 1, false);
+
+                // the masks of a block are found before any of its characters are changed
+                buffer[fieldEnd] = EOL;
+                buffer[dataEnd] = EOL;
+
+                if (field > 0)
+                    add_parsed_field(field, buffer + fieldEnd + 1, buffer + dataEnd, sorted);
+
+                fieldStart = dataEnd + 1;
+            }
+        }
+
+        // initialize the fix message object
+        inline void init(const char *input, const size_t length)
+        {
+            // if input is invalid, bail out immediately
+            if (input == nullptr || is_delim(*input) || is_equals(*input))
+                return;
+
+            // allocate memory for holding a copy of the message data, with a block of padding
+            // after it, so that whole blocks can be read by the simd instructions
+            buffer = static_cast<char *>(std::malloc(length + 1 + fix_helpers::BLOCK_SIZE));
+
+            // copy the fix mesage data
+            std::memcpy(buffer, input, length);
+
+            // null terminate the fix message (and clear the padding)
+            std::memset(buffer + length, 0, 1 + fix_helpers::BLOCK_SIZE);
+
+            // true while the tags are in ascending order, with no repeats
+            bool sorted = true;
+
+            const simd::instruction_set is = simd::get_instruction_set();
+
+            if (is == simd::instruction_set::IS_SCALAR)
+                read_fields_scalar(length, sorted);
+            else
+                read_fields_blocks(length, is, sorted);
+
+            build_index(sorted);
+            build_group_index();
+        }
     }; // class fix_message
 
 } // namespace rda
@@ -10,11 +10,11 @@
 #include <iostream>
 #include <map>
 #include <string>
+#include <string_view>
 
 #include "algorithm_rda.h"
 #include "fix_db.h"
 #include "fix_message.h"
-#include "json.h"
 #include "platform_defs.h"
 
 PUSH_WARN_DISABLE
@@ -27,14 +27,9 @@ namespace rda
         class fix_message_util
         {
         private:
-            // the parsed json data, containing definitions of fix messages
-            std::shared_ptr<rda::json::node_object> fix_data;
-
-            // private constructor
-            fix_message_util()
-            {
-                fix_data = rda::json::parse(rda::fix_db::get());
-            }
+            // private constructor. the dictionary is a set of compile time tables in fix_db,
+            // so there is nothing to load.
+            fix_message_util() = default;
 
         public:
             // singleton object does not allow copy
@@ -54,15 +49,15 @@ namespace rda
             }
 
             // return the name of a FIX tag
-            std::string tag_name(const size_t tag) const
+            std::string_view tag_name(const size_t tag) const
             {
-                return fix_data->get_string_by_path("tags/" + std::to_string(tag));
+                return fix_db::tag_name(tag);
             }
 
             // return the name of a FIX field, relating to a FIX tag
-            std::string field_name(const size_t tag, const std::string &field) const
+            std::string_view field_name(const size_t tag, const std::string_view field) const
             {
-                return fix_data->get_string_by_path("fields/" + std::to_string(tag) + "/" + field);
+                return fix_db::field_name(tag, field);
             }
 
             // print out a fix message in long, multi-line, human readable format
@@ -99,28 +94,23 @@ namespace rda
                 if (print_orig_msg)
                     std::cout << fm.to_string() << std::endl;
 
-                // iterate over fix fields
-                for (size_t i = 1; i <= fix_message::MAX_FIX_ID; ++i)
+                // iterate over fix fields, in order of tag number
+                for (const auto &f : fm)
                 {
+                    const size_t i = f.tag;
+
                     // if we aren't filtering tags, or if the tag is in the filtered_tags whitelist
                     if (!filtered || rda::algorithm_rda::contains(filtered_tags, i))
                     {
-                        // attampt to get the field data
-                        const char *field_data = fm.get_field(i);
-
-                        // if the field data exists for this tag number
-                        if (field_data != nullptr)
-                        {
-                            // extract info about the tag and field
-                            const std::string field_data_str(field_data);
-                            const std::string tag_desc = tag_name(i);
-                            const std::string field_desc = field_name(i, field_data_str);
-
-                            if (field_desc.empty())
-                                std::cout << "[" << i << " : " << tag_desc << "] = " << field_data_str << std::endl;
-                            else
-                                std::cout << "[" << i << " : " << tag_desc << "] = " << field_data_str << " [" << field_desc << "]" << std::endl;
-                        }
+                        // extract info about the tag and field
+                        const std::string field_data_str(fm.value_of(f));
+                        const std::string_view tag_desc = tag_name(i);
+                        const std::string_view field_desc = field_name(i, field_data_str);
+
+                        if (field_desc.empty())
+                            std::cout << "[" << i << " : " << tag_desc << "] = " << field_data_str << std::endl;
+                        else
+                            std::cout << "[" << i << " : " << tag_desc << "] = " << field_data_str << " [" << field_desc << "]" << std::endl;
                     }
                 }
             }
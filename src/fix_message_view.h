@@ -0,0 +1,280 @@
+#pragma once
+
+//
+// fix_message_view.h - Zero-copy view of a FIX message in a caller's buffer. The message is
+//  parsed in place, without copying or changing it, and the view records the offset and
+//  length of each field. A view holds no heap memory, so one can be allocated up front and
+//  re-used for every message read (for example, straight out of a ring buffer). The buffer
+//  must outlive any use of the view, or of the values returned from it.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace rda
+{
+    // helpers for reading FIX messages
+    namespace fix_helpers
+    {
+        // table of the characters that end a value: SOH, NUL, '|' and '^'
+        struct delimiter_table
+        {
+            bool is[256];
+
+            constexpr delimiter_table()
+                : is{}
+            {
+                is[0x01] = true;
+                is[0x00] = true;
+                is[static_cast<unsigned char>('|')] = true;
+                is[static_cast<unsigned char>('^')] = true;
+            }
+        };
+
+        constexpr static const delimiter_table DELIMITERS{};
+
+    } // namespace fix_helpers
+
+    class fix_message_view
+    {
+    public:
+        // maximum number of fields recorded from one message
+        constexpr static const size_t MAX_FIELDS = 512;
+
+        // highest tag number found by a direct lookup (higher tags are searched for)
+        constexpr static const size_t MAX_INDEXED_TAG = 1139;
+
+        // the position of one field in the message
+        struct field
+        {
+            // the tag number
+            uint32_t tag = 0;
+
+            // offset of the value from the start of the message
+            uint32_t offset = 0;
+
+            // length of the value
+            uint32_t length = 0;
+        };
+
+    private:
+        // FIX delimiter characters
+        constexpr static const char PIPE = '|';
+        constexpr static const char EQUALS = '=';
+
+        // the message
+        std::string_view message;
+
+        // the fields, in the order they appear in the message
+        std::array<field, MAX_FIELDS> fields{};
+
+        // number of fields recorded
+        size_t num_fields = 0;
+
+        // one more than the position in fields of the first field with each tag number (zero
+        // if the tag is not in the message)
+        std::array<uint16_t, MAX_INDEXED_TAG + 1> index{};
+
+        // true if the message had more than MAX_FIELDS fields
+        bool truncated = false;
+
+    public:
+        // constructor, of an empty view
+        fix_message_view() = default;
+
+        // constructor, parsing a message
+        explicit fix_message_view(const std::string_view input)
+        {
+            parse(input);
+        }
+
+        // constructor, parsing a message
+        fix_message_view(const char *input, const size_t length)
+        {
+            parse(std::string_view(input, length));
+        }
+
+        // parse a message, replacing the one viewed before. returns false if the message had
+        // more fields than can be recorded (the fields after MAX_FIELDS are not recorded).
+        bool parse(const std::string_view input)
+        {
+            clear();
+            message = input;
+
+            const char *const begin = input.data();
+            const char *const end = begin + input.size();
+            const char *p = begin;
+
+            const bool *const is_delim = fix_helpers::DELIMITERS.is;
+            field *const out = fields.data();
+            uint16_t *const first = index.data();
+
+            while (p < end)
+            {
+                // read the tag number, up to the equals sign
+                uint32_t tag = 0;
+                bool numeric = true;
+
+                while (p < end && *p != EQUALS && !is_delim[static_cast<unsigned char>(*p)])
+                {
+                    if (*p >= '0' && *p <= '9' && tag < 100000000)
+                        tag = tag * 10 + static_cast<uint32_t>(*p - '0');
+                    else
+                        numeric = false;
+                    ++p;
+                }
+
+                if (p == end)
+                    break;
+
+                // a field without an equals sign has no value
+                if (*p != EQUALS)
+                {
+                    ++p;
+                    continue;
+                }
+
+                const char *value = ++p;
+
+                while (p < end && !is_delim[static_cast<unsigned char>(*p)])
+                    ++p;
+
+                if (numeric && tag != 0)
+                {
+                    if (num_fields == MAX_FIELDS)
+                    {
+                        truncated = true;
+                        return false;
+                    }
+
+                    field &f = out[num_fields++];
+                    f.tag = tag;
+                    f.offset = static_cast<uint32_t>(value - begin);
+                    f.length = static_cast<uint32_t>(p - value);
+
+                    if (tag <= MAX_INDEXED_TAG && first[tag] == 0)
+                        first[tag] = static_cast<uint16_t>(num_fields);
+                }
+
+                // skip the delimiter
+                if (p < end)
+                    ++p;
+            }
+
+            return true;
+        }
+
+        // forget the message viewed
+        void clear()
+        {
+            // only the index entries that were set need to be cleared
+            for (size_t i = 0; i < num_fields; ++i)
+                if (fields[i].tag <= MAX_INDEXED_TAG)
+                    index[fields[i].tag] = 0;
+
+            message = std::string_view();
+            num_fields = 0;
+            truncated = false;
+        }
+
+        // returns the value of the first field with a tag number (empty if it is not in the
+        // message)
+        std::string_view get_field(const size_t tag) const
+        {
+            const field *f = find(tag);
+            return (f != nullptr ? value_of(*f) : std::string_view());
+        }
+
+        // returns true if the message has a field with the tag number
+        bool has_field(const size_t tag) const
+        {
+            return (find(tag) != nullptr);
+        }
+
+        // returns the number of fields recorded
+        size_t size() const
+        {
+            return num_fields;
+        }
+
+        // returns true if no fields were recorded
+        bool empty() const
+        {
+            return (num_fields == 0);
+        }
+
+        // access a field by its position in the message
+        const field &operator[](const size_t position) const
+        {
+            return fields[position];
+        }
+
+        // returns the value of a field of this message
+        std::string_view value_of(const field &f) const
+        {
+            return message.substr(f.offset, f.length);
+        }
+
+        // returns the message viewed
+        std::string_view get_message() const
+        {
+            return message;
+        }
+
+        // returns true if the message had more fields than could be recorded
+        bool is_truncated() const
+        {
+            return truncated;
+        }
+
+        // const begin iterator over the fields
+        const field *begin() const
+        {
+            return fields.data();
+        }
+
+        // const end iterator over the fields
+        const field *end() const
+        {
+            return fields.data() + num_fields;
+        }
+
+        // return string representation of this fix message, with '|' delimiters
+        std::string to_string() const
+        {
+            std::string s;
+
+            for (const field &f : *this)
+            {
+                s += std::to_string(f.tag);
+                s += EQUALS;
+                s += value_of(f);
+                s += PIPE;
+            }
+
+            return s;
+        }
+
+    private:
+
+        // returns the first field with a tag number (nullptr if it is not in the message)
+        const field *find(const size_t tag) const
+        {
+            if (tag <= MAX_INDEXED_TAG)
+                return (index[tag] != 0 ? &fields[index[tag] - 1] : nullptr);
+
+            for (size_t i = 0; i < num_fields; ++i)
+                if (fields[i].tag == tag)
+                    return &fields[i];
+
+            return nullptr;
+        }
+
+    }; // class fix_message_view
+
+} // namespace rda
@@ -8,16 +8,31 @@
 // 2020-05-02
 //
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "algorithm_rda.h"
 #include "platform_defs.h"
+#include "simd_rda.h"
 
 PUSH_WARN_DISABLE
 WARN_DISABLE_GCC("-Wunused-function")
@@ -171,115 +186,275 @@ namespace rda
 
         } // namespace data_validator_helpers
 
-        // methods for determining and validating json data types
-        namespace data_validators
+        // helper methods for classifying and converting the text of json numbers in a single
+        // pass, eight digits at a time where possible
+        namespace number_helpers
         {
-            // returns true if input represents a null json type
-            bool is_type_null(const std::string &input)
+            // powers of ten that are exactly representable as a double
+            constexpr static const double EXACT_POWERS_OF_TEN[] = {
+                1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+            // most significant digits of a float that are converted without rounding error
+            constexpr static const size_t MAX_EXACT_FLOAT_DIGITS = 15;
+
+            // most digits of an integer that can not overflow an int64_t
+            constexpr static const size_t MAX_EXACT_INTEGER_DIGITS = 18;
+
+            // returns true if the character is a decimal digit
+            constexpr bool is_digit(const char c)
             {
-                return (input == "null");
+                return (c >= '0' && c <= '9');
             }
 
-            // returns true if input represents a boolean json type
-            bool is_type_boolean(const std::string &input)
+            // returns true if the character is an exponent marker
+            constexpr bool is_exponent(const char c)
             {
-                return (input == "true" || input == "false");
+                return (c == 'e' || c == 'E');
             }
 
-            // returns true if input represents an integer number json type
-            bool is_type_integer(const std::string &input)
+            // load eight characters as a little endian 64 bit integer
+            uint64_t load_eight(const char *p)
             {
-                const std::vector<char> INTEGER_START_CHARS = {
-                    '-', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
-                const std::vector<char> INTEGER_REMAINING_CHARS = {
-                    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
+                uint64_t v = 0;
+                std::memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+                v = __builtin_bswap64(v);
+#endif
+                return v;
+            }
 
-                if (input == "0" || input == "-0")
-                    return true;
+            // returns true if all eight characters (loaded by load_eight) are digits
+            constexpr bool is_eight_digits(const uint64_t v)
+            {
+                return ((((v & 0xF0F0F0F0F0F0F0F0ULL) | (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+                         0x3333333333333333ULL));
+            }
 
-                if (input.empty())
-                    return false;
+            // returns the value of eight digits (loaded by load_eight), combining adjacent
+            // pairs of digits, then pairs of pairs, then pairs of those
+            constexpr uint64_t parse_eight_digits(uint64_t v)
+            {
+                v = ((v & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+                v = ((v & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+                return ((v & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+            }
 
-                if (!data_validator_helpers::starts_with(input, INTEGER_START_CHARS, 0))
-                    return false;
+            // read the digits starting at p into value, and move p past them. returns the
+            // number of digits read. value wraps around if there are more than 19 digits.
+            size_t read_digits(const char *&p, const char *const end, uint64_t &value)
+            {
+                const char *const start = p;
 
-                if (!data_validator_helpers::all_chars_match(input, INTEGER_REMAINING_CHARS,
-                                                             1))
-                    return false;
+                while (end - p >= 8)
+                {
+                    const uint64_t v = load_eight(p);
+                    if (!is_eight_digits(v))
+                        break;
 
-                return true;
+                    value = value * 100000000ULL + parse_eight_digits(v);
+                    p += 8;
+                }
+
+                while (p < end && is_digit(*p))
+                    value = value * 10 + static_cast<uint64_t>(*p++ - '0');
+
+                return static_cast<size_t>(p - start);
             }
 
-            // returns true if input represents a floating point number json type
-            bool is_type_float(const std::string &input)
+            // what the text of a token can be read as
+            struct number_class
             {
-                const std::vector<char> E_CHARS = {'e', 'E'};
-                const std::vector<char> DIGIT_CHARS = {'0', '1', '2', '3', '4',
-                                                              '5', '6', '7', '8', '9'};
-                const std::vector<char> DIGIT_OR_E = {'0', '1', '2', '3', '4', '5',
-                                                             '6', '7', '8', '9', 'e', 'E'};
-                const std::vector<char> FLOAT_START_CHARS = {
-                    '-', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
-                const std::vector<char> FLOAT_CHARS = {
-                    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '-', '.', 'e', 'E'};
-
-                // empty tokens are not floating point numbers
-                if (input.empty())
-                    return false;
+                // true if it is an integer
+                bool integer = false;
 
-                // floating point numbers must start with an appropriate character
-                if (!data_validator_helpers::starts_with(input, FLOAT_START_CHARS, 0))
-                    return false;
+                // true if it is a floating point number (integers usually are too)
+                bool floating = false;
+            };
 
-                // if the token starts with a zero, the next character must be the decimal
-                // point, followed by a digit or 'e'
-                if (data_validator_helpers::starts_with(input, '0', 0))
-                    if (!data_validator_helpers::starts_with(input, '.', 1))
-                        if (!data_validator_helpers::starts_with(input, DIGIT_OR_E, 2))
-                            return false;
+            // scan the text of a token once, to find whether it is an integer or a floating
+            // point number. the rules are those that the data validators have always applied.
+            number_class scan(const std::string_view s)
+            {
+                number_class result;
+                const size_t n = s.size();
 
-                // if any invalid characters are encountered, not a float
-                if (!data_validator_helpers::all_chars_match(input, FLOAT_CHARS, 0))
-                    return false;
+                if (n == 0 || (s[0] != '-' && !is_digit(s[0])))
+                    return result;
 
-                // must contain at least one digit
-                if (data_validator_helpers::count_matches(input, DIGIT_CHARS, 0) == 0)
-                    return false;
+                size_t digits = 0;
+                size_t minus_signs = 0;
+                size_t dots = 0;
+                size_t exponents = 0;
+                size_t dot_pos = 0;
+                size_t exponent_pos = 0;
+                size_t late_minus_pos = std::string_view::npos;
 
-                const size_t minus_sign_count =
-                    data_validator_helpers::count_matches(input, '-', 0);
-                const size_t dot_count = data_validator_helpers::count_matches(input, '.', 0);
-                const size_t e_count =
-                    data_validator_helpers::count_matches(input, E_CHARS, 0);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    const char c = s[i];
 
-                // must not contain more than two minus signs
-                if (minus_sign_count > 2)
-                    return false;
+                    if (is_digit(c))
+                    {
+                        ++digits;
+                    }
+                    else if (c == '-')
+                    {
+                        if (i >= 2 && late_minus_pos == std::string_view::npos)
+                            late_minus_pos = i;
+                        ++minus_signs;
+                    }
+                    else if (c == '.')
+                    {
+                        if (dots++ == 0)
+                            dot_pos = i;
+                    }
+                    else if (is_exponent(c))
+                    {
+                        if (exponents++ == 0)
+                            exponent_pos = i;
+                    }
+                    else
+                    {
+                        return result;
+                    }
+                }
 
-                // if one minus sign, it must be the first character
-                if (minus_sign_count == 1)
-                    if (!data_validator_helpers::starts_with(input, '-', 0))
-                        return false;
+                // a minus sign or a non-zero digit, followed by only digits (or just a zero)
+                result.integer = (dots == 0 && exponents == 0 && minus_signs == (s[0] == '-' ? 1u : 0u) &&
+                                  (s[0] != '0' || n == 1));
 
-                // if two minus signs, the second one must be preceded by an 'e'
-                if (minus_sign_count == 2)
-                    if (!data_validator_helpers::immediately_preceeds(input, '-', E_CHARS, 2))
-                        return false;
+                // a leading zero must be followed by a dot, or have a digit or an 'e' after it
+                if (s[0] == '0' && !(n > 1 && s[1] == '.') && !(n > 2 && (is_digit(s[2]) || is_exponent(s[2]))))
+                    return result;
 
-                // must not contain more than one dot
-                if (dot_count > 1)
-                    return false;
+                if (digits == 0 || dots > 1 || exponents > 1 || minus_signs > 2)
+                    return result;
 
-                // must not contain more than one 'e'
-                if (e_count > 1)
-                    return false;
+                // one minus sign must be the first character, and a second one must come just
+                // before the 'e'
+                if (minus_signs == 1 && s[0] != '-')
+                    return result;
 
-                // if there is both a dot and an e, the dot must come before the 'e'
-                if (dot_count == 1 && e_count == 1)
-                    if (!data_validator_helpers::preceeds(input, '.', E_CHARS, 0))
-                        return false;
+                if (minus_signs == 2 && (late_minus_pos == std::string_view::npos || late_minus_pos + 1 >= n ||
+                                         !is_exponent(s[late_minus_pos + 1])))
+                    return result;
 
-                return true;
+                // the dot must come before the 'e'
+                if (dots == 1 && exponents == 1 && dot_pos > exponent_pos)
+                    return result;
+
+                result.floating = true;
+                return result;
+            }
+
+            // classify the text of an unquoted token as JDT_INTEGER, JDT_FLOAT, or JDT_UNDEFINED
+            // if it is not a number
+            JsonDataType classify(const std::string_view s)
+            {
+                const number_class c = scan(s);
+
+                if (c.integer)
+                    return JsonDataType::JDT_INTEGER;
+
+                if (c.floating)
+                    return JsonDataType::JDT_FLOAT;
+
+                return JsonDataType::JDT_UNDEFINED;
+            }
+
+            // convert the text of an integer, as atoll() would (saturating on overflow)
+            int64_t to_integer(const std::string_view s)
+            {
+                const bool negative = (!s.empty() && s[0] == '-');
+                const char *p = s.data() + (negative ? 1 : 0);
+                const char *const end = s.data() + s.size();
+
+                if (static_cast<size_t>(end - p) <= MAX_EXACT_INTEGER_DIGITS)
+                {
+                    uint64_t value = 0;
+                    read_digits(p, end, value);
+
+                    if (p == end)
+                        return (negative ? -static_cast<int64_t>(value) : static_cast<int64_t>(value));
+                }
+
+                int64_t value = 0;
+                const auto result = std::from_chars(s.data(), end, value);
+
+                if (result.ec == std::errc::result_out_of_range)
+                    return (negative ? std::numeric_limits<int64_t>::min() : std::numeric_limits<int64_t>::max());
+
+                return value;
+            }
+
+            // convert the text of a floating point number, as atof() would. numbers of up to 15
+            // digits without an exponent are converted exactly with one division, and others
+            // with std::from_chars where it is available.
+            double to_float(const std::string_view s)
+            {
+                const bool negative = (!s.empty() && s[0] == '-');
+                const char *p = s.data() + (negative ? 1 : 0);
+                const char *const end = s.data() + s.size();
+
+                uint64_t mantissa = 0;
+                size_t digits = read_digits(p, end, mantissa);
+                size_t fraction_digits = 0;
+
+                if (p < end && *p == '.')
+                {
+                    ++p;
+                    fraction_digits = read_digits(p, end, mantissa);
+                    digits += fraction_digits;
+                }
+
+                if (p == end && digits > 0 && digits <= MAX_EXACT_FLOAT_DIGITS)
+                {
+                    const double value = static_cast<double>(mantissa) / EXACT_POWERS_OF_TEN[fraction_digits];
+                    return (negative ? -value : value);
+                }
+
+#if defined(__cpp_lib_to_chars)
+                double value = 0.0;
+                const auto result = std::from_chars(s.data(), end, value);
+
+                if (result.ec == std::errc())
+                    return value;
+
+                if (result.ec == std::errc::invalid_argument)
+                    return 0.0;
+#endif
+                // out of range, where atof() returns infinity or a denormal number
+                return atof(std::string(s).c_str());
+            }
+
+        } // namespace number_helpers
+
+        // methods for determining and validating json data types
+        namespace data_validators
+        {
+            // returns true if input represents a null json type
+            bool is_type_null(const std::string &input)
+            {
+                return (input == "null");
+            }
+
+            // returns true if input represents a boolean json type
+            bool is_type_boolean(const std::string &input)
+            {
+                return (input == "true" || input == "false");
+            }
+
+            // returns true if input represents an integer number json type
+            bool is_type_integer(const std::string &input)
+            {
+                return number_helpers::scan(input).integer;
+            }
+
+            // returns true if input represents a floating point number json type
+            bool is_type_float(const std::string &input)
+            {
+                return number_helpers::scan(input).floating;
             }
 
             // returns true if input represents an array json type
@@ -406,6 +581,189 @@ namespace rda
 
         } // namespace data_validators
 
+        // helper methods for classifying the characters of json text in blocks of 64 bytes at
+        // a time, using the best instruction set available (see simd_rda.h)
+        namespace scan_helpers
+        {
+            // number of bytes classified at a time
+            constexpr static const size_t BLOCK_SIZE = 64;
+
+            // classification of a block of bytes. bit n of each mask is set if byte n of the
+            // block is of that class.
+            struct block_masks
+            {
+                // quote characters: "
+                uint64_t quote = 0;
+
+                // backslash characters
+                uint64_t backslash = 0;
+
+                // structural characters (json delimiters): : , { } [ ]
+                uint64_t structural = 0;
+
+                // whitespace characters: space, newline, tab, carriage return
+                uint64_t whitespace = 0;
+            };
+
+            // classify up to BLOCK_SIZE bytes, one byte at a time
+            void classify_scalar(const char *data, const size_t size, block_masks &masks)
+            {
+                masks = block_masks();
+
+                for (size_t i = 0; i < size && i < BLOCK_SIZE; ++i)
+                {
+                    const uint64_t bit = (static_cast<uint64_t>(1) << i);
+
+                    switch (data[i])
+                    {
+                        case '"':
+                            masks.quote |= bit;
+                            break;
+                        case '\\':
+                            masks.backslash |= bit;
+                            break;
+                        case ':':
+                        case ',':
+                        case '{':
+                        case '}':
+                        case '[':
+                        case ']':
+                            masks.structural |= bit;
+                            break;
+                        case ' ':
+                        case '\n':
+                        case '\t':
+                        case '\r':
+                            masks.whitespace |= bit;
+                            break;
+                        default:
+                            break;
+                    }
+                }
+            }
+
+#if defined(RDA_SIMD_X86)
+            // classify exactly BLOCK_SIZE bytes, 16 at a time
+            RDA_TARGET_SSE2 void classify_sse2(const char *data, block_masks &masks)
+            {
+                masks = block_masks();
+
+                for (size_t i = 0; i < BLOCK_SIZE; i += 16)
+                {
+                    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+
+                    // setting the 0x20 bit maps [ and ] onto { and }
+                    const __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+
+                    const __m128i quote = _mm_cmpeq_epi8(v, _mm_set1_epi8('"'));
+                    const __m128i backslash = _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'));
+                    const __m128i structural =
+                        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(':')), _mm_cmpeq_epi8(v, _mm_set1_epi8(','))),
+                                     _mm_or_si128(_mm_cmpeq_epi8(lower, _mm_set1_epi8('{')), _mm_cmpeq_epi8(lower, _mm_set1_epi8('}'))));
+                    const __m128i whitespace =
+                        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))),
+                                     _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\t')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))));
+
+                    masks.quote |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(quote))) << i;
+                    masks.backslash |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(backslash))) << i;
+                    masks.structural |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(structural))) << i;
+                    masks.whitespace |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(whitespace))) << i;
+                }
+            }
+
+            // classify exactly BLOCK_SIZE bytes, 32 at a time
+            RDA_TARGET_AVX2 void classify_avx2(const char *data, block_masks &masks)
+            {
+                masks = block_masks();
+
+                for (size_t i = 0; i < BLOCK_SIZE; i += 32)
+                {
+                    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+
+                    // setting the 0x20 bit maps [ and ] onto { and }
+                    const __m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+
+                    const __m256i quote = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('"'));
+                    const __m256i backslash = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'));
+                    const __m256i structural =
+                        _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(':')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8(','))),
+                                        _mm256_or_si256(_mm256_cmpeq_epi8(lower, _mm256_set1_epi8('{')), _mm256_cmpeq_epi8(lower, _mm256_set1_epi8('}'))));
+                    const __m256i whitespace =
+                        _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'))),
+                                        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r'))));
+
+                    masks.quote |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(quote))) << i;
+                    masks.backslash |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(backslash))) << i;
+                    masks.structural |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(structural))) << i;
+                    masks.whitespace |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(whitespace))) << i;
+                }
+            }
+#endif
+
+            // classify up to BLOCK_SIZE bytes, using the given instruction set. bytes past
+            // size are not in any class.
+            void classify(const char *data, const size_t size, block_masks &masks,
+                          const simd::instruction_set is)
+            {
+#if defined(RDA_SIMD_X86)
+                if (is != simd::instruction_set::IS_SCALAR)
+                {
+                    // a partial block is classified from a copy, padded with null bytes
+                    char padded[BLOCK_SIZE] = {};
+                    const char *block = data;
+
+                    if (size < BLOCK_SIZE)
+                    {
+                        std::copy(data, data + size, padded);
+                        block = padded;
+                    }
+
+                    if (is == simd::instruction_set::IS_AVX2)
+                        classify_avx2(block, masks);
+                    else
+                        classify_sse2(block, masks);
+
+                    return;
+                }
+#endif
+                static_cast<void>(is); // unused without simd
+                classify_scalar(data, size, masks);
+            }
+
+            // classify up to BLOCK_SIZE bytes, using the selected instruction set
+            void classify(const char *data, const size_t size, block_masks &masks)
+            {
+                classify(data, size, masks, simd::get_instruction_set());
+            }
+
+            // returns the instruction set that is currently selected for the lexer. the lexer
+            // tests one character at a time by default: most tokens end within a few bytes, and
+            // finding them from the masks of each block was measured no faster (see "benchmark:
+            // structural scanning"). classify() still uses the best instruction set.
+            std::atomic<simd::instruction_set> &selected_lexer_instruction_set()
+            {
+                static std::atomic<simd::instruction_set> selected{simd::instruction_set::IS_SCALAR};
+                return selected;
+            }
+
+            // returns the instruction set the lexer uses
+            simd::instruction_set get_lexer_instruction_set()
+            {
+                return selected_lexer_instruction_set().load(std::memory_order_relaxed);
+            }
+
+            // select the instruction set for the lexer to use (for example, to compare them).
+            // capped at the best supported instruction set. returns the one actually selected.
+            simd::instruction_set set_lexer_instruction_set(const simd::instruction_set is)
+            {
+                const simd::instruction_set best = simd::detect_instruction_set();
+                const simd::instruction_set chosen = (static_cast<int>(is) <= static_cast<int>(best) ? is : best);
+                selected_lexer_instruction_set().store(chosen, std::memory_order_relaxed);
+                return chosen;
+            }
+
+        } // namespace scan_helpers
+
         // helper methods for parsing json data
         namespace parse_helpers
         {
@@ -418,11 +776,9 @@ namespace rda
                 if (data_validators::is_type_boolean(input))
                     return JsonDataType::JDT_BOOLEAN;
 
-                if (data_validators::is_type_integer(input))
-                    return JsonDataType::JDT_INTEGER;
-
-                if (data_validators::is_type_float(input))
-                    return JsonDataType::JDT_FLOAT;
+                const JsonDataType number = number_helpers::classify(input);
+                if (number != JsonDataType::JDT_UNDEFINED)
+                    return number;
 
                 if (data_validators::is_type_array(input))
                     return JsonDataType::JDT_ARRAY;
@@ -533,95 +889,816 @@ namespace rda
                 return tokens;
             }
 
-        } // namespace parse_helpers
+            // kinds of tokens produced by the lexer
+            enum class token_type
+            {
+                TT_END,       // no more input
+                TT_DELIMITER, // one of : , { } [ ]
+                TT_QUOTED,    // "quoted text"
+                TT_UNQUOTED   // any other run of text up to the next delimiter
+            };
 
-        // base class for json data nodes
-        class node
-        {
-        protected:
-            // node data type
-            const JsonDataType type = JsonDataType::JDT_UNDEFINED;
+            // a single token, referring directly into the input text
+            struct token
+            {
+                // the kind of token
+                token_type type = token_type::TT_END;
 
-            // key name
-            const std::string key = "";
+                // text of the token. for quoted tokens, this excludes the surrounding quotes
+                // and escape sequences have not been applied yet.
+                std::string_view text;
 
-        public:
+                // true if a quoted token contains escaped backslashes or quotes
+                bool escaped = false;
 
-            // constructor
-            node(const JsonDataType type_, const std::string& key_)
-                : type(type_), key(key_)
-            {
-            }
+                // true if a quoted token was closed by a matching quote
+                bool terminated = true;
 
-            // virtual destructor because this is a base class
-            virtual ~node() = default;
+                // returns true if this token is the given delimiter character
+                bool is_delimiter(const char c) const
+                {
+                    return (type == token_type::TT_DELIMITER && text.front() == c);
+                }
+            };
 
-            // returns the json node type
-            virtual JsonDataType get_type() const
+            // reads one token at a time from the input text, following the same rules as
+            // tokenize(), but without copying each token into its own string. with a simd
+            // instruction set selected for it (see scan_helpers::set_lexer_instruction_set()),
+            // the input is classified 64 bytes at a time, and tokens are found from the
+            // resulting bitmasks. by default it tests one character at a time, which is as fast
+            // for the short tokens of most documents.
+            class lexer
             {
-                return type;
-            }
+            private:
+                // value of block_start before any block has been classified
+                constexpr static const size_t NO_BLOCK = static_cast<size_t>(-1);
 
-            // returns the key name
-            virtual std::string get_key() const
-            {
-                return key;
-            }
+                // the input text
+                std::string_view input;
 
-            // return a string representation of the node
-            virtual std::string to_string() const
-            {
-                return "";
-            }
+                // current read position in the input
+                size_t index = 0;
 
-            // return a simple string representation of the node
-            virtual std::string to_simple_string() const
-            {
-                return "";
-            }
+                // position where the last token read starts (the end of input for TT_END)
+                size_t token_index = 0;
 
-            // return a pretty string representation of the node
-            virtual std::string to_pretty_string(const size_t indent = 0) const
-            {
-                static_cast<void>(indent); // unused
-                return "";
-            }
+                // start of the block of input that was classified last
+                size_t block_start = NO_BLOCK;
 
-        }; // class node
+                // classification of the block of input starting at block_start
+                scan_helpers::block_masks masks;
 
-        // node to store null data type
-        class node_null : public node
-        {
-        public:
-            // constructor
-            node_null(const std::string &key_, const std::vector<std::string> &tokens, size_t &token_index)
-                : node(JsonDataType::JDT_NULL, key_)
-            {
-                static_cast<void>(tokens);      // unused
-                static_cast<void>(token_index); // unused
-            }
+                // instruction set used to classify the input
+                simd::instruction_set is = scan_helpers::get_lexer_instruction_set();
 
-            // constructor
-            node_null(const std::string &key_)
-                : node(JsonDataType::JDT_NULL, key_)
-            {
-            }
+            public:
+                // constructor
+                lexer(const std::string_view input_, const size_t start_index)
+                    : input(input_), index(start_index)
+                {
+                }
 
-            // get the data
-            void* get_data() const
-            {
-                return nullptr;
-            }
+                // returns the current read position in the input
+                size_t position() const
+                {
+                    return index;
+                }
 
-            // return a string representation of the node
-            std::string to_string() const override
-            {
-                std::stringstream ss;
+                // returns the position where the last token read starts
+                size_t token_position() const
+                {
+                    return token_index;
+                }
 
-                if (!key.empty())
-                    ss << "\"" << key << "\":";
+                // move the read position (for example, past a part of the input that is skipped)
+                void seek(const size_t pos)
+                {
+                    index = pos;
+                }
 
-                ss << "null";
+                // read and return the next token
+                token next()
+                {
+                    token t;
+
+                    // skip over any whitespace between tokens
+                    if (index < input.size() && is_whitespace(input[index]))
+                        index = find_not_whitespace(index);
+
+                    token_index = std::min(index, input.size());
+
+                    if (index >= input.size())
+                        return t;
+
+                    const char c = input[index];
+
+                    if (is_delimiter(c))
+                    {
+                        t.type = token_type::TT_DELIMITER;
+                        t.text = input.substr(index, 1);
+                        ++index;
+                    }
+                    else if (c == '"')
+                    {
+                        read_quoted(t);
+                    }
+                    else
+                    {
+                        read_non_quoted(t);
+                    }
+
+                    return t;
+                }
+
+                // returns the text of a quoted token with its escape sequences applied
+                static std::string unescape(const token &t)
+                {
+                    std::string output(t.text.size(), '\0');
+                    output.resize(unescape(t, &output[0]));
+                    return output;
+                }
+
+                // writes the text of a quoted token with its escape sequences applied into
+                // output (which must hold at least t.text.size() characters). returns the
+                // number of characters written.
+                static size_t unescape(const token &t, char *output)
+                {
+                    size_t length = 0;
+
+                    for (size_t i = 0; i < t.text.size(); ++i)
+                    {
+                        if (t.escaped && t.text[i] == '\\' && i + 1 < t.text.size() &&
+                            (t.text[i + 1] == '\\' || t.text[i + 1] == '"'))
+                            ++i;
+
+                        output[length++] = t.text[i];
+                    }
+
+                    // an unterminated token only had its leading quote stripped, so a
+                    // trailing escaped quote is removed as if it were the closing quote
+                    if (!t.terminated && length > 0 && output[length - 1] == '"')
+                        --length;
+
+                    return length;
+                }
+
+            private:
+                // classify the block of input containing pos, if it is not already
+                void load_block(const size_t pos)
+                {
+                    const size_t start = pos - (pos % scan_helpers::BLOCK_SIZE);
+
+                    if (start != block_start)
+                    {
+                        block_start = start;
+                        scan_helpers::classify(input.data() + start,
+                                               std::min(scan_helpers::BLOCK_SIZE, input.size() - start),
+                                               masks, is);
+                    }
+                }
+
+                // returns the position of the first character at or after pos whose class is in
+                // the selected masks (or the end of input if there is none). without simd, it is
+                // faster to test one character at a time with match than to build the masks.
+                template <typename Select, typename Match>
+                size_t find_first(size_t pos, const Select &select, const Match &match)
+                {
+                    if (is == simd::instruction_set::IS_SCALAR)
+                    {
+                        while (pos < input.size() && !match(input[pos]))
+                            ++pos;
+
+                        return pos;
+                    }
+
+                    while (pos < input.size())
+                    {
+                        load_block(pos);
+
+                        const size_t offset = pos - block_start;
+                        const uint64_t bits = (select(masks) >> offset);
+
+                        if (bits != 0)
+                            return std::min(pos + simd::trailing_zeros(bits), input.size());
+
+                        pos = block_start + scan_helpers::BLOCK_SIZE;
+                    }
+
+                    return input.size();
+                }
+
+                // returns the position of the first non-whitespace character at or after pos
+                size_t find_not_whitespace(const size_t pos)
+                {
+                    return find_first(
+                        pos, [](const scan_helpers::block_masks &m) { return ~m.whitespace; },
+                        [](const char c) { return !is_whitespace(c); });
+                }
+
+                // returns the position of the first delimiter at or after pos
+                size_t find_delimiter(const size_t pos)
+                {
+                    return find_first(
+                        pos, [](const scan_helpers::block_masks &m) { return m.structural; },
+                        [](const char c) { return is_delimiter(c); });
+                }
+
+                // returns the position of the first quote or backslash at or after pos
+                size_t find_quote_or_backslash(const size_t pos)
+                {
+                    return find_first(
+                        pos, [](const scan_helpers::block_masks &m) { return m.quote | m.backslash; },
+                        [](const char c) { return c == '"' || c == '\\'; });
+                }
+
+                // returns true if the character is json whitespace
+                static bool is_whitespace(const char c)
+                {
+                    return (c == ' ' || c == '\n' || c == '\t' || c == '\r');
+                }
+
+                // returns true if the character is a json delimiter
+                static bool is_delimiter(const char c)
+                {
+                    return (c == ':' || c == ',' || c == '{' || c == '}' || c == '[' || c == ']');
+                }
+
+                // read a quoted token, starting at the opening quote
+                void read_quoted(token &t)
+                {
+                    t.type = token_type::TT_QUOTED;
+
+                    const size_t start = index + 1;
+                    size_t i = find_quote_or_backslash(start);
+
+                    while (i < input.size() && input[i] == '\\')
+                    {
+                        if (i + 1 < input.size() && (input[i + 1] == '\\' || input[i + 1] == '"'))
+                        {
+                            t.escaped = true;
+                            ++i;
+                        }
+
+                        i = find_quote_or_backslash(i + 1);
+                    }
+
+                    t.terminated = (i < input.size());
+                    t.text = input.substr(start, i - start);
+                    index = (t.terminated ? i + 1 : i);
+                }
+
+                // read an unquoted token, up to the next delimiter, without trailing whitespace
+                void read_non_quoted(token &t)
+                {
+                    t.type = token_type::TT_UNQUOTED;
+
+                    const size_t start = index;
+
+                    index = find_delimiter(index);
+
+                    size_t end = index;
+
+                    while (end > start && is_whitespace(input[end - 1]))
+                        --end;
+
+                    t.text = input.substr(start, end - start);
+                }
+
+            }; // class lexer
+
+            // inspect a token to determine the json data type it corresponds to
+            JsonDataType determine_data_type(const token &t)
+            {
+                switch (t.type)
+                {
+                    case token_type::TT_DELIMITER:
+                    {
+                        if (t.is_delimiter('{'))
+                            return JsonDataType::JDT_OBJECT;
+                        if (t.is_delimiter('['))
+                            return JsonDataType::JDT_ARRAY;
+                        return JsonDataType::JDT_STRING;
+                    }
+                    case token_type::TT_UNQUOTED:
+                    {
+                        if (t.text == "null")
+                            return JsonDataType::JDT_NULL;
+
+                        if (t.text == "true" || t.text == "false")
+                            return JsonDataType::JDT_BOOLEAN;
+
+                        // any other unquoted text that is not a number is a string
+                        const JsonDataType number = number_helpers::classify(t.text);
+                        return (number != JsonDataType::JDT_UNDEFINED ? number : JsonDataType::JDT_STRING);
+                    }
+                    default:
+                    {
+                        return JsonDataType::JDT_STRING;
+                    }
+                }
+            }
+
+            // one member of an object, as read by read_object_member()
+            struct object_member
+            {
+                // true if a key name followed by a colon was read
+                bool has_key = false;
+
+                // the key name (if has_key is true)
+                token key;
+
+                // the token that decides the data type of the value
+                token type_token;
+
+                // the token that the value data is read from
+                token data_token;
+            };
+
+            // read the next element of an array from the lexer. returns false at the end of
+            // input or the close of the array.
+            bool read_array_element(lexer &lex, token &element)
+            {
+                for (;;)
+                {
+                    element = lex.next();
+
+                    // bail out at the end of input or the close of the array
+                    if (element.type == token_type::TT_END || element.is_delimiter(']'))
+                        return false;
+
+                    // skip over commas
+                    if (!element.is_delimiter(','))
+                        return true;
+                }
+            }
+
+            // read the next member of an object from the lexer. returns false at the end of
+            // input or the close of the object.
+            bool read_object_member(lexer &lex, object_member &member)
+            {
+                for (;;)
+                {
+                    const token t = lex.next();
+
+                    // bail out at the end of input or the close of the object
+                    if (t.type == token_type::TT_END || t.is_delimiter('}'))
+                        return false;
+
+                    // skip over commas
+                    if (t.is_delimiter(','))
+                        continue;
+
+                    member = object_member();
+                    member.type_token = t;
+                    member.data_token = t;
+
+                    // attempt to read a key
+                    if (!t.is_delimiter('[') && !t.is_delimiter(']') && !t.is_delimiter('{'))
+                    {
+                        const token after_key = lex.next();
+
+                        if (after_key.is_delimiter(':'))
+                        {
+                            // we successfully read a key name and a colon, so the value follows
+                            member.has_key = true;
+                            member.key = t;
+                            member.type_token = lex.next();
+                            member.data_token = member.type_token;
+
+                            if (member.type_token.type == token_type::TT_END)
+                                return false;
+                        }
+                        else
+                        {
+                            // we failed to read a key. instead assume it is malformed data, typed
+                            // by the would-be key and read from the token after it.
+                            member.data_token = after_key;
+                        }
+                    }
+
+                    return true;
+                }
+            }
+
+        } // namespace parse_helpers
+
+        // a path of key names ("path/to/node"), split up once ahead of time, to be used
+        // for repeated lookups with the get_*_by_path methods. a path can be constexpr, in
+        // which case it is split at compile time. lookups by path do not allocate. the path
+        // refers to the text it was made from, so that text must outlive it.
+        class path
+        {
+        public:
+            // maximum number of key names in a path
+            constexpr static const size_t MAX_DEPTH = 32;
+
+        private:
+            // the key names in the path
+            std::array<std::string_view, MAX_DEPTH> segments{};
+
+            // number of key names in the path
+            size_t count = 0;
+
+            // true if the text had more than MAX_DEPTH key names (such a path finds nothing)
+            bool overflow = false;
+
+        public:
+            // constructor. empty key names (from leading, trailing or doubled '/') are skipped.
+            constexpr explicit path(const std::string_view text)
+            {
+                size_t start = 0;
+
+                while (start < text.size())
+                {
+                    size_t end = text.find('/', start);
+                    if (end == std::string_view::npos)
+                        end = text.size();
+
+                    if (end > start)
+                    {
+                        if (count == MAX_DEPTH)
+                        {
+                            overflow = true;
+                            count = 0;
+                            break;
+                        }
+
+                        segments[count++] = text.substr(start, end - start);
+                    }
+
+                    start = end + 1;
+                }
+            }
+
+            // returns the number of key names in the path
+            constexpr size_t size() const
+            {
+                return count;
+            }
+
+            // returns true if there are no key names in the path
+            constexpr bool empty() const
+            {
+                return count == 0;
+            }
+
+            // returns true if the text had more than MAX_DEPTH key names
+            constexpr bool too_deep() const
+            {
+                return overflow;
+            }
+
+            // access a key name by index
+            constexpr std::string_view operator[](const size_t index) const
+            {
+                return segments[index];
+            }
+
+            // begin iterator over the key names
+            constexpr const std::string_view *begin() const
+            {
+                return segments.data();
+            }
+
+            // end iterator over the key names
+            constexpr const std::string_view *end() const
+            {
+                return segments.data() + count;
+            }
+
+        }; // class path
+
+        class key_pool;
+
+        // a key name stored once in a key_pool, and shared by every node parsed with that key
+        struct pooled_key
+        {
+            // the key name
+            std::string text;
+
+            // the pool the key belongs to
+            const key_pool *pool = nullptr;
+
+            // position of the key in the pool
+            uint32_t id = 0;
+        };
+
+        // statistics of the lookups in a key_pool
+        struct key_pool_stats
+        {
+            // number of key names looked up
+            size_t lookups = 0;
+
+            // number of lookups that found a key already in the pool
+            size_t hits = 0;
+
+            // number of distinct keys in the pool
+            size_t keys = 0;
+
+            // total length of the distinct keys
+            size_t bytes = 0;
+
+            // returns the fraction of lookups that found a key already in the pool
+            double hit_rate() const
+            {
+                return (lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups));
+            }
+        };
+
+        // table of interned key names, that documents can be parsed against. each distinct key
+        // name is stored once, and nodes refer to it by a handle, so nodes with the same key
+        // name in the same pool can be compared by pointer. a pool can be shared by parsers on
+        // multiple threads, and must outlive every node that was parsed with it.
+        class key_pool
+        {
+        private:
+            // the keys, which never move once added
+            std::deque<pooled_key> keys;
+
+            // the keys by name (the views are of the key text in the keys)
+            std::unordered_map<std::string_view, const pooled_key *> lookup;
+
+            // guards keys and lookup
+            mutable std::shared_mutex mutex;
+
+            // number of key names looked up
+            std::atomic<size_t> lookups{0};
+
+            // number of lookups that found a key already in the pool
+            std::atomic<size_t> hits{0};
+
+            // total length of the distinct keys
+            size_t bytes = 0;
+
+        public:
+            // constructor
+            key_pool() = default;
+
+            // a pool can not be copied, as nodes point into it
+            key_pool(const key_pool &) = delete;
+            key_pool &operator=(const key_pool &) = delete;
+
+            // returns the handle of a key name, adding it to the pool if it is not there yet
+            const pooled_key *intern(const std::string_view name)
+            {
+                lookups.fetch_add(1, std::memory_order_relaxed);
+
+                {
+                    std::shared_lock<std::shared_mutex> lock(mutex);
+                    const auto iter = lookup.find(name);
+
+                    if (iter != lookup.end())
+                    {
+                        hits.fetch_add(1, std::memory_order_relaxed);
+                        return iter->second;
+                    }
+                }
+
+                std::unique_lock<std::shared_mutex> lock(mutex);
+
+                // another thread may have added the key since the shared lock was released
+                const auto iter = lookup.find(name);
+                if (iter != lookup.end())
+                {
+                    hits.fetch_add(1, std::memory_order_relaxed);
+                    return iter->second;
+                }
+
+                keys.push_back(pooled_key{std::string(name), this, static_cast<uint32_t>(keys.size())});
+                const pooled_key *k = &keys.back();
+                lookup.emplace(k->text, k);
+                bytes += name.size();
+                return k;
+            }
+
+            // returns the handle of a key name, or nullptr if it is not in the pool
+            const pooled_key *find(const std::string_view name) const
+            {
+                std::shared_lock<std::shared_mutex> lock(mutex);
+                const auto iter = lookup.find(name);
+                return (iter != lookup.end() ? iter->second : nullptr);
+            }
+
+            // returns the number of distinct keys in the pool
+            size_t size() const
+            {
+                std::shared_lock<std::shared_mutex> lock(mutex);
+                return keys.size();
+            }
+
+            // returns the statistics of the lookups in the pool
+            key_pool_stats get_stats() const
+            {
+                key_pool_stats stats;
+                stats.lookups = lookups.load(std::memory_order_relaxed);
+                stats.hits = hits.load(std::memory_order_relaxed);
+
+                std::shared_lock<std::shared_mutex> lock(mutex);
+                stats.keys = keys.size();
+                stats.bytes = bytes;
+                return stats;
+            }
+
+            // reset the lookup statistics (the keys stay in the pool)
+            void reset_stats()
+            {
+                lookups.store(0, std::memory_order_relaxed);
+                hits.store(0, std::memory_order_relaxed);
+            }
+
+        }; // class key_pool
+
+        // a path of key names resolved against a key_pool once ahead of time, so that each
+        // lookup in a document parsed with the pool compares handles instead of key names
+        class key_path
+        {
+        private:
+            // the handles of the key names in the path
+            std::vector<const pooled_key *> segments;
+
+        public:
+            // constructor. the key names are added to the pool if they are not there yet.
+            key_path(key_pool &pool, const std::string_view text)
+            {
+                const json::path p(text);
+
+                for (const std::string_view segment : p)
+                    segments.push_back(pool.intern(segment));
+
+                if (p.too_deep())
+                    segments.clear();
+            }
+
+            // returns the number of key names in the path
+            size_t size() const
+            {
+                return segments.size();
+            }
+
+            // access a key handle by index
+            const pooled_key *operator[](const size_t index) const
+            {
+                return segments[index];
+            }
+
+        }; // class key_path
+
+        // base class for json data nodes
+        class node
+        {
+        protected:
+            // node data type
+            const JsonDataType type = JsonDataType::JDT_UNDEFINED;
+
+            // true if the key name is in a key_pool (interned is set), rather than owned by the
+            // node (key is set)
+            bool is_interned = false;
+
+            // key name: owned by the node, or the handle of a key name in a key_pool, if the node
+            // was parsed with one. only one of them is kept, so an interned node does not also
+            // hold a (empty) string of its own.
+            union
+            {
+                std::string key;
+                const pooled_key *interned;
+            };
+
+        private:
+            // the parser sets the interned key of the nodes it creates
+            friend class parser;
+
+            // refer to a key name in a key_pool, in place of the key name owned by the node
+            void set_interned(const pooled_key *k)
+            {
+                if (!is_interned)
+                    key.~basic_string();
+
+                interned = k;
+                is_interned = true;
+            }
+
+        public:
+
+            // constructor
+            node(const JsonDataType type_, const std::string& key_)
+                : type(type_), key(key_)
+            {
+            }
+
+            // copy constructor
+            node(const node &other)
+                : type(other.type), is_interned(other.is_interned)
+            {
+                if (is_interned)
+                    interned = other.interned;
+                else
+                    new (&key) std::string(other.key);
+            }
+
+            // virtual destructor because this is a base class
+            virtual ~node()
+            {
+                if (!is_interned)
+                    key.~basic_string();
+            }
+
+            // returns the json node type
+            virtual JsonDataType get_type() const
+            {
+                return type;
+            }
+
+            // returns the key name
+            virtual std::string get_key() const
+            {
+                return std::string(get_key_view());
+            }
+
+            // returns a view of the key name, without copying it
+            std::string_view get_key_view() const
+            {
+                if (is_interned)
+                    return interned->text;
+
+                return key;
+            }
+
+            // returns the handle of the key name in a key_pool (nullptr if it is not interned)
+            const pooled_key *get_pooled_key() const
+            {
+                return (is_interned ? interned : nullptr);
+            }
+
+            // returns true if the node has the key name of a handle. nodes interned in the same
+            // pool are compared by pointer, and only other nodes by key name.
+            bool has_key(const pooled_key *k) const
+            {
+                if (is_interned)
+                {
+                    if (interned == k)
+                        return true;
+
+                    if (interned->pool == k->pool)
+                        return false;
+                }
+
+                return (get_key_view() == k->text);
+            }
+
+            // return a string representation of the node
+            virtual std::string to_string() const
+            {
+                return "";
+            }
+
+            // return a simple string representation of the node
+            virtual std::string to_simple_string() const
+            {
+                return "";
+            }
+
+            // return a pretty string representation of the node
+            virtual std::string to_pretty_string(const size_t indent = 0) const
+            {
+                static_cast<void>(indent); // unused
+                return "";
+            }
+
+        }; // class node
+
+        // node to store null data type
+        class node_null : public node
+        {
+        public:
+            // constructor
+            node_null(const std::string &key_, const std::vector<std::string> &tokens, size_t &token_index)
+                : node(JsonDataType::JDT_NULL, key_)
+            {
+                static_cast<void>(tokens);      // unused
+                static_cast<void>(token_index); // unused
+            }
+
+            // constructor
+            node_null(const std::string &key_)
+                : node(JsonDataType::JDT_NULL, key_)
+            {
+            }
+
+            // get the data
+            void* get_data() const
+            {
+                return nullptr;
+            }
+
+            // return a string representation of the node
+            std::string to_string() const override
+            {
+                std::stringstream ss;
+
+                if (!get_key_view().empty())
+                    ss << "\"" << get_key_view() << "\":";
+
+                ss << "null";
 
                 return ss.str();
             }
@@ -640,10 +1717,10 @@ namespace rda
 
                 std::stringstream ss;
 
-                if (key.empty())
+                if (get_key_view().empty())
                     ss << indent_str << "null";
                 else
-                    ss << indent_str << "\"" << key << "\" : null";
+                    ss << indent_str << "\"" << get_key_view() << "\" : null";
 
                 return ss.str();
             }
@@ -681,8 +1758,8 @@ namespace rda
             {
                 std::stringstream ss;
 
-                if (!key.empty())
-                    ss << "\"" << key << "\":";
+                if (!get_key_view().empty())
+                    ss << "\"" << get_key_view() << "\":";
 
                 if (data)
                     ss << "true";
@@ -706,10 +1783,10 @@ namespace rda
 
                 std::stringstream ss;
 
-                if (key.empty())
+                if (get_key_view().empty())
                     ss << indent_str << (data ? "true" : "false");
                 else
-                    ss << indent_str << "\"" << key << "\": " << (data ? "true" : "false");
+                    ss << indent_str << "\"" << get_key_view() << "\": " << (data ? "true" : "false");
 
                 return ss.str();
             }
@@ -758,8 +1835,8 @@ namespace rda
             {
                 std::stringstream ss;
 
-                if (!key.empty())
-                    ss << "\"" << key << "\":";
+                if (!get_key_view().empty())
+                    ss << "\"" << get_key_view() << "\":";
 
                 ss << std::to_string(data);
 
@@ -780,10 +1857,10 @@ namespace rda
 
                 std::stringstream ss;
 
-                if (key.empty())
+                if (get_key_view().empty())
                     ss << indent_str << std::to_string(data);
                 else
-                    ss << indent_str << "\"" << key << "\": " << std::to_string(data);
+                    ss << indent_str << "\"" << get_key_view() << "\": " << std::to_string(data);
 
                 return ss.str();
             }
@@ -794,7 +1871,7 @@ namespace rda
                                          size_t &token_index)
             {
                 if (token_index < tokens.size())
-                    return (atoll(tokens[token_index].c_str()));
+                    return number_helpers::to_integer(tokens[token_index]);
 
                 return 0;
             }
@@ -832,8 +1909,8 @@ namespace rda
             {
                 std::stringstream ss;
 
-                if (!key.empty())
-                    ss << "\"" << key << "\":";
+                if (!get_key_view().empty())
+                    ss << "\"" << get_key_view() << "\":";
 
                 ss << std::to_string(data);
 
@@ -854,10 +1931,10 @@ namespace rda
 
                 std::stringstream ss;
 
-                if (key.empty())
+                if (get_key_view().empty())
                     ss << indent_str << std::to_string(data);
                 else
-                    ss << indent_str << "\"" << key << "\": " << std::to_string(data);
+                    ss << indent_str << "\"" << get_key_view() << "\": " << std::to_string(data);
 
                 return ss.str();
             }
@@ -868,7 +1945,7 @@ namespace rda
                                       size_t &token_index)
             {
                 if (token_index < tokens.size())
-                    return (atof(tokens[token_index].c_str()));
+                    return number_helpers::to_float(tokens[token_index]);
 
                 return 0.0f;
             }
@@ -895,103 +1972,357 @@ namespace rda
             {
             }
 
+            // constructor
+            node_string(const std::string &key_, std::string &&data_)
+                : node(JsonDataType::JDT_STRING, key_), data(std::move(data_))
+            {
+            }
+
             // get the data
             std::string get_data() const
+            {
+                return std::string(get_data_view());
+            }
+
+            // returns a view of the data, without copying it. valid for the lifetime of the node.
+            virtual std::string_view get_data_view() const
             {
                 return data;
             }
 
+            // returns true if the data is borrowed from a source buffer, instead of owned
+            virtual bool is_borrowed() const
+            {
+                return false;
+            }
+
             // return a string representation of the node
             std::string to_string() const override
             {
                 std::stringstream ss;
 
-                if (!key.empty())
-                    ss << "\"" << key << "\":";
+                if (!get_key_view().empty())
+                    ss << "\"" << get_key_view() << "\":";
+
+                ss << "\"" << add_escape_characters(get_data_view()) << "\"";
+
+                return ss.str();
+            }
+
+            // return a simple string representation of the node
+            std::string to_simple_string() const override
+            {
+                return get_data();
+            }
+
+            // return a pretty string representation of the node
+            std::string to_pretty_string(const size_t indent = 0) const override
+            {
+                const std::string indent_str =
+                    algorithm_rda::string_index_utils::string_indent("    ", indent);
+
+                std::stringstream ss;
+
+                if (get_key_view().empty())
+                    ss << indent_str << "\"" << add_escape_characters(get_data_view()) << "\"";
+                else
+                    ss << indent_str << "\"" << get_key_view() << "\": \"" << add_escape_characters(get_data_view())
+                       << "\"";
+
+                return ss.str();
+            }
+
+        protected:
+            // escape all backslash and quote characters with a backslash
+            static std::string add_escape_characters(const std::string_view input)
+            {
+                std::string output;
+
+                if (!input.empty())
+                {
+                    size_t index = input.size();
+
+                    do
+                    {
+                        --index;
+                        char c = input[index];
+
+                        output.insert(0, std::string(1, c));
+                        if (c == '\\' || c == '"')
+                            output.insert(0, "\\");
+                    } while (index > 0);
+                }
+                return output;
+            }
+
+            // parse and return a string value
+            static std::string parse_string(const std::vector<std::string> &tokens, size_t &token_index)
+            {
+                std::string output;
+
+                if (token_index < tokens.size())
+                {
+                    output = tokens[token_index];
+
+                    if (data_validator_helpers::starts_with(output, '"', 0) &&
+                        data_validator_helpers::ends_with(output, '"'))
+                        algorithm_rda::string_index_utils::strip_leading_and_trailing_quote(
+                            output);
+                }
+
+                return output;
+            }
+
+        }; // class node_string
+
+        // node to store string data type, where the data is borrowed from (points into) a
+        // source buffer that the node keeps alive, instead of being copied. only the strings
+        // of a document parsed with parse_retained() are borrowed, so other strings do not
+        // pay for the source buffer.
+        class node_borrowed_string : public node_string
+        {
+        protected:
+            // buffer that the data points into
+            const std::shared_ptr<const std::string> source;
+
+            // string data, in the source buffer
+            const std::string_view borrowed;
+
+        public:
+            // constructor
+            node_borrowed_string(const std::string &key_, std::shared_ptr<const std::string> source_,
+                                 const std::string_view data_)
+                : node_string(key_, std::string()), source(std::move(source_)), borrowed(data_)
+            {
+            }
+
+            // returns a view of the data, without copying it. valid for the lifetime of the node.
+            std::string_view get_data_view() const override
+            {
+                return borrowed;
+            }
+
+            // returns true if the data is borrowed from a source buffer, instead of owned
+            bool is_borrowed() const override
+            {
+                return true;
+            }
+
+        }; // class node_borrowed_string
+
+        // fwd dec of parsing factory (used by node_array and node_object classes)
+        void add_object_or_array_data(
+            std::vector<std::shared_ptr<node>> &object_data,
+            const JsonDataType data_type, const std::string &key_name,
+            const std::vector<std::string> &tokens, size_t &token_index);
+
+        // the input text and structural index of a lazily parsed document. the arrays and
+        // objects of the document keep it alive, and read their children from it the first
+        // time they are accessed, so sub-trees that are never touched are never built.
+        class lazy_document : public std::enable_shared_from_this<lazy_document>
+        {
+        private:
+            // the input text
+            std::shared_ptr<const std::string> source;
+
+            // for every array and object, in order of position: the position just after its
+            // opening delimiter, and the position just after its closing delimiter (or the end
+            // of input, if it is never closed)
+            std::vector<std::pair<size_t, size_t>> spans;
+
+            // held while the children of an array or object are read
+            mutable std::mutex read_mutex;
+
+        public:
+            // constructor. indexes the array or object whose opening delimiter ends just
+            // before root_offset, and everything inside of it.
+            lazy_document(std::shared_ptr<const std::string> source_, const size_t root_offset,
+                          const bool root_is_object)
+                : source(std::move(source_))
+            {
+                parse_helpers::lexer lex(*source, root_offset);
+                index_children(lex, root_is_object);
+            }
+
+            // returns the input text
+            const std::shared_ptr<const std::string> &get_source() const
+            {
+                return source;
+            }
+
+            // returns the number of arrays and objects in the document
+            size_t num_containers() const
+            {
+                return spans.size();
+            }
+
+            // returns the position just after the close of the array or object whose children
+            // start at offset
+            size_t end_of(const size_t offset) const
+            {
+                const auto iter = std::lower_bound(
+                    spans.cbegin(), spans.cend(), offset,
+                    [](const std::pair<size_t, size_t> &span, const size_t value) { return span.first < value; });
 
-                ss << "\"" << add_escape_characters(data) << "\"";
+                if (iter == spans.cend() || iter->first != offset)
+                    return source->size();
+
+                return iter->second;
+            }
+
+            // returns the mutex that is held while children are read
+            std::mutex &get_mutex() const
+            {
+                return read_mutex;
+            }
+
+            // read the children of the array or object whose children start at offset. nested
+            // arrays and objects are skipped, and are read in turn when they are accessed.
+            std::vector<std::shared_ptr<node>> read_children(const size_t offset, const bool is_object) const;
+
+        private:
+            // record the span of an array or object, reading up to and including its close
+            void index_children(parse_helpers::lexer &lex, const bool is_object)
+            {
+                const size_t slot = spans.size();
+                spans.emplace_back(lex.position(), 0);
+
+                if (is_object)
+                {
+                    parse_helpers::object_member member;
+                    while (parse_helpers::read_object_member(lex, member))
+                        index_value(lex, member.type_token);
+                }
+                else
+                {
+                    parse_helpers::token element;
+                    while (parse_helpers::read_array_element(lex, element))
+                        index_value(lex, element);
+                }
 
-                return ss.str();
+                spans[slot].second = lex.position();
             }
 
-            // return a simple string representation of the node
-            std::string to_simple_string() const override
+            // record the spans inside of a value. only a value typed by an opening delimiter
+            // is an array or object, and then the delimiter is also its data.
+            void index_value(parse_helpers::lexer &lex, const parse_helpers::token &type_token)
             {
-                return data;
+                if (type_token.is_delimiter('['))
+                    index_children(lex, false);
+                else if (type_token.is_delimiter('{'))
+                    index_children(lex, true);
             }
 
-            // return a pretty string representation of the node
-            std::string to_pretty_string(const size_t indent = 0) const override
-            {
-                const std::string indent_str =
-                    algorithm_rda::string_index_utils::string_indent("    ", indent);
+        }; // class lazy_document
 
-                std::stringstream ss;
+        // where the children of a lazily parsed array or object are read from. arrays and
+        // objects only point to one while it is needed, so those that were not lazily parsed
+        // pay for no more than the pointer.
+        struct lazy_source
+        {
+            // the document the children are read from
+            std::shared_ptr<const lazy_document> document;
 
-                if (key.empty())
-                    ss << indent_str << "\"" << add_escape_characters(data) << "\"";
-                else
-                    ss << indent_str << "\"" << key << "\": \"" << add_escape_characters(data)
-                       << "\"";
+            // position in the document where the children start
+            size_t offset = 0;
 
-                return ss.str();
-            }
+            // true until the children have been read from the document
+            std::atomic<bool> pending{true};
 
-        protected:
-            // escape all backslash and quote characters with a backslash
-            static std::string add_escape_characters(const std::string &input)
+            // constructor
+            lazy_source(std::shared_ptr<const lazy_document> document_, const size_t offset_)
+                : document(std::move(document_)), offset(offset_)
             {
-                std::string output;
+            }
 
-                if (!input.empty())
+            // read the children into data, if they have not been read yet
+            void load(std::vector<std::shared_ptr<node>> &data, const bool is_object)
+            {
+                if (pending.load(std::memory_order_acquire))
                 {
-                    size_t index = input.size();
+                    std::lock_guard<std::mutex> lock(document->get_mutex());
 
-                    do
+                    if (pending.load(std::memory_order_relaxed))
                     {
-                        --index;
-                        char c = input[index];
-
-                        output.insert(0, std::string(1, c));
-                        if (c == '\\' || c == '"')
-                            output.insert(0, "\\");
-                    } while (index > 0);
+                        data = document->read_children(offset, is_object);
+                        pending.store(false, std::memory_order_release);
+                    }
                 }
-                return output;
             }
+        };
 
-            // parse and return a string value
-            static std::string parse_string(const std::vector<std::string> &tokens, size_t &token_index)
+        // the hash of the value of an array or object (see json_diff.h), kept on the node once
+        // it is computed. changing an array or object that has been hashed starts a new epoch,
+        // which forgets every cached hash: the nodes that contain it may have been hashed with
+        // it, and a node does not know its parents. a node that has not been hashed has no
+        // hashed parents (hashing a node hashes its children first), so changing it, such as
+        // while a tree is built, keeps the cached hashes.
+        class hash_cache
+        {
+        private:
+            // the hash, and the epoch it was computed in (zero if it has not been computed)
+            mutable std::atomic<uint64_t> value{0};
+            mutable std::atomic<uint64_t> epoch{0};
+
+            // returns the current epoch
+            static std::atomic<uint64_t> &current_epoch()
             {
-                std::string output;
+                static std::atomic<uint64_t> e{1};
+                return e;
+            }
 
-                if (token_index < tokens.size())
-                {
-                    output = tokens[token_index];
+        public:
+            hash_cache() = default;
 
-                    if (data_validator_helpers::starts_with(output, '"', 0) &&
-                        data_validator_helpers::ends_with(output, '"'))
-                        algorithm_rda::string_index_utils::strip_leading_and_trailing_quote(
-                            output);
-                }
+            // copy constructor (a copy has the same value, so it keeps the hash)
+            hash_cache(const hash_cache &other)
+                : value(other.value.load(std::memory_order_relaxed)), epoch(other.epoch.load(std::memory_order_acquire))
+            {
+            }
 
-                return output;
+            hash_cache &operator=(const hash_cache &) = delete;
+
+            // sets h to the cached hash, and returns true, if it was computed in this epoch
+            bool get(uint64_t &h) const
+            {
+                if (epoch.load(std::memory_order_acquire) != current_epoch().load(std::memory_order_relaxed))
+                    return false;
+
+                h = value.load(std::memory_order_relaxed);
+                return true;
             }
 
-        }; // class node_string
+            // cache a hash computed in this epoch
+            void set(const uint64_t h) const
+            {
+                value.store(h, std::memory_order_relaxed);
+                epoch.store(current_epoch().load(std::memory_order_relaxed), std::memory_order_release);
+            }
 
-        // fwd dec of parsing factory (used by node_array and node_object classes)
-        void add_object_or_array_data(
-            std::vector<std::shared_ptr<node>> &object_data,
-            const JsonDataType data_type, const std::string &key_name,
-            const std::vector<std::string> &tokens, size_t &token_index);
+            // called before the value of the node changes. starts a new epoch if the node
+            // has a cached hash.
+            void changed()
+            {
+                uint64_t h = 0;
+                if (get(h))
+                    current_epoch().fetch_add(1, std::memory_order_relaxed);
+
+                epoch.store(0, std::memory_order_relaxed);
+            }
+        };
 
         // node to store array data type
         class node_array : public node
         {
         protected:
-            // array data
-            std::vector<std::shared_ptr<node>> data;
+            // array data (mutable, as a lazily parsed array reads it on first access)
+            mutable std::vector<std::shared_ptr<node>> data;
+
+            // where the data is read from, if the array was lazily parsed (nullptr otherwise)
+            const std::unique_ptr<lazy_source> lazy;
+
+            // the hash of the value of the array, once it is computed
+            hash_cache cached_hash;
 
         public:
             // constructor
@@ -1006,45 +2337,83 @@ namespace rda
             {
             }
 
+            // constructor
+            node_array(const std::string &key_, std::vector<std::shared_ptr<node>> &&data_)
+                : node(JsonDataType::JDT_ARRAY, key_), data(std::move(data_))
+            {
+            }
+
+            // constructor. the children are read from the document when first accessed.
+            node_array(const std::string &key_, std::shared_ptr<const lazy_document> lazy_, const size_t offset)
+                : node(JsonDataType::JDT_ARRAY, key_),
+                  lazy(lazy_ != nullptr ? std::make_unique<lazy_source>(std::move(lazy_), offset) : nullptr)
+            {
+            }
+
+            // copy constructor (the children of a lazy array are read first)
+            node_array(const node_array &other)
+                : node(other), data(other.get_data()), cached_hash(other.cached_hash)
+            {
+            }
+
+            // returns the cached hash of the value of the array
+            const hash_cache &get_hash_cache() const
+            {
+                return cached_hash;
+            }
+
+            // returns false if the children have not been read from the lazy document yet
+            bool is_materialized() const
+            {
+                return (lazy == nullptr || !lazy->pending.load(std::memory_order_acquire));
+            }
+
             // get the data
             const std::vector<std::shared_ptr<node>> & get_data() const
             {
+                load();
                 return data;
             }
 
             // const begin iterator
             std::vector<std::shared_ptr<node>>::const_iterator cbegin() const
             {
+                load();
                 return data.cbegin();
             }
 
             // begin iterator
             std::vector<std::shared_ptr<node>>::const_iterator begin() const
             {
+                load();
                 return data.begin();
             }
 
             // const end iterator
             std::vector<std::shared_ptr<node>>::const_iterator cend() const
             {
+                load();
                 return data.cend();
             }
 
             // end iterator
             std::vector<std::shared_ptr<node>>::const_iterator end() const
             {
+                load();
                 return data.end();
             }
 
             // returns the number of child elements
             size_t size() const
             {
+                load();
                 return data.size();
             }
 
             // returns if the data is empty
             bool empty() const
             {
+                load();
                 return data.empty();
             }
 
@@ -1053,8 +2422,8 @@ namespace rda
             {
                 std::stringstream ss;
 
-                if (!key.empty())
-                    ss << "\"" << key << "\":";
+                if (!get_key_view().empty())
+                    ss << "\"" << get_key_view() << "\":";
 
                 ss << to_simple_string();
 
@@ -1064,6 +2433,8 @@ namespace rda
             // return a simple string representation of the node
             std::string to_simple_string() const override
             {
+                load();
+
                 std::stringstream ss;
 
                 ss << "[";
@@ -1083,13 +2454,15 @@ namespace rda
             // return a pretty string representation of the node
             std::string to_pretty_string(const size_t indent = 0) const override
             {
+                load();
+
                 const std::string indent_str =
                     algorithm_rda::string_index_utils::string_indent("    ", indent);
 
                 std::stringstream ss;
 
-                if (!key.empty())
-                    ss << indent_str << "\"" << key << "\":" << std::endl;
+                if (!get_key_view().empty())
+                    ss << indent_str << "\"" << get_key_view() << "\":" << std::endl;
 
                 ss << indent_str << "[" << std::endl;
 
@@ -1111,6 +2484,8 @@ namespace rda
             // access child by index
             std::shared_ptr<node> operator[](const size_t index) const
             {
+                load();
+
                 if (index >= data.size())
                     return nullptr;
                 return data[index];
@@ -1120,8 +2495,12 @@ namespace rda
             void add_child(std::shared_ptr<node> child,
                            const size_t index = std::numeric_limits<size_t>::max())
             {
+                load();
+
                 if (child != nullptr)
                 {
+                    cached_hash.changed();
+
                     const size_t position = std::min(index, data.size());
                     data.insert(data.cbegin() + position, child);
                 }
@@ -1130,11 +2509,23 @@ namespace rda
             // remove a child node by index
             void remove_child(const size_t index)
             {
+                load();
+
                 if (index < data.size())
+                {
+                    cached_hash.changed();
                     data.erase(data.cbegin() + index);
+                }
             }
 
         protected:
+            // read the children from the lazy document, if they have not been read yet
+            void load() const
+            {
+                if (lazy != nullptr)
+                    lazy->load(data, false);
+            }
+
             // parse and return an array of objects
             static std::vector<std::shared_ptr<node>>
             parse_array(const std::vector<std::string> &tokens, size_t &token_index)
@@ -1178,8 +2569,24 @@ namespace rda
         class node_object : public node
         {
         protected:
-            // object data
-            std::vector<std::shared_ptr<node>> data;
+            // lookup table from key name to the index of the first child with that key
+            typedef std::unordered_map<std::string_view, size_t> key_index_t;
+
+            // objects with at least this many children use a key index for lookups
+            constexpr static const size_t KEY_INDEX_THRESHOLD = 16;
+
+            // object data (mutable, as a lazily parsed object reads it on first access)
+            mutable std::vector<std::shared_ptr<node>> data;
+
+            // where the data is read from, if the object was lazily parsed (nullptr otherwise)
+            const std::unique_ptr<lazy_source> lazy;
+
+            // the hash of the value of the object, once it is computed
+            hash_cache cached_hash;
+
+            // key index, built the first time it is needed (nullptr until then). it may be
+            // built by const lookups, so it is published atomically for concurrent readers.
+            mutable std::atomic<key_index_t *> key_index{nullptr};
 
         public:
             // constructor
@@ -1194,45 +2601,90 @@ namespace rda
             {
             }
 
+            // constructor
+            node_object(const std::string &key_, std::vector<std::shared_ptr<node>> &&data_)
+                : node(JsonDataType::JDT_OBJECT, key_), data(std::move(data_))
+            {
+            }
+
+            // constructor. the children are read from the document when first accessed.
+            node_object(const std::string &key_, std::shared_ptr<const lazy_document> lazy_, const size_t offset)
+                : node(JsonDataType::JDT_OBJECT, key_),
+                  lazy(lazy_ != nullptr ? std::make_unique<lazy_source>(std::move(lazy_), offset) : nullptr)
+            {
+            }
+
+            // copy constructor (the key index is not copied, it is rebuilt when needed. the
+            // children of a lazy object are read first.)
+            node_object(const node_object &other)
+                : node(other), data(other.get_data()), cached_hash(other.cached_hash)
+            {
+            }
+
+            // returns the cached hash of the value of the object
+            const hash_cache &get_hash_cache() const
+            {
+                return cached_hash;
+            }
+
+            // destructor
+            ~node_object() override
+            {
+                delete key_index.load();
+            }
+
+            // returns false if the children have not been read from the lazy document yet
+            bool is_materialized() const
+            {
+                return (lazy == nullptr || !lazy->pending.load(std::memory_order_acquire));
+            }
+
             // get the data
             const std::vector<std::shared_ptr<node>> & get_data() const
             {
+                load();
                 return data;
             }
 
             // const begin iterator
             std::vector<std::shared_ptr<node>>::const_iterator cbegin() const
             {
+                load();
                 return data.cbegin();
             }
 
             // begin iterator
             std::vector<std::shared_ptr<node>>::const_iterator begin() const
             {
+                load();
                 return data.begin();
             }
 
             // const end iterator
             std::vector<std::shared_ptr<node>>::const_iterator cend() const
             {
+                load();
                 return data.cend();
             }
 
             // end iterator
             std::vector<std::shared_ptr<node>>::const_iterator end() const
             {
+                load();
                 return data.end();
             }
 
             // returns the number of child elements
             size_t size() const
             {
+                load();
                 return data.size();
             }
 
             // returns if the data is empty
             bool empty() const
             {
+                load();
                 return data.empty();
             }
 
@@ -1241,8 +2693,8 @@ namespace rda
             {
                 std::stringstream ss;
 
-                if (!key.empty())
-                    ss << "\"" << key << "\":";
+                if (!get_key_view().empty())
+                    ss << "\"" << get_key_view() << "\":";
 
                 ss << to_simple_string();
 
@@ -1252,6 +2704,8 @@ namespace rda
             // return a simple string representation of the node
             std::string to_simple_string() const override
             {
+                load();
+
                 std::stringstream ss;
 
                 ss << "{";
@@ -1265,217 +2719,484 @@ namespace rda
 
                 ss << "}";
 
-                return ss.str();
+                return ss.str();
+            }
+
+            // return a pretty string representation of the node
+            std::string to_pretty_string(const size_t indent = 0) const override
+            {
+                load();
+
+                const std::string indent_str =
+                    algorithm_rda::string_index_utils::string_indent("    ", indent);
+
+                std::stringstream ss;
+
+                if (!get_key_view().empty())
+                    ss << indent_str << "\"" << get_key_view() << "\":" << std::endl;
+
+                ss << indent_str << "{" << std::endl;
+
+                for (size_t i = 0; i < data.size(); ++i)
+                {
+                    ss << data[i]->to_pretty_string(indent + 1);
+
+                    if (i + 1 != data.size())
+                        ss << ",";
+
+                    ss << std::endl;
+                }
+
+                ss << indent_str << "}";
+
+                return ss.str();
+            }
+
+            // access child by path
+            std::shared_ptr<node> operator[](const std::string &key_name) const
+            {
+                return get_node_by_path(key_name);
+            }
+
+            // add a child node
+            void add_child(std::shared_ptr<node> child,
+                           const size_t index = std::numeric_limits<size_t>::max())
+            {
+                load();
+
+                if (child != nullptr)
+                {
+                    cached_hash.changed();
+
+                    const size_t position = std::min(index, data.size());
+                    data.insert(data.cbegin() + position, child);
+
+                    // keep the key index up to date, if it has been built
+                    if (key_index_t *ki = key_index.load())
+                    {
+                        if (position + 1 != data.size())
+                            for (auto &entry : *ki)
+                                if (entry.second >= position)
+                                    ++entry.second;
+
+                        const auto iter = ki->find(data[position]->get_key_view());
+
+                        if (iter == ki->end() || iter->second > position)
+                            set_key_index_entry(*ki, position);
+                    }
+                }
+            }
+
+            // remove a child node by key name
+            void remove_child(const std::string &key_name)
+            {
+                if (const std::shared_ptr<node> *child = find_child(key_name))
+                    remove_child(static_cast<size_t>(child - data.data()));
+            }
+
+            // remove a child node by index
+            void remove_child(const size_t index)
+            {
+                load();
+
+                if (index < data.size())
+                {
+                    // hold the removed child until its key is no longer referenced by the key index
+                    const std::shared_ptr<node> removed = data[index];
+
+                    cached_hash.changed();
+                    data.erase(data.cbegin() + index);
+
+                    // keep the key index up to date, if it has been built
+                    if (key_index_t *ki = key_index.load())
+                    {
+                        const auto iter = ki->find(removed->get_key_view());
+                        const bool was_indexed = (iter != ki->end() && iter->second == index);
+
+                        if (was_indexed)
+                            ki->erase(iter);
+
+                        for (auto &entry : *ki)
+                            if (entry.second > index)
+                                --entry.second;
+
+                        // another child with the same key may now be the first one
+                        if (was_indexed)
+                            for (size_t i = index; i < data.size(); ++i)
+                                if (data[i]->get_key_view() == removed->get_key_view())
+                                {
+                                    set_key_index_entry(*ki, i);
+                                    break;
+                                }
+                    }
+                }
+            }
+
+            // returns a pointer to the first child with the given key name (nullptr if not found)
+            const std::shared_ptr<node> *find_child(const std::string_view key_name) const
+            {
+                load();
+
+                if (data.size() >= KEY_INDEX_THRESHOLD)
+                {
+                    const key_index_t &ki = get_key_index();
+                    const auto iter = ki.find(key_name);
+
+                    if (iter == ki.cend())
+                        return nullptr;
+
+                    return &data[iter->second];
+                }
+
+                for (const auto &c : data)
+                    if (c->get_key_view() == key_name)
+                        return &c;
+
+                return nullptr;
+            }
+
+            // returns a pointer to the first child with the key name of a handle (nullptr if
+            // not found). children interned in the same pool are compared by pointer.
+            const std::shared_ptr<node> *find_child(const pooled_key *k) const
+            {
+                load();
+
+                if (data.size() >= KEY_INDEX_THRESHOLD)
+                    return find_child(std::string_view(k->text));
+
+                for (const auto &c : data)
+                    if (c->has_key(k))
+                        return &c;
+
+                return nullptr;
+            }
+
+            // return a json node specified by a string path: "path/to/node"
+            std::shared_ptr<node> get_node_by_path(const std::string &path) const
+            {
+                return node_value(find_node_by_path(path));
+            }
+
+            // return a json node specified by a pre-split path
+            std::shared_ptr<node> get_node_by_path(const json::path &p) const
+            {
+                return node_value(find_node_by_path(p));
+            }
+
+            // return a json node specified by a path resolved against a key pool
+            std::shared_ptr<node> get_node_by_path(const key_path &p) const
+            {
+                return node_value(find_node_by_segments(p));
+            }
+
+            // return json node specd by vector<string> path {"path", "to", "node"}
+            std::shared_ptr<node>
+            get_node_by_path(const std::vector<std::string> &path) const
+            {
+                return node_value(find_node_by_segments(path));
+            }
+
+            // returns true if there exists a node specified by path
+            bool does_node_exist(const std::string &path) const
+            {
+                return (find_node_by_path(path) != nullptr);
+            }
+
+            // returns true if there exists a node specified by a pre-split path
+            bool does_node_exist(const json::path &p) const
+            {
+                return (find_node_by_path(p) != nullptr);
+            }
+
+            // returns true if there exists a node specified by a path resolved against a key pool
+            bool does_node_exist(const key_path &p) const
+            {
+                return (find_node_by_segments(p) != nullptr);
+            }
+
+            // returns the json node type specified by path
+            JsonDataType get_node_type_by_path(const std::string &path) const
+            {
+                return type_value(find_node_by_path(path));
+            }
+
+            // returns the json node type specified by a pre-split path
+            JsonDataType get_node_type_by_path(const json::path &p) const
+            {
+                return type_value(find_node_by_path(p));
+            }
+
+            // return a json node_array object specified by path
+            std::shared_ptr<node_array> get_array_by_path(const std::string &path) const
+            {
+                return array_value(find_node_by_path(path));
+            }
+
+            // return a json node_array object specified by a pre-split path
+            std::shared_ptr<node_array> get_array_by_path(const json::path &p) const
+            {
+                return array_value(find_node_by_path(p));
             }
 
-            // return a pretty string representation of the node
-            std::string to_pretty_string(const size_t indent = 0) const override
+            // return a json node_object object specified by path
+            std::shared_ptr<node_object>
+            get_object_by_path(const std::string &path) const
             {
-                const std::string indent_str =
-                    algorithm_rda::string_index_utils::string_indent("    ", indent);
+                return object_value(find_node_by_path(path));
+            }
 
-                std::stringstream ss;
+            // return a json node_object object specified by a pre-split path
+            std::shared_ptr<node_object>
+            get_object_by_path(const json::path &p) const
+            {
+                return object_value(find_node_by_path(p));
+            }
 
-                if (!key.empty())
-                    ss << indent_str << "\"" << key << "\":" << std::endl;
+            // return a string specified by the path from a json object
+            std::string get_string_by_path(const std::string &path) const
+            {
+                return string_value(find_node_by_path(path));
+            }
 
-                ss << indent_str << "{" << std::endl;
+            // return a string specified by a pre-split path from a json object
+            std::string get_string_by_path(const json::path &p) const
+            {
+                return string_value(find_node_by_path(p));
+            }
 
-                for (size_t i = 0; i < data.size(); ++i)
-                {
-                    ss << data[i]->to_pretty_string(indent + 1);
+            // return a view of a string specified by the path from a json object, without
+            // copying it. the view is valid for the lifetime of the string node.
+            std::string_view get_string_view_by_path(const std::string &path) const
+            {
+                return string_view_value(find_node_by_path(path));
+            }
 
-                    if (i + 1 != data.size())
-                        ss << ",";
+            // return a view of a string specified by a pre-split path from a json object,
+            // without copying it. the view is valid for the lifetime of the string node.
+            std::string_view get_string_view_by_path(const json::path &p) const
+            {
+                return string_view_value(find_node_by_path(p));
+            }
 
-                    ss << std::endl;
-                }
+            // return an integer specified by the path from a json object
+            int64_t get_integer_by_path(const std::string &path) const
+            {
+                return integer_value(find_node_by_path(path));
+            }
 
-                ss << indent_str << "}";
+            // return an integer specified by a pre-split path from a json object
+            int64_t get_integer_by_path(const json::path &p) const
+            {
+                return integer_value(find_node_by_path(p));
+            }
 
-                return ss.str();
+            // return a float specified by the path from a json object
+            double get_float_by_path(const std::string &path) const
+            {
+                return float_value(find_node_by_path(path));
             }
 
-            // access child by path
-            std::shared_ptr<node> operator[](const std::string &key_name) const
+            // return a float specified by a pre-split path from a json object
+            double get_float_by_path(const json::path &p) const
             {
-                return get_node_by_path(key_name);
+                return float_value(find_node_by_path(p));
             }
 
-            // add a child node
-            void add_child(std::shared_ptr<node> child,
-                           const size_t index = std::numeric_limits<size_t>::max())
+            // return a float specified by the path of a json object, which an be either
+            // integer or floating point number
+            double get_number_by_path(const std::string &path) const
             {
-                if (child != nullptr)
-                {
-                    const size_t position = std::min(index, data.size());
-                    data.insert(data.cbegin() + position, child);
-                }
+                return number_value(find_node_by_path(path));
             }
 
-            // remove a child node by key name
-            void remove_child(const std::string &key_name)
+            // return a float specified by a pre-split path of a json object, which an be
+            // either integer or floating point number
+            double get_number_by_path(const json::path &p) const
             {
-                auto iter = std::find_if(
-                    data.cbegin(), data.cend(),
-                    [key_name](std::shared_ptr<node> n) { return key_name == n->get_key(); });
+                return number_value(find_node_by_path(p));
+            }
 
-                if (iter != data.cend())
-                    data.erase(iter);
+            // return a boolean specified by the path from a json object
+            bool get_boolean_by_path(const std::string &path) const
+            {
+                return boolean_value(find_node_by_path(path));
             }
 
-            // remove a child node by index
-            void remove_child(const size_t index)
+            // return a boolean specified by a pre-split path from a json object
+            bool get_boolean_by_path(const json::path &p) const
             {
-                if (index < data.size())
-                    data.erase(data.cbegin() + index);
+                return boolean_value(find_node_by_path(p));
             }
 
-            // return a json node specified by a string path: "path/to/node"
-            std::shared_ptr<node> get_node_by_path(const std::string &path) const
+        protected:
+            // find the node specified by a string path: "path/to/node" (nullptr if not found)
+            const std::shared_ptr<node> *find_node_by_path(const std::string &path) const
             {
-                std::vector<std::string> split_path =
-                    algorithm_rda::split_string_to_vector(path, "/");
-                return get_node_by_path(split_path);
+                // split the path without allocating, unless it is too deep for a json::path
+                const json::path p(path);
+
+                if (!p.too_deep())
+                    return find_node_by_segments(p);
+
+                return find_node_by_segments(algorithm_rda::split_string_to_vector(path, "/"));
             }
 
-            // return json node specd by vector<string> path {"path", "to", "node"}
-            std::shared_ptr<node>
-            get_node_by_path(const std::vector<std::string> &path) const
+            // find the node specified by a pre-split path (nullptr if not found)
+            const std::shared_ptr<node> *find_node_by_path(const json::path &p) const
             {
-                std::shared_ptr<node> retValue = nullptr;
+                return find_node_by_segments(p);
+            }
 
-                auto level = data;
+            // find the node specified by a sequence of key names (nullptr if not found)
+            template <typename Segments>
+            const std::shared_ptr<node> *find_node_by_segments(const Segments &segments) const
+            {
+                const node_object *level = this;
 
-                for (size_t i = 0; i < path.size(); ++i)
+                for (size_t i = 0; i < segments.size(); ++i)
                 {
-                    bool found = false;
-
-                    for (auto c : level)
-                    {
-                        if (c->get_key() == path[i])
-                        {
-                            if (i + 1 == path.size())
-                                retValue = c;
-                            else if (c->get_type() == JsonDataType::JDT_OBJECT)
-                                level = std::dynamic_pointer_cast<node_object>(c)->data;
-                            else
-                                return nullptr;
-
-                            found = true;
-                            break;
-                        }
-                    }
+                    const std::shared_ptr<node> *child = level->find_child(segments[i]);
 
-                    if (!found)
+                    if (child == nullptr)
                         break;
+
+                    if (i + 1 == segments.size())
+                        return child;
+                    else if ((*child)->get_type() == JsonDataType::JDT_OBJECT)
+                        level = static_cast<const node_object *>(child->get());
+                    else
+                        return nullptr;
                 }
 
-                return retValue;
+                return nullptr;
             }
 
-            // returns true if there exists a node specified by path
-            bool does_node_exist(const std::string &path) const
+            // returns the node found by a lookup
+            static std::shared_ptr<node> node_value(const std::shared_ptr<node> *n)
             {
-                return (get_node_by_path(path) != nullptr);
+                return (n != nullptr ? *n : nullptr);
             }
 
-            // returns the json node type specified by path
-            JsonDataType get_node_type_by_path(const std::string &path) const
+            // returns the type of the node found by a lookup
+            static JsonDataType type_value(const std::shared_ptr<node> *n)
             {
-                auto n = get_node_by_path(path);
-
-                if (n == nullptr)
-                    return JsonDataType::JDT_UNDEFINED;
-                else
-                    return n->get_type();
+                return (n != nullptr ? (*n)->get_type() : JsonDataType::JDT_UNDEFINED);
             }
 
-            // return a json node_array object specified by path
-            std::shared_ptr<node_array> get_array_by_path(const std::string &path) const
+            // returns the node found by a lookup, if it is an array
+            static std::shared_ptr<node_array> array_value(const std::shared_ptr<node> *n)
             {
-                std::shared_ptr<node> n = get_node_by_path(path);
-
-                if (n == nullptr || n->get_type() != JsonDataType::JDT_ARRAY)
+                if (n == nullptr || (*n)->get_type() != JsonDataType::JDT_ARRAY)
                     return nullptr;
 
-                return std::dynamic_pointer_cast<node_array>(n);
+                return std::static_pointer_cast<node_array>(*n);
             }
 
-            // return a json node_object object specified by path
-            std::shared_ptr<node_object>
-            get_object_by_path(const std::string &path) const
+            // returns the node found by a lookup, if it is an object
+            static std::shared_ptr<node_object> object_value(const std::shared_ptr<node> *n)
             {
-                std::shared_ptr<node> n = get_node_by_path(path);
-
-                if (n == nullptr || n->get_type() != JsonDataType::JDT_OBJECT)
+                if (n == nullptr || (*n)->get_type() != JsonDataType::JDT_OBJECT)
                     return nullptr;
 
-                return std::dynamic_pointer_cast<node_object>(n);
+                return std::static_pointer_cast<node_object>(*n);
             }
 
-            // return a string specified by the path from a json object
-            std::string get_string_by_path(const std::string &path) const
+            // returns the string data of the node found by a lookup
+            static std::string string_value(const std::shared_ptr<node> *n)
             {
-                std::shared_ptr<node> n = get_node_by_path(path);
-
-                if (n == nullptr || n->get_type() != JsonDataType::JDT_STRING)
+                if (n == nullptr || (*n)->get_type() != JsonDataType::JDT_STRING)
                     return "";
 
-                return std::dynamic_pointer_cast<node_string>(n)->get_data();
+                return static_cast<const node_string *>(n->get())->get_data();
             }
 
-            // return an integer specified by the path from a json object
-            int64_t get_integer_by_path(const std::string &path) const
+            // returns a view of the string data of the node found by a lookup
+            static std::string_view string_view_value(const std::shared_ptr<node> *n)
             {
-                std::shared_ptr<node> n = get_node_by_path(path);
+                if (n == nullptr || (*n)->get_type() != JsonDataType::JDT_STRING)
+                    return std::string_view();
 
-                if (n == nullptr || n->get_type() != JsonDataType::JDT_INTEGER)
+                return static_cast<const node_string *>(n->get())->get_data_view();
+            }
+
+            // returns the integer data of the node found by a lookup
+            static int64_t integer_value(const std::shared_ptr<node> *n)
+            {
+                if (n == nullptr || (*n)->get_type() != JsonDataType::JDT_INTEGER)
                     return 0;
 
-                return std::dynamic_pointer_cast<node_integer>(n)->get_data();
+                return static_cast<const node_integer *>(n->get())->get_data();
             }
 
-            // return a float specified by the path from a json object
-            double get_float_by_path(const std::string &path) const
+            // returns the float data of the node found by a lookup
+            static double float_value(const std::shared_ptr<node> *n)
             {
-                std::shared_ptr<node> n = get_node_by_path(path);
-
-                if (n == nullptr || n->get_type() != JsonDataType::JDT_FLOAT)
+                if (n == nullptr || (*n)->get_type() != JsonDataType::JDT_FLOAT)
                     return 0.0f;
 
-                return std::dynamic_pointer_cast<node_float>(n)->get_data();
+                return static_cast<const node_float *>(n->get())->get_data();
             }
 
-            // return a float specified by the path of a json object, which an be either
-            // integer or floating point number
-            double get_number_by_path(const std::string &path) const
+            // returns the integer or float data of the node found by a lookup
+            static double number_value(const std::shared_ptr<node> *n)
             {
-                std::shared_ptr<node> n = get_node_by_path(path);
-
                 if (n != nullptr)
                 {
-                    if (n->get_type() == JsonDataType::JDT_INTEGER)
-                        return static_cast<double>(std::dynamic_pointer_cast<node_integer>(n)->get_data());
-                    else if (n->get_type() == JsonDataType::JDT_FLOAT)
-                        return std::dynamic_pointer_cast<node_float>(n)->get_data();
+                    if ((*n)->get_type() == JsonDataType::JDT_INTEGER)
+                        return static_cast<double>(static_cast<const node_integer *>(n->get())->get_data());
+                    else if ((*n)->get_type() == JsonDataType::JDT_FLOAT)
+                        return static_cast<const node_float *>(n->get())->get_data();
                 }
 
                 return 0.0f;
             }
 
-            // return a boolean specified by the path from a json object
-            bool get_boolean_by_path(const std::string &path) const
+            // returns the boolean data of the node found by a lookup
+            static bool boolean_value(const std::shared_ptr<node> *n)
             {
-                std::shared_ptr<node> n = get_node_by_path(path);
-
-                if (n == nullptr || n->get_type() != JsonDataType::JDT_BOOLEAN)
+                if (n == nullptr || (*n)->get_type() != JsonDataType::JDT_BOOLEAN)
                     return false;
 
-                return std::dynamic_pointer_cast<node_boolean>(n)->get_data();
+                return static_cast<const node_boolean *>(n->get())->get_data();
+            }
+
+            // read the children from the lazy document, if they have not been read yet
+            void load() const
+            {
+                if (lazy != nullptr)
+                    lazy->load(data, true);
+            }
+
+            // returns the key index, building it first if necessary
+            const key_index_t &get_key_index() const
+            {
+                key_index_t *ki = key_index.load(std::memory_order_acquire);
+
+                if (ki == nullptr)
+                {
+                    auto built = std::make_unique<key_index_t>();
+                    built->reserve(data.size());
+
+                    // only the first child with each key is indexed
+                    for (size_t i = 0; i < data.size(); ++i)
+                        built->emplace(data[i]->get_key_view(), i);
+
+                    // another thread may have built the index at the same time
+                    if (key_index.compare_exchange_strong(ki, built.get(), std::memory_order_acq_rel))
+                        ki = built.release();
+                }
+
+                return *ki;
+            }
+
+            // point the key index entry for the child at position to that child
+            void set_key_index_entry(key_index_t &ki, const size_t position)
+            {
+                // the index key is a view of the child's own key, so replace the whole entry
+                ki.erase(data[position]->get_key_view());
+                ki.emplace(data[position]->get_key_view(), position);
             }
 
-        protected:
             // parse and return an object
             static std::vector<std::shared_ptr<node>>
             parse_object(const std::vector<std::string> &tokens, size_t &token_index)
@@ -1625,22 +3346,219 @@ namespace rda
             }
         }
 
-        // parse a json string and return a smart pointer to the object data
-        std::shared_ptr<node_object> parse_object(const std::string &input,
-                                                  const size_t start_index = 0)
+        // single-pass recursive descent parser. reads tokens directly from the input text
+        // and builds the node tree as it goes, instead of first splitting the whole input
+        // into a vector of token strings. builds the same tree as the token based node
+        // constructors, including for mal-formed input.
+        class parser
         {
-            size_t parse_index = start_index;
-            const auto tokens = parse_helpers::tokenize(input, parse_index);
+        private:
+            // reads tokens from the input text
+            parse_helpers::lexer lex;
 
-            if (tokens.empty())
-                return nullptr;
+            // the input text, if string values without escapes are to borrow from it
+            std::shared_ptr<const std::string> source;
 
-            if (!data_validators::is_type_object(tokens.front()))
-                return nullptr;
+            // the document being lazily parsed, if nested arrays and objects are to be skipped
+            // and read when they are first accessed
+            std::shared_ptr<const lazy_document> lazy;
+
+            // the pool that key names are interned in, if any
+            key_pool *keys = nullptr;
+
+        public:
+            // constructor
+            parser(const std::string_view input, const size_t start_index = 0)
+                : lex(input, start_index)
+            {
+            }
+
+            // constructor. string values that contain no escapes point into the source text
+            // instead of being copied, and keep it alive.
+            parser(std::shared_ptr<const std::string> source_, const size_t start_index = 0)
+                : lex(*source_, start_index), source(std::move(source_))
+            {
+            }
+
+            // constructor. key names are interned in the pool, which must outlive the nodes.
+            parser(const std::string_view input, key_pool &pool, const size_t start_index = 0)
+                : lex(input, start_index), keys(&pool)
+            {
+            }
+
+            // constructor. nested arrays and objects are skipped using the index of the lazy
+            // document, and string values borrow from its input text.
+            parser(std::shared_ptr<const lazy_document> lazy_, const size_t start_index)
+                : lex(*lazy_->get_source(), start_index), source(lazy_->get_source()), lazy(std::move(lazy_))
+            {
+            }
+
+            // parse and return an object (returns nullptr if the input does not start with one)
+            std::shared_ptr<node_object> parse_object()
+            {
+                if (!lex.next().is_delimiter('{'))
+                    return nullptr;
+
+                return std::make_shared<node_object>("", read_object_data());
+            }
+
+            // parse and return an array (returns nullptr if the input does not start with one)
+            std::shared_ptr<node_array> parse_array()
+            {
+                if (!lex.next().is_delimiter('['))
+                    return nullptr;
+
+                return std::make_shared<node_array>("", read_array_data());
+            }
+
+            // read the children of an array whose opening bracket has been read, up to and
+            // including the closing bracket
+            std::vector<std::shared_ptr<node>> read_array_data()
+            {
+                std::vector<std::shared_ptr<node>> nodes;
+                parse_helpers::token element;
+
+                while (parse_helpers::read_array_element(lex, element))
+                    nodes.push_back(make_node(parse_helpers::determine_data_type(element), "", element));
+
+                return nodes;
+            }
+
+            // read the children of an object whose opening brace has been read, up to and
+            // including the closing brace
+            std::vector<std::shared_ptr<node>> read_object_data()
+            {
+                std::vector<std::shared_ptr<node>> nodes;
+                parse_helpers::object_member member;
+
+                while (parse_helpers::read_object_member(lex, member))
+                {
+                    if (keys != nullptr && member.has_key)
+                    {
+                        std::shared_ptr<node> n = make_node(parse_helpers::determine_data_type(member.type_token),
+                                                            std::string(), member.data_token);
+                        if (n != nullptr)
+                            n->set_interned(intern(member.key));
+
+                        nodes.push_back(std::move(n));
+                        continue;
+                    }
+
+                    nodes.push_back(make_node(parse_helpers::determine_data_type(member.type_token),
+                                              member.has_key ? token_string(member.key) : std::string(),
+                                              member.data_token));
+                }
+
+                return nodes;
+            }
+
+            // read the elements of an array as read_array_data() does, but stop at the first
+            // element that starts at or after limit (without reading it). first is set to the
+            // position of the first token read that is not a comma, and stop to the position
+            // of the token that the read stopped at: that element, the closing bracket, or the
+            // end of input. returns false if the read stopped at the close of the array.
+            bool read_array_data_until(const size_t limit, std::vector<std::shared_ptr<node>> &nodes,
+                                       size_t &first, size_t &stop)
+            {
+                parse_helpers::token element;
+
+                for (bool is_first = true;; is_first = false)
+                {
+                    const bool has_element = parse_helpers::read_array_element(lex, element);
+                    stop = lex.token_position();
+
+                    if (is_first)
+                        first = stop;
+
+                    if (!has_element)
+                        return false;
+
+                    if (stop >= limit)
+                        return true;
+
+                    nodes.push_back(make_node(parse_helpers::determine_data_type(element), "", element));
+                }
+            }
+
+        private:
+            // returns the text of a token, as used for a key name or string value
+            static std::string token_string(const parse_helpers::token &t)
+            {
+                if (t.type == parse_helpers::token_type::TT_QUOTED)
+                    return parse_helpers::lexer::unescape(t);
+
+                return std::string(t.text);
+            }
+
+            // returns the handle of a key name token in the key pool. a key name without escapes
+            // is looked up without being copied.
+            const pooled_key *intern(const parse_helpers::token &t)
+            {
+                if (t.type == parse_helpers::token_type::TT_QUOTED && (t.escaped || !t.terminated))
+                    return keys->intern(token_string(t));
+
+                return keys->intern(t.text);
+            }
+
+            // create a node of the given data type, reading its data from the token
+            std::shared_ptr<node> make_node(const JsonDataType data_type,
+                                            const std::string &key_name,
+                                            const parse_helpers::token &t)
+            {
+                const bool unquoted = (t.type == parse_helpers::token_type::TT_UNQUOTED);
+
+                switch (data_type)
+                {
+                    case JsonDataType::JDT_NULL:
+                        return std::make_shared<node_null>(key_name);
+                    case JsonDataType::JDT_BOOLEAN:
+                        return std::make_shared<node_boolean>(key_name, unquoted && t.text == "true");
+                    case JsonDataType::JDT_INTEGER:
+                        return std::make_shared<node_integer>(
+                            key_name, unquoted ? number_helpers::to_integer(t.text) : 0);
+                    case JsonDataType::JDT_FLOAT:
+                        return std::make_shared<node_float>(
+                            key_name, unquoted ? number_helpers::to_float(t.text) : 0.0);
+                    case JsonDataType::JDT_ARRAY:
+                        if (lazy != nullptr)
+                            return std::make_shared<node_array>(key_name, lazy, skip_children());
+                        return std::make_shared<node_array>(key_name, read_array_data());
+                    case JsonDataType::JDT_OBJECT:
+                        if (lazy != nullptr)
+                            return std::make_shared<node_object>(key_name, lazy, skip_children());
+                        return std::make_shared<node_object>(key_name, read_object_data());
+                    case JsonDataType::JDT_STRING:
+                        if (source != nullptr && !(t.type == parse_helpers::token_type::TT_QUOTED && t.escaped))
+                            return std::make_shared<node_borrowed_string>(key_name, source, t.text);
+                        return std::make_shared<node_string>(key_name, token_string(t));
+                    default:
+                        return nullptr;
+                }
+            }
+
+            // skip over the children of an array or object whose opening delimiter has been
+            // read. returns the position where they start.
+            size_t skip_children()
+            {
+                const size_t offset = lex.position();
+                lex.seek(lazy->end_of(offset));
+                return offset;
+            }
+
+        }; // class parser
+
+        // read the children of the array or object whose children start at offset
+        std::vector<std::shared_ptr<node>> lazy_document::read_children(const size_t offset, const bool is_object) const
+        {
+            parser p(shared_from_this(), offset);
+            return (is_object ? p.read_object_data() : p.read_array_data());
+        }
 
-            // create and return the object node
-            size_t token_index = 0;
-            return std::make_shared<node_object>("", tokens, token_index);
+        // parse a json string and return a smart pointer to the object data
+        std::shared_ptr<node_object> parse_object(const std::string &input,
+                                                  const size_t start_index = 0)
+        {
+            return parser(input, start_index).parse_object();
         }
 
         // parse a json string and return a smart pointer to the object data
@@ -1654,18 +3572,79 @@ namespace rda
         std::shared_ptr<node_array> parse_array(const std::string& input,
             const size_t start_index = 0)
         {
-            size_t parse_index = start_index;
-            const auto tokens = parse_helpers::tokenize(input, parse_index);
+            return parser(input, start_index).parse_array();
+        }
+
+        // parse a json string and return a smart pointer to the object data. key names are
+        // interned in the pool, which must outlive the returned tree.
+        std::shared_ptr<node_object> parse(const std::string &input, key_pool &pool, const size_t start_index = 0)
+        {
+            return parser(input, pool, start_index).parse_object();
+        }
+
+        // parse a json string and return a smart pointer to the array data. key names are
+        // interned in the pool, which must outlive the returned tree.
+        std::shared_ptr<node_array> parse_array(const std::string &input, key_pool &pool, const size_t start_index = 0)
+        {
+            return parser(input, pool, start_index).parse_array();
+        }
+
+        // parse a json string and return a smart pointer to the object data. string values
+        // that contain no escapes point into the input instead of being copied, and the
+        // tree keeps the input alive.
+        std::shared_ptr<node_object> parse_retained(std::shared_ptr<const std::string> input,
+                                                    const size_t start_index = 0)
+        {
+            if (input == nullptr)
+                return nullptr;
+
+            return parser(std::move(input), start_index).parse_object();
+        }
+
+        // parse a json string and return a smart pointer to the array data. string values
+        // that contain no escapes point into the input instead of being copied, and the
+        // tree keeps the input alive.
+        std::shared_ptr<node_array> parse_array_retained(std::shared_ptr<const std::string> input,
+                                                         const size_t start_index = 0)
+        {
+            if (input == nullptr)
+                return nullptr;
+
+            return parser(std::move(input), start_index).parse_array();
+        }
+
+        // index a json string, and return a smart pointer to the object data. the children of
+        // each object and array are only parsed when they are first accessed, and string
+        // values that contain no escapes point into the input. the tree keeps the input alive.
+        std::shared_ptr<node_object> parse_lazy(std::shared_ptr<const std::string> input,
+                                                const size_t start_index = 0)
+        {
+            if (input == nullptr)
+                return nullptr;
+
+            parse_helpers::lexer lex(*input, start_index);
+            if (!lex.next().is_delimiter('{'))
+                return nullptr;
+
+            auto doc = std::make_shared<const lazy_document>(std::move(input), lex.position(), true);
+            return std::make_shared<node_object>("", doc, lex.position());
+        }
 
-            if (tokens.empty())
+        // index a json string, and return a smart pointer to the array data. the children of
+        // each object and array are only parsed when they are first accessed, and string
+        // values that contain no escapes point into the input. the tree keeps the input alive.
+        std::shared_ptr<node_array> parse_array_lazy(std::shared_ptr<const std::string> input,
+                                                     const size_t start_index = 0)
+        {
+            if (input == nullptr)
                 return nullptr;
 
-            if (!data_validators::is_type_array(tokens.front()))
+            parse_helpers::lexer lex(*input, start_index);
+            if (!lex.next().is_delimiter('['))
                 return nullptr;
 
-            // create and return the object node
-            size_t token_index = 0;
-            return std::make_shared<node_array>("", tokens, token_index);
+            auto doc = std::make_shared<const lazy_document>(std::move(input), lex.position(), false);
+            return std::make_shared<node_array>("", doc, lex.position());
         }
 
         // cast the node to a null node
@@ -1849,6 +3828,27 @@ namespace rda
             }
             return p;
         }
+
+        // get a view of the string value of a node, without copying it. the view is valid for
+        // the lifetime of the node.
+        std::string_view get_value_string_view(const std::shared_ptr<node> &n)
+        {
+            if (n != nullptr && n->get_type() == JsonDataType::JDT_STRING)
+                return static_cast<const node_string *>(n.get())->get_data_view();
+            return std::string_view();
+        }
+
+        // try to get a view of the string value of a node, without copying it
+        std::pair<bool, std::string_view> try_get_value_string_view(const std::shared_ptr<node> &n)
+        {
+            std::pair<bool, std::string_view> p = { false, std::string_view() };
+            if (n != nullptr && n->get_type() == JsonDataType::JDT_STRING)
+            {
+                p.first = true;
+                p.second = get_value_string_view(n);
+            }
+            return p;
+        }
         
         // populate a container of booleans
         template<typename BooleanContainer>
@@ -0,0 +1,819 @@
+#pragma once
+
+//
+// json_arena.h - Arena allocated json document. All of the nodes, keys and strings of a
+//  parsed document live in one monotonic arena, and are freed together with the document.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "json.h"
+#include "platform_defs.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE_GCC("-Wunused-function")
+
+namespace rda
+{
+    namespace json
+    {
+        // monotonic memory arena. memory is handed out from large blocks, and is only ever
+        // released all at once, when the arena is reset or destroyed.
+        class arena
+        {
+        private:
+            // default size of each block of memory
+            constexpr static const size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+            // the blocks of memory owned by the arena
+            std::vector<std::unique_ptr<char[]>> blocks;
+
+            // size of the next block to allocate
+            size_t next_block_size = DEFAULT_BLOCK_SIZE;
+
+            // next free byte in the current block
+            char *current = nullptr;
+
+            // number of free bytes remaining in the current block
+            size_t remaining = 0;
+
+            // total number of bytes handed out
+            size_t used = 0;
+
+        public:
+            // constructor
+            arena(const size_t initial_block_size = DEFAULT_BLOCK_SIZE)
+                : next_block_size(std::max(initial_block_size, static_cast<size_t>(64)))
+            {
+            }
+
+            // no copy constructor
+            arena(const arena &) = delete;
+
+            // no assignment operator
+            arena &operator=(const arena &) = delete;
+
+            // allocate size bytes with the given alignment
+            void *allocate(const size_t size, const size_t alignment = alignof(std::max_align_t))
+            {
+                size_t padding = (alignment - (reinterpret_cast<uintptr_t>(current) % alignment)) % alignment;
+
+                if (current == nullptr || padding + size > remaining)
+                {
+                    add_block(size + alignment);
+                    padding = (alignment - (reinterpret_cast<uintptr_t>(current) % alignment)) % alignment;
+                }
+
+                char *p = current + padding;
+                current += padding + size;
+                remaining -= padding + size;
+                used += size;
+
+                return p;
+            }
+
+            // allocate and construct an array of count objects of trivially destructible type T
+            template <typename T>
+            T *allocate_array(const size_t count)
+            {
+                static_assert(std::is_trivially_destructible<T>::value, "arena objects are never destroyed");
+
+                T *p = static_cast<T *>(allocate(sizeof(T) * std::max(count, static_cast<size_t>(1)), alignof(T)));
+
+                for (size_t i = 0; i < count; ++i)
+                    new (p + i) T();
+
+                return p;
+            }
+
+            // release all memory held by the arena
+            void reset()
+            {
+                blocks.clear();
+                current = nullptr;
+                remaining = 0;
+                used = 0;
+            }
+
+            // returns the number of bytes handed out by the arena
+            size_t bytes_used() const
+            {
+                return used;
+            }
+
+            // returns the number of blocks allocated by the arena
+            size_t block_count() const
+            {
+                return blocks.size();
+            }
+
+        private:
+            // add a new block, large enough to hold at least min_size bytes
+            void add_block(const size_t min_size)
+            {
+                const size_t size = std::max(next_block_size, min_size);
+
+                blocks.emplace_back(new char[size]);
+                current = blocks.back().get();
+                remaining = size;
+
+                // grow the blocks geometrically, so large documents need few of them
+                next_block_size = size * 2;
+            }
+
+        }; // class arena
+
+        // node of an arena allocated json document. nodes do not own any memory; keys,
+        // strings and child nodes all refer into the arena of the document.
+        class arena_node
+        {
+            friend class arena_document;
+
+        private:
+            // node data type
+            JsonDataType type = JsonDataType::JDT_UNDEFINED;
+
+            // key name
+            std::string_view key;
+
+            // string data (JDT_STRING)
+            std::string_view string_data;
+
+            // number of child nodes (JDT_ARRAY, JDT_OBJECT)
+            size_t child_count = 0;
+
+            // contiguous array of child nodes (JDT_ARRAY, JDT_OBJECT)
+            const arena_node *children = nullptr;
+
+            // scalar data
+            union
+            {
+                bool boolean_data;
+                int64_t integer_data;
+                double float_data;
+            };
+
+        public:
+            // constructor
+            arena_node()
+                : integer_data(0)
+            {
+            }
+
+            // returns the json node type
+            JsonDataType get_type() const
+            {
+                return type;
+            }
+
+            // returns the key name
+            std::string_view get_key() const
+            {
+                return key;
+            }
+
+            // get the boolean data (false if not a boolean)
+            bool get_boolean() const
+            {
+                return (type == JsonDataType::JDT_BOOLEAN && boolean_data);
+            }
+
+            // get the integer data (0 if not an integer)
+            int64_t get_integer() const
+            {
+                return (type == JsonDataType::JDT_INTEGER ? integer_data : 0);
+            }
+
+            // get the float data (0.0 if not a float)
+            double get_float() const
+            {
+                return (type == JsonDataType::JDT_FLOAT ? float_data : 0.0);
+            }
+
+            // get the string data (empty if not a string)
+            std::string_view get_string() const
+            {
+                return string_data;
+            }
+
+            // begin iterator over child nodes
+            const arena_node *begin() const
+            {
+                return children;
+            }
+
+            // end iterator over child nodes
+            const arena_node *end() const
+            {
+                return children + child_count;
+            }
+
+            // returns the number of child elements
+            size_t size() const
+            {
+                return child_count;
+            }
+
+            // returns if there are no child elements
+            bool empty() const
+            {
+                return child_count == 0;
+            }
+
+            // access child by index
+            const arena_node *operator[](const size_t index) const
+            {
+                if (index >= child_count)
+                    return nullptr;
+                return children + index;
+            }
+
+            // access child by path
+            const arena_node *operator[](const std::string_view path) const
+            {
+                return get_node_by_path(path);
+            }
+
+            // returns the first child with the given key name
+            const arena_node *find(const std::string_view key_name) const
+            {
+                for (const arena_node &child : *this)
+                    if (child.key == key_name)
+                        return &child;
+
+                return nullptr;
+            }
+
+            // return a json node specified by a string path: "path/to/node"
+            const arena_node *get_node_by_path(const std::string_view path) const
+            {
+                if (type != JsonDataType::JDT_OBJECT)
+                    return nullptr;
+
+                const arena_node *level = this;
+                const arena_node *found = nullptr;
+                size_t start = 0;
+
+                while (start <= path.size())
+                {
+                    size_t end = path.find('/', start);
+                    if (end == std::string_view::npos)
+                        end = path.size();
+
+                    // empty path segments are skipped, as when splitting a path
+                    if (end > start)
+                    {
+                        if (level == nullptr || level->type != JsonDataType::JDT_OBJECT)
+                            return nullptr;
+
+                        found = level->find(path.substr(start, end - start));
+                        if (found == nullptr)
+                            return nullptr;
+
+                        level = found;
+                    }
+
+                    start = end + 1;
+                }
+
+                return found;
+            }
+
+            // return a json node specified by a pre-split path
+            const arena_node *get_node_by_path(const path &p) const
+            {
+                if (type != JsonDataType::JDT_OBJECT || p.empty())
+                    return nullptr;
+
+                const arena_node *level = this;
+
+                for (const std::string_view key_name : p)
+                {
+                    if (level->type != JsonDataType::JDT_OBJECT)
+                        return nullptr;
+
+                    level = level->find(key_name);
+                    if (level == nullptr)
+                        return nullptr;
+                }
+
+                return level;
+            }
+
+            // returns true if there exists a node specified by path
+            bool does_node_exist(const std::string_view path) const
+            {
+                return (get_node_by_path(path) != nullptr);
+            }
+
+            // returns true if there exists a node specified by a pre-split path
+            bool does_node_exist(const path &p) const
+            {
+                return (get_node_by_path(p) != nullptr);
+            }
+
+            // returns the json node type specified by path
+            JsonDataType get_node_type_by_path(const std::string_view path) const
+            {
+                const arena_node *n = get_node_by_path(path);
+                return (n == nullptr ? JsonDataType::JDT_UNDEFINED : n->type);
+            }
+
+            // returns the json node type specified by a pre-split path
+            JsonDataType get_node_type_by_path(const path &p) const
+            {
+                const arena_node *n = get_node_by_path(p);
+                return (n == nullptr ? JsonDataType::JDT_UNDEFINED : n->type);
+            }
+
+            // return an array node specified by path
+            const arena_node *get_array_by_path(const std::string_view path) const
+            {
+                const arena_node *n = get_node_by_path(path);
+                return (n != nullptr && n->type == JsonDataType::JDT_ARRAY ? n : nullptr);
+            }
+
+            // return an array node specified by a pre-split path
+            const arena_node *get_array_by_path(const path &p) const
+            {
+                const arena_node *n = get_node_by_path(p);
+                return (n != nullptr && n->type == JsonDataType::JDT_ARRAY ? n : nullptr);
+            }
+
+            // return an object node specified by path
+            const arena_node *get_object_by_path(const std::string_view path) const
+            {
+                const arena_node *n = get_node_by_path(path);
+                return (n != nullptr && n->type == JsonDataType::JDT_OBJECT ? n : nullptr);
+            }
+
+            // return an object node specified by a pre-split path
+            const arena_node *get_object_by_path(const path &p) const
+            {
+                const arena_node *n = get_node_by_path(p);
+                return (n != nullptr && n->type == JsonDataType::JDT_OBJECT ? n : nullptr);
+            }
+
+            // return a string specified by the path
+            std::string_view get_string_by_path(const std::string_view path) const
+            {
+                const arena_node *n = get_node_by_path(path);
+                return (n != nullptr ? n->get_string() : std::string_view());
+            }
+
+            // return a string specified by a pre-split path
+            std::string_view get_string_by_path(const path &p) const
+            {
+                const arena_node *n = get_node_by_path(p);
+                return (n != nullptr ? n->get_string() : std::string_view());
+            }
+
+            // return an integer specified by the path
+            int64_t get_integer_by_path(const std::string_view path) const
+            {
+                const arena_node *n = get_node_by_path(path);
+                return (n != nullptr ? n->get_integer() : 0);
+            }
+
+            // return an integer specified by a pre-split path
+            int64_t get_integer_by_path(const path &p) const
+            {
+                const arena_node *n = get_node_by_path(p);
+                return (n != nullptr ? n->get_integer() : 0);
+            }
+
+            // return a float specified by the path
+            double get_float_by_path(const std::string_view path) const
+            {
+                const arena_node *n = get_node_by_path(path);
+                return (n != nullptr ? n->get_float() : 0.0);
+            }
+
+            // return a float specified by a pre-split path
+            double get_float_by_path(const path &p) const
+            {
+                const arena_node *n = get_node_by_path(p);
+                return (n != nullptr ? n->get_float() : 0.0);
+            }
+
+            // return a float specified by the path, which can be either integer or floating point number
+            double get_number_by_path(const std::string_view path) const
+            {
+                const arena_node *n = get_node_by_path(path);
+
+                if (n != nullptr && n->type == JsonDataType::JDT_INTEGER)
+                    return static_cast<double>(n->integer_data);
+
+                return (n != nullptr ? n->get_float() : 0.0);
+            }
+
+            // return a float specified by a pre-split path, which can be either integer or floating point number
+            double get_number_by_path(const path &p) const
+            {
+                const arena_node *n = get_node_by_path(p);
+
+                if (n != nullptr && n->type == JsonDataType::JDT_INTEGER)
+                    return static_cast<double>(n->integer_data);
+
+                return (n != nullptr ? n->get_float() : 0.0);
+            }
+
+            // return a boolean specified by the path
+            bool get_boolean_by_path(const std::string_view path) const
+            {
+                const arena_node *n = get_node_by_path(path);
+                return (n != nullptr && n->get_boolean());
+            }
+
+            // return a boolean specified by a pre-split path
+            bool get_boolean_by_path(const path &p) const
+            {
+                const arena_node *n = get_node_by_path(p);
+                return (n != nullptr && n->get_boolean());
+            }
+
+            // build and return an equivalent, heap allocated node
+            std::shared_ptr<node> to_node() const
+            {
+                const std::string key_name(key);
+
+                switch (type)
+                {
+                    case JsonDataType::JDT_NULL:
+                        return std::make_shared<node_null>(key_name);
+                    case JsonDataType::JDT_BOOLEAN:
+                        return std::make_shared<node_boolean>(key_name, boolean_data);
+                    case JsonDataType::JDT_INTEGER:
+                        return std::make_shared<node_integer>(key_name, integer_data);
+                    case JsonDataType::JDT_FLOAT:
+                        return std::make_shared<node_float>(key_name, float_data);
+                    case JsonDataType::JDT_STRING:
+                        return std::make_shared<node_string>(key_name, std::string(string_data));
+                    case JsonDataType::JDT_ARRAY:
+                        return std::make_shared<node_array>(key_name, children_to_nodes());
+                    case JsonDataType::JDT_OBJECT:
+                        return std::make_shared<node_object>(key_name, children_to_nodes());
+                    default:
+                        return nullptr;
+                }
+            }
+
+        private:
+            // build heap allocated nodes for all child nodes
+            std::vector<std::shared_ptr<node>> children_to_nodes() const
+            {
+                std::vector<std::shared_ptr<node>> nodes;
+                nodes.reserve(child_count);
+
+                for (const arena_node &child : *this)
+                    nodes.push_back(child.to_node());
+
+                return nodes;
+            }
+
+        }; // class arena_node
+
+        // json document whose nodes, keys and strings are all stored in one arena. the
+        // whole document is released at once, without visiting each node.
+        class arena_document
+        {
+        private:
+            // memory for the nodes, keys and strings of the document
+            arena memory;
+
+            // the root node (nullptr if nothing was parsed)
+            const arena_node *root = nullptr;
+
+            // stack of completed child nodes, waiting for their parent to close
+            std::vector<arena_node> pending;
+
+        public:
+            // constructor
+            arena_document(const size_t initial_block_size = 64 * 1024)
+                : memory(initial_block_size)
+            {
+            }
+
+            // no copy constructor
+            arena_document(const arena_document &) = delete;
+
+            // no assignment operator
+            arena_document &operator=(const arena_document &) = delete;
+
+            // parse an object from the input, replacing any previous contents. returns false
+            // if the input does not start with an object.
+            bool parse_object(const std::string_view input, const size_t start_index = 0)
+            {
+                return parse(input, start_index, '{');
+            }
+
+            // parse an array from the input, replacing any previous contents. returns false
+            // if the input does not start with an array.
+            bool parse_array(const std::string_view input, const size_t start_index = 0)
+            {
+                return parse(input, start_index, '[');
+            }
+
+            // returns the root node (nullptr if nothing was parsed)
+            const arena_node *get_root() const
+            {
+                return root;
+            }
+
+            // returns the memory arena of the document
+            const arena &get_arena() const
+            {
+                return memory;
+            }
+
+            // release the document
+            void clear()
+            {
+                root = nullptr;
+                memory.reset();
+            }
+
+            // return a json node specified by a string path: "path/to/node"
+            const arena_node *get_node_by_path(const std::string_view path) const
+            {
+                return (root != nullptr ? root->get_node_by_path(path) : nullptr);
+            }
+
+            // return a json node specified by a pre-split path
+            const arena_node *get_node_by_path(const path &p) const
+            {
+                return (root != nullptr ? root->get_node_by_path(p) : nullptr);
+            }
+
+            // returns true if there exists a node specified by path
+            bool does_node_exist(const std::string_view path) const
+            {
+                return (get_node_by_path(path) != nullptr);
+            }
+
+            // returns true if there exists a node specified by a pre-split path
+            bool does_node_exist(const path &p) const
+            {
+                return (get_node_by_path(p) != nullptr);
+            }
+
+            // returns the json node type specified by path
+            JsonDataType get_node_type_by_path(const std::string_view path) const
+            {
+                return (root != nullptr ? root->get_node_type_by_path(path) : JsonDataType::JDT_UNDEFINED);
+            }
+
+            // returns the json node type specified by a pre-split path
+            JsonDataType get_node_type_by_path(const path &p) const
+            {
+                return (root != nullptr ? root->get_node_type_by_path(p) : JsonDataType::JDT_UNDEFINED);
+            }
+
+            // return an array node specified by path
+            const arena_node *get_array_by_path(const std::string_view path) const
+            {
+                return (root != nullptr ? root->get_array_by_path(path) : nullptr);
+            }
+
+            // return an array node specified by a pre-split path
+            const arena_node *get_array_by_path(const path &p) const
+            {
+                return (root != nullptr ? root->get_array_by_path(p) : nullptr);
+            }
+
+            // return an object node specified by path
+            const arena_node *get_object_by_path(const std::string_view path) const
+            {
+                return (root != nullptr ? root->get_object_by_path(path) : nullptr);
+            }
+
+            // return an object node specified by a pre-split path
+            const arena_node *get_object_by_path(const path &p) const
+            {
+                return (root != nullptr ? root->get_object_by_path(p) : nullptr);
+            }
+
+            // return a string specified by the path
+            std::string_view get_string_by_path(const std::string_view path) const
+            {
+                return (root != nullptr ? root->get_string_by_path(path) : std::string_view());
+            }
+
+            // return a string specified by a pre-split path
+            std::string_view get_string_by_path(const path &p) const
+            {
+                return (root != nullptr ? root->get_string_by_path(p) : std::string_view());
+            }
+
+            // return an integer specified by the path
+            int64_t get_integer_by_path(const std::string_view path) const
+            {
+                return (root != nullptr ? root->get_integer_by_path(path) : 0);
+            }
+
+            // return an integer specified by a pre-split path
+            int64_t get_integer_by_path(const path &p) const
+            {
+                return (root != nullptr ? root->get_integer_by_path(p) : 0);
+            }
+
+            // return a float specified by the path
+            double get_float_by_path(const std::string_view path) const
+            {
+                return (root != nullptr ? root->get_float_by_path(path) : 0.0);
+            }
+
+            // return a float specified by a pre-split path
+            double get_float_by_path(const path &p) const
+            {
+                return (root != nullptr ? root->get_float_by_path(p) : 0.0);
+            }
+
+            // return a float specified by the path, which can be either integer or floating point number
+            double get_number_by_path(const std::string_view path) const
+            {
+                return (root != nullptr ? root->get_number_by_path(path) : 0.0);
+            }
+
+            // return a float specified by a pre-split path, which can be either integer or floating point number
+            double get_number_by_path(const path &p) const
+            {
+                return (root != nullptr ? root->get_number_by_path(p) : 0.0);
+            }
+
+            // return a boolean specified by the path
+            bool get_boolean_by_path(const std::string_view path) const
+            {
+                return (root != nullptr && root->get_boolean_by_path(path));
+            }
+
+            // return a boolean specified by a pre-split path
+            bool get_boolean_by_path(const path &p) const
+            {
+                return (root != nullptr && root->get_boolean_by_path(p));
+            }
+
+        private:
+            // parse the input, which must start with the open character
+            bool parse(const std::string_view input, const size_t start_index, const char open)
+            {
+                clear();
+
+                parse_helpers::lexer lex(input, start_index);
+                const parse_helpers::token first = lex.next();
+
+                if (!first.is_delimiter(open))
+                    return false;
+
+                arena_node *r = memory.allocate_array<arena_node>(1);
+                fill_node(*r, parse_helpers::determine_data_type(first), std::string_view(), first, lex);
+                root = r;
+
+                pending.clear();
+                return true;
+            }
+
+            // copy text into the arena, returning a view of the copy
+            std::string_view store(const std::string_view text)
+            {
+                if (text.empty())
+                    return std::string_view();
+
+                char *p = static_cast<char *>(memory.allocate(text.size(), 1));
+                std::copy(text.cbegin(), text.cend(), p);
+                return std::string_view(p, text.size());
+            }
+
+            // copy the text of a token into the arena (applying escapes), returning a view of the copy
+            std::string_view store(const parse_helpers::token &t)
+            {
+                if (t.type != parse_helpers::token_type::TT_QUOTED)
+                    return store(t.text);
+
+                if (t.text.empty())
+                    return std::string_view();
+
+                char *p = static_cast<char *>(memory.allocate(t.text.size(), 1));
+                return std::string_view(p, parse_helpers::lexer::unescape(t, p));
+            }
+
+            // fill in a node of the given data type, reading its data from the token
+            void fill_node(arena_node &n, const JsonDataType data_type, const std::string_view key_name,
+                           const parse_helpers::token &t, parse_helpers::lexer &lex)
+            {
+                const bool unquoted = (t.type == parse_helpers::token_type::TT_UNQUOTED);
+
+                n.type = data_type;
+                n.key = key_name;
+
+                switch (data_type)
+                {
+                    case JsonDataType::JDT_BOOLEAN:
+                        n.boolean_data = (unquoted && t.text == "true");
+                        break;
+                    case JsonDataType::JDT_INTEGER:
+                        n.integer_data = (unquoted ? number_helpers::to_integer(t.text) : 0);
+                        break;
+                    case JsonDataType::JDT_FLOAT:
+                        n.float_data = (unquoted ? number_helpers::to_float(t.text) : 0.0);
+                        break;
+                    case JsonDataType::JDT_STRING:
+                        n.string_data = store(t);
+                        break;
+                    case JsonDataType::JDT_ARRAY:
+                        read_array_children(n, lex);
+                        break;
+                    case JsonDataType::JDT_OBJECT:
+                        read_object_children(n, lex);
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            // move the nodes pending above stack_base into a contiguous array in the arena,
+            // as the children of n
+            void adopt_pending(arena_node &n, const size_t stack_base)
+            {
+                n.child_count = pending.size() - stack_base;
+
+                arena_node *children = memory.allocate_array<arena_node>(n.child_count);
+                std::copy(pending.cbegin() + static_cast<std::ptrdiff_t>(stack_base), pending.cend(), children);
+                n.children = children;
+
+                pending.resize(stack_base);
+            }
+
+            // read the children of an array, up to and including the closing bracket
+            void read_array_children(arena_node &n, parse_helpers::lexer &lex)
+            {
+                const size_t stack_base = pending.size();
+                parse_helpers::token element;
+
+                while (parse_helpers::read_array_element(lex, element))
+                {
+                    arena_node child;
+                    fill_node(child, parse_helpers::determine_data_type(element), std::string_view(), element, lex);
+                    pending.push_back(child);
+                }
+
+                adopt_pending(n, stack_base);
+            }
+
+            // read the children of an object, up to and including the closing brace
+            void read_object_children(arena_node &n, parse_helpers::lexer &lex)
+            {
+                const size_t stack_base = pending.size();
+                parse_helpers::object_member member;
+
+                while (parse_helpers::read_object_member(lex, member))
+                {
+                    arena_node child;
+                    fill_node(child, parse_helpers::determine_data_type(member.type_token),
+                              member.has_key ? store(member.key) : std::string_view(),
+                              member.data_token, lex);
+                    pending.push_back(child);
+                }
+
+                adopt_pending(n, stack_base);
+            }
+
+        }; // class arena_document
+
+        // parse a json string into an arena allocated document (nullptr if the input does not start with an object)
+        std::shared_ptr<arena_document> parse_arena(const std::string_view input, const size_t start_index = 0)
+        {
+            auto doc = std::make_shared<arena_document>(std::max(input.size(), static_cast<size_t>(4096)));
+
+            if (!doc->parse_object(input, start_index))
+                return nullptr;
+
+            return doc;
+        }
+
+        // parse a json string into an arena allocated document (nullptr if the input does not start with an array)
+        std::shared_ptr<arena_document> parse_arena_array(const std::string_view input, const size_t start_index = 0)
+        {
+            auto doc = std::make_shared<arena_document>(std::max(input.size(), static_cast<size_t>(4096)));
+
+            if (!doc->parse_array(input, start_index))
+                return nullptr;
+
+            return doc;
+        }
+
+    } // namespace json
+} // namespace rda
+
+POP_WARN_DISABLE
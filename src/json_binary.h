@@ -0,0 +1,733 @@
+#pragma once
+
+//
+// json_binary.h - Compact binary encoding of json node trees. Keeps the data type of every
+//  node (including integer vs float), every key name and the order of children. Arrays and
+//  objects are prefixed with their encoded length, so a reader can skip over a sub-tree, or
+//  look values up directly in the encoded bytes, without decoding the rest.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "json.h"
+#include "platform_defs.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE_GCC("-Wunused-function")
+
+//
+// layout of an encoded document:
+//
+//   document := "RJB" version(1 byte) value
+//   value    := tag(1 byte) key payload
+//   key      := length(varint) bytes
+//
+//   tag      payload
+//   ---      -------
+//   null     (none)
+//   false    (none)
+//   true     (none)
+//   integer  zig-zag varint
+//   float    8 bytes, little endian ieee 754
+//   string   length(varint) bytes
+//   array    body length(8 bytes, little endian) body, where body := count(varint) value*
+//   object   body length(8 bytes, little endian) body, where body := count(varint) value*
+//
+// varints are unsigned, little endian base 128 (7 bits per byte, the high bit set on every
+// byte except the last).
+//
+
+namespace rda
+{
+    namespace json
+    {
+        // helper classes and methods for the binary encoding
+        namespace binary_helpers
+        {
+            // the bytes at the start of every encoded document
+            constexpr static const char MAGIC[3] = {'R', 'J', 'B'};
+
+            // version of the encoding (version 1 had a 4 byte body length)
+            constexpr static const uint8_t VERSION = 2;
+
+            // size of the document header
+            constexpr static const size_t HEADER_SIZE = 4;
+
+            // size of the body length of an array or object (8 bytes, so that a body of 4 GB or
+            // more is not truncated)
+            constexpr static const size_t BODY_LENGTH_SIZE = 8;
+
+            // tag byte at the start of every value
+            enum class binary_tag : uint8_t
+            {
+                BT_NULL = 0,
+                BT_FALSE = 1,
+                BT_TRUE = 2,
+                BT_INTEGER = 3,
+                BT_FLOAT = 4,
+                BT_STRING = 5,
+                BT_ARRAY = 6,
+                BT_OBJECT = 7
+            };
+
+            // append an unsigned varint
+            void write_varint(std::string &out, uint64_t value)
+            {
+                while (value >= 0x80)
+                {
+                    out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+                    value >>= 7;
+                }
+
+                out.push_back(static_cast<char>(value));
+            }
+
+            // append a little endian integer of the given number of bytes
+            void write_fixed(std::string &out, const uint64_t value, const size_t num_bytes)
+            {
+                for (size_t i = 0; i < num_bytes; ++i)
+                    out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+            }
+
+            // overwrite a little endian integer of the given number of bytes at position
+            void patch_fixed(std::string &out, const size_t position, const uint64_t value, const size_t num_bytes)
+            {
+                for (size_t i = 0; i < num_bytes; ++i)
+                    out[position + i] = static_cast<char>((value >> (8 * i)) & 0xff);
+            }
+
+            // append a length prefixed run of bytes
+            void write_bytes(std::string &out, const std::string_view bytes)
+            {
+                write_varint(out, bytes.size());
+                out.append(bytes.data(), bytes.size());
+            }
+
+            // append a node, its key name, and all of its children
+            void write_value(std::string &out, const node &n)
+            {
+                const size_t tag_position = out.size();
+                out.push_back(0);
+                write_bytes(out, n.get_key_view());
+
+                binary_tag tag = binary_tag::BT_NULL;
+
+                switch (n.get_type())
+                {
+                    case JsonDataType::JDT_BOOLEAN:
+                    {
+                        tag = (static_cast<const node_boolean &>(n).get_data() ? binary_tag::BT_TRUE : binary_tag::BT_FALSE);
+                        break;
+                    }
+                    case JsonDataType::JDT_INTEGER:
+                    {
+                        tag = binary_tag::BT_INTEGER;
+                        const int64_t value = static_cast<const node_integer &>(n).get_data();
+                        write_varint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+                        break;
+                    }
+                    case JsonDataType::JDT_FLOAT:
+                    {
+                        tag = binary_tag::BT_FLOAT;
+                        const double value = static_cast<const node_float &>(n).get_data();
+                        uint64_t bits = 0;
+                        memcpy(&bits, &value, sizeof(bits));
+                        write_fixed(out, bits, sizeof(bits));
+                        break;
+                    }
+                    case JsonDataType::JDT_STRING:
+                    {
+                        tag = binary_tag::BT_STRING;
+                        write_bytes(out, static_cast<const node_string &>(n).get_data_view());
+                        break;
+                    }
+                    case JsonDataType::JDT_ARRAY:
+                    case JsonDataType::JDT_OBJECT:
+                    {
+                        const bool is_array = (n.get_type() == JsonDataType::JDT_ARRAY);
+                        const auto &children = (is_array ? static_cast<const node_array &>(n).get_data()
+                                                         : static_cast<const node_object &>(n).get_data());
+
+                        tag = (is_array ? binary_tag::BT_ARRAY : binary_tag::BT_OBJECT);
+
+                        // the body length is filled in once the body has been written
+                        const size_t length_position = out.size();
+                        write_fixed(out, 0, BODY_LENGTH_SIZE);
+                        write_varint(out, children.size());
+
+                        for (const auto &child : children)
+                            write_value(out, *child);
+
+                        patch_fixed(out, length_position, out.size() - length_position - BODY_LENGTH_SIZE, BODY_LENGTH_SIZE);
+                        break;
+                    }
+                    default:
+                    {
+                        break;
+                    }
+                }
+
+                out[tag_position] = static_cast<char>(tag);
+            }
+
+            // reads from encoded bytes. every read checks the bounds of the input, and a
+            // failed read leaves the reader failed, so callers can check once at the end.
+            class reader
+            {
+            private:
+                // the encoded bytes
+                std::string_view input;
+
+                // current read position
+                size_t index = 0;
+
+                // true if a read has failed
+                bool failed = false;
+
+            public:
+                // constructor
+                explicit reader(const std::string_view input_, const size_t start_index = 0)
+                    : input(input_), index(start_index), failed(start_index > input_.size())
+                {
+                }
+
+                // returns the current read position
+                size_t position() const
+                {
+                    return index;
+                }
+
+                // returns the number of unread bytes
+                size_t remaining() const
+                {
+                    return input.size() - index;
+                }
+
+                // returns true if no read has failed
+                bool ok() const
+                {
+                    return !failed;
+                }
+
+                // read a single byte
+                uint8_t read_byte()
+                {
+                    if (failed || index >= input.size())
+                        return fail<uint8_t>();
+
+                    return static_cast<uint8_t>(input[index++]);
+                }
+
+                // read an unsigned varint
+                uint64_t read_varint()
+                {
+                    uint64_t value = 0;
+
+                    for (unsigned int shift = 0; shift < 64; shift += 7)
+                    {
+                        const uint8_t b = read_byte();
+                        value |= (static_cast<uint64_t>(b & 0x7f) << shift);
+
+                        if ((b & 0x80) == 0)
+                            return value;
+                    }
+
+                    return fail<uint64_t>();
+                }
+
+                // read a little endian integer of the given number of bytes
+                uint64_t read_fixed(const size_t num_bytes)
+                {
+                    if (failed || input.size() - index < num_bytes)
+                        return fail<uint64_t>();
+
+                    uint64_t value = 0;
+
+                    for (size_t i = 0; i < num_bytes; ++i)
+                        value |= (static_cast<uint64_t>(static_cast<uint8_t>(input[index + i])) << (8 * i));
+
+                    index += num_bytes;
+                    return value;
+                }
+
+                // read a length prefixed run of bytes
+                std::string_view read_bytes()
+                {
+                    const uint64_t length = read_varint();
+
+                    if (failed || input.size() - index < length)
+                        return fail<std::string_view>();
+
+                    const std::string_view bytes = input.substr(index, static_cast<size_t>(length));
+                    index += static_cast<size_t>(length);
+                    return bytes;
+                }
+
+                // move the read position forward by a number of bytes
+                void skip(const uint64_t num_bytes)
+                {
+                    if (failed || input.size() - index < num_bytes)
+                        fail<int>();
+                    else
+                        index += static_cast<size_t>(num_bytes);
+                }
+
+                // skip over the payload of a value whose tag and key have been read
+                void skip_payload(const binary_tag tag)
+                {
+                    switch (tag)
+                    {
+                        case binary_tag::BT_NULL:
+                        case binary_tag::BT_FALSE:
+                        case binary_tag::BT_TRUE:
+                            break;
+                        case binary_tag::BT_INTEGER:
+                            read_varint();
+                            break;
+                        case binary_tag::BT_FLOAT:
+                            skip(sizeof(double));
+                            break;
+                        case binary_tag::BT_STRING:
+                            read_bytes();
+                            break;
+                        case binary_tag::BT_ARRAY:
+                        case binary_tag::BT_OBJECT:
+                            skip(read_fixed(BODY_LENGTH_SIZE));
+                            break;
+                        default:
+                            fail<int>();
+                            break;
+                    }
+                }
+
+            private:
+                // mark the reader as failed, and return an empty value
+                template <typename T>
+                T fail()
+                {
+                    failed = true;
+                    return T();
+                }
+
+            }; // class reader
+
+            // returns true if the tag byte is a known tag
+            bool is_valid_tag(const uint8_t tag)
+            {
+                return (tag <= static_cast<uint8_t>(binary_tag::BT_OBJECT));
+            }
+
+            // returns the json data type of a tag
+            JsonDataType tag_type(const binary_tag tag)
+            {
+                switch (tag)
+                {
+                    case binary_tag::BT_NULL:
+                        return JsonDataType::JDT_NULL;
+                    case binary_tag::BT_FALSE:
+                    case binary_tag::BT_TRUE:
+                        return JsonDataType::JDT_BOOLEAN;
+                    case binary_tag::BT_INTEGER:
+                        return JsonDataType::JDT_INTEGER;
+                    case binary_tag::BT_FLOAT:
+                        return JsonDataType::JDT_FLOAT;
+                    case binary_tag::BT_STRING:
+                        return JsonDataType::JDT_STRING;
+                    case binary_tag::BT_ARRAY:
+                        return JsonDataType::JDT_ARRAY;
+                    case binary_tag::BT_OBJECT:
+                        return JsonDataType::JDT_OBJECT;
+                    default:
+                        return JsonDataType::JDT_UNDEFINED;
+                }
+            }
+
+            // decode the value at the read position, and all of its children (nullptr if
+            // the input is not valid)
+            std::shared_ptr<node> read_value(reader &r)
+            {
+                const uint8_t tag_byte = r.read_byte();
+                const std::string key_name(r.read_bytes());
+
+                if (!r.ok() || !is_valid_tag(tag_byte))
+                    return nullptr;
+
+                switch (static_cast<binary_tag>(tag_byte))
+                {
+                    case binary_tag::BT_NULL:
+                        return std::make_shared<node_null>(key_name);
+                    case binary_tag::BT_FALSE:
+                        return std::make_shared<node_boolean>(key_name, false);
+                    case binary_tag::BT_TRUE:
+                        return std::make_shared<node_boolean>(key_name, true);
+                    case binary_tag::BT_INTEGER:
+                    {
+                        const uint64_t zigzag = r.read_varint();
+                        const int64_t value = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+                        return (r.ok() ? std::make_shared<node_integer>(key_name, value) : nullptr);
+                    }
+                    case binary_tag::BT_FLOAT:
+                    {
+                        const uint64_t bits = r.read_fixed(sizeof(double));
+                        double value = 0.0;
+                        memcpy(&value, &bits, sizeof(value));
+                        return (r.ok() ? std::make_shared<node_float>(key_name, value) : nullptr);
+                    }
+                    case binary_tag::BT_STRING:
+                    {
+                        const std::string_view value = r.read_bytes();
+                        return (r.ok() ? std::make_shared<node_string>(key_name, std::string(value)) : nullptr);
+                    }
+                    case binary_tag::BT_ARRAY:
+                    case binary_tag::BT_OBJECT:
+                    {
+                        const uint64_t body_length = r.read_fixed(BODY_LENGTH_SIZE);
+                        const size_t body_start = r.position();
+
+                        if (!r.ok() || body_length > r.remaining())
+                            return nullptr;
+
+                        // every child takes at least two bytes, which bounds a corrupt count
+                        const uint64_t count = r.read_varint();
+                        if (!r.ok() || count > body_length / 2)
+                            return nullptr;
+
+                        std::vector<std::shared_ptr<node>> children;
+                        children.reserve(static_cast<size_t>(count));
+
+                        for (uint64_t i = 0; i < count; ++i)
+                        {
+                            std::shared_ptr<node> child = read_value(r);
+                            if (child == nullptr)
+                                return nullptr;
+                            children.push_back(std::move(child));
+                        }
+
+                        if (r.position() - body_start != body_length)
+                            return nullptr;
+
+                        if (tag_byte == static_cast<uint8_t>(binary_tag::BT_ARRAY))
+                            return std::make_shared<node_array>(key_name, std::move(children));
+
+                        return std::make_shared<node_object>(key_name, std::move(children));
+                    }
+                    default:
+                        return nullptr;
+                }
+            }
+
+        } // namespace binary_helpers
+
+        // encodes json nodes into a buffer that is kept between calls, so that once it has
+        // grown large enough, encoding does not allocate any memory
+        class binary_encoder
+        {
+        private:
+            // the encoded bytes
+            std::string buffer;
+
+        public:
+            // constructor
+            explicit binary_encoder(const size_t initial_capacity = 0)
+            {
+                buffer.reserve(initial_capacity);
+            }
+
+            // replace the contents of the buffer with the encoded document, and return a view
+            // of it. the view is valid until the encoder is next used.
+            std::string_view encode(const node &n)
+            {
+                buffer.clear();
+                buffer.append(binary_helpers::MAGIC, sizeof(binary_helpers::MAGIC));
+                buffer.push_back(static_cast<char>(binary_helpers::VERSION));
+                binary_helpers::write_value(buffer, n);
+                return buffer;
+            }
+
+            // returns the contents of the buffer
+            std::string_view get_buffer() const
+            {
+                return buffer;
+            }
+
+            // returns the number of bytes in the buffer
+            size_t size() const
+            {
+                return buffer.size();
+            }
+
+        }; // class binary_encoder
+
+        // a value inside of an encoded document, read in place. looking up a child skips over
+        // the encoded bytes of the children before it, without decoding them. a default
+        // constructed (or failed) value is not valid, and has the type JDT_UNDEFINED.
+        class binary_value
+        {
+        private:
+            // the encoded document
+            std::string_view input;
+
+            // position of the tag of the value
+            size_t start = 0;
+
+            // the tag of the value
+            binary_helpers::binary_tag tag = binary_helpers::binary_tag::BT_NULL;
+
+            // the key name of the value
+            std::string_view key;
+
+            // position of the payload of the value
+            size_t payload = 0;
+
+            // true if the value was read successfully
+            bool valid = false;
+
+        public:
+            // constructor (an invalid value)
+            binary_value() = default;
+
+            // constructor. reads the tag and key of the value at position.
+            binary_value(const std::string_view input_, const size_t position)
+                : input(input_), start(position)
+            {
+                binary_helpers::reader r(input, position);
+                const uint8_t tag_byte = r.read_byte();
+                key = r.read_bytes();
+                payload = r.position();
+                valid = (r.ok() && binary_helpers::is_valid_tag(tag_byte));
+                tag = static_cast<binary_helpers::binary_tag>(valid ? tag_byte : 0);
+            }
+
+            // returns true if the value was read successfully
+            bool is_valid() const
+            {
+                return valid;
+            }
+
+            // returns the data type of the value
+            JsonDataType get_type() const
+            {
+                return (valid ? binary_helpers::tag_type(tag) : JsonDataType::JDT_UNDEFINED);
+            }
+
+            // returns the key name of the value
+            std::string_view get_key() const
+            {
+                return key;
+            }
+
+            // returns the boolean data (false if the value is not a boolean)
+            bool get_boolean() const
+            {
+                return (valid && tag == binary_helpers::binary_tag::BT_TRUE);
+            }
+
+            // returns the integer data (0 if the value is not an integer)
+            int64_t get_integer() const
+            {
+                if (get_type() != JsonDataType::JDT_INTEGER)
+                    return 0;
+
+                binary_helpers::reader r(input, payload);
+                const uint64_t zigzag = r.read_varint();
+                return static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+            }
+
+            // returns the float data (0.0 if the value is not a float)
+            double get_float() const
+            {
+                if (get_type() != JsonDataType::JDT_FLOAT)
+                    return 0.0;
+
+                binary_helpers::reader r(input, payload);
+                const uint64_t bits = r.read_fixed(sizeof(double));
+                double value = 0.0;
+                memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            // returns a view of the string data (empty if the value is not a string). the view
+            // points into the encoded document.
+            std::string_view get_string() const
+            {
+                if (get_type() != JsonDataType::JDT_STRING)
+                    return std::string_view();
+
+                binary_helpers::reader r(input, payload);
+                return r.read_bytes();
+            }
+
+            // returns the number of children of an array or object (0 for other values)
+            size_t size() const
+            {
+                size_t first = 0;
+                return static_cast<size_t>(read_body(first));
+            }
+
+            // returns the child at an index of an array or object (invalid if out of range)
+            binary_value operator[](const size_t index) const
+            {
+                size_t position = 0;
+                const uint64_t count = read_body(position);
+
+                for (uint64_t i = 0; i < count; ++i)
+                {
+                    const binary_value child(input, position);
+                    if (!child.is_valid())
+                        break;
+                    if (i == index)
+                        return child;
+                    position = child.end();
+                }
+
+                return binary_value();
+            }
+
+            // returns the first child of an object with the given key name (invalid if not found)
+            binary_value find(const std::string_view key_name) const
+            {
+                if (get_type() != JsonDataType::JDT_OBJECT)
+                    return binary_value();
+
+                size_t position = 0;
+                const uint64_t count = read_body(position);
+
+                for (uint64_t i = 0; i < count; ++i)
+                {
+                    const binary_value child(input, position);
+                    if (!child.is_valid())
+                        break;
+                    if (child.get_key() == key_name)
+                        return child;
+                    position = child.end();
+                }
+
+                return binary_value();
+            }
+
+            // returns the value specified by a path of key names through nested objects
+            binary_value get_by_path(const json::path &p) const
+            {
+                if (p.too_deep())
+                    return binary_value();
+
+                binary_value current = *this;
+
+                for (const std::string_view segment : p)
+                {
+                    current = current.find(segment);
+                    if (!current.is_valid())
+                        break;
+                }
+
+                return current;
+            }
+
+            // returns the value specified by a string path: "path/to/node"
+            binary_value get_by_path(const std::string &path) const
+            {
+                return get_by_path(json::path(path));
+            }
+
+            // decode the value and all of its children into nodes (nullptr if not valid)
+            std::shared_ptr<node> to_node() const
+            {
+                if (!valid)
+                    return nullptr;
+
+                binary_helpers::reader r(input, start);
+                return binary_helpers::read_value(r);
+            }
+
+            // returns the position just past the end of the value (its start, if not valid)
+            size_t end() const
+            {
+                if (!valid)
+                    return start;
+
+                binary_helpers::reader r(input, payload);
+                r.skip_payload(tag);
+                return (r.ok() ? r.position() : start);
+            }
+
+        private:
+            // read the count of children of an array or object, and the position of the first
+            // child. returns 0 for other values, or if the body is not valid.
+            uint64_t read_body(size_t &first) const
+            {
+                if (!valid || (tag != binary_helpers::binary_tag::BT_ARRAY && tag != binary_helpers::binary_tag::BT_OBJECT))
+                    return 0;
+
+                binary_helpers::reader r(input, payload);
+                const uint64_t body_length = r.read_fixed(binary_helpers::BODY_LENGTH_SIZE);
+                const uint64_t count = r.read_varint();
+
+                if (!r.ok() || body_length > input.size() - payload - binary_helpers::BODY_LENGTH_SIZE)
+                    return 0;
+
+                first = r.position();
+                return count;
+            }
+
+        }; // class binary_value
+
+        // encode a node, its key name, and all of its children
+        std::string encode_binary(const node &n)
+        {
+            binary_encoder encoder;
+            return std::string(encoder.encode(n));
+        }
+
+        // returns true if the input starts with the header of an encoded document
+        bool is_binary(const std::string_view input)
+        {
+            return (input.size() > binary_helpers::HEADER_SIZE &&
+                    input.compare(0, sizeof(binary_helpers::MAGIC),
+                                  std::string_view(binary_helpers::MAGIC, sizeof(binary_helpers::MAGIC))) == 0 &&
+                    static_cast<uint8_t>(input[sizeof(binary_helpers::MAGIC)]) == binary_helpers::VERSION);
+        }
+
+        // returns the root value of an encoded document, to be read in place (invalid if the
+        // input is not an encoded document). the input must outlive the value.
+        binary_value read_binary(const std::string_view input)
+        {
+            if (!is_binary(input))
+                return binary_value();
+
+            return binary_value(input, binary_helpers::HEADER_SIZE);
+        }
+
+        // decode an encoded document (nullptr if the input is not valid)
+        std::shared_ptr<node> decode_binary(const std::string_view input)
+        {
+            if (!is_binary(input))
+                return nullptr;
+
+            binary_helpers::reader r(input, binary_helpers::HEADER_SIZE);
+            return binary_helpers::read_value(r);
+        }
+
+        // decode an encoded document whose root is an object (nullptr if it is not valid)
+        std::shared_ptr<node_object> decode_binary_object(const std::string_view input)
+        {
+            return std::dynamic_pointer_cast<node_object>(decode_binary(input));
+        }
+
+        // decode an encoded document whose root is an array (nullptr if it is not valid)
+        std::shared_ptr<node_array> decode_binary_array(const std::string_view input)
+        {
+            return std::dynamic_pointer_cast<node_array>(decode_binary(input));
+        }
+
+    } // namespace json
+} // namespace rda
+
+POP_WARN_DISABLE
@@ -0,0 +1,286 @@
+#pragma once
+
+//
+// json_diff.h - Differences between two versions of a json document, as a JSON Patch
+//  (RFC 6902) that turns the first version into the second. Both trees are walked in step,
+//  and an array or object is skipped as soon as it is found to be the same node, or to have
+//  the same hash, in both. The hash of each array and object is cached on its node the
+//  first time it is needed, so diffing many versions against the same base only hashes the
+//  nodes that are new, and versions that share sub-trees (such as those made by
+//  json_patch.h) are only walked along the paths that changed. Changing a tree in place
+//  that has been hashed forgets the cached hashes (see hash_cache in json.h), so diffs stay
+//  correct, but are no longer incremental until the trees are hashed again. The hashes are
+//  64 bits, so two different sub-trees are taken to be equal with a chance of about 2^-64.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "json.h"
+#include "json_patch.h"
+#include "platform_defs.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE_GCC("-Wunused-function")
+
+namespace rda
+{
+    namespace json
+    {
+        // helper methods for finding the differences between two node trees
+        namespace diff_helpers
+        {
+            // mix the bits of a 64 bit value (the finalizer of splitmix64)
+            constexpr uint64_t mix(uint64_t h)
+            {
+                h ^= (h >> 30);
+                h *= 0xbf58476d1ce4e5b9ULL;
+                h ^= (h >> 27);
+                h *= 0x94d049bb133111ebULL;
+                h ^= (h >> 31);
+                return h;
+            }
+
+            // combine a value into a hash, where the order of the values matters
+            constexpr uint64_t combine(const uint64_t h, const uint64_t value)
+            {
+                return mix(h ^ (value + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2)));
+            }
+
+            // returns the hash of a string (64 bit FNV-1a)
+            uint64_t hash_string(const std::string_view s)
+            {
+                uint64_t h = 0xcbf29ce484222325ULL;
+
+                for (const char c : s)
+                {
+                    h ^= static_cast<unsigned char>(c);
+                    h *= 0x100000001b3ULL;
+                }
+
+                return mix(h);
+            }
+
+            // returns the hash of the value of a node (its own key name is not included). an
+            // array hashes its children in order, and an object hashes its members in any
+            // order, with their key names. the hash of an array or object is cached on it.
+            uint64_t hash(const node &n)
+            {
+                const JsonDataType type = n.get_type();
+                uint64_t h = mix(static_cast<uint64_t>(type) + 1);
+
+                switch (type)
+                {
+                    case JsonDataType::JDT_BOOLEAN:
+                        h = combine(h, static_cast<const node_boolean &>(n).get_data() ? 1 : 0);
+                        break;
+                    case JsonDataType::JDT_INTEGER:
+                        h = combine(h, static_cast<uint64_t>(static_cast<const node_integer &>(n).get_data()));
+                        break;
+                    case JsonDataType::JDT_FLOAT:
+                    {
+                        // 0.0 and -0.0 are equal, so they must have the same hash
+                        const double d = static_cast<const node_float &>(n).get_data();
+                        const double value = (d == 0.0 ? 0.0 : d);
+                        uint64_t bits = 0;
+                        std::memcpy(&bits, &value, sizeof(bits));
+                        h = combine(h, bits);
+                        break;
+                    }
+                    case JsonDataType::JDT_STRING:
+                        h = combine(h, hash_string(static_cast<const node_string &>(n).get_data_view()));
+                        break;
+                    case JsonDataType::JDT_ARRAY:
+                    {
+                        const auto &a = static_cast<const node_array &>(n);
+                        uint64_t cached = 0;
+                        if (a.get_hash_cache().get(cached))
+                            return cached;
+
+                        for (const auto &child : a.get_data())
+                            h = combine(h, hash(*child));
+                        h = combine(h, a.get_data().size());
+
+                        a.get_hash_cache().set(h);
+                        break;
+                    }
+                    case JsonDataType::JDT_OBJECT:
+                    {
+                        const auto &o = static_cast<const node_object &>(n);
+                        uint64_t cached = 0;
+                        if (o.get_hash_cache().get(cached))
+                            return cached;
+
+                        uint64_t sum = 0;
+                        for (const auto &child : o.get_data())
+                            sum += mix(combine(hash_string(child->get_key_view()), hash(*child)));
+                        h = combine(combine(h, sum), o.get_data().size());
+
+                        o.get_hash_cache().set(h);
+                        break;
+                    }
+                    default:
+                        break;
+                }
+
+                return h;
+            }
+
+            // returns a reference token escaped for a json pointer ("~" as "~0", "/" as "~1")
+            std::string escape(const std::string_view token)
+            {
+                std::string s;
+                s.reserve(token.size());
+
+                for (const char c : token)
+                {
+                    if (c == '~')
+                        s += "~0";
+                    else if (c == '/')
+                        s += "~1";
+                    else
+                        s += c;
+                }
+
+                return s;
+            }
+
+            // returns true if two nodes have the same value (and the same type). arrays and
+            // objects are compared by their (cached) hashes, without walking their children, and
+            // other values are compared directly.
+            bool same(const std::shared_ptr<node> &a, const std::shared_ptr<node> &b)
+            {
+                if (a == b)
+                    return true;
+
+                const JsonDataType type = a->get_type();
+
+                if (type != b->get_type())
+                    return false;
+
+                if (type == JsonDataType::JDT_OBJECT || type == JsonDataType::JDT_ARRAY)
+                    return (hash(*a) == hash(*b));
+
+                return patch_helpers::equal(*a, *b);
+            }
+
+            // appends an operation to a patch. the value, if any, is shared with the tree it
+            // came from.
+            void emit(std::vector<std::shared_ptr<node>> &ops, const char *op, const std::string &path,
+                      const std::shared_ptr<node> &value = nullptr)
+            {
+                std::vector<std::shared_ptr<node>> members;
+                members.reserve(3);
+                members.push_back(std::make_shared<node_string>("op", op));
+                members.push_back(std::make_shared<node_string>("path", path));
+
+                if (value != nullptr)
+                    members.push_back(patch_helpers::with_key(value, "value"));
+
+                ops.push_back(std::make_shared<node_object>("", std::move(members)));
+            }
+
+            // appends the operations that turn a into b, at the given path
+            void diff(const std::shared_ptr<node> &a, const std::shared_ptr<node> &b, const std::string &path,
+                      std::vector<std::shared_ptr<node>> &ops)
+            {
+                if (same(a, b))
+                    return;
+
+                const JsonDataType type = a->get_type();
+
+                if (type != b->get_type() || (type != JsonDataType::JDT_OBJECT && type != JsonDataType::JDT_ARRAY))
+                {
+                    emit(ops, "replace", path, b);
+                    return;
+                }
+
+                if (type == JsonDataType::JDT_OBJECT)
+                {
+                    const auto &oa = static_cast<const node_object &>(*a);
+                    const auto &ob = static_cast<const node_object &>(*b);
+
+                    for (const auto &child : oa.get_data())
+                    {
+                        // a duplicate key name can only be reached by its first member
+                        if (oa.find_child(child->get_key_view())->get() != child.get())
+                            continue;
+
+                        const std::string child_path = path + "/" + escape(child->get_key_view());
+
+                        if (const std::shared_ptr<node> *other = ob.find_child(child->get_key_view()))
+                            diff(child, *other, child_path, ops);
+                        else
+                            emit(ops, "remove", child_path);
+                    }
+
+                    for (const auto &child : ob.get_data())
+                        if (oa.find_child(child->get_key_view()) == nullptr &&
+                            ob.find_child(child->get_key_view())->get() == child.get())
+                            emit(ops, "add", path + "/" + escape(child->get_key_view()), child);
+
+                    return;
+                }
+
+                const auto &ca = static_cast<const node_array &>(*a).get_data();
+                const auto &cb = static_cast<const node_array &>(*b).get_data();
+
+                // skip the elements that are the same at the start and the end of both arrays
+                size_t prefix = 0;
+                while (prefix < ca.size() && prefix < cb.size() && same(ca[prefix], cb[prefix]))
+                    ++prefix;
+
+                size_t suffix = 0;
+                while (suffix < ca.size() - prefix && suffix < cb.size() - prefix &&
+                       same(ca[ca.size() - 1 - suffix], cb[cb.size() - 1 - suffix]))
+                    ++suffix;
+
+                const size_t count_a = ca.size() - prefix - suffix;
+                const size_t count_b = cb.size() - prefix - suffix;
+                const size_t common = std::min(count_a, count_b);
+
+                for (size_t i = prefix; i < prefix + common; ++i)
+                    diff(ca[i], cb[i], path + "/" + std::to_string(i), ops);
+
+                // remove from the back, so the indexes of the elements still to remove do not move
+                for (size_t i = prefix + count_a; i > prefix + common; --i)
+                    emit(ops, "remove", path + "/" + std::to_string(i - 1));
+
+                for (size_t i = prefix + common; i < prefix + count_b; ++i)
+                    emit(ops, "add", path + "/" + std::to_string(i), cb[i]);
+            }
+
+        } // namespace diff_helpers
+
+        // returns the json patch (an array of operations, as read by json::patch) that turns
+        // the document from into the document to. the values in the patch are shared with
+        // the document to, not copied. an empty patch means the documents are equal.
+        std::shared_ptr<node_array> diff(const std::shared_ptr<node_object> &from, const std::shared_ptr<node_object> &to)
+        {
+            std::vector<std::shared_ptr<node>> ops;
+
+            if (from != nullptr && to != nullptr)
+                diff_helpers::diff(from, to, "", ops);
+
+            return std::make_shared<node_array>("", std::move(ops));
+        }
+
+        // returns the hash of the value of a node. nodes with equal values (ignoring the order
+        // of the members of objects) have the same hash.
+        uint64_t hash(const std::shared_ptr<node> &n)
+        {
+            return (n == nullptr ? 0 : diff_helpers::hash(*n));
+        }
+
+    } // namespace json
+} // namespace rda
+
+POP_WARN_DISABLE
@@ -0,0 +1,401 @@
+#pragma once
+
+//
+// json_lines.h - Reader for newline delimited json (NDJSON / JSON lines), where each line
+//  of the input is an independent object. Records are parsed in parallel by a pool of
+//  worker threads, and handed back either in order or as they are finished.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "fileio.h"
+#include "json.h"
+#include "platform_defs.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE_GCC("-Wunused-function")
+
+namespace rda
+{
+    namespace json
+    {
+        // throughput of the last read done by an ndjson_reader
+        struct ndjson_stats
+        {
+            // number of records read
+            size_t records = 0;
+
+            // number of records that did not parse as an object
+            size_t failures = 0;
+
+            // number of bytes of input
+            size_t bytes = 0;
+
+            // elapsed time, in seconds
+            double seconds = 0.0;
+
+            // returns the number of records read per second
+            double records_per_second() const
+            {
+                return (seconds > 0.0 ? static_cast<double>(records) / seconds : 0.0);
+            }
+
+            // returns the number of megabytes (millions of bytes) read per second
+            double megabytes_per_second() const
+            {
+                return (seconds > 0.0 ? static_cast<double>(bytes) / 1000000.0 / seconds : 0.0);
+            }
+
+            // return a string representation of the stats
+            std::string to_string() const
+            {
+                std::stringstream ss;
+                ss << records << " records (" << failures << " failed), " << bytes << " bytes in "
+                   << seconds << " sec: " << records_per_second() << " records/s, "
+                   << megabytes_per_second() << " MB/s";
+                return ss.str();
+            }
+        };
+
+        // parses newline delimited json on a pool of worker threads. the input is split at
+        // newlines into records (blank lines are skipped, and a trailing carriage return is
+        // removed), and the records are parsed in batches.
+        class ndjson_reader
+        {
+        public:
+            // called with the index of a record and its parsed object (nullptr if the record
+            // did not parse as an object)
+            typedef std::function<void(const size_t, std::shared_ptr<node_object>)> record_callback;
+
+            // default number of records parsed by a worker at a time
+            constexpr static const size_t DEFAULT_BATCH_SIZE = 256;
+
+        private:
+            // number of worker threads
+            size_t num_threads = 1;
+
+            // number of records parsed by a worker at a time
+            size_t batch_size = DEFAULT_BATCH_SIZE;
+
+            // throughput of the last read
+            ndjson_stats stats;
+
+            // the pool that key names are interned in, if any
+            key_pool *keys = nullptr;
+
+        public:
+            // constructor. a thread count of zero uses one thread per hardware thread.
+            explicit ndjson_reader(const size_t threads = 0, const size_t records_per_batch = DEFAULT_BATCH_SIZE)
+                : num_threads(threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency())),
+                  batch_size(std::max(records_per_batch, static_cast<size_t>(1)))
+            {
+            }
+
+            // returns the number of worker threads
+            size_t get_num_threads() const
+            {
+                return num_threads;
+            }
+
+            // returns the throughput of the last read
+            const ndjson_stats &get_stats() const
+            {
+                return stats;
+            }
+
+            // intern the key names of every record in a pool (nullptr to stop), which must
+            // outlive the parsed records. records share one copy of each key name.
+            void set_key_pool(key_pool *pool)
+            {
+                keys = pool;
+            }
+
+            // split the input into the text of each record
+            static std::vector<std::string_view> split_records(const std::string_view input)
+            {
+                std::vector<std::string_view> records;
+                size_t start = 0;
+
+                while (start < input.size())
+                {
+                    size_t end = input.find('\n', start);
+                    if (end == std::string_view::npos)
+                        end = input.size();
+
+                    std::string_view line = input.substr(start, end - start);
+                    if (!line.empty() && line.back() == '\r')
+                        line.remove_suffix(1);
+
+                    if (line.find_first_not_of(" \t\r") != std::string_view::npos)
+                        records.push_back(line);
+
+                    start = end + 1;
+                }
+
+                return records;
+            }
+
+            // parse every record, calling op in record order. op is called on the calling
+            // thread, while the workers go on parsing the records that follow. if op throws,
+            // the workers are stopped and joined before the exception is rethrown.
+            void read_ordered(const std::string_view input, const record_callback &op)
+            {
+                read(input, op, true);
+            }
+
+            // parse every record, calling op as each batch of records is finished, in no
+            // particular order. op is called on the worker threads, but never concurrently.
+            void read_unordered(const std::string_view input, const record_callback &op)
+            {
+                read(input, op, false);
+            }
+
+            // parse every record, and return the objects in record order
+            std::vector<std::shared_ptr<node_object>> read_all(const std::string_view input)
+            {
+                const std::vector<std::string_view> records = split_records(input);
+                std::vector<std::shared_ptr<node_object>> objects(records.size());
+
+                // each record has its own slot, so the workers can fill them in directly
+                run(input.size(), records, [&](const size_t index, std::shared_ptr<node_object> obj) {
+                    objects[index] = std::move(obj);
+                });
+
+                return objects;
+            }
+
+            // read a file from disk, and parse every record, calling op in record order.
+            // returns false if the file could not be read.
+            bool read_file_ordered(const std::string &file_path, const record_callback &op)
+            {
+                fileio file(file_path);
+                if (!file.read())
+                    return false;
+
+                read_ordered(std::string_view(file.get_data(), file.size()), op);
+                return true;
+            }
+
+            // read a file from disk, and parse every record, calling op in no particular
+            // order. returns false if the file could not be read.
+            bool read_file_unordered(const std::string &file_path, const record_callback &op)
+            {
+                fileio file(file_path);
+                if (!file.read())
+                    return false;
+
+                read_unordered(std::string_view(file.get_data(), file.size()), op);
+                return true;
+            }
+
+        private:
+            // parse every record, calling op in order or as batches are finished
+            void read(const std::string_view input, const record_callback &op, const bool ordered)
+            {
+                const std::vector<std::string_view> records = split_records(input);
+
+                if (!ordered)
+                {
+                    std::mutex op_mutex;
+
+                    run(input.size(), records, nullptr, [&](const size_t first, std::vector<std::shared_ptr<node_object>> &batch) {
+                        std::lock_guard<std::mutex> lock(op_mutex);
+                        for (size_t i = 0; i < batch.size(); ++i)
+                            op(first + i, std::move(batch[i]));
+                    });
+
+                    return;
+                }
+
+                // finished batches wait in their slot until all of the batches before them have
+                // been handed back. workers only run a limited number of batches ahead.
+                const size_t num_batches = (records.size() + batch_size - 1) / batch_size;
+                const size_t max_ahead = num_threads * 4;
+
+                std::vector<std::vector<std::shared_ptr<node_object>>> slots(num_batches);
+                std::vector<bool> finished(num_batches, false);
+                std::mutex slot_mutex;
+                std::condition_variable slot_cv;
+                size_t next_to_hand_back = 0;
+                bool stopped = false;
+
+                auto wait_for_room = [&](const size_t batch_index) {
+                    std::unique_lock<std::mutex> lock(slot_mutex);
+                    slot_cv.wait(lock, [&] { return stopped || batch_index < next_to_hand_back + max_ahead; });
+                };
+
+                auto store = [&](const size_t first, std::vector<std::shared_ptr<node_object>> &batch) {
+                    {
+                        std::lock_guard<std::mutex> lock(slot_mutex);
+                        slots[first / batch_size].swap(batch);
+                        finished[first / batch_size] = true;
+                    }
+                    slot_cv.notify_all();
+                };
+
+                auto hand_back = [&]() {
+                    for (size_t b = 0; b < num_batches; ++b)
+                    {
+                        std::vector<std::shared_ptr<node_object>> batch;
+                        {
+                            std::unique_lock<std::mutex> lock(slot_mutex);
+                            slot_cv.wait(lock, [&] { return stopped || finished[b]; });
+                            if (stopped)
+                                return;
+
+                            batch.swap(slots[b]);
+                            next_to_hand_back = b + 1;
+                        }
+                        slot_cv.notify_all();
+
+                        for (size_t i = 0; i < batch.size(); ++i)
+                            op(b * batch_size + i, std::move(batch[i]));
+                    }
+                };
+
+                // wake the workers and the calling thread if anything throws
+                auto stop = [&]() {
+                    {
+                        std::lock_guard<std::mutex> lock(slot_mutex);
+                        stopped = true;
+                    }
+                    slot_cv.notify_all();
+                };
+
+                run(input.size(), records, nullptr, store, wait_for_room, hand_back, stop);
+            }
+
+            // parse the records on the worker threads. each record is either passed to
+            // on_record as it is parsed, or collected into a batch that is passed to on_batch.
+            // wait_for_room is called before each batch is started, and on_caller is run on
+            // the calling thread while the workers run. if anything throws, the workers stop
+            // (on_stop is called to wake any that are waiting), and the first exception is
+            // rethrown once they have all been joined.
+            void run(const size_t input_bytes,
+                     const std::vector<std::string_view> &records,
+                     const record_callback &on_record,
+                     const std::function<void(const size_t, std::vector<std::shared_ptr<node_object>> &)> &on_batch = nullptr,
+                     const std::function<void(const size_t)> &wait_for_room = nullptr,
+                     const std::function<void()> &on_caller = nullptr,
+                     const std::function<void()> &on_stop = nullptr)
+            {
+                const auto start_time = std::chrono::steady_clock::now();
+
+                const size_t num_batches = (records.size() + batch_size - 1) / batch_size;
+                std::atomic<size_t> next_batch{0};
+                std::atomic<size_t> failures{0};
+
+                std::atomic<bool> stopping{false};
+                std::exception_ptr error;
+                std::mutex error_mutex;
+
+                // keep the first exception, and stop the workers
+                auto fail = [&](std::exception_ptr e) {
+                    {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if (!error)
+                            error = e;
+                    }
+
+                    stopping = true;
+                    if (on_stop)
+                        on_stop();
+                };
+
+                auto worker = [&]() {
+                    try
+                    {
+                        std::vector<std::shared_ptr<node_object>> batch;
+
+                        for (;;)
+                        {
+                            const size_t b = next_batch.fetch_add(1);
+                            if (b >= num_batches || stopping)
+                                break;
+
+                            if (wait_for_room)
+                                wait_for_room(b);
+
+                            if (stopping)
+                                break;
+
+                            const size_t first = b * batch_size;
+                            const size_t last = std::min(first + batch_size, records.size());
+                            size_t batch_failures = 0;
+
+                            batch.clear();
+
+                            for (size_t i = first; i < last; ++i)
+                            {
+                                std::shared_ptr<node_object> obj = (keys != nullptr ? parser(records[i], *keys) : parser(records[i])).parse_object();
+
+                                if (obj == nullptr)
+                                    ++batch_failures;
+
+                                if (on_batch)
+                                    batch.push_back(std::move(obj));
+                                else
+                                    on_record(i, std::move(obj));
+                            }
+
+                            if (on_batch)
+                                on_batch(first, batch);
+
+                            failures += batch_failures;
+                        }
+                    }
+                    catch (...)
+                    {
+                        fail(std::current_exception());
+                    }
+                };
+
+                const size_t thread_count = std::min(num_threads, std::max(num_batches, static_cast<size_t>(1)));
+                std::vector<std::thread> thread_vector;
+
+                try
+                {
+                    for (size_t i = 0; i < thread_count; ++i)
+                        thread_vector.emplace_back(worker);
+
+                    if (on_caller)
+                        on_caller();
+                }
+                catch (...)
+                {
+                    fail(std::current_exception());
+                }
+
+                for (auto &t : thread_vector)
+                    t.join();
+
+                if (error)
+                    std::rethrow_exception(error);
+
+                stats.records = records.size();
+                stats.failures = failures;
+                stats.bytes = input_bytes;
+                stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+            }
+
+        }; // class ndjson_reader
+
+    } // namespace json
+} // namespace rda
+
+POP_WARN_DISABLE
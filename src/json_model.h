@@ -1,7 +1,9 @@
 #pragma once
 
 //
-// json_model.h - Base class for structures to model JSON data.
+// json_model.h - Base class for structures to model JSON data. The member macros also build
+//  a compile-time field list, which json_record uses to decode a model into plain values in
+//  one traversal, and to encode it again in a single pass.
 //
 // Written by Ryan Antkowiak
 //
@@ -9,20 +11,521 @@
 //
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <initializer_list>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "json.h"
+#include "json_writer.h"
+
+namespace rda
+{
+    // compile-time field lists of json_model classes, and records that hold the values of
+    // every field as plain c++ members. a record is decoded from a document in one traversal
+    // of the object's children, instead of one path lookup per field per access, and is
+    // encoded in a single pass.
+    namespace json_binding
+    {
+        // largest number of fields in one model
+        constexpr static const size_t MAX_FIELDS = 128;
+
+        // overload rank used to count the fields of a model as they are declared. a call with
+        // rank<MAX_FIELDS> picks the overload with the highest rank declared so far.
+        template <size_t N>
+        struct rank : rank<N - 1>
+        {
+        };
+
+        template <>
+        struct rank<0>
+        {
+        };
+
+        // index of a field
+        template <size_t N>
+        using count = std::integral_constant<size_t, N>;
+
+        template <typename Model>
+        class record;
+
+        // reads the field list of a model (the members declared by the JSON_MEMBER_ macros are
+        // only accessible through it)
+        struct access
+        {
+            // returns the number of fields of a model
+            template <typename Model>
+            static constexpr size_t field_count()
+            {
+                return decltype(Model::json_field_counter(rank<MAX_FIELDS>{}))::value;
+            }
+
+            // the field of a model at an index
+            template <typename Model, size_t I>
+            using field = decltype(Model::json_field(count<I>{}));
+        };
+
+        // boolean field
+        struct field_bool
+        {
+            typedef bool value_type;
+
+            static bool matches(const json::node &n)
+            {
+                return (n.get_type() == json::JsonDataType::JDT_BOOLEAN);
+            }
+
+            static void read(const json::node &n, value_type &value)
+            {
+                value = static_cast<const json::node_boolean &>(n).get_data();
+            }
+
+            static std::shared_ptr<json::node> encode(const std::string &key_name, const value_type &value)
+            {
+                return std::make_shared<json::node_boolean>(key_name, value);
+            }
+
+            template <typename Sink>
+            static void write(Sink &sink, const value_type &value)
+            {
+                if (value)
+                    sink.write("true", 4);
+                else
+                    sink.write("false", 5);
+            }
+        };
+
+        // integer field
+        struct field_int
+        {
+            typedef int64_t value_type;
+
+            static bool matches(const json::node &n)
+            {
+                return (n.get_type() == json::JsonDataType::JDT_INTEGER);
+            }
+
+            static void read(const json::node &n, value_type &value)
+            {
+                value = static_cast<const json::node_integer &>(n).get_data();
+            }
+
+            static std::shared_ptr<json::node> encode(const std::string &key_name, const value_type &value)
+            {
+                return std::make_shared<json::node_integer>(key_name, value);
+            }
+
+            template <typename Sink>
+            static void write(Sink &sink, const value_type &value)
+            {
+                json::write_helpers::write_integer(sink, value);
+            }
+        };
+
+        // float field
+        struct field_float
+        {
+            typedef double value_type;
+
+            static bool matches(const json::node &n)
+            {
+                return (n.get_type() == json::JsonDataType::JDT_FLOAT);
+            }
+
+            static void read(const json::node &n, value_type &value)
+            {
+                value = static_cast<const json::node_float &>(n).get_data();
+            }
+
+            static std::shared_ptr<json::node> encode(const std::string &key_name, const value_type &value)
+            {
+                return std::make_shared<json::node_float>(key_name, value);
+            }
+
+            template <typename Sink>
+            static void write(Sink &sink, const value_type &value)
+            {
+                json::write_helpers::write_float(sink, value);
+            }
+        };
+
+        // string field
+        struct field_string
+        {
+            typedef std::string value_type;
+
+            static bool matches(const json::node &n)
+            {
+                return (n.get_type() == json::JsonDataType::JDT_STRING);
+            }
+
+            static void read(const json::node &n, value_type &value)
+            {
+                const std::string_view data = static_cast<const json::node_string &>(n).get_data_view();
+                value.assign(data.data(), data.size());
+            }
+
+            static std::shared_ptr<json::node> encode(const std::string &key_name, const value_type &value)
+            {
+                return std::make_shared<json::node_string>(key_name, value);
+            }
+
+            template <typename Sink>
+            static void write(Sink &sink, const value_type &value)
+            {
+                sink.put('"');
+                json::write_helpers::write_escaped(sink, value);
+                sink.put('"');
+            }
+        };
+
+        // object field, holding the record of another model
+        template <typename Model>
+        struct field_object
+        {
+            typedef record<Model> value_type;
+
+            static bool matches(const json::node &n)
+            {
+                return (n.get_type() == json::JsonDataType::JDT_OBJECT);
+            }
+
+            static void read(const json::node &n, value_type &value)
+            {
+                value.decode(static_cast<const json::node_object &>(n));
+            }
+
+            static std::shared_ptr<json::node> encode(const std::string &key_name, const value_type &value)
+            {
+                return value.to_object(key_name);
+            }
+
+            template <typename Sink>
+            static void write(Sink &sink, const value_type &value)
+            {
+                value.write(sink);
+            }
+        };
+
+        // array field, holding the elements of the array that are of the element field's
+        // type (the others are skipped, as by the JSON_MEMBER_ARRAY_ getters)
+        template <typename Element>
+        struct field_array
+        {
+            typedef std::vector<typename Element::value_type> value_type;
+
+            static bool matches(const json::node &n)
+            {
+                return (n.get_type() == json::JsonDataType::JDT_ARRAY);
+            }
+
+            static void read(const json::node &n, value_type &value)
+            {
+                for (const auto &child : static_cast<const json::node_array &>(n))
+                {
+                    if (Element::matches(*child))
+                    {
+                        typename Element::value_type element{};
+                        Element::read(*child, element);
+                        value.push_back(std::move(element));
+                    }
+                }
+            }
+
+            static std::shared_ptr<json::node> encode(const std::string &key_name, const value_type &value)
+            {
+                std::vector<std::shared_ptr<json::node>> children;
+                children.reserve(value.size());
+
+                for (const auto &element : value)
+                    children.push_back(Element::encode("", element));
+
+                return std::make_shared<json::node_array>(key_name, std::move(children));
+            }
+
+            template <typename Sink>
+            static void write(Sink &sink, const value_type &value)
+            {
+                sink.put('[');
+
+                for (size_t i = 0; i < value.size(); ++i)
+                {
+                    if (i != 0)
+                        sink.put(',');
+                    Element::write(sink, value[i]);
+                }
+
+                sink.put(']');
+            }
+        };
+
+        // the values of every field of a model, as plain c++ members. a field's value is
+        // accessed with get<Model::VAR_NAME_field>(), where VAR_NAME is the name given to the
+        // JSON_MEMBER_ macro. fields that are missing (or of another type) have the same
+        // default value as the model's getter returns.
+        template <typename Model>
+        class record
+        {
+        public:
+            // number of fields of the model
+            constexpr static const size_t num_fields = access::field_count<Model>();
+
+        private:
+            // the field at an index
+            template <size_t I>
+            using field = access::field<Model, I>;
+
+            // tuple of the value types of the fields
+            template <size_t... I>
+            static auto values_type(std::index_sequence<I...>) -> std::tuple<typename field<I>::value_type...>;
+
+            // sequence of the field indexes
+            typedef std::make_index_sequence<num_fields> indexes;
+
+            // the field values
+            decltype(values_type(indexes{})) values;
+
+        public:
+            // returns the value of a field, by field type
+            template <typename Field>
+            typename Field::value_type &get()
+            {
+                return std::get<index_of<Field>(indexes{})>(values);
+            }
+
+            // returns the value of a field, by field type
+            template <typename Field>
+            const typename Field::value_type &get() const
+            {
+                return std::get<index_of<Field>(indexes{})>(values);
+            }
+
+            // returns the value of a field, by index
+            template <size_t I>
+            typename field<I>::value_type &get()
+            {
+                return std::get<I>(values);
+            }
+
+            // returns the value of a field, by index
+            template <size_t I>
+            const typename field<I>::value_type &get() const
+            {
+                return std::get<I>(values);
+            }
+
+            // returns the json name of the field at an index
+            template <size_t I>
+            static constexpr const char *name()
+            {
+                return field<I>::name();
+            }
+
+            // set every field from an object, in one traversal of its children. the first
+            // child with a field's name is used, as by the getters. fields whose name is a
+            // path of more than one key are looked up by path after the traversal.
+            void decode(const json::node_object &obj)
+            {
+                values = decltype(values)();
+
+                std::array<bool, num_fields> found{};
+
+                for (const auto &child : obj)
+                    match_child(*child, child->get_key_view(), found, indexes{});
+
+                read_paths(obj, indexes{});
+            }
+
+            // set every field from the document of a model. returns false if it has none.
+            bool decode(const Model &model)
+            {
+                if (!model.get_pointer())
+                    return false;
+
+                decode(*model.get_pointer());
+                return true;
+            }
+
+            // returns an object node holding every field, in the order they were declared
+            std::shared_ptr<json::node_object> to_object(const std::string &key_name = "") const
+            {
+                std::vector<std::shared_ptr<json::node>> children;
+                children.reserve(num_fields);
+                encode_fields(children, indexes{});
+                return std::make_shared<json::node_object>(key_name, std::move(children));
+            }
+
+            // returns a model whose document holds every field
+            Model to_model() const
+            {
+                Model model;
+                model.set_pointer(to_object());
+                return model;
+            }
+
+            // write every field as compact json text (as model.toJSON() writes it), in one pass
+            template <typename Sink>
+            void write(Sink &sink) const
+            {
+                sink.put('{');
+                write_fields(sink, indexes{});
+                sink.put('}');
+            }
+
+            // add every field as compact json text to the end of a buffer
+            void append_json(std::string &buffer) const
+            {
+                json::write_helpers::buffer_sink sink(buffer);
+                write(sink);
+            }
+
+            // returns every field as compact json text
+            std::string to_json() const
+            {
+                std::string buffer;
+                append_json(buffer);
+                return buffer;
+            }
+
+        private:
+            // returns the index of a field type (num_fields if it is not a field of the model)
+            template <typename Field, size_t... I>
+            static constexpr size_t index_of(std::index_sequence<I...>)
+            {
+                size_t index = num_fields;
+                ((index = (std::is_same<Field, field<I>>::value ? I : index)), ...);
+                return index;
+            }
+
+            // returns the parsed name of the field at an index
+            template <size_t I>
+            static constexpr json::path field_path()
+            {
+                return json::path(field<I>::name());
+            }
+
+            // set the first field not yet found whose name is the key of a child
+            template <size_t... I>
+            void match_child(const json::node &child, const std::string_view key_name,
+                             std::array<bool, num_fields> &found, std::index_sequence<I...>)
+            {
+                (void)(match_field<I>(child, key_name, found) || ...);
+            }
+
+            // set the field at an index, if it is not yet found and has the key name
+            template <size_t I>
+            bool match_field(const json::node &child, const std::string_view key_name,
+                             std::array<bool, num_fields> &found)
+            {
+                constexpr json::path p = field_path<I>();
+
+                if (p.size() != 1 || found[I] || p[0] != key_name)
+                    return false;
+
+                found[I] = true;
+
+                if (field<I>::matches(child))
+                    field<I>::read(child, std::get<I>(values));
+
+                return true;
+            }
+
+            // set the fields whose names are longer paths, by looking them up
+            template <size_t... I>
+            void read_paths(const json::node_object &obj, std::index_sequence<I...>)
+            {
+                (read_path<I>(obj), ...);
+            }
+
+            // set the field at an index by looking it up, if its name is a longer path
+            template <size_t I>
+            void read_path(const json::node_object &obj)
+            {
+                constexpr json::path p = field_path<I>();
+
+                if (p.size() == 1)
+                    return;
+
+                const std::shared_ptr<json::node> n = obj.get_node_by_path(p);
+
+                if (n != nullptr && field<I>::matches(*n))
+                    field<I>::read(*n, std::get<I>(values));
+            }
+
+            // add a node for every field
+            template <size_t... I>
+            void encode_fields(std::vector<std::shared_ptr<json::node>> &children, std::index_sequence<I...>) const
+            {
+                (children.push_back(field<I>::encode(field<I>::name(), std::get<I>(values))), ...);
+            }
+
+            // write every field, separated by commas
+            template <typename Sink, size_t... I>
+            void write_fields(Sink &sink, std::index_sequence<I...>) const
+            {
+                (write_field<I>(sink), ...);
+            }
+
+            // write the field at an index, with its key name
+            template <size_t I, typename Sink>
+            void write_field(Sink &sink) const
+            {
+                if (I != 0)
+                    sink.put(',');
+
+                sink.put('"');
+                json::write_helpers::write_text(sink, field<I>::name());
+                sink.write("\":", 2);
+                field<I>::write(sink, std::get<I>(values));
+            }
+
+        }; // class record
+
+        // decode every field of a model, in one traversal of its document
+        template <typename Model>
+        record<Model> decode(const Model &model)
+        {
+            record<Model> r;
+            r.decode(model);
+            return r;
+        }
+
+    } // namespace json_binding
+
+    // the values of every field of a model, as plain c++ members
+    template <typename Model>
+    using json_record = json_binding::record<Model>;
+
+} // namespace rda
+
+// registers a member in the compile-time field list of its model. the field type is named
+// VAR_NAME_field, and is used to get the member's value from a json_record.
+#define JSON_MEMBER_FIELD(VAR_NAME, JSON_NAME, FIELD_KIND)                                                       \
+struct VAR_NAME##_field : FIELD_KIND                                                                             \
+{                                                                                                                \
+    static constexpr const char *name() { return JSON_NAME; }                                                    \
+};                                                                                                               \
+using VAR_NAME##_field_id = decltype(json_field_counter(rda::json_binding::rank<rda::json_binding::MAX_FIELDS>{})); \
+static rda::json_binding::count<VAR_NAME##_field_id::value + 1>                                                  \
+    json_field_counter(rda::json_binding::rank<VAR_NAME##_field_id::value + 1>);                                 \
+static VAR_NAME##_field json_field(rda::json_binding::count<VAR_NAME##_field_id::value>);                        \
+friend struct rda::json_binding::access;
+
 
 // Boolean member
 #define JSON_MEMBER_BOOL(CLASS_NAME, VAR_NAME, JSON_NAME)                                                        \
+JSON_MEMBER_FIELD(VAR_NAME, JSON_NAME, rda::json_binding::field_bool)                                            \
 bool VAR_NAME () const                                                                                           \
 {                                                                                                                \
+    static constexpr json::path json_path(JSON_NAME);                                                            \
     if (m_pJSON)                                                                                                 \
-        return m_pJSON->get_boolean_by_path(JSON_NAME);                                                          \
+        return m_pJSON->get_boolean_by_path(json_path);                                                          \
     return false;                                                                                                \
 }                                                                                                                \
 CLASS_NAME& VAR_NAME (bool value)                                                                                \
@@ -37,10 +540,12 @@ CLASS_NAME& VAR_NAME (bool value)
 
 // Integer member
 #define JSON_MEMBER_INT(CLASS_NAME, VAR_NAME, JSON_NAME)                                                         \
+JSON_MEMBER_FIELD(VAR_NAME, JSON_NAME, rda::json_binding::field_int)                                             \
 int64_t VAR_NAME () const                                                                                        \
 {                                                                                                                \
+    static constexpr json::path json_path(JSON_NAME);                                                            \
     if (m_pJSON)                                                                                                 \
-        return static_cast<int64_t>(m_pJSON->get_integer_by_path(JSON_NAME));                                    \
+        return static_cast<int64_t>(m_pJSON->get_integer_by_path(json_path));                                    \
     return 0;                                                                                                    \
 }                                                                                                                \
 CLASS_NAME& VAR_NAME (int64_t value)                                                                             \
@@ -55,10 +560,12 @@ CLASS_NAME& VAR_NAME (int64_t value)
 
 // Float member
 #define JSON_MEMBER_FLOAT(CLASS_NAME, VAR_NAME, JSON_NAME)                                                       \
+JSON_MEMBER_FIELD(VAR_NAME, JSON_NAME, rda::json_binding::field_float)                                           \
 double VAR_NAME () const                                                                                         \
 {                                                                                                                \
+    static constexpr json::path json_path(JSON_NAME);                                                            \
     if (m_pJSON)                                                                                                 \
-        return static_cast<double>(m_pJSON->get_float_by_path(JSON_NAME));                                       \
+        return static_cast<double>(m_pJSON->get_float_by_path(json_path));                                       \
     return 0.0;                                                                                                  \
 }                                                                                                                \
 CLASS_NAME& VAR_NAME (double value)                                                                              \
@@ -73,10 +580,12 @@ CLASS_NAME& VAR_NAME (double value)
 
 // String member
 #define JSON_MEMBER_STRING(CLASS_NAME, VAR_NAME, JSON_NAME)                                                      \
+JSON_MEMBER_FIELD(VAR_NAME, JSON_NAME, rda::json_binding::field_string)                                          \
 std::string VAR_NAME () const                                                                                    \
 {                                                                                                                \
+    static constexpr json::path json_path(JSON_NAME);                                                            \
     if (m_pJSON)                                                                                                 \
-        return m_pJSON->get_string_by_path(JSON_NAME);                                                           \
+        return m_pJSON->get_string_by_path(json_path);                                                           \
     return "";                                                                                                   \
 }                                                                                                                \
 CLASS_NAME& VAR_NAME (const std::string& value)                                                                  \
@@ -91,12 +600,14 @@ CLASS_NAME& VAR_NAME (const std::string& value)
 
 // Object member
 #define JSON_MEMBER_OBJECT(CLASS_NAME, OBJECT_TYPE, VAR_NAME, JSON_NAME)                                         \
+JSON_MEMBER_FIELD(VAR_NAME, JSON_NAME, rda::json_binding::field_object<OBJECT_TYPE>)                             \
 OBJECT_TYPE VAR_NAME () const                                                                                    \
 {                                                                                                                \
+    static constexpr json::path json_path(JSON_NAME);                                                            \
     if (m_pJSON)                                                                                                 \
     {                                                                                                            \
         OBJECT_TYPE o{};                                                                                         \
-        o.set_pointer(m_pJSON->get_object_by_path(JSON_NAME));                                                   \
+        o.set_pointer(m_pJSON->get_object_by_path(json_path));                                                   \
         return o;                                                                                                \
     }                                                                                                            \
     return OBJECT_TYPE{};                                                                                        \
@@ -113,11 +624,13 @@ CLASS_NAME& VAR_NAME (const OBJECT_TYPE& value)
 
 // Array of Booleans member
 #define JSON_MEMBER_ARRAY_BOOL(CLASS_NAME, VAR_NAME, JSON_NAME)                                                  \
+JSON_MEMBER_FIELD(VAR_NAME, JSON_NAME, rda::json_binding::field_array<rda::json_binding::field_bool>)            \
 std::vector<bool> VAR_NAME() const                                                                               \
 {                                                                                                                \
     std::vector<bool> v;                                                                                         \
+    static constexpr json::path json_path(JSON_NAME);                                                            \
     if (m_pJSON)                                                                                                 \
-        if (const auto arr = m_pJSON->get_array_by_path(JSON_NAME))                                              \
+        if (const auto arr = m_pJSON->get_array_by_path(json_path))                                              \
             for (const auto& pNode : *arr)                                                                       \
                 if (const auto pValNode = std::dynamic_pointer_cast<json::node_boolean>(pNode))                  \
                     v.push_back(pValNode->get_data());                                                           \
@@ -139,11 +652,13 @@ CLASS_NAME& VAR_NAME(const std::vector<bool>& v)
 
 // Array of Integers member
 #define JSON_MEMBER_ARRAY_INT(CLASS_NAME, VAR_NAME, JSON_NAME)                                                   \
+JSON_MEMBER_FIELD(VAR_NAME, JSON_NAME, rda::json_binding::field_array<rda::json_binding::field_int>)             \
 std::vector<int64_t> VAR_NAME() const                                                                            \
 {                                                                                                                \
     std::vector<int64_t> v;                                                                                      \
+    static constexpr json::path json_path(JSON_NAME);                                                            \
     if (m_pJSON)                                                                                                 \
-        if (const auto arr = m_pJSON->get_array_by_path(JSON_NAME))                                              \
+        if (const auto arr = m_pJSON->get_array_by_path(json_path))                                              \
             for (const auto& pNode : *arr)                                                                       \
                 if (const auto pValNode = std::dynamic_pointer_cast<json::node_integer>(pNode))                  \
                     v.push_back(pValNode->get_data());                                                           \
@@ -165,11 +680,13 @@ CLASS_NAME& VAR_NAME(const std::vector<int64_t>& v)
 
 // Array of Floats member
 #define JSON_MEMBER_ARRAY_FLOAT(CLASS_NAME, VAR_NAME, JSON_NAME)                                                 \
+JSON_MEMBER_FIELD(VAR_NAME, JSON_NAME, rda::json_binding::field_array<rda::json_binding::field_float>)           \
 std::vector<double> VAR_NAME() const                                                                             \
 {                                                                                                                \
     std::vector<double> v;                                                                                       \
+    static constexpr json::path json_path(JSON_NAME);                                                            \
     if (m_pJSON)                                                                                                 \
-        if (const auto arr = m_pJSON->get_array_by_path(JSON_NAME))                                              \
+        if (const auto arr = m_pJSON->get_array_by_path(json_path))                                              \
             for (const auto& pNode : *arr)                                                                       \
                 if (const auto pValNode = std::dynamic_pointer_cast<json::node_float>(pNode))                    \
                     v.push_back(pValNode->get_data());                                                           \
@@ -191,11 +708,13 @@ CLASS_NAME& VAR_NAME(const std::vector<double>& v)
 
 // Array of Strings member
 #define JSON_MEMBER_ARRAY_STRING(CLASS_NAME, VAR_NAME, JSON_NAME)                                                \
+JSON_MEMBER_FIELD(VAR_NAME, JSON_NAME, rda::json_binding::field_array<rda::json_binding::field_string>)          \
 std::vector<std::string> VAR_NAME() const                                                                        \
 {                                                                                                                \
     std::vector<std::string> v;                                                                                  \
+    static constexpr json::path json_path(JSON_NAME);                                                            \
     if (m_pJSON)                                                                                                 \
-        if (const auto arr = m_pJSON->get_array_by_path(JSON_NAME))                                              \
+        if (const auto arr = m_pJSON->get_array_by_path(json_path))                                              \
             for (const auto& pNode : *arr)                                                                       \
                 if (const auto pValNode = std::dynamic_pointer_cast<json::node_string>(pNode))                   \
                     v.push_back(pValNode->get_data());                                                           \
@@ -217,11 +736,13 @@ CLASS_NAME& VAR_NAME(const std::vector<std::string>& v)
 
 // Array of Objects member
 #define JSON_MEMBER_ARRAY_OBJECT(CLASS_NAME, OBJECT_TYPE, VAR_NAME, JSON_NAME)                                   \
+JSON_MEMBER_FIELD(VAR_NAME, JSON_NAME, rda::json_binding::field_array<rda::json_binding::field_object<OBJECT_TYPE>>)\
 std::vector<OBJECT_TYPE> VAR_NAME() const                                                                        \
 {                                                                                                                \
     std::vector<OBJECT_TYPE> v;                                                                                  \
+    static constexpr json::path json_path(JSON_NAME);                                                            \
     if (m_pJSON)                                                                                                 \
-        if (const auto arr = m_pJSON->get_array_by_path(JSON_NAME))                                              \
+        if (const auto arr = m_pJSON->get_array_by_path(json_path))                                              \
             for (const auto& pNode : *arr)                                                                       \
                 if (const auto pValNode = std::dynamic_pointer_cast<json::node_object>(pNode))                   \
                 {                                                                                                \
@@ -301,6 +822,11 @@ namespace rda
     protected:
         std::shared_ptr<json::node_object> m_pJSON = nullptr;
 
+        // the end of the field list (see JSON_MEMBER_FIELD). derived models add their fields
+        // after it.
+        static json_binding::count<0> json_field_counter(json_binding::rank<0>);
+        friend struct json_binding::access;
+
     }; // class json_model
 
 } // namespace rda
@@ -0,0 +1,304 @@
+#pragma once
+
+//
+// json_parallel.h - Parallel parsing of large top level json arrays. The input is first
+//  scanned for the commas that separate the elements of the array, using the same block
+//  classification as the json lexer, and is split at them into chunks that are parsed
+//  concurrently. The result is the same node_array that json::parse_array() returns.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "json.h"
+#include "platform_defs.h"
+#include "simd_rda.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE_GCC("-Wunused-function")
+
+namespace rda
+{
+    namespace json
+    {
+        // helper methods for splitting the elements of a json array into chunks
+        namespace parallel_helpers
+        {
+            // returns the positions (just after a comma) where the elements of the array whose
+            // children start at begin can be split into num_chunks chunks of about the same
+            // size. only commas between elements of that array are used, so splits never fall
+            // inside a string or a nested array or object. fewer positions are returned if the
+            // array has too few elements.
+            std::vector<size_t> find_split_points(const std::string_view input, const size_t begin,
+                                                  const size_t num_chunks)
+            {
+                std::vector<size_t> splits;
+
+                if (num_chunks < 2 || begin >= input.size())
+                    return splits;
+
+                const size_t length = input.size() - begin;
+                const simd::instruction_set is = simd::get_instruction_set();
+
+                size_t target = begin + length / num_chunks;
+                size_t depth = 1;
+                bool in_string = false;
+                bool skip_next = false;
+
+                scan_helpers::block_masks masks;
+
+                for (size_t block = begin; block < input.size(); block += scan_helpers::BLOCK_SIZE)
+                {
+                    const size_t size = std::min(scan_helpers::BLOCK_SIZE, input.size() - block);
+                    scan_helpers::classify(input.data() + block, size, masks, is);
+
+                    // an escaped character at the start of this block was accounted for at the
+                    // end of the last one
+                    uint64_t bits = (masks.quote | masks.backslash | masks.structural);
+                    if (skip_next)
+                    {
+                        bits &= ~static_cast<uint64_t>(1);
+                        skip_next = false;
+                    }
+
+                    while (bits != 0)
+                    {
+                        const unsigned int offset = simd::trailing_zeros(bits);
+                        const uint64_t bit = (static_cast<uint64_t>(1) << offset);
+                        bits &= (bits - 1);
+
+                        const size_t pos = block + offset;
+                        const char c = input[pos];
+
+                        if (in_string)
+                        {
+                            if (c == '"')
+                            {
+                                in_string = false;
+                            }
+                            else if (c == '\\' && pos + 1 < input.size() &&
+                                     (input[pos + 1] == '\\' || input[pos + 1] == '"'))
+                            {
+                                // the escaped character is not a delimiter of any kind
+                                if (offset + 1 < scan_helpers::BLOCK_SIZE)
+                                    bits &= ~(bit << 1);
+                                else
+                                    skip_next = true;
+                            }
+
+                            continue;
+                        }
+
+                        switch (c)
+                        {
+                            case '"':
+                                in_string = true;
+                                break;
+                            case '[':
+                            case '{':
+                                ++depth;
+                                break;
+                            case ']':
+                            case '}':
+                                if (--depth == 0)
+                                    return splits;
+                                break;
+                            case ',':
+                                if (depth == 1 && pos >= target)
+                                {
+                                    splits.push_back(pos + 1);
+
+                                    if (splits.size() + 1 == num_chunks)
+                                        return splits;
+
+                                    target = begin + length * (splits.size() + 1) / num_chunks;
+                                }
+                                break;
+                            default:
+                                break;
+                        }
+                    }
+                }
+
+                return splits;
+            }
+
+        } // namespace parallel_helpers
+
+        // statistics of the last parse done by a parallel_parser
+        struct parallel_parse_stats
+        {
+            // number of chunks the array was split into
+            size_t chunks = 0;
+
+            // true if the chunks did not line up, and the input was parsed serially
+            bool fallback = false;
+        };
+
+        // parses a large top level json array on multiple threads. the children of the array
+        // are split into one chunk per thread, and each chunk is parsed by its own parser.
+        // when the chunks do not line up with each other (which can only happen for input
+        // that is not well formed), the input is parsed again serially, so the result is
+        // always the same as json::parse_array().
+        class parallel_parser
+        {
+        public:
+            // default minimum number of bytes of input parsed by each thread
+            constexpr static const size_t DEFAULT_MIN_CHUNK_SIZE = 64 * 1024;
+
+        private:
+            // the result of parsing one chunk
+            struct chunk_result
+            {
+                // the elements read
+                std::vector<std::shared_ptr<node>> nodes;
+
+                // position of the first token read
+                size_t first = 0;
+
+                // position of the token the read stopped at
+                size_t stop = 0;
+            };
+
+            // number of threads
+            size_t num_threads = 1;
+
+            // minimum number of bytes of input parsed by each thread
+            size_t min_chunk_size = DEFAULT_MIN_CHUNK_SIZE;
+
+            // statistics of the last parse
+            parallel_parse_stats stats;
+
+        public:
+            // constructor. a thread count of zero uses one thread per hardware thread.
+            explicit parallel_parser(const size_t threads = 0, const size_t min_chunk_size_ = DEFAULT_MIN_CHUNK_SIZE)
+                : num_threads(threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency())),
+                  min_chunk_size(std::max(min_chunk_size_, static_cast<size_t>(1)))
+            {
+            }
+
+            // returns the number of threads
+            size_t get_num_threads() const
+            {
+                return num_threads;
+            }
+
+            // returns the statistics of the last parse
+            const parallel_parse_stats &get_stats() const
+            {
+                return stats;
+            }
+
+            // parse and return an array (returns nullptr if the input does not start with one)
+            std::shared_ptr<node_array> parse_array(const std::string_view input, const size_t start_index = 0)
+            {
+                stats = parallel_parse_stats();
+
+                parse_helpers::lexer lex(input, start_index);
+                if (!lex.next().is_delimiter('['))
+                    return nullptr;
+
+                const size_t begin = lex.position();
+                const size_t max_chunks = std::min(num_threads, (input.size() - begin) / min_chunk_size);
+
+                std::vector<size_t> starts = {begin};
+                for (const size_t split : parallel_helpers::find_split_points(input, begin, max_chunks))
+                    starts.push_back(split);
+
+                stats.chunks = starts.size();
+
+                if (starts.size() == 1)
+                    return parser(input, start_index).parse_array();
+
+                std::vector<chunk_result> results(starts.size());
+
+                // one thread per chunk, so that the chunks are all parsed at the same time. if
+                // anything throws, the first exception is rethrown once all threads are joined.
+                std::vector<std::thread> thread_vector;
+                thread_vector.reserve(starts.size());
+
+                std::exception_ptr error;
+                std::mutex error_mutex;
+
+                // keep the first exception
+                auto fail = [&](std::exception_ptr e) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error)
+                        error = e;
+                };
+
+                try
+                {
+                    for (size_t k = 0; k < starts.size(); ++k)
+                    {
+                        thread_vector.emplace_back([&, k]() {
+                            try
+                            {
+                                const size_t limit = (k + 1 < starts.size() ? starts[k + 1] : SIZE_MAX);
+                                parser(input, starts[k]).read_array_data_until(limit, results[k].nodes, results[k].first, results[k].stop);
+                            }
+                            catch (...)
+                            {
+                                fail(std::current_exception());
+                            }
+                        });
+                    }
+                }
+                catch (...)
+                {
+                    fail(std::current_exception());
+                }
+
+                for (auto &t : thread_vector)
+                    t.join();
+
+                if (error)
+                    std::rethrow_exception(error);
+
+                // each chunk must pick up exactly where the one before it stopped
+                for (size_t k = 0; k + 1 < results.size(); ++k)
+                {
+                    if (results[k].stop != results[k + 1].first)
+                    {
+                        stats.fallback = true;
+                        return parser(input, start_index).parse_array();
+                    }
+                }
+
+                size_t count = 0;
+                for (const auto &result : results)
+                    count += result.nodes.size();
+
+                std::vector<std::shared_ptr<node>> nodes;
+                nodes.reserve(count);
+
+                for (auto &result : results)
+                    std::move(result.nodes.begin(), result.nodes.end(), std::back_inserter(nodes));
+
+                return std::make_shared<node_array>("", std::move(nodes));
+            }
+
+        }; // class parallel_parser
+
+        // parse a json string on multiple threads and return a smart pointer to the array
+        // data. a thread count of zero uses one thread per hardware thread.
+        std::shared_ptr<node_array> parse_array_parallel(const std::string_view input, const size_t threads = 0)
+        {
+            return parallel_parser(threads).parse_array(input);
+        }
+
+    } // namespace json
+} // namespace rda
+
+POP_WARN_DISABLE
@@ -0,0 +1,688 @@
+#pragma once
+
+//
+// json_patch.h - JSON Patch (RFC 6902) and JSON Merge Patch (RFC 7386) for node trees.
+//  Patching never modifies the document: it returns a new version, in which only the
+//  objects and arrays on the path to each change are new, and every unchanged sub-tree is
+//  shared with the old version. Keeping many versions of a large document (such as
+//  snapshots of a configuration) costs little more memory than their differences. As
+//  nodes are shared between versions, a version must not be changed in place (with
+//  add_child() or remove_child()) once it has been patched or used as a patch.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "json.h"
+#include "json_query.h"
+#include "platform_defs.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE_GCC("-Wunused-function")
+
+namespace rda
+{
+    namespace json
+    {
+        // helper methods for building new versions of a node tree
+        namespace patch_helpers
+        {
+            // the reference tokens of a json pointer
+            typedef std::vector<query_helpers::segment> pointer;
+
+            // value returned by find_position() when there is no such child
+            constexpr static const size_t NOT_FOUND = static_cast<size_t>(-1);
+
+            // parse a json pointer ("" for the whole document, or "/a/0/b"). returns false if
+            // the text is not a json pointer.
+            bool parse_pointer(const std::string_view text, pointer &tokens)
+            {
+                if (!text.empty() && text[0] != '/')
+                    return false;
+
+                return query_helpers::query_parser(text).parse(tokens);
+            }
+
+            // returns true if a is a proper prefix of b
+            bool is_proper_prefix(const pointer &a, const pointer &b)
+            {
+                if (a.size() >= b.size())
+                    return false;
+
+                for (size_t i = 0; i < a.size(); ++i)
+                    if (a[i].name != b[i].name)
+                        return false;
+
+                return true;
+            }
+
+            // returns true if two pointers are the same
+            bool is_same(const pointer &a, const pointer &b)
+            {
+                if (a.size() != b.size())
+                    return false;
+
+                for (size_t i = 0; i < a.size(); ++i)
+                    if (a[i].name != b[i].name)
+                        return false;
+
+                return true;
+            }
+
+            // returns the children of an array or object (nullptr for any other node)
+            const std::vector<std::shared_ptr<node>> *children_of(const node *n)
+            {
+                if (n == nullptr)
+                    return nullptr;
+
+                if (n->get_type() == JsonDataType::JDT_OBJECT)
+                    return &static_cast<const node_object *>(n)->get_data();
+
+                if (n->get_type() == JsonDataType::JDT_ARRAY)
+                    return &static_cast<const node_array *>(n)->get_data();
+
+                return nullptr;
+            }
+
+            // returns the position of the child of an array or object that a reference token
+            // refers to (the first child with the key name in an object), or NOT_FOUND
+            size_t find_position(const node &container, const query_helpers::segment &token)
+            {
+                if (container.get_type() == JsonDataType::JDT_OBJECT)
+                {
+                    const auto &obj = static_cast<const node_object &>(container);
+
+                    if (const std::shared_ptr<node> *child = obj.find_child(token.name))
+                        return static_cast<size_t>(child - obj.get_data().data());
+
+                    return NOT_FOUND;
+                }
+
+                if (container.get_type() == JsonDataType::JDT_ARRAY && token.has_index &&
+                    static_cast<size_t>(token.index) < static_cast<const node_array &>(container).size())
+                    return static_cast<size_t>(token.index);
+
+                return NOT_FOUND;
+            }
+
+            // returns a node with the given key name and the same value as n (n itself, if it
+            // already has that key name). the children of an array or object are shared.
+            std::shared_ptr<node> with_key(const std::shared_ptr<node> &n, const std::string &key)
+            {
+                if (n->get_key_view() == key)
+                    return n;
+
+                switch (n->get_type())
+                {
+                    case JsonDataType::JDT_NULL:
+                        return std::make_shared<node_null>(key);
+                    case JsonDataType::JDT_BOOLEAN:
+                        return std::make_shared<node_boolean>(key, static_cast<const node_boolean &>(*n).get_data());
+                    case JsonDataType::JDT_INTEGER:
+                        return std::make_shared<node_integer>(key, static_cast<const node_integer &>(*n).get_data());
+                    case JsonDataType::JDT_FLOAT:
+                        return std::make_shared<node_float>(key, static_cast<const node_float &>(*n).get_data());
+                    case JsonDataType::JDT_STRING:
+                        return std::make_shared<node_string>(key, static_cast<const node_string &>(*n).get_data());
+                    case JsonDataType::JDT_ARRAY:
+                        return std::make_shared<node_array>(key, static_cast<const node_array &>(*n).get_data());
+                    case JsonDataType::JDT_OBJECT:
+                        return std::make_shared<node_object>(key, static_cast<const node_object &>(*n).get_data());
+                    default:
+                        return nullptr;
+                }
+            }
+
+            // returns a new array or object, with the key name of container and the given
+            // children
+            std::shared_ptr<node> make_container(const node &container, std::vector<std::shared_ptr<node>> &&children)
+            {
+                if (container.get_type() == JsonDataType::JDT_OBJECT)
+                    return std::make_shared<node_object>(container.get_key(), std::move(children));
+
+                return std::make_shared<node_array>(container.get_key(), std::move(children));
+            }
+
+            // returns the node that a json pointer refers to (nullptr if there is none)
+            std::shared_ptr<node> find(const std::shared_ptr<node> &root, const pointer &tokens)
+            {
+                std::shared_ptr<node> n = root;
+
+                for (const auto &token : tokens)
+                {
+                    const auto *children = children_of(n.get());
+                    if (children == nullptr)
+                        return nullptr;
+
+                    const size_t position = find_position(*n, token);
+                    if (position == NOT_FOUND)
+                        return nullptr;
+
+                    n = (*children)[position];
+                }
+
+                return n;
+            }
+
+            // returns true if two nodes have equal values (their own key names are ignored).
+            // numbers are equal if they have the same value, whether integer or floating
+            // point, and objects are equal if they have equal members, in any order.
+            bool equal(const node &a, const node &b)
+            {
+                const JsonDataType ta = a.get_type();
+                const JsonDataType tb = b.get_type();
+
+                const bool a_number = (ta == JsonDataType::JDT_INTEGER || ta == JsonDataType::JDT_FLOAT);
+                const bool b_number = (tb == JsonDataType::JDT_INTEGER || tb == JsonDataType::JDT_FLOAT);
+
+                if (a_number && b_number)
+                {
+                    if (ta == JsonDataType::JDT_INTEGER && tb == JsonDataType::JDT_INTEGER)
+                        return (static_cast<const node_integer &>(a).get_data() == static_cast<const node_integer &>(b).get_data());
+
+                    const double da = (ta == JsonDataType::JDT_INTEGER ? static_cast<double>(static_cast<const node_integer &>(a).get_data())
+                                                                       : static_cast<const node_float &>(a).get_data());
+                    const double db = (tb == JsonDataType::JDT_INTEGER ? static_cast<double>(static_cast<const node_integer &>(b).get_data())
+                                                                       : static_cast<const node_float &>(b).get_data());
+                    return (da == db);
+                }
+
+                if (ta != tb)
+                    return false;
+
+                switch (ta)
+                {
+                    case JsonDataType::JDT_NULL:
+                        return true;
+                    case JsonDataType::JDT_BOOLEAN:
+                        return (static_cast<const node_boolean &>(a).get_data() == static_cast<const node_boolean &>(b).get_data());
+                    case JsonDataType::JDT_STRING:
+                        return (static_cast<const node_string &>(a).get_data_view() == static_cast<const node_string &>(b).get_data_view());
+                    case JsonDataType::JDT_ARRAY:
+                    {
+                        const auto &ca = static_cast<const node_array &>(a).get_data();
+                        const auto &cb = static_cast<const node_array &>(b).get_data();
+
+                        if (ca.size() != cb.size())
+                            return false;
+
+                        for (size_t i = 0; i < ca.size(); ++i)
+                            if (ca[i] != cb[i] && !equal(*ca[i], *cb[i]))
+                                return false;
+
+                        return true;
+                    }
+                    case JsonDataType::JDT_OBJECT:
+                    {
+                        const auto &oa = static_cast<const node_object &>(a);
+                        const auto &ob = static_cast<const node_object &>(b);
+
+                        if (oa.size() != ob.size())
+                            return false;
+
+                        for (const auto &child : oa.get_data())
+                        {
+                            const std::shared_ptr<node> *other = ob.find_child(child->get_key_view());
+                            if (other == nullptr || (*other != child && !equal(*child, **other)))
+                                return false;
+                        }
+
+                        return true;
+                    }
+                    default:
+                        return false;
+                }
+            }
+
+            // kinds of change made to the array or object at the end of a path
+            enum class edit_type
+            {
+                ET_ADD,
+                ET_REMOVE,
+                ET_REPLACE
+            };
+
+            // returns a new version of n with the change made at the end of the path (from the
+            // token at depth), sharing every sub-tree that is not on the path. returns nullptr
+            // if the path does not exist, or the change can not be made there.
+            std::shared_ptr<node> edit(const std::shared_ptr<node> &n, const pointer &tokens, const size_t depth,
+                                       const edit_type type, const std::shared_ptr<node> &value)
+            {
+                const auto *children = children_of(n.get());
+                if (children == nullptr)
+                    return nullptr;
+
+                const query_helpers::segment &token = tokens[depth];
+                const size_t position = find_position(*n, token);
+                std::vector<std::shared_ptr<node>> copy;
+
+                if (depth + 1 < tokens.size())
+                {
+                    if (position == NOT_FOUND)
+                        return nullptr;
+
+                    std::shared_ptr<node> child = edit((*children)[position], tokens, depth + 1, type, value);
+                    if (child == nullptr)
+                        return nullptr;
+
+                    copy = *children;
+                    copy[position] = std::move(child);
+                    return make_container(*n, std::move(copy));
+                }
+
+                const bool in_object = (n->get_type() == JsonDataType::JDT_OBJECT);
+                const std::string key = (in_object ? token.name : std::string());
+
+                switch (type)
+                {
+                    case edit_type::ET_ADD:
+                    {
+                        // adding to an object replaces an existing member. adding to an array
+                        // inserts before the index, or appends for "-".
+                        size_t insert_at = position;
+
+                        if (!in_object)
+                        {
+                            if (token.name == "-")
+                                insert_at = children->size();
+                            else if (token.has_index && static_cast<size_t>(token.index) <= children->size())
+                                insert_at = static_cast<size_t>(token.index);
+                            else
+                                return nullptr;
+                        }
+
+                        copy.reserve(children->size() + 1);
+                        copy = *children;
+
+                        if (in_object && position != NOT_FOUND)
+                            copy[position] = with_key(value, key);
+                        else if (in_object)
+                            copy.push_back(with_key(value, key));
+                        else
+                            copy.insert(copy.begin() + static_cast<std::ptrdiff_t>(insert_at), with_key(value, key));
+                        break;
+                    }
+                    case edit_type::ET_REMOVE:
+                    {
+                        if (position == NOT_FOUND)
+                            return nullptr;
+
+                        copy.reserve(children->size() - 1);
+                        copy.insert(copy.end(), children->begin(), children->begin() + static_cast<std::ptrdiff_t>(position));
+                        copy.insert(copy.end(), children->begin() + static_cast<std::ptrdiff_t>(position) + 1, children->end());
+                        break;
+                    }
+                    case edit_type::ET_REPLACE:
+                    {
+                        if (position == NOT_FOUND)
+                            return nullptr;
+
+                        copy = *children;
+                        copy[position] = with_key(value, key);
+                        break;
+                    }
+                }
+
+                return make_container(*n, std::move(copy));
+            }
+
+            // returns target merged with a merge patch (RFC 7386), with the given key name.
+            // target may be nullptr. returns target itself if the patch changes nothing.
+            std::shared_ptr<node> merge(const std::shared_ptr<node> &target, const std::shared_ptr<node> &patch,
+                                        const std::string &key)
+            {
+                if (patch->get_type() != JsonDataType::JDT_OBJECT)
+                {
+                    if (target != nullptr && equal(*target, *patch))
+                        return target;
+
+                    return with_key(patch, key);
+                }
+
+                const bool is_object = (target != nullptr && target->get_type() == JsonDataType::JDT_OBJECT);
+
+                std::vector<std::shared_ptr<node>> children;
+                if (is_object)
+                    children = static_cast<const node_object &>(*target).get_data();
+
+                // position of the first child with each key name. removed children are set to
+                // nullptr until the end, so the positions stay valid.
+                std::unordered_map<std::string_view, size_t> positions;
+                positions.reserve(children.size());
+                for (size_t i = 0; i < children.size(); ++i)
+                    positions.emplace(children[i]->get_key_view(), i);
+
+                bool changed = !is_object;
+                bool removed = false;
+
+                for (const auto &member : static_cast<const node_object &>(*patch).get_data())
+                {
+                    const std::string_view name = member->get_key_view();
+                    const auto iter = positions.find(name);
+                    const bool found = (iter != positions.end() && children[iter->second] != nullptr);
+
+                    if (member->get_type() == JsonDataType::JDT_NULL)
+                    {
+                        if (found)
+                        {
+                            children[iter->second] = nullptr;
+                            changed = removed = true;
+                        }
+
+                        continue;
+                    }
+
+                    const std::shared_ptr<node> existing = (found ? children[iter->second] : nullptr);
+                    std::shared_ptr<node> merged = merge(existing, member, std::string(name));
+
+                    if (merged == existing)
+                        continue;
+
+                    changed = true;
+
+                    if (found)
+                    {
+                        children[iter->second] = std::move(merged);
+                    }
+                    else
+                    {
+                        positions[name] = children.size();
+                        children.push_back(std::move(merged));
+                    }
+                }
+
+                if (!changed)
+                    return target;
+
+                if (removed)
+                    children.erase(std::remove(children.begin(), children.end(), nullptr), children.end());
+
+                return std::make_shared<node_object>(key, std::move(children));
+            }
+
+        } // namespace patch_helpers
+
+        // operations of a json patch
+        enum class patch_op
+        {
+            PO_ADD,
+            PO_REMOVE,
+            PO_REPLACE,
+            PO_MOVE,
+            PO_COPY,
+            PO_TEST
+        };
+
+        // one operation of a json patch
+        struct patch_operation
+        {
+            // the operation
+            patch_op op = patch_op::PO_ADD;
+
+            // the location that the operation applies to
+            patch_helpers::pointer path;
+
+            // the location that a move or copy reads from
+            patch_helpers::pointer from;
+
+            // the value that is added, replaced, or tested for
+            std::shared_ptr<node> value;
+        };
+
+        // a parsed json patch (RFC 6902): an array of operations, applied in order. a patch
+        // is applied as a whole: if any operation fails, the document is left as it was.
+        class patch
+        {
+        public:
+            // value of the failed operation index when no operation has failed
+            constexpr static const size_t NO_FAILURE = static_cast<size_t>(-1);
+
+        private:
+            // the operations
+            std::vector<patch_operation> operations;
+
+            // true if every operation in the patch document was well formed
+            bool valid = false;
+
+        public:
+            // constructor, from a patch document
+            explicit patch(const node_array &document)
+            {
+                valid = read(document);
+
+                if (!valid)
+                    operations.clear();
+            }
+
+            // constructor, from the text of a patch document
+            explicit patch(const std::string &text)
+            {
+                const auto document = parse_array(text);
+                valid = (document != nullptr && read(*document));
+
+                if (!valid)
+                    operations.clear();
+            }
+
+            // returns true if every operation in the patch document was well formed
+            bool is_valid() const
+            {
+                return valid;
+            }
+
+            // returns the operations
+            const std::vector<patch_operation> &get_operations() const
+            {
+                return operations;
+            }
+
+            // returns a new version of the document with the patch applied, sharing every
+            // unchanged sub-tree with it. returns nullptr if the patch is not valid, or an
+            // operation fails (failed_operation, if given, is set to its index), or the result
+            // is not an object. the document itself is never changed.
+            std::shared_ptr<node_object> apply(const std::shared_ptr<node_object> &document,
+                                               size_t *failed_operation = nullptr) const
+            {
+                if (failed_operation != nullptr)
+                    *failed_operation = NO_FAILURE;
+
+                if (!valid || document == nullptr)
+                    return nullptr;
+
+                std::shared_ptr<node> current = document;
+
+                for (size_t i = 0; i < operations.size(); ++i)
+                {
+                    current = apply(current, operations[i]);
+
+                    if (current == nullptr)
+                    {
+                        if (failed_operation != nullptr)
+                            *failed_operation = i;
+
+                        return nullptr;
+                    }
+                }
+
+                if (current->get_type() != JsonDataType::JDT_OBJECT)
+                    return nullptr;
+
+                return std::static_pointer_cast<node_object>(current);
+            }
+
+        private:
+            // read the operations from a patch document. returns false if any is mal-formed.
+            bool read(const node_array &document)
+            {
+                for (const auto &element : document)
+                {
+                    if (element->get_type() != JsonDataType::JDT_OBJECT)
+                        return false;
+
+                    const auto &obj = static_cast<const node_object &>(*element);
+                    const std::shared_ptr<node> *op_node = obj.find_child("op");
+                    if (op_node == nullptr || (*op_node)->get_type() != JsonDataType::JDT_STRING)
+                        return false;
+
+                    const std::string_view op = get_value_string_view(*op_node);
+                    patch_operation operation;
+
+                    if (op == "add")
+                        operation.op = patch_op::PO_ADD;
+                    else if (op == "remove")
+                        operation.op = patch_op::PO_REMOVE;
+                    else if (op == "replace")
+                        operation.op = patch_op::PO_REPLACE;
+                    else if (op == "move")
+                        operation.op = patch_op::PO_MOVE;
+                    else if (op == "copy")
+                        operation.op = patch_op::PO_COPY;
+                    else if (op == "test")
+                        operation.op = patch_op::PO_TEST;
+                    else
+                        return false;
+
+                    const std::shared_ptr<node> *path = obj.find_child("path");
+                    if (path == nullptr || (*path)->get_type() != JsonDataType::JDT_STRING ||
+                        !patch_helpers::parse_pointer(get_value_string_view(*path), operation.path))
+                        return false;
+
+                    if (operation.op == patch_op::PO_MOVE || operation.op == patch_op::PO_COPY)
+                    {
+                        const std::shared_ptr<node> *from = obj.find_child("from");
+                        if (from == nullptr || (*from)->get_type() != JsonDataType::JDT_STRING ||
+                            !patch_helpers::parse_pointer(get_value_string_view(*from), operation.from))
+                            return false;
+                    }
+
+                    if (operation.op == patch_op::PO_ADD || operation.op == patch_op::PO_REPLACE ||
+                        operation.op == patch_op::PO_TEST)
+                    {
+                        const std::shared_ptr<node> *value = obj.find_child("value");
+                        if (value == nullptr)
+                            return false;
+
+                        operation.value = *value;
+                    }
+
+                    operations.push_back(std::move(operation));
+                }
+
+                return true;
+            }
+
+            // returns a new version of the document with one operation applied (nullptr if it
+            // fails)
+            static std::shared_ptr<node> apply(const std::shared_ptr<node> &document, const patch_operation &operation)
+            {
+                switch (operation.op)
+                {
+                    case patch_op::PO_ADD:
+                        return add(document, operation.path, operation.value);
+                    case patch_op::PO_REMOVE:
+                    {
+                        if (operation.path.empty())
+                            return nullptr;
+
+                        return patch_helpers::edit(document, operation.path, 0, patch_helpers::edit_type::ET_REMOVE, nullptr);
+                    }
+                    case patch_op::PO_REPLACE:
+                    {
+                        if (operation.path.empty())
+                            return patch_helpers::with_key(operation.value, document->get_key());
+
+                        return patch_helpers::edit(document, operation.path, 0, patch_helpers::edit_type::ET_REPLACE,
+                                                   operation.value);
+                    }
+                    case patch_op::PO_MOVE:
+                    {
+                        // a location can not be moved into one of its own children
+                        if (patch_helpers::is_proper_prefix(operation.from, operation.path))
+                            return nullptr;
+
+                        const std::shared_ptr<node> value = patch_helpers::find(document, operation.from);
+                        if (value == nullptr)
+                            return nullptr;
+
+                        if (patch_helpers::is_same(operation.from, operation.path))
+                            return document;
+
+                        const std::shared_ptr<node> removed = patch_helpers::edit(
+                            document, operation.from, 0, patch_helpers::edit_type::ET_REMOVE, nullptr);
+                        if (removed == nullptr)
+                            return nullptr;
+
+                        return add(removed, operation.path, value);
+                    }
+                    case patch_op::PO_COPY:
+                    {
+                        // the copied sub-tree is shared, not copied
+                        const std::shared_ptr<node> value = patch_helpers::find(document, operation.from);
+                        if (value == nullptr)
+                            return nullptr;
+
+                        return add(document, operation.path, value);
+                    }
+                    case patch_op::PO_TEST:
+                    {
+                        const std::shared_ptr<node> actual = patch_helpers::find(document, operation.path);
+                        if (actual == nullptr || !patch_helpers::equal(*actual, *operation.value))
+                            return nullptr;
+
+                        return document;
+                    }
+                    default:
+                        return nullptr;
+                }
+            }
+
+            // returns a new version of the document with a value added at the path
+            static std::shared_ptr<node> add(const std::shared_ptr<node> &document, const patch_helpers::pointer &path,
+                                             const std::shared_ptr<node> &value)
+            {
+                if (path.empty())
+                    return patch_helpers::with_key(value, document->get_key());
+
+                return patch_helpers::edit(document, path, 0, patch_helpers::edit_type::ET_ADD, value);
+            }
+
+        }; // class patch
+
+        // apply a json patch (RFC 6902), given as text, to a document. returns the new version
+        // of the document, or nullptr if the patch is not valid or can not be applied.
+        std::shared_ptr<node_object> apply_patch(const std::shared_ptr<node_object> &document, const std::string &patch_text)
+        {
+            return patch(patch_text).apply(document);
+        }
+
+        // apply a json merge patch (RFC 7386) to a document. members of the patch that are
+        // null are removed from the document, objects are merged, and any other value
+        // replaces the member with its key name. returns the new version of the document (the
+        // document itself if nothing changed), or nullptr if the patch is not an object.
+        std::shared_ptr<node_object> apply_merge_patch(const std::shared_ptr<node_object> &document,
+                                                       const std::shared_ptr<node> &merge_patch)
+        {
+            if (document == nullptr || merge_patch == nullptr || merge_patch->get_type() != JsonDataType::JDT_OBJECT)
+                return nullptr;
+
+            return std::static_pointer_cast<node_object>(patch_helpers::merge(document, merge_patch, document->get_key()));
+        }
+
+        // apply a json merge patch (RFC 7386), given as text, to a document
+        std::shared_ptr<node_object> apply_merge_patch(const std::shared_ptr<node_object> &document,
+                                                       const std::string &merge_patch_text)
+        {
+            return apply_merge_patch(document, parse(merge_patch_text));
+        }
+
+    } // namespace json
+} // namespace rda
+
+POP_WARN_DISABLE
@@ -0,0 +1,1081 @@
+#pragma once
+
+//
+// json_query.h - Queries that select nodes from a json document, written as a JSONPath
+//  expression ("$.store.book[*].title") or as a JSON Pointer ("/store/book/0/title").
+//  JSONPath supports key names, array indices (negative indices count from the end),
+//  wildcards, recursive descent and filter predicates. Queries are evaluated against a node
+//  tree, or while a document is being read, in which case only the matching sub-trees are
+//  ever built.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "json.h"
+#include "json_sax.h"
+#include "platform_defs.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE_GCC("-Wunused-function")
+
+//
+// JSONPath syntax:
+//
+//   $                the root of the document
+//   .name  ['name']  the member of an object with the key name
+//   [2]  [-1]        the element of an array at an index (negative counts from the end)
+//   .*  [*]          every member or element
+//   ..name  ..*      recursive descent: the selector applied at any depth below
+//   [?(@.a.b < 10)]  every member or element that satisfies a predicate. a predicate is a
+//                    comparison (==, !=, <, <=, >, >=) of a value relative to the member or
+//                    element (@) with a number, 'string', true, false or null, or just a
+//                    relative value to test that it exists. comparisons are joined by && and ||.
+//
+// JSON Pointer syntax (the empty string selects the whole document):
+//
+//   /name/0          a key name, or an array index. ~1 stands for '/' and ~0 for '~'.
+//
+// every node is selected at most once, in document order.
+//
+
+namespace rda
+{
+    namespace json
+    {
+        // helper methods for parsing and evaluating queries
+        namespace query_helpers
+        {
+            // kinds of selector of a query segment
+            enum class selector_type
+            {
+                ST_NAME,     // the member of an object with a key name
+                ST_INDEX,    // the element of an array at an index
+                ST_WILDCARD, // every member or element
+                ST_FILTER,   // every member or element that satisfies a predicate
+                ST_POINTER   // a json pointer reference token: a key name, or an array index
+            };
+
+            // comparison operators of a filter predicate
+            enum class compare_op
+            {
+                CO_EXISTS,
+                CO_EQUAL,
+                CO_NOT_EQUAL,
+                CO_LESS,
+                CO_LESS_EQUAL,
+                CO_GREATER,
+                CO_GREATER_EQUAL
+            };
+
+            // one step of a path relative to the node being filtered: a key name or an index
+            struct step
+            {
+                std::string name;
+                int64_t index = 0;
+                bool is_index = false;
+            };
+
+            // a literal value in a filter predicate
+            struct literal
+            {
+                JsonDataType type = JsonDataType::JDT_NULL;
+                bool boolean = false;
+                int64_t integer = 0;
+                double number = 0.0;
+                std::string text;
+            };
+
+            // a comparison of the value at a relative path with a literal
+            struct comparison
+            {
+                std::vector<step> operand;
+                compare_op op = compare_op::CO_EXISTS;
+                literal value;
+            };
+
+            // a filter predicate: comparisons joined by && in each term, and terms joined by ||
+            typedef std::vector<std::vector<comparison>> predicate;
+
+            // one segment of a query, which selects children of the nodes selected so far (or
+            // with descendant set, of those nodes and all of their descendants)
+            struct segment
+            {
+                selector_type type = selector_type::ST_WILDCARD;
+                bool descendant = false;
+                std::string name;
+                int64_t index = 0;
+                bool has_index = false;
+                predicate filter;
+            };
+
+            // the segments of a query that a node has been reached by. a state equal to the
+            // number of segments means the node is selected.
+            typedef std::vector<size_t> state_set;
+
+            // parses the text of a query into its segments
+            class query_parser
+            {
+            private:
+                // the query text
+                std::string_view text;
+
+                // current read position
+                size_t pos = 0;
+
+            public:
+                // constructor
+                explicit query_parser(const std::string_view text_)
+                    : text(text_)
+                {
+                }
+
+                // parse the query into segments. returns false if it is not a valid query.
+                bool parse(std::vector<segment> &segments)
+                {
+                    if (text.empty() || text[0] == '/')
+                        return parse_pointer(segments);
+
+                    if (!accept('$'))
+                        return false;
+
+                    while (pos < text.size())
+                    {
+                        segment seg;
+
+                        if (accept('.'))
+                        {
+                            seg.descendant = accept('.');
+
+                            if (seg.descendant && accept('['))
+                            {
+                                if (!parse_bracket(seg))
+                                    return false;
+                            }
+                            else if (!parse_dot_name(seg))
+                            {
+                                return false;
+                            }
+                        }
+                        else if (!accept('[') || !parse_bracket(seg))
+                        {
+                            return false;
+                        }
+
+                        segments.push_back(std::move(seg));
+                    }
+
+                    return true;
+                }
+
+            private:
+                // returns the current character (or a null character at the end)
+                char peek() const
+                {
+                    return (pos < text.size() ? text[pos] : '\0');
+                }
+
+                // consume the character if it is next. returns true if it was.
+                bool accept(const char c)
+                {
+                    if (peek() != c)
+                        return false;
+
+                    ++pos;
+                    return true;
+                }
+
+                // consume the text if it is next. returns true if it was.
+                bool accept(const std::string_view s)
+                {
+                    if (text.substr(pos, s.size()) != s)
+                        return false;
+
+                    pos += s.size();
+                    return true;
+                }
+
+                // skip over any spaces
+                void skip_spaces()
+                {
+                    while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t'))
+                        ++pos;
+                }
+
+                // returns true if the character may be part of a key name in a filter
+                static bool is_name_char(const char c)
+                {
+                    return (c != '\0' && c != ' ' && c != '\t' && c != '.' && c != '[' && c != ']' && c != '(' &&
+                            c != ')' && c != '=' && c != '!' && c != '<' && c != '>' && c != '&' && c != '|' &&
+                            c != '\'' && c != '"');
+                }
+
+                // parse a json pointer: reference tokens, each preceded by a '/'
+                bool parse_pointer(std::vector<segment> &segments)
+                {
+                    while (accept('/'))
+                    {
+                        segment seg;
+                        seg.type = selector_type::ST_POINTER;
+
+                        for (; pos < text.size() && text[pos] != '/'; ++pos)
+                        {
+                            if (text[pos] != '~')
+                                seg.name += text[pos];
+                            else if (pos + 1 < text.size() && (text[pos + 1] == '0' || text[pos + 1] == '1'))
+                                seg.name += (text[++pos] == '0' ? '~' : '/');
+                            else
+                                return false;
+                        }
+
+                        // a token is also an array index if it is a number without leading zeros
+                        seg.has_index = (!seg.name.empty() && seg.name.size() < 19 &&
+                                         seg.name.find_first_not_of("0123456789") == std::string::npos &&
+                                         (seg.name[0] != '0' || seg.name.size() == 1));
+
+                        if (seg.has_index)
+                            seg.index = static_cast<int64_t>(atoll(seg.name.c_str()));
+
+                        segments.push_back(std::move(seg));
+                    }
+
+                    return (pos == text.size());
+                }
+
+                // parse the selector after a '.': a key name or '*'
+                bool parse_dot_name(segment &seg)
+                {
+                    if (accept('*'))
+                    {
+                        seg.type = selector_type::ST_WILDCARD;
+                        return true;
+                    }
+
+                    const size_t start = pos;
+                    while (pos < text.size() && text[pos] != '.' && text[pos] != '[')
+                        ++pos;
+
+                    seg.type = selector_type::ST_NAME;
+                    seg.name = std::string(text.substr(start, pos - start));
+                    return !seg.name.empty();
+                }
+
+                // parse the selector after a '[', up to and including the ']'
+                bool parse_bracket(segment &seg)
+                {
+                    skip_spaces();
+
+                    if (accept('*'))
+                    {
+                        seg.type = selector_type::ST_WILDCARD;
+                    }
+                    else if (peek() == '\'' || peek() == '"')
+                    {
+                        seg.type = selector_type::ST_NAME;
+                        if (!parse_quoted(seg.name))
+                            return false;
+                    }
+                    else if (accept('?'))
+                    {
+                        seg.type = selector_type::ST_FILTER;
+                        skip_spaces();
+
+                        const bool parenthesized = accept('(');
+                        if (!parse_predicate(seg.filter))
+                            return false;
+
+                        skip_spaces();
+                        if (parenthesized && !accept(')'))
+                            return false;
+                    }
+                    else
+                    {
+                        seg.type = selector_type::ST_INDEX;
+                        if (!parse_integer(seg.index))
+                            return false;
+                    }
+
+                    skip_spaces();
+                    return accept(']');
+                }
+
+                // parse a string in single or double quotes. a backslash escapes the character
+                // after it.
+                bool parse_quoted(std::string &output)
+                {
+                    const char quote = text[pos++];
+
+                    while (pos < text.size() && text[pos] != quote)
+                    {
+                        if (text[pos] == '\\' && pos + 1 < text.size())
+                            ++pos;
+
+                        output += text[pos++];
+                    }
+
+                    return accept(quote);
+                }
+
+                // parse an integer, with an optional leading minus sign
+                bool parse_integer(int64_t &value)
+                {
+                    const bool negative = accept('-');
+                    const size_t start = pos;
+
+                    value = 0;
+                    while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9' && pos - start < 18)
+                        value = value * 10 + (text[pos++] - '0');
+
+                    if (negative)
+                        value = -value;
+
+                    return (pos > start && !(peek() >= '0' && peek() <= '9'));
+                }
+
+                // parse comparisons joined by && and ||
+                bool parse_predicate(predicate &filter)
+                {
+                    do
+                    {
+                        filter.emplace_back();
+
+                        do
+                        {
+                            filter.back().emplace_back();
+                            if (!parse_comparison(filter.back().back()))
+                                return false;
+
+                            skip_spaces();
+                        } while (accept("&&"));
+
+                    } while (accept("||"));
+
+                    return true;
+                }
+
+                // parse a relative path, optionally followed by an operator and a literal
+                bool parse_comparison(comparison &c)
+                {
+                    skip_spaces();
+
+                    if (!accept('@'))
+                        return false;
+
+                    for (;;)
+                    {
+                        step s;
+
+                        if (accept('.'))
+                        {
+                            const size_t start = pos;
+                            while (is_name_char(peek()))
+                                ++pos;
+
+                            s.name = std::string(text.substr(start, pos - start));
+                            if (s.name.empty())
+                                return false;
+                        }
+                        else if (accept('['))
+                        {
+                            skip_spaces();
+
+                            if (peek() == '\'' || peek() == '"')
+                            {
+                                if (!parse_quoted(s.name))
+                                    return false;
+                            }
+                            else
+                            {
+                                s.is_index = true;
+                                if (!parse_integer(s.index))
+                                    return false;
+                            }
+
+                            skip_spaces();
+                            if (!accept(']'))
+                                return false;
+                        }
+                        else
+                        {
+                            break;
+                        }
+
+                        c.operand.push_back(std::move(s));
+                    }
+
+                    skip_spaces();
+
+                    if (accept("=="))
+                        c.op = compare_op::CO_EQUAL;
+                    else if (accept("!="))
+                        c.op = compare_op::CO_NOT_EQUAL;
+                    else if (accept("<="))
+                        c.op = compare_op::CO_LESS_EQUAL;
+                    else if (accept(">="))
+                        c.op = compare_op::CO_GREATER_EQUAL;
+                    else if (accept('<'))
+                        c.op = compare_op::CO_LESS;
+                    else if (accept('>'))
+                        c.op = compare_op::CO_GREATER;
+                    else
+                        return true;
+
+                    skip_spaces();
+                    return parse_literal(c.value);
+                }
+
+                // parse a number, a quoted string, true, false or null
+                bool parse_literal(literal &value)
+                {
+                    if (peek() == '\'' || peek() == '"')
+                    {
+                        value.type = JsonDataType::JDT_STRING;
+                        return parse_quoted(value.text);
+                    }
+
+                    if (accept("true"))
+                    {
+                        value.type = JsonDataType::JDT_BOOLEAN;
+                        value.boolean = true;
+                        return true;
+                    }
+
+                    if (accept("false"))
+                    {
+                        value.type = JsonDataType::JDT_BOOLEAN;
+                        return true;
+                    }
+
+                    if (accept("null"))
+                    {
+                        value.type = JsonDataType::JDT_NULL;
+                        return true;
+                    }
+
+                    const size_t start = pos;
+                    while (pos < text.size() && std::string_view("+-0123456789.eE").find(text[pos]) != std::string_view::npos)
+                        ++pos;
+
+                    value.text = std::string(text.substr(start, pos - start));
+
+                    if (data_validators::is_type_integer(value.text))
+                    {
+                        value.type = JsonDataType::JDT_INTEGER;
+                        value.integer = static_cast<int64_t>(atoll(value.text.c_str()));
+                        return true;
+                    }
+
+                    if (data_validators::is_type_float(value.text))
+                    {
+                        value.type = JsonDataType::JDT_FLOAT;
+                        value.number = atof(value.text.c_str());
+                        return true;
+                    }
+
+                    return false;
+                }
+
+            }; // class query_parser
+
+            // returns the node at a path relative to n (nullptr if there is none)
+            const node *resolve(const node *n, const std::vector<step> &operand)
+            {
+                for (const step &s : operand)
+                {
+                    if (n == nullptr)
+                        return nullptr;
+
+                    if (s.is_index)
+                    {
+                        if (n->get_type() != JsonDataType::JDT_ARRAY)
+                            return nullptr;
+
+                        const auto &children = static_cast<const node_array *>(n)->get_data();
+                        const int64_t size = static_cast<int64_t>(children.size());
+                        const int64_t index = (s.index < 0 ? s.index + size : s.index);
+
+                        n = (index >= 0 && index < size ? children[static_cast<size_t>(index)].get() : nullptr);
+                    }
+                    else
+                    {
+                        if (n->get_type() != JsonDataType::JDT_OBJECT)
+                            return nullptr;
+
+                        const std::shared_ptr<node> *child = static_cast<const node_object *>(n)->find_child(s.name);
+                        n = (child != nullptr ? child->get() : nullptr);
+                    }
+                }
+
+                return n;
+            }
+
+            // compare a node with a literal of the same data type (integers and floats compare
+            // with each other). order is set negative, zero or positive as the node is less
+            // than, equal to or greater than the literal. returns false if they can not be
+            // compared.
+            bool compare_value(const node *n, const literal &value, int &order)
+            {
+                const JsonDataType type = n->get_type();
+
+                if (value.type == JsonDataType::JDT_INTEGER || value.type == JsonDataType::JDT_FLOAT)
+                {
+                    if (type == JsonDataType::JDT_INTEGER && value.type == JsonDataType::JDT_INTEGER)
+                    {
+                        const int64_t a = static_cast<const node_integer *>(n)->get_data();
+                        order = (a < value.integer ? -1 : (a > value.integer ? 1 : 0));
+                        return true;
+                    }
+
+                    double a = 0.0;
+                    if (type == JsonDataType::JDT_INTEGER)
+                        a = static_cast<double>(static_cast<const node_integer *>(n)->get_data());
+                    else if (type == JsonDataType::JDT_FLOAT)
+                        a = static_cast<const node_float *>(n)->get_data();
+                    else
+                        return false;
+
+                    const double b = (value.type == JsonDataType::JDT_INTEGER ? static_cast<double>(value.integer) : value.number);
+                    order = (a < b ? -1 : (a > b ? 1 : 0));
+                    return true;
+                }
+
+                if (type != value.type)
+                    return false;
+
+                if (type == JsonDataType::JDT_STRING)
+                {
+                    const int c = static_cast<const node_string *>(n)->get_data_view().compare(value.text);
+                    order = (c < 0 ? -1 : (c > 0 ? 1 : 0));
+                }
+                else if (type == JsonDataType::JDT_BOOLEAN)
+                {
+                    order = (static_cast<const node_boolean *>(n)->get_data() == value.boolean ? 0 : 1);
+                }
+                else
+                {
+                    order = 0;
+                }
+
+                return true;
+            }
+
+            // returns true if the comparison holds for the node being filtered
+            bool evaluate(const node *n, const comparison &c)
+            {
+                const node *operand = resolve(n, c.operand);
+
+                if (c.op == compare_op::CO_EXISTS)
+                    return (operand != nullptr);
+
+                int order = 0;
+                if (operand == nullptr || !compare_value(operand, c.value, order))
+                    return (c.op == compare_op::CO_NOT_EQUAL);
+
+                // booleans and nulls only compare for equality
+                const bool ordered = (c.value.type != JsonDataType::JDT_BOOLEAN && c.value.type != JsonDataType::JDT_NULL);
+
+                switch (c.op)
+                {
+                    case compare_op::CO_EQUAL:
+                        return (order == 0);
+                    case compare_op::CO_NOT_EQUAL:
+                        return (order != 0);
+                    case compare_op::CO_LESS:
+                        return (ordered && order < 0);
+                    case compare_op::CO_LESS_EQUAL:
+                        return (ordered && order <= 0);
+                    case compare_op::CO_GREATER:
+                        return (ordered && order > 0);
+                    case compare_op::CO_GREATER_EQUAL:
+                        return (ordered && order >= 0);
+                    default:
+                        return false;
+                }
+            }
+
+            // returns true if the predicate holds for the node being filtered
+            bool evaluate(const node *n, const predicate &filter)
+            {
+                for (const auto &term : filter)
+                {
+                    bool holds = true;
+
+                    for (const auto &c : term)
+                        if (!(holds = evaluate(n, c)))
+                            break;
+
+                    if (holds)
+                        return true;
+                }
+
+                return false;
+            }
+
+            // returns true if the segment selects a child. key is its key name in an object,
+            // and index its position among the size children of its parent. child may be
+            // nullptr if the segment does not need it.
+            bool selects(const segment &seg, const bool in_object, const std::string_view key,
+                         const size_t index, const size_t size, const node *child)
+            {
+                switch (seg.type)
+                {
+                    case selector_type::ST_NAME:
+                        return (in_object && key == seg.name);
+                    case selector_type::ST_INDEX:
+                        if (in_object)
+                            return false;
+                        if (seg.index >= 0)
+                            return (index == static_cast<size_t>(seg.index));
+                        return (static_cast<size_t>(-seg.index) <= size && index == size - static_cast<size_t>(-seg.index));
+                    case selector_type::ST_WILDCARD:
+                        return true;
+                    case selector_type::ST_FILTER:
+                        return (child != nullptr && evaluate(child, seg.filter));
+                    case selector_type::ST_POINTER:
+                        return (in_object ? key == seg.name : (seg.has_index && index == static_cast<size_t>(seg.index)));
+                    default:
+                        return false;
+                }
+            }
+
+            // add a state to a set, if it is not already in it
+            void add_state(state_set &states, const size_t state)
+            {
+                for (const size_t s : states)
+                    if (s == state)
+                        return;
+
+                states.push_back(state);
+            }
+
+            // find the states of a child from the states of its parent
+            void advance(const std::vector<segment> &segments, const state_set &parent, const bool in_object,
+                         const std::string_view key, const size_t index, const size_t size, const node *child,
+                         state_set &states)
+            {
+                states.clear();
+
+                for (const size_t s : parent)
+                {
+                    if (s == segments.size())
+                        continue;
+
+                    if (segments[s].descendant)
+                        add_state(states, s);
+
+                    if (selects(segments[s], in_object, key, index, size, child))
+                        add_state(states, s + 1);
+                }
+            }
+
+            // returns true if a node in these states is selected
+            bool is_selected(const std::vector<segment> &segments, const state_set &states)
+            {
+                for (const size_t s : states)
+                    if (s == segments.size())
+                        return true;
+
+                return false;
+            }
+
+            // returns true if selecting the children of a node in these states needs all of
+            // the children (for an index from the end), or the sub-tree of each (for a filter)
+            bool needs_tree(const std::vector<segment> &segments, const state_set &states)
+            {
+                for (const size_t s : states)
+                    if (s < segments.size() &&
+                        (segments[s].type == selector_type::ST_FILTER ||
+                         (segments[s].type == selector_type::ST_INDEX && segments[s].index < 0)))
+                        return true;
+
+                return false;
+            }
+
+            // add the nodes selected in the sub-tree of n, which is in the given states, to the
+            // results. returns false once there are max_results results (if it is not zero).
+            bool visit(const std::vector<segment> &segments, const std::shared_ptr<node> &n, const state_set &states,
+                       std::vector<std::shared_ptr<node>> &results, const size_t max_results)
+            {
+                if (is_selected(segments, states))
+                {
+                    results.push_back(n);
+
+                    if (max_results != 0 && results.size() >= max_results)
+                        return false;
+                }
+
+                const JsonDataType type = n->get_type();
+                if (type != JsonDataType::JDT_ARRAY && type != JsonDataType::JDT_OBJECT)
+                    return true;
+
+                const bool in_object = (type == JsonDataType::JDT_OBJECT);
+                const auto &children = (in_object ? static_cast<const node_object *>(n.get())->get_data()
+                                                  : static_cast<const node_array *>(n.get())->get_data());
+
+                state_set child_states;
+
+                for (size_t i = 0; i < children.size(); ++i)
+                {
+                    advance(segments, states, in_object, children[i]->get_key_view(), i, children.size(),
+                            children[i].get(), child_states);
+
+                    if (!child_states.empty() && !visit(segments, children[i], child_states, results, max_results))
+                        return false;
+                }
+
+                return true;
+            }
+
+        } // namespace query_helpers
+
+        // evaluates a query while a document is read (see json_sax.h). sub-trees that can not
+        // contain a selected node are skipped without building any nodes. selected nodes are
+        // built, as are the children of a node that a filter or an index from the end is
+        // applied to, which are then evaluated as a tree.
+        class query_handler : public sax_handler
+        {
+        private:
+            // an object or array being read, that some of the query has been matched to
+            struct stream_frame
+            {
+                query_helpers::state_set states;
+                bool is_object = false;
+                size_t next_index = 0;
+            };
+
+            // an object or array being built
+            struct build_frame
+            {
+                std::string key;
+                bool is_object = false;
+                std::vector<std::shared_ptr<node>> children;
+            };
+
+            // the segments of the query
+            const std::vector<query_helpers::segment> &segments;
+
+            // stop reading once there are this many results (zero for no limit)
+            size_t max_results = 0;
+
+            // the selected nodes
+            std::vector<std::shared_ptr<node>> results;
+
+            // the objects and arrays being read, innermost last
+            std::vector<stream_frame> frames;
+
+            // the objects and arrays being built, innermost last
+            std::vector<build_frame> building;
+
+            // the states of the outermost object or array being built
+            query_helpers::state_set build_states;
+
+            // scratch space for the states of the next value
+            query_helpers::state_set next_states;
+
+            // number of objects and arrays open in a sub-tree that is being skipped
+            size_t skip_depth = 0;
+
+            // the key name of the next value in an object
+            std::string key;
+
+        public:
+            // constructor. the segments (see query::get_segments()) must outlive the handler.
+            explicit query_handler(const std::vector<query_helpers::segment> &segments_, const size_t max_results_ = 0)
+                : segments(segments_), max_results(max_results_)
+            {
+            }
+
+            // returns the selected nodes
+            const std::vector<std::shared_ptr<node>> &get_results() const
+            {
+                return results;
+            }
+
+            // move the selected nodes out of the handler
+            std::vector<std::shared_ptr<node>> take_results()
+            {
+                return std::move(results);
+            }
+
+            // prepare to read another document
+            void reset()
+            {
+                results.clear();
+                frames.clear();
+                building.clear();
+                skip_depth = 0;
+            }
+
+            bool on_start_object() override
+            {
+                return open(true);
+            }
+
+            bool on_end_object() override
+            {
+                return close();
+            }
+
+            bool on_start_array() override
+            {
+                return open(false);
+            }
+
+            bool on_end_array() override
+            {
+                return close();
+            }
+
+            bool on_key(const std::string_view key_name) override
+            {
+                if (skip_depth == 0)
+                    key.assign(key_name.data(), key_name.size());
+
+                return true;
+            }
+
+            bool on_string(const std::string_view value) override
+            {
+                return scalar([&](const std::string &k) { return std::make_shared<node_string>(k, std::string(value)); });
+            }
+
+            bool on_integer(const int64_t value) override
+            {
+                return scalar([&](const std::string &k) { return std::make_shared<node_integer>(k, value); });
+            }
+
+            bool on_float(const double value) override
+            {
+                return scalar([&](const std::string &k) { return std::make_shared<node_float>(k, value); });
+            }
+
+            bool on_boolean(const bool value) override
+            {
+                return scalar([&](const std::string &k) { return std::make_shared<node_boolean>(k, value); });
+            }
+
+            bool on_null() override
+            {
+                return scalar([&](const std::string &k) { return std::make_shared<node_null>(k); });
+            }
+
+        private:
+            // returns the key name of the next value (empty in an array)
+            const std::string &next_key() const
+            {
+                static const std::string none;
+
+                const bool in_object = (!building.empty() ? building.back().is_object
+                                                          : (!frames.empty() && frames.back().is_object));
+                return (in_object ? key : none);
+            }
+
+            // find the states of the next value in the innermost object or array being read.
+            // returns false if it is in no state, and can be skipped.
+            bool advance()
+            {
+                if (frames.empty())
+                {
+                    next_states.assign(1, 0);
+                    return true;
+                }
+
+                stream_frame &f = frames.back();
+                query_helpers::advance(segments, f.states, f.is_object, key, f.next_index++, 0, nullptr, next_states);
+                return !next_states.empty();
+            }
+
+            // handle a value that is not an object or array. make creates its node.
+            template <typename Make>
+            bool scalar(const Make &make)
+            {
+                if (skip_depth > 0)
+                    return true;
+
+                if (!building.empty())
+                {
+                    building.back().children.push_back(make(next_key()));
+                    return true;
+                }
+
+                if (!advance() || !query_helpers::is_selected(segments, next_states))
+                    return true;
+
+                results.push_back(make(next_key()));
+                return (max_results == 0 || results.size() < max_results);
+            }
+
+            // handle the start of an object or array
+            bool open(const bool is_object)
+            {
+                if (skip_depth > 0)
+                {
+                    ++skip_depth;
+                    return true;
+                }
+
+                if (!building.empty())
+                {
+                    building.push_back(build_frame{next_key(), is_object, {}});
+                    return true;
+                }
+
+                if (!advance())
+                {
+                    skip_depth = 1;
+                    return true;
+                }
+
+                if (query_helpers::is_selected(segments, next_states) || query_helpers::needs_tree(segments, next_states))
+                {
+                    build_states = next_states;
+                    building.push_back(build_frame{next_key(), is_object, {}});
+                    return true;
+                }
+
+                frames.push_back(stream_frame{next_states, is_object, 0});
+                return true;
+            }
+
+            // handle the end of an object or array
+            bool close()
+            {
+                if (skip_depth > 0)
+                {
+                    --skip_depth;
+                    return true;
+                }
+
+                if (building.empty())
+                {
+                    if (!frames.empty())
+                        frames.pop_back();
+
+                    return true;
+                }
+
+                build_frame f = std::move(building.back());
+                building.pop_back();
+
+                std::shared_ptr<node> n;
+                if (f.is_object)
+                    n = std::make_shared<node_object>(f.key, std::move(f.children));
+                else
+                    n = std::make_shared<node_array>(f.key, std::move(f.children));
+
+                if (!building.empty())
+                {
+                    building.back().children.push_back(std::move(n));
+                    return true;
+                }
+
+                return query_helpers::visit(segments, n, build_states, results, max_results);
+            }
+
+        }; // class query_handler
+
+        // a parsed JSONPath or JSON Pointer query
+        class query
+        {
+        private:
+            // the segments of the query
+            std::vector<query_helpers::segment> segments;
+
+            // true if the text of the query was valid
+            bool valid = false;
+
+        public:
+            // constructor. check is_valid() to see if the text was a valid query.
+            explicit query(const std::string_view text)
+            {
+                valid = query_helpers::query_parser(text).parse(segments);
+
+                if (!valid)
+                    segments.clear();
+            }
+
+            // returns true if the text of the query was valid. an invalid query selects nothing.
+            bool is_valid() const
+            {
+                return valid;
+            }
+
+            // returns the segments of the query
+            const std::vector<query_helpers::segment> &get_segments() const
+            {
+                return segments;
+            }
+
+            // returns the nodes of a tree that the query selects, in document order. at most
+            // max_results are returned (if it is not zero).
+            std::vector<std::shared_ptr<node>> evaluate(const std::shared_ptr<node> &root, const size_t max_results = 0) const
+            {
+                std::vector<std::shared_ptr<node>> results;
+
+                if (valid && root != nullptr)
+                    query_helpers::visit(segments, root, query_helpers::state_set(1, 0), results, max_results);
+
+                return results;
+            }
+
+            // returns the first node of a tree that the query selects (nullptr if there is none)
+            std::shared_ptr<node> evaluate_first(const std::shared_ptr<node> &root) const
+            {
+                const auto results = evaluate(root, 1);
+                return (results.empty() ? nullptr : results.front());
+            }
+
+            // read a json document, and return the nodes that the query selects in document
+            // order, without building the rest of the tree. reading stops once there are
+            // max_results results (if it is not zero).
+            std::vector<std::shared_ptr<node>> evaluate(const std::string_view input, const size_t max_results = 0) const
+            {
+                if (!valid)
+                    return std::vector<std::shared_ptr<node>>();
+
+                query_handler handler(segments, max_results);
+                parse_sax(input, handler);
+                return handler.take_results();
+            }
+
+            // read a json document from a stream, one chunk at a time, and return the nodes that
+            // the query selects in document order, without building the rest of the tree
+            std::vector<std::shared_ptr<node>> evaluate(std::istream &input, const size_t max_results = 0,
+                                                        const size_t chunk_size = 64 * 1024) const
+            {
+                if (!valid)
+                    return std::vector<std::shared_ptr<node>>();
+
+                query_handler handler(segments, max_results);
+                parse_sax(input, handler, chunk_size);
+                return handler.take_results();
+            }
+
+            // read a json document, and return the first node that the query selects (nullptr
+            // if there is none). reading stops at the first selected node.
+            std::shared_ptr<node> evaluate_first(const std::string_view input) const
+            {
+                const auto results = evaluate(input, 1);
+                return (results.empty() ? nullptr : results.front());
+            }
+
+        }; // class query
+
+        // returns the nodes of a tree that a JSONPath or JSON Pointer query selects
+        std::vector<std::shared_ptr<node>> select(const std::shared_ptr<node> &root, const std::string_view query_text)
+        {
+            return query(query_text).evaluate(root);
+        }
+
+    } // namespace json
+} // namespace rda
+
+POP_WARN_DISABLE
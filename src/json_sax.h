@@ -0,0 +1,458 @@
+#pragma once
+
+//
+// json_sax.h - Event based (SAX style) json reader. Reports the structure and values of a
+//  document to a handler as they are read, instead of building a tree. Input can be fed in
+//  chunks of any size, and memory use stays bounded regardless of the size of the document.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "json.h"
+#include "platform_defs.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE_GCC("-Wunused-function")
+WARN_DISABLE(4100, "-Wunused-parameter")
+
+namespace rda
+{
+    namespace json
+    {
+        // receives the events of a document from a sax_reader. every method returns true to
+        // continue reading, or false to stop. string_view arguments are only valid for the
+        // duration of the call. every value inside of an object is preceded by a key (which
+        // is empty for mal-formed members without a key name, as in the node tree).
+        class sax_handler
+        {
+        public:
+            // destructor
+            virtual ~sax_handler() = default;
+
+            // the start of an object
+            virtual bool on_start_object()
+            {
+                return true;
+            }
+
+            // the end of an object
+            virtual bool on_end_object()
+            {
+                return true;
+            }
+
+            // the start of an array
+            virtual bool on_start_array()
+            {
+                return true;
+            }
+
+            // the end of an array
+            virtual bool on_end_array()
+            {
+                return true;
+            }
+
+            // the key name of the next value in an object
+            virtual bool on_key(const std::string_view key_name)
+            {
+                return true;
+            }
+
+            // a string value
+            virtual bool on_string(const std::string_view value)
+            {
+                return true;
+            }
+
+            // an integer value
+            virtual bool on_integer(const int64_t value)
+            {
+                return true;
+            }
+
+            // a floating point value
+            virtual bool on_float(const double value)
+            {
+                return true;
+            }
+
+            // a boolean value
+            virtual bool on_boolean(const bool value)
+            {
+                return true;
+            }
+
+            // a null value
+            virtual bool on_null()
+            {
+                return true;
+            }
+
+        }; // class sax_handler
+
+        // incremental, event based json reader. follows the same rules as the node tree
+        // parser (including for mal-formed input), so the events describe exactly the tree
+        // that json::parse() or json::parse_array() would build. only the unread tail of the
+        // input (at most one partial token) and the nesting of the open objects and arrays
+        // are held in memory between calls to feed().
+        class sax_reader
+        {
+        private:
+            // what the reader expects next
+            enum class reader_state
+            {
+                RS_START,        // the opening brace or bracket of the document
+                RS_ARRAY,        // an element of an array
+                RS_OBJECT,       // the first token of an object member
+                RS_OBJECT_AFTER, // the token after the first token of an object member
+                RS_OBJECT_VALUE, // the value of an object member, after its key and colon
+                RS_DONE,         // the document has been closed
+                RS_FAILED        // the input was not a document, or the handler stopped
+            };
+
+            // receives the events
+            sax_handler &handler;
+
+            // unread input. tokens are read from here, and only complete tokens are consumed.
+            std::string buffer;
+
+            // number of characters at the front of the buffer that have been consumed
+            size_t consumed = 0;
+
+            // current state
+            reader_state state = reader_state::RS_START;
+
+            // the open objects (true) and arrays (false), innermost last
+            std::vector<bool> nesting;
+
+            // the first token of an object member (or its key name), held until the token
+            // after it has been read
+            parse_helpers::token held;
+
+            // copy of the text of the held token, so it may outlive the buffer contents
+            std::string held_text;
+
+            // scratch space for unescaping keys and strings
+            std::string scratch;
+
+        public:
+            // constructor
+            explicit sax_reader(sax_handler &handler_)
+                : handler(handler_)
+            {
+            }
+
+            // read the next chunk of input. returns false if reading has failed.
+            bool feed(const std::string_view chunk)
+            {
+                if (state == reader_state::RS_DONE || state == reader_state::RS_FAILED)
+                    return (state == reader_state::RS_DONE);
+
+                // drop the consumed input before appending more, so only the unread tail is kept
+                if (consumed > 0)
+                {
+                    buffer.erase(0, consumed);
+                    consumed = 0;
+                }
+
+                buffer.append(chunk.data(), chunk.size());
+
+                read_tokens(false);
+
+                return (state != reader_state::RS_FAILED);
+            }
+
+            // signal the end of input. any open objects and arrays are closed, as in the node
+            // tree. returns true if a complete document was read.
+            bool finish()
+            {
+                if (state != reader_state::RS_DONE && state != reader_state::RS_FAILED)
+                    read_tokens(true);
+
+                buffer.clear();
+                consumed = 0;
+
+                return (state == reader_state::RS_DONE);
+            }
+
+            // prepare to read another document
+            void reset()
+            {
+                buffer.clear();
+                consumed = 0;
+                state = reader_state::RS_START;
+                nesting.clear();
+            }
+
+            // returns true once the document has been closed
+            bool is_done() const
+            {
+                return (state == reader_state::RS_DONE);
+            }
+
+            // returns true if the input was not a document, or the handler stopped reading
+            bool has_failed() const
+            {
+                return (state == reader_state::RS_FAILED);
+            }
+
+            // returns the number of objects and arrays that are currently open
+            size_t depth() const
+            {
+                return nesting.size();
+            }
+
+            // returns the number of unread characters held between calls to feed()
+            size_t buffered() const
+            {
+                return buffer.size() - consumed;
+            }
+
+        private:
+            // read and handle all of the complete tokens in the buffer. at the end of input,
+            // partial tokens are complete as they are.
+            void read_tokens(const bool end_of_input)
+            {
+                parse_helpers::lexer lex(buffer, consumed);
+
+                while (state != reader_state::RS_DONE && state != reader_state::RS_FAILED)
+                {
+                    const parse_helpers::token t = lex.next();
+
+                    if (t.type == parse_helpers::token_type::TT_END)
+                    {
+                        consumed = buffer.size();
+
+                        if (end_of_input)
+                            handle_end();
+
+                        return;
+                    }
+
+                    // a token that runs to the end of the buffer may continue in the next chunk
+                    if (!end_of_input &&
+                        ((t.type == parse_helpers::token_type::TT_QUOTED && !t.terminated) ||
+                         (t.type == parse_helpers::token_type::TT_UNQUOTED && lex.position() == buffer.size())))
+                        return;
+
+                    consumed = lex.position();
+                    handle_token(t);
+                }
+            }
+
+            // handle the next token, according to the current state
+            void handle_token(const parse_helpers::token &t)
+            {
+                switch (state)
+                {
+                    case reader_state::RS_START:
+                    {
+                        if (t.is_delimiter('{'))
+                            open(true);
+                        else if (t.is_delimiter('['))
+                            open(false);
+                        else
+                            state = reader_state::RS_FAILED;
+                        break;
+                    }
+                    case reader_state::RS_ARRAY:
+                    {
+                        if (t.is_delimiter(']'))
+                            close();
+                        else if (!t.is_delimiter(','))
+                            value(parse_helpers::determine_data_type(t), t);
+                        break;
+                    }
+                    case reader_state::RS_OBJECT:
+                    {
+                        if (t.is_delimiter('}'))
+                        {
+                            close();
+                        }
+                        else if (t.is_delimiter('[') || t.is_delimiter(']') || t.is_delimiter('{'))
+                        {
+                            // these can not be a key name, so this is a value without one
+                            if (emit(handler.on_key(std::string_view())))
+                                value(parse_helpers::determine_data_type(t), t);
+                        }
+                        else if (!t.is_delimiter(','))
+                        {
+                            hold(t);
+                            state = reader_state::RS_OBJECT_AFTER;
+                        }
+                        break;
+                    }
+                    case reader_state::RS_OBJECT_AFTER:
+                    {
+                        if (t.is_delimiter(':'))
+                        {
+                            // the held token is a key name, and the value follows
+                            state = reader_state::RS_OBJECT_VALUE;
+                        }
+                        else
+                        {
+                            // the held token was not a key. instead assume it is malformed data,
+                            // typed by the would-be key and read from this token.
+                            state = reader_state::RS_OBJECT;
+                            if (emit(handler.on_key(std::string_view())))
+                                value(parse_helpers::determine_data_type(held), t);
+                        }
+                        break;
+                    }
+                    case reader_state::RS_OBJECT_VALUE:
+                    {
+                        state = reader_state::RS_OBJECT;
+                        if (emit(handler.on_key(token_text(held))))
+                            value(parse_helpers::determine_data_type(t), t);
+                        break;
+                    }
+                    default:
+                    {
+                        break;
+                    }
+                }
+            }
+
+            // handle the end of input: finish the current member, and close everything
+            void handle_end()
+            {
+                if (state == reader_state::RS_START)
+                {
+                    state = reader_state::RS_FAILED;
+                    return;
+                }
+
+                // a would-be key at the end of input is a value with no data
+                if (state == reader_state::RS_OBJECT_AFTER)
+                {
+                    state = reader_state::RS_OBJECT;
+                    if (emit(handler.on_key(std::string_view())))
+                        value(parse_helpers::determine_data_type(held), parse_helpers::token());
+                }
+
+                while (state != reader_state::RS_DONE && state != reader_state::RS_FAILED)
+                    close();
+            }
+
+            // keep a copy of a token, as it may be needed after the buffer changes
+            void hold(const parse_helpers::token &t)
+            {
+                held = t;
+                held_text.assign(t.text.data(), t.text.size());
+                held.text = held_text;
+            }
+
+            // returns the text of a token, as used for a key name or string value
+            std::string_view token_text(const parse_helpers::token &t)
+            {
+                if (t.type != parse_helpers::token_type::TT_QUOTED || (!t.escaped && t.terminated))
+                    return t.text;
+
+                scratch.resize(t.text.size());
+                scratch.resize(parse_helpers::lexer::unescape(t, &scratch[0]));
+                return scratch;
+            }
+
+            // report a value of the given data type, reading its data from the token
+            void value(const JsonDataType data_type, const parse_helpers::token &t)
+            {
+                const bool unquoted = (t.type == parse_helpers::token_type::TT_UNQUOTED);
+
+                switch (data_type)
+                {
+                    case JsonDataType::JDT_NULL:
+                        emit(handler.on_null());
+                        break;
+                    case JsonDataType::JDT_BOOLEAN:
+                        emit(handler.on_boolean(unquoted && t.text == "true"));
+                        break;
+                    case JsonDataType::JDT_INTEGER:
+                        emit(handler.on_integer(
+                            unquoted ? number_helpers::to_integer(t.text) : 0));
+                        break;
+                    case JsonDataType::JDT_FLOAT:
+                        emit(handler.on_float(unquoted ? number_helpers::to_float(t.text) : 0.0));
+                        break;
+                    case JsonDataType::JDT_ARRAY:
+                        open(false);
+                        break;
+                    case JsonDataType::JDT_OBJECT:
+                        open(true);
+                        break;
+                    case JsonDataType::JDT_STRING:
+                        emit(handler.on_string(token_text(t)));
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            // open an object or array
+            void open(const bool is_object)
+            {
+                nesting.push_back(is_object);
+                state = (is_object ? reader_state::RS_OBJECT : reader_state::RS_ARRAY);
+                emit(is_object ? handler.on_start_object() : handler.on_start_array());
+            }
+
+            // close the innermost object or array
+            void close()
+            {
+                const bool is_object = nesting.back();
+                nesting.pop_back();
+
+                if (nesting.empty())
+                    state = reader_state::RS_DONE;
+                else
+                    state = (nesting.back() ? reader_state::RS_OBJECT : reader_state::RS_ARRAY);
+
+                emit(is_object ? handler.on_end_object() : handler.on_end_array());
+            }
+
+            // record whether the handler wants to continue. returns true to continue.
+            bool emit(const bool keep_going)
+            {
+                if (!keep_going)
+                    state = reader_state::RS_FAILED;
+
+                return keep_going;
+            }
+
+        }; // class sax_reader
+
+        // read a complete json document, reporting its events to the handler. returns true
+        // if a complete document was read.
+        bool parse_sax(const std::string_view input, sax_handler &handler)
+        {
+            sax_reader reader(handler);
+            reader.feed(input);
+            return reader.finish();
+        }
+
+        // read a json document from a stream, one chunk at a time, reporting its events to the
+        // handler. returns true if a complete document was read.
+        bool parse_sax(std::istream &input, sax_handler &handler, const size_t chunk_size = 64 * 1024)
+        {
+            sax_reader reader(handler);
+            std::vector<char> chunk(chunk_size > 0 ? chunk_size : 1);
+
+            while (!reader.is_done() && input.read(chunk.data(), static_cast<std::streamsize>(chunk.size())).gcount() > 0)
+                if (!reader.feed(std::string_view(chunk.data(), static_cast<size_t>(input.gcount()))))
+                    return false;
+
+            return reader.finish();
+        }
+
+    } // namespace json
+} // namespace rda
+
+POP_WARN_DISABLE
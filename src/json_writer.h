@@ -0,0 +1,381 @@
+#pragma once
+
+//
+// json_writer.h - Serializes json node trees in a single pass, into a reusable buffer or
+//  through an output iterator. Produces exactly the same text as node::to_string() and
+//  node::to_pretty_string(), without building a temporary string at every level.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "json.h"
+#include "platform_defs.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE_GCC("-Wunused-function")
+
+namespace rda
+{
+    namespace json
+    {
+        // layout of serialized json text
+        enum class write_style
+        {
+            WS_COMPACT, // as node::to_string()
+            WS_PRETTY   // as node::to_pretty_string()
+        };
+
+        // helper classes and methods for serializing json
+        namespace write_helpers
+        {
+            // writes characters to the end of a string, which keeps its capacity for re-use
+            class buffer_sink
+            {
+            private:
+                // the buffer to write to
+                std::string &buffer;
+
+            public:
+                // constructor
+                explicit buffer_sink(std::string &buffer_)
+                    : buffer(buffer_)
+                {
+                }
+
+                // write a single character
+                void put(const char c)
+                {
+                    buffer.push_back(c);
+                }
+
+                // write a run of characters
+                void write(const char *text, const size_t length)
+                {
+                    buffer.append(text, length);
+                }
+            };
+
+            // writes characters through an output iterator
+            template <typename OutputIt>
+            class iterator_sink
+            {
+            private:
+                // where the next character is written
+                OutputIt out;
+
+            public:
+                // constructor
+                explicit iterator_sink(OutputIt out_)
+                    : out(out_)
+                {
+                }
+
+                // write a single character
+                void put(const char c)
+                {
+                    *out = c;
+                    ++out;
+                }
+
+                // write a run of characters
+                void write(const char *text, const size_t length)
+                {
+                    out = std::copy(text, text + length, out);
+                }
+
+                // returns the iterator past the last character written
+                OutputIt get_iterator() const
+                {
+                    return out;
+                }
+            };
+
+            // write a run of characters
+            template <typename Sink>
+            void write_text(Sink &sink, const std::string_view text)
+            {
+                sink.write(text.data(), text.size());
+            }
+
+            // write a string, escaping backslashes and quotes with a backslash
+            template <typename Sink>
+            void write_escaped(Sink &sink, const std::string_view text)
+            {
+                size_t start = 0;
+
+                for (size_t i = 0; i < text.size(); ++i)
+                {
+                    if (text[i] == '\\' || text[i] == '"')
+                    {
+                        sink.write(text.data() + start, i - start);
+                        sink.put('\\');
+                        start = i;
+                    }
+                }
+
+                sink.write(text.data() + start, text.size() - start);
+            }
+
+            // write an integer, as std::to_string() does
+            template <typename Sink>
+            void write_integer(Sink &sink, const int64_t value)
+            {
+                char digits[24];
+                const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+                sink.write(digits, static_cast<size_t>(result.ptr - digits));
+            }
+
+            // write a floating point number, as std::to_string() does (six decimal places)
+            template <typename Sink>
+            void write_float(Sink &sink, const double value)
+            {
+                // large enough for the largest double, written in full without an exponent
+                char digits[400];
+                const auto result = std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::fixed, 6);
+                sink.write(digits, static_cast<size_t>(result.ptr - digits));
+            }
+
+            // write the indentation for a level of a pretty tree
+            template <typename Sink>
+            void write_indent(Sink &sink, const size_t indent)
+            {
+                for (size_t i = 0; i < indent; ++i)
+                    sink.write("    ", 4);
+            }
+
+            // write the value of a node that is not an array or object
+            template <typename Sink>
+            void write_scalar(Sink &sink, const node &n)
+            {
+                switch (n.get_type())
+                {
+                    case JsonDataType::JDT_NULL:
+                        sink.write("null", 4);
+                        break;
+                    case JsonDataType::JDT_BOOLEAN:
+                        if (static_cast<const node_boolean &>(n).get_data())
+                            sink.write("true", 4);
+                        else
+                            sink.write("false", 5);
+                        break;
+                    case JsonDataType::JDT_INTEGER:
+                        write_integer(sink, static_cast<const node_integer &>(n).get_data());
+                        break;
+                    case JsonDataType::JDT_FLOAT:
+                        write_float(sink, static_cast<const node_float &>(n).get_data());
+                        break;
+                    case JsonDataType::JDT_STRING:
+                        sink.put('"');
+                        write_escaped(sink, static_cast<const node_string &>(n).get_data_view());
+                        sink.put('"');
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            // returns the children of an array or object node
+            const std::vector<std::shared_ptr<node>> &children(const node &n)
+            {
+                if (n.get_type() == JsonDataType::JDT_ARRAY)
+                    return static_cast<const node_array &>(n).get_data();
+
+                return static_cast<const node_object &>(n).get_data();
+            }
+
+            // write a node as node::to_string() does
+            template <typename Sink>
+            void write_compact(Sink &sink, const node &n)
+            {
+                const std::string_view key_name = n.get_key_view();
+
+                if (!key_name.empty())
+                {
+                    sink.put('"');
+                    write_text(sink, key_name);
+                    sink.write("\":", 2);
+                }
+
+                const JsonDataType type = n.get_type();
+
+                if (type != JsonDataType::JDT_ARRAY && type != JsonDataType::JDT_OBJECT)
+                {
+                    write_scalar(sink, n);
+                    return;
+                }
+
+                const auto &data = children(n);
+
+                sink.put(type == JsonDataType::JDT_ARRAY ? '[' : '{');
+
+                for (size_t i = 0; i < data.size(); ++i)
+                {
+                    if (i != 0)
+                        sink.put(',');
+                    write_compact(sink, *data[i]);
+                }
+
+                sink.put(type == JsonDataType::JDT_ARRAY ? ']' : '}');
+            }
+
+            // write a node as node::to_pretty_string() does
+            template <typename Sink>
+            void write_pretty(Sink &sink, const node &n, const size_t indent)
+            {
+                const std::string_view key_name = n.get_key_view();
+                const JsonDataType type = n.get_type();
+
+                write_indent(sink, indent);
+
+                if (type != JsonDataType::JDT_ARRAY && type != JsonDataType::JDT_OBJECT)
+                {
+                    if (!key_name.empty())
+                    {
+                        sink.put('"');
+                        write_text(sink, key_name);
+
+                        // a null value has always been written with a space before the colon
+                        if (type == JsonDataType::JDT_NULL)
+                            sink.write("\" : ", 4);
+                        else
+                            sink.write("\": ", 3);
+                    }
+
+                    write_scalar(sink, n);
+                    return;
+                }
+
+                if (!key_name.empty())
+                {
+                    sink.put('"');
+                    write_text(sink, key_name);
+                    sink.write("\":\n", 3);
+                    write_indent(sink, indent);
+                }
+
+                const auto &data = children(n);
+
+                sink.put(type == JsonDataType::JDT_ARRAY ? '[' : '{');
+                sink.put('\n');
+
+                for (size_t i = 0; i < data.size(); ++i)
+                {
+                    write_pretty(sink, *data[i], indent + 1);
+
+                    if (i + 1 != data.size())
+                        sink.put(',');
+
+                    sink.put('\n');
+                }
+
+                write_indent(sink, indent);
+                sink.put(type == JsonDataType::JDT_ARRAY ? ']' : '}');
+            }
+
+            // write a node in the given style
+            template <typename Sink>
+            void write_node(Sink &sink, const node &n, const write_style style, const size_t indent)
+            {
+                if (style == write_style::WS_PRETTY)
+                    write_pretty(sink, n, indent);
+                else
+                    write_compact(sink, n);
+            }
+
+        } // namespace write_helpers
+
+        // serializes json nodes into a buffer that is kept between calls, so that once it has
+        // grown large enough, writing does not allocate any memory
+        class writer
+        {
+        private:
+            // the serialized text
+            std::string buffer;
+
+        public:
+            // constructor
+            explicit writer(const size_t initial_capacity = 0)
+            {
+                buffer.reserve(initial_capacity);
+            }
+
+            // replace the contents of the buffer with the serialized node, and return a view
+            // of it. the view is valid until the writer is next used.
+            std::string_view write(const node &n, const write_style style = write_style::WS_COMPACT,
+                                   const size_t indent = 0)
+            {
+                buffer.clear();
+                append(n, style, indent);
+                return buffer;
+            }
+
+            // replace the contents of the buffer with the pretty serialized node
+            std::string_view write_pretty(const node &n, const size_t indent = 0)
+            {
+                return write(n, write_style::WS_PRETTY, indent);
+            }
+
+            // add the serialized node to the end of the buffer
+            void append(const node &n, const write_style style = write_style::WS_COMPACT,
+                        const size_t indent = 0)
+            {
+                write_helpers::buffer_sink sink(buffer);
+                write_helpers::write_node(sink, n, style, indent);
+            }
+
+            // add text to the end of the buffer (for example, a separator between nodes)
+            void append(const std::string_view text)
+            {
+                buffer.append(text.data(), text.size());
+            }
+
+            // returns the contents of the buffer
+            std::string_view get_buffer() const
+            {
+                return buffer;
+            }
+
+            // returns the number of characters in the buffer
+            size_t size() const
+            {
+                return buffer.size();
+            }
+
+            // returns the number of characters the buffer can hold without growing
+            size_t capacity() const
+            {
+                return buffer.capacity();
+            }
+
+            // empty the buffer, keeping its memory for re-use
+            void clear()
+            {
+                buffer.clear();
+            }
+
+        }; // class writer
+
+        // serialize a node through an output iterator. returns the iterator past the last
+        // character written.
+        template <typename OutputIt>
+        OutputIt write(const node &n, OutputIt out, const write_style style = write_style::WS_COMPACT,
+                       const size_t indent = 0)
+        {
+            write_helpers::iterator_sink<OutputIt> sink(out);
+            write_helpers::write_node(sink, n, style, indent);
+            return sink.get_iterator();
+        }
+
+    } // namespace json
+} // namespace rda
+
+POP_WARN_DISABLE
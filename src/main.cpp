@@ -14,9 +14,20 @@
 #include "unit_tests/test_bidirectional_map.h"
 #include "unit_tests/test_cmdline_options.h"
 #include "unit_tests/test_fileio.h"
+#include "unit_tests/test_fix_framer.h"
 #include "unit_tests/test_fix_message.h"
+#include "unit_tests/test_fix_message_view.h"
 #include "unit_tests/test_json.h"
+#include "unit_tests/test_json_arena.h"
+#include "unit_tests/test_json_binary.h"
+#include "unit_tests/test_json_diff.h"
+#include "unit_tests/test_json_lines.h"
 #include "unit_tests/test_json_model.h"
+#include "unit_tests/test_json_parallel.h"
+#include "unit_tests/test_json_patch.h"
+#include "unit_tests/test_json_query.h"
+#include "unit_tests/test_json_sax.h"
+#include "unit_tests/test_json_writer.h"
 #include "unit_tests/test_object_builder.h"
 #include "unit_tests/test_one_to_one_map.h"
 #include "unit_tests/test_regex_builder.h"
@@ -35,9 +46,20 @@ int main()
     rda::test_bidirectional_map().run_tests();
     rda::test_cmdline_options().run_tests();
     rda::test_fileio().run_tests();
+    rda::test_fix_framer().run_tests();
     rda::test_fix_message().run_tests();
+    rda::test_fix_message_view().run_tests();
     rda::test_json().run_tests();
+    rda::test_json_arena().run_tests();
+    rda::test_json_binary().run_tests();
+    rda::test_json_diff().run_tests();
+    rda::test_json_lines().run_tests();
     rda::test_json_model().run_tests();
+    rda::test_json_parallel().run_tests();
+    rda::test_json_patch().run_tests();
+    rda::test_json_query().run_tests();
+    rda::test_json_sax().run_tests();
+    rda::test_json_writer().run_tests();
     rda::test_object_builder().run_tests();
     rda::test_one_to_one_map().run_tests();
     rda::test_regex_builder().run_tests();
@@ -0,0 +1,142 @@
+#pragma once
+
+//
+// simd_rda.h - Runtime detection and selection of the SIMD instruction sets used by the
+//  vectorized scanners in other headers, with a scalar fallback where none are available.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <atomic>
+#include <cstdint>
+
+#include "platform_defs.h"
+
+// set up "RDA_SIMD_X86" when compiling for x86 (where SSE2 and AVX2 may be available)
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define RDA_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// set up macros for compiling individual functions for an instruction set that the rest of
+// the program is not compiled for. msvc allows any intrinsics without this.
+#if defined(RDA_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+#define RDA_TARGET_SSE2 __attribute__((target("sse2")))
+#define RDA_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define RDA_TARGET_SSE2
+#define RDA_TARGET_AVX2
+#endif
+
+PUSH_WARN_DISABLE
+WARN_DISABLE_GCC("-Wunused-function")
+
+namespace rda
+{
+    namespace simd
+    {
+        // instruction sets that a scanner may use, in order of preference
+        enum class instruction_set
+        {
+            IS_SCALAR, // plain c++, one byte at a time
+            IS_SSE2,   // 16 bytes at a time
+            IS_AVX2    // 32 bytes at a time
+        };
+
+        // returns the best instruction set supported by the processor and operating system
+        instruction_set detect_instruction_set()
+        {
+#if defined(RDA_SIMD_X86) && defined(_MSC_VER)
+            int info[4] = {0, 0, 0, 0};
+            __cpuid(info, 0);
+            const int max_leaf = info[0];
+
+            __cpuid(info, 1);
+            const bool has_sse2 = ((info[3] & (1 << 26)) != 0);
+            const bool has_osxsave = ((info[2] & (1 << 27)) != 0);
+
+            // avx2 also needs the operating system to save the ymm registers
+            if (has_osxsave && max_leaf >= 7 && (_xgetbv(0) & 0x6) == 0x6)
+            {
+                __cpuidex(info, 7, 0);
+                if ((info[1] & (1 << 5)) != 0)
+                    return instruction_set::IS_AVX2;
+            }
+
+            return (has_sse2 ? instruction_set::IS_SSE2 : instruction_set::IS_SCALAR);
+#elif defined(RDA_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+            __builtin_cpu_init();
+
+            if (__builtin_cpu_supports("avx2"))
+                return instruction_set::IS_AVX2;
+
+            if (__builtin_cpu_supports("sse2"))
+                return instruction_set::IS_SSE2;
+
+            return instruction_set::IS_SCALAR;
+#else
+            return instruction_set::IS_SCALAR;
+#endif
+        }
+
+        // returns the instruction set that is currently selected for use by the scanners
+        std::atomic<instruction_set> &selected_instruction_set()
+        {
+            static std::atomic<instruction_set> selected{detect_instruction_set()};
+            return selected;
+        }
+
+        // returns the instruction set the scanners use
+        instruction_set get_instruction_set()
+        {
+            return selected_instruction_set().load(std::memory_order_relaxed);
+        }
+
+        // select the instruction set for the scanners to use (for example, to compare them).
+        // capped at the best supported instruction set. returns the one actually selected.
+        instruction_set set_instruction_set(const instruction_set is)
+        {
+            const instruction_set best = detect_instruction_set();
+            const instruction_set chosen = (static_cast<int>(is) <= static_cast<int>(best) ? is : best);
+            selected_instruction_set().store(chosen, std::memory_order_relaxed);
+            return chosen;
+        }
+
+        // returns the name of an instruction set
+        const char *instruction_set_name(const instruction_set is)
+        {
+            switch (is)
+            {
+                case instruction_set::IS_SSE2:
+                    return "sse2";
+                case instruction_set::IS_AVX2:
+                    return "avx2";
+                default:
+                    return "scalar";
+            }
+        }
+
+        // returns the index of the lowest set bit (the mask must not be zero)
+        unsigned int trailing_zeros(const uint64_t mask)
+        {
+#if defined(_MSC_VER) && defined(_M_X64)
+            unsigned long index = 0;
+            _BitScanForward64(&index, mask);
+            return static_cast<unsigned int>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned int>(__builtin_ctzll(mask));
+#else
+            unsigned int index = 0;
+            while (((mask >> index) & 1) == 0)
+                ++index;
+            return index;
+#endif
+        }
+
+    } // namespace simd
+} // namespace rda
+
+POP_WARN_DISABLE
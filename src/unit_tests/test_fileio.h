@@ -42,6 +42,7 @@ namespace rda
                 ASSERT_TRUE(f.get_path() == R"(C:\test.txt)");
                 ASSERT_TRUE(f.to_string() == "");
                 ASSERT_TRUE(f.to_vector().empty());
+                ASSERT_TRUE(f.get_data() == nullptr);
             });
 
             add_test("set string", [](std::shared_ptr<unit_test_input_base> input) {
@@ -54,6 +55,7 @@ namespace rda
                 ASSERT_FALSE(f.empty());
                 ASSERT_TRUE(f.get_path() == R"(C:\test.txt)");
                 ASSERT_TRUE(f.to_string() == "hello world");
+                ASSERT_TRUE(std::string(f.get_data(), f.size()) == "hello world");
                 ASSERT_FALSE(f.to_vector().empty());
                 ASSERT_TRUE(f.to_vector() == std::vector<char>(
                                                  {'h', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd'}));
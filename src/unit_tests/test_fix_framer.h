@@ -0,0 +1,290 @@
+#pragma once
+
+//
+// test_fix_framer.h - Unit tests for fix_framer.h.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "unit_test_base.h"
+
+#include "../benchmark.h"
+#include "../platform_defs.h"
+
+#include "../fix_framer.h"
+#include "../fix_message_view.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE(4100, "-Wunused-parameter")
+
+namespace rda
+{
+    class test_fix_framer : public unit_test_base
+    {
+    protected:
+        // data structure of inputs that can be re-used by each unit test
+        struct unit_test_input_fix_framer : public unit_test_input_base
+        {
+            // returns a whole message, with its body length and checksum, of some body fields
+            static std::string make_message(const std::string &body, const char delimiter = fix_framer::SOH)
+            {
+                std::string m = "8=FIX.4.4";
+                m += delimiter;
+                m += "9=" + std::to_string(body.size());
+                m += delimiter;
+                m += body;
+
+                char trailer[8];
+                std::snprintf(trailer, sizeof(trailer), "10=%03u", fix_framer::checksum(m));
+                m += trailer;
+                m += delimiter;
+                return m;
+            }
+
+            // returns the body of an order, with a sequence number
+            static std::string make_order(const size_t seq)
+            {
+                std::string body = "35=D|34=" + std::to_string(seq) +
+                                   "|49=TESTBUY1|52=20180920-18:14:19.508|56=TESTSELL1|11=636730640278898634|"
+                                   "15=USD|21=2|38=7000|40=1|54=1|55=MSFT|60=20180920-18:14:19.492|";
+
+                for (char &c : body)
+                    if (c == '|')
+                        c = fix_framer::SOH;
+
+                return body;
+            }
+
+            const std::string order1 = make_message(make_order(1));
+            const std::string order2 = make_message(make_order(2));
+            const std::string order3 = make_message(make_order(3));
+            const std::string stream = order1 + order2 + order3;
+        };
+
+        // returns the name of the module that is being tested
+        std::string get_test_module_name() const override
+        {
+            return "test_fix_framer";
+        }
+
+        // create and return the data structure of input to be provided to each test
+        std::shared_ptr<unit_test_input_base> create_test_input(const size_t testNum, const std::string &description) override
+        {
+            return std::make_shared<unit_test_input_fix_framer>();
+        }
+
+        // adds all of the tests that will be run
+        void create_tests() override
+        {
+            add_test("checksum", [](std::shared_ptr<unit_test_input_base> input) {
+                const std::string order =
+                    "8=FIX.4.4\x01" "9=148\x01" "35=D\x01" "34=1080\x01" "49=TESTBUY1\x01" "52=20180920-18:14:19.508\x01" "56="
+                    "TESTSELL1\x01" "11=636730640278898634\x01" "15=USD\x01" "21=2\x01" "38=7000\x01" "40=1\x01" "54=1\x01" "55=MSFT\x01"
+                    "60=20180920-18:14:19.492\x01";
+
+                ASSERT_TRUE(fix_framer::checksum(order) == 92);
+                ASSERT_TRUE(fix_framer::checksum("") == 0);
+            });
+
+            add_test("messages fed whole", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_fix_framer>(input);
+
+                fix_framer framer;
+                std::vector<std::string_view> messages;
+
+                framer.feed(pInput->stream, [&](std::string_view m) { messages.push_back(m); });
+
+                // the messages are views of the data fed, not copies
+                ASSERT_TRUE(messages.size() == 3);
+                ASSERT_TRUE(messages[0] == pInput->order1);
+                ASSERT_TRUE(messages[2] == pInput->order3);
+                ASSERT_TRUE(messages[0].data() == pInput->stream.data());
+                ASSERT_TRUE(messages[1].data() == pInput->stream.data() + pInput->order1.size());
+
+                ASSERT_TRUE(framer.pending() == 0);
+                ASSERT_TRUE(framer.get_stats().messages == 3);
+                ASSERT_TRUE(framer.get_stats().message_bytes == pInput->stream.size());
+                ASSERT_TRUE(framer.get_stats().skipped_bytes == 0);
+                ASSERT_TRUE(framer.get_stats().framing_errors == 0);
+
+                // each message can be parsed in place
+                const fix_message_view view(messages[1]);
+                ASSERT_EQUAL(view.get_field(34), std::string_view("2"));
+                ASSERT_EQUAL(view.get_field(55), std::string_view("MSFT"));
+            });
+
+            add_test("messages split across reads", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_fix_framer>(input);
+
+                // every chunk size, down to one byte at a time
+                for (size_t chunk = 1; chunk <= pInput->stream.size(); chunk += (chunk < 40 ? 1 : 37))
+                {
+                    fix_framer framer;
+                    std::vector<std::string> messages;
+
+                    for (size_t pos = 0; pos < pInput->stream.size(); pos += chunk)
+                        framer.feed(std::string_view(pInput->stream).substr(pos, chunk),
+                                    [&](std::string_view m) { messages.emplace_back(m); });
+
+                    ASSERT_TRUE(messages.size() == 3);
+                    ASSERT_EQUAL(messages[0], pInput->order1);
+                    ASSERT_EQUAL(messages[1], pInput->order2);
+                    ASSERT_EQUAL(messages[2], pInput->order3);
+                    ASSERT_TRUE(framer.pending() == 0);
+                    ASSERT_TRUE(framer.get_stats().framing_errors == 0);
+                }
+
+                // reading straight into the buffer
+                fix_framer framer;
+                std::vector<std::string> messages;
+                std::string_view m;
+
+                for (size_t pos = 0; pos < pInput->stream.size(); pos += 50)
+                {
+                    const size_t size = std::min(static_cast<size_t>(50), pInput->stream.size() - pos);
+                    const auto space = framer.prepare(size);
+                    ASSERT_TRUE(space.second >= size);
+                    std::memcpy(space.first, pInput->stream.data() + pos, size);
+                    framer.commit(size);
+
+                    while (framer.next(m))
+                        messages.emplace_back(m);
+                }
+
+                ASSERT_TRUE(messages.size() == 3);
+                ASSERT_EQUAL(messages[2], pInput->order3);
+            });
+
+            add_test("resync after garbage", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_fix_framer>(input);
+
+                // garbage before, between and inside messages
+                std::string corrupt = pInput->order2;
+                corrupt.resize(corrupt.size() / 2);
+
+                const std::string data = "garbage 8" + pInput->order1 + "xyz" + corrupt + pInput->order3 +
+                                         "8=FIX.4.4\x01" "9=abc\x01" + pInput->order2;
+
+                for (const size_t chunk : {data.size(), static_cast<size_t>(1), static_cast<size_t>(13)})
+                {
+                    fix_framer framer;
+                    std::vector<std::string> messages;
+
+                    for (size_t pos = 0; pos < data.size(); pos += chunk)
+                        framer.feed(std::string_view(data).substr(pos, chunk), [&](std::string_view m) { messages.emplace_back(m); });
+
+                    ASSERT_TRUE(messages.size() == 3);
+                    ASSERT_EQUAL(messages[0], pInput->order1);
+                    ASSERT_EQUAL(messages[1], pInput->order3);
+                    ASSERT_EQUAL(messages[2], pInput->order2);
+                    ASSERT_TRUE(framer.get_stats().messages == 3);
+                    ASSERT_TRUE(framer.pending() == 0);
+                    ASSERT_TRUE(framer.get_stats().framing_errors > 0);
+                    ASSERT_TRUE(framer.get_stats().skipped_bytes > 0);
+                }
+            });
+
+            add_test("bad checksum and oversized messages", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_fix_framer>(input);
+
+                std::string bad = pInput->order2;
+                bad[bad.size() - 2] = (bad[bad.size() - 2] == '9' ? '0' : static_cast<char>(bad[bad.size() - 2] + 1));
+
+                const std::string data = pInput->order1 + bad + pInput->order3;
+
+                fix_framer checked;
+                size_t count = 0;
+                checked.feed(data, [&](std::string_view m) { ++count; });
+                ASSERT_TRUE(count == 2);
+                ASSERT_TRUE(checked.get_stats().checksum_errors == 1);
+                ASSERT_TRUE(checked.get_stats().skipped_bytes == bad.size());
+
+                // the checksum need not be verified
+                fix_framer unchecked(fix_framer::DEFAULT_MAX_MESSAGE_SIZE, fix_framer::SOH, false);
+                count = 0;
+                unchecked.feed(data, [&](std::string_view m) { ++count; });
+                ASSERT_TRUE(count == 3);
+
+                // a message longer than the maximum is skipped
+                fix_framer small(200);
+                std::vector<std::string> messages;
+                const std::string big = unit_test_input_fix_framer::make_message(std::string(300, 'x') + "\x01");
+                small.feed(pInput->order1 + big + pInput->order3, [&](std::string_view m) { messages.emplace_back(m); });
+                ASSERT_TRUE(messages.size() == 2);
+                ASSERT_EQUAL(messages[1], pInput->order3);
+            });
+
+            add_test("pipe delimited messages", [](std::shared_ptr<unit_test_input_base> input) {
+                const std::string m1 = unit_test_input_fix_framer::make_message("35=0|49=A|56=B|", '|');
+                const std::string m2 = unit_test_input_fix_framer::make_message("35=1|49=A|56=B|112=X|", '|');
+
+                fix_framer framer(fix_framer::DEFAULT_MAX_MESSAGE_SIZE, '|');
+                std::vector<std::string> messages;
+                framer.feed(m1 + "\n" + m2 + "\n", [&](std::string_view m) { messages.emplace_back(m); });
+
+                ASSERT_TRUE(messages.size() == 2);
+                ASSERT_EQUAL(messages[0], m1);
+                ASSERT_EQUAL(messages[1], m2);
+                ASSERT_EQUAL(fix_message_view(messages[1]).get_field(112), std::string_view("X"));
+            });
+
+            add_test("benchmark: frame a recorded session file", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_fix_framer>(input);
+
+                // record a session of messages to a file
+                const size_t count = 200000;
+                const std::string path = (std::filesystem::temp_directory_path() / "test_fix_framer_session.log").string();
+
+                {
+                    std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+                    for (size_t i = 0; i < count; ++i)
+                        ofs << unit_test_input_fix_framer::make_message(unit_test_input_fix_framer::make_order(i + 1));
+                }
+
+                size_t framed = 0;
+                size_t total_length = 0;
+
+                std::ifstream ifs(path, std::ios::binary);
+                ASSERT_TRUE(ifs.good());
+
+                const auto start = std::chrono::steady_clock::now();
+
+                {
+                    benchmark b("fix_framer: frame 200000 messages from a file, 4 KB at a time");
+                    fix_framer framer;
+                    framer.read(ifs, [&](std::string_view m) {
+                        ++framed;
+                        total_length += m.size();
+                    }, 4096);
+                    ASSERT_TRUE(framer.get_stats().framing_errors == 0);
+                }
+
+                const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+                std::cout << "Benchmark: fix_framer: " << (elapsed > 0 ? framed * 1000000 / static_cast<size_t>(elapsed) : framed)
+                          << " messages/s" << std::endl;
+
+                ifs.close();
+                std::filesystem::remove(path);
+
+                ASSERT_TRUE(framed == count);
+                ASSERT_TRUE(total_length > count * pInput->order1.size() - count * 6);
+            });
+        }
+
+    }; // class test_fix_framer
+
+} // namespace rda
+
+POP_WARN_DISABLE
@@ -6,19 +6,29 @@
 // Written by Ryan Antkowiak
 //
 
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <functional>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
 #include "unit_test_base.h"
 
+#include "../benchmark.h"
 #include "../platform_defs.h"
 
+#include "../fileio.h"
+#include "../fix_db.h"
 #include "../fix_message.h"
 #include "../fix_message_util.h"
+#include "../json.h"
+#include "../simd_rda.h"
 
 PUSH_WARN_DISABLE
 WARN_DISABLE(4100, "-Wunused-parameter")
@@ -44,6 +54,9 @@ namespace rda
                 "8=FIX.4.49=14835=D34=108049=TESTBUY152=20180920-18:14:19.50856="
                 "TESTSELL111=63673064027889863415=USD21=238=700040=154=155=MSFT"
                 "60=20180920-18:14:19.49210=092";
+
+            // the dictionary that fix_db.h is generated from (relative to the repository root)
+            const std::string fix_db_json_path = "fix_messages_5_0.json";
         };
 
         std::string get_test_module_name() const override
@@ -143,6 +156,452 @@ namespace rda
                 ASSERT_FALSE(std::is_assignable<fix_message &, fix_message>::value);
             });
 
+            add_test("long messages and high tag numbers", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_fix_message>(input);
+
+                // an execution report longer than 255 bytes, with user defined tags
+                std::string report = "8=FIX.4.4|9=512|35=8|49=SELL|56=BUY|17=EXEC12345|37=ORD98765|39=2|150=F|55=MSFT|";
+                for (size_t i = 0; i < 40; ++i)
+                    report += std::to_string(5000 + i) + "=custom value " + std::to_string(i) + "|";
+                report += "9999=last|10=123|";
+                ASSERT_TRUE(report.size() > 255);
+
+                const fix_message fm(report);
+                ASSERT_EQUAL(std::string(fm.get_field(35)), std::string("8"));
+                ASSERT_EQUAL(std::string(fm.get_field(150)), std::string("F"));
+                ASSERT_EQUAL(std::string(fm.get_field(5000)), std::string("custom value 0"));
+                ASSERT_EQUAL(std::string(fm.get_field(5039)), std::string("custom value 39"));
+                ASSERT_EQUAL(std::string(fm.get_field(9999)), std::string("last"));
+                ASSERT_EQUAL(std::string(fm.get_field(10)), std::string("123"));
+                ASSERT_NULL(fm.get_field(5040));
+                ASSERT_NULL(fm.get_field(4999));
+                ASSERT_TRUE(fm.size() == 52);
+
+                // the fields are iterated in order of tag number
+                size_t last = 0;
+                for (const auto &f : fm)
+                {
+                    ASSERT_TRUE(f.tag > last);
+                    ASSERT_TRUE(std::strlen(fm.value_of(f)) == f.length);
+                    last = f.tag;
+                }
+
+                // a repeated tag keeps its last value, and the message order is kept
+                const fix_message repeated("55=IBM|35=D|448=A|448=B|20000=x|1=ACCT|");
+                ASSERT_EQUAL(std::string(repeated.get_field(448)), std::string("B"));
+                ASSERT_EQUAL(std::string(repeated.get_field(1)), std::string("ACCT"));
+                ASSERT_EQUAL(std::string(repeated.get_field(20000)), std::string("x"));
+                ASSERT_TRUE(repeated.size() == 5);
+                ASSERT_EQUAL(repeated.to_string(), std::string("55=IBM|35=D|448=B|20000=x|1=ACCT|"));
+
+                // the index is sized to the message, not to the highest tag number
+                ASSERT_TRUE(sizeof(fix_message) < 2048);
+                ASSERT_EQUAL(fix_message(pInput->str4).to_string(), fix_message(pInput->str3).to_string());
+            });
+
+            add_test("repeating groups", [](std::shared_ptr<unit_test_input_base> input) {
+                // a market data snapshot, with three entries
+                const fix_message snapshot("8=FIX.4.4|35=W|55=MSFT|268=3|269=0|270=100.50|271=200|269=1|270=100.60|271=300|"
+                                           "290=1|269=2|270=100.55|271=50|10=000|");
+
+                ASSERT_TRUE(snapshot.group_size(268) == 3);
+                ASSERT_EQUAL(std::string(snapshot.group(268, 0).get_field(270)), std::string("100.50"));
+                ASSERT_EQUAL(std::string(snapshot.group(268, 1).get_field(271)), std::string("300"));
+                ASSERT_EQUAL(std::string(snapshot.group(268, 1).get_field(290)), std::string("1"));
+                ASSERT_EQUAL(std::string(snapshot.group(268, 2).get_field(269)), std::string("2"));
+                ASSERT_TRUE(snapshot.group(268, 0).size() == 3);
+                ASSERT_TRUE(snapshot.group(268, 2).size() == 3);
+                ASSERT_NULL(snapshot.group(268, 0).get_field(290));
+                ASSERT_NULL(snapshot.group(268, 2).get_field(10));
+                ASSERT_TRUE(snapshot.group(268, 3).empty());
+                ASSERT_TRUE(snapshot.group(453, 0).empty());
+                ASSERT_NULL(snapshot.group(453, 0).get_field(448));
+                ASSERT_TRUE(snapshot.group_size(453) == 0);
+
+                // the message fields still give the last value of a repeated tag
+                ASSERT_EQUAL(std::string(snapshot.get_field(270)), std::string("100.55"));
+                ASSERT_EQUAL(std::string(snapshot.get_field(55)), std::string("MSFT"));
+
+                // parties of an order, with a nested group of sub ids, and the fields after the group
+                const fix_message order("8=FIX.4.4|35=D|11=ORD1|453=2|448=BRKR|447=D|452=1|802=2|523=desk|803=4|523=trader|803=2|"
+                                        "448=CLNT|447=D|452=3|54=1|55=IBM|38=100|10=000|");
+
+                ASSERT_TRUE(order.group_size(453) == 2);
+                ASSERT_EQUAL(std::string(order.group(453, 0).get_field(448)), std::string("BRKR"));
+                ASSERT_EQUAL(std::string(order.group(453, 0).get_field(523)), std::string("desk"));
+                ASSERT_EQUAL(std::string(order.group(453, 1).get_field(448)), std::string("CLNT"));
+                ASSERT_EQUAL(std::string(order.group(453, 1).get_field(452)), std::string("3"));
+                ASSERT_TRUE(order.group(453, 0).size() == 8);
+                ASSERT_TRUE(order.group(453, 1).size() == 3);
+                ASSERT_NULL(order.group(453, 1).get_field(54));
+                ASSERT_EQUAL(std::string(order.get_field(54)), std::string("1"));
+
+                // fields of an instance are in message order
+                std::string tags;
+                for (const auto &f : order.group(453, 1))
+                    tags += std::to_string(f.tag) + "=" + order.group(453, 1).value_of(f) + "|";
+                ASSERT_EQUAL(tags, std::string("448=CLNT|447=D|452=3|"));
+
+                // a group with one instance, and a group with fewer instances than its count
+                const fix_message single("35=D|453=1|448=ONLY|447=D|452=1|448=EXTRA|10=000|");
+                ASSERT_TRUE(single.group_size(453) == 1);
+                ASSERT_EQUAL(std::string(single.group(453, 0).get_field(448)), std::string("ONLY"));
+                ASSERT_TRUE(single.group(453, 0).size() == 3);
+
+                const fix_message few("35=W|268=5|269=0|270=1.5|269=1|270=1.6|10=000|");
+                ASSERT_TRUE(few.group_size(268) == 2);
+                ASSERT_EQUAL(std::string(few.group(268, 1).get_field(270)), std::string("1.6"));
+
+                // a group with one instance ends at the first field that is not a member, and the
+                // next group starts after the body fields
+                const fix_message legs("35=D|453=1|448=A|447=D|452=3|55=MSFT|555=2|600=X|624=1|600=Y|624=2|10=000|");
+                ASSERT_TRUE(legs.group_size(453) == 1);
+                ASSERT_TRUE(legs.group(453, 0).size() == 3);
+                ASSERT_NULL(legs.group(453, 0).get_field(55));
+                ASSERT_EQUAL(std::string(legs.get_field(55)), std::string("MSFT"));
+                ASSERT_TRUE(legs.group_size(555) == 2);
+                ASSERT_EQUAL(std::string(legs.group(555, 0).get_field(600)), std::string("X"));
+                ASSERT_EQUAL(std::string(legs.group(555, 1).get_field(624)), std::string("2"));
+                ASSERT_NULL(legs.group(555, 1).get_field(10));
+
+                // two parties nested in each of two sides, found from the instance of the side
+                const fix_message sides("35=AE|552=2|54=1|453=2|448=P1|447=D|452=1|448=P2|447=D|452=3|37=ORD1|"
+                                        "54=2|453=2|448=P3|447=D|452=1|448=P4|447=D|452=3|37=ORD2|10=000|");
+                ASSERT_TRUE(sides.group_size(552) == 2);
+                ASSERT_TRUE(sides.group_size(453) == 0);
+                ASSERT_TRUE(sides.group(552, 0).group_size(453) == 2);
+                ASSERT_TRUE(sides.group(552, 1).group_size(453) == 2);
+                ASSERT_EQUAL(std::string(sides.group(552, 0).group(453, 0).get_field(448)), std::string("P1"));
+                ASSERT_EQUAL(std::string(sides.group(552, 0).group(453, 1).get_field(448)), std::string("P2"));
+                ASSERT_EQUAL(std::string(sides.group(552, 1).group(453, 0).get_field(448)), std::string("P3"));
+                ASSERT_EQUAL(std::string(sides.group(552, 1).group(453, 1).get_field(452)), std::string("3"));
+                ASSERT_TRUE(sides.group(552, 0).group(453, 1).size() == 3);
+                ASSERT_TRUE(sides.group(552, 0).group(453, 2).empty());
+                ASSERT_TRUE(sides.group(552, 1).group(802, 0).empty());
+                ASSERT_TRUE(sides.group(552, 0).size() == 9);
+                ASSERT_EQUAL(std::string(sides.group(552, 0).get_field(37)), std::string("ORD1"));
+                ASSERT_EQUAL(std::string(sides.group(552, 1).get_field(37)), std::string("ORD2"));
+                ASSERT_TRUE(sides.group(552, 2).group_size(453) == 0);
+
+                // groups nested two deep
+                ASSERT_TRUE(order.group(453, 0).group_size(802) == 2);
+                ASSERT_EQUAL(std::string(order.group(453, 0).group(802, 1).get_field(523)), std::string("trader"));
+                ASSERT_TRUE(order.group(453, 1).group_size(802) == 0);
+
+                // an optional field only in the last instance still belongs to it
+                const fix_message last("35=W|268=2|269=0|270=1.5|269=1|270=1.6|271=100|10=000|");
+                ASSERT_TRUE(last.group_size(268) == 2);
+                ASSERT_NULL(last.group(268, 0).get_field(271));
+                ASSERT_EQUAL(std::string(last.group(268, 1).get_field(271)), std::string("100"));
+
+                // a count of zero has no instances
+                const fix_message none("35=W|268=0|55=X|10=000|");
+                ASSERT_TRUE(none.group_size(268) == 0);
+                ASSERT_EQUAL(std::string(none.get_field(55)), std::string("X"));
+
+                // a large snapshot, past the instances kept inline
+                std::string book = "35=W|55=MSFT|268=100|";
+                for (size_t i = 0; i < 100; ++i)
+                    book += "269=" + std::to_string(i % 2) + "|270=" + std::to_string(100 + i) + "|271=" + std::to_string(i) + "|";
+                book += "10=000|";
+
+                const fix_message large(book);
+                ASSERT_TRUE(large.group_size(268) == 100);
+                ASSERT_EQUAL(std::string(large.group(268, 99).get_field(270)), std::string("199"));
+                ASSERT_EQUAL(std::string(large.group(268, 42).get_field(271)), std::string("42"));
+            });
+
+            add_test("simd scanning", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_fix_message>(input);
+
+                const std::vector<simd::instruction_set> instruction_sets = {
+                    simd::instruction_set::IS_SCALAR, simd::instruction_set::IS_SSE2, simd::instruction_set::IS_AVX2};
+
+                fix_helpers::block_masks masks;
+                fix_helpers::classify_scalar("35=D\x01" "49=A|5=x^y", 15, masks);
+                ASSERT_TRUE(masks.equals == 0x0884);
+                ASSERT_TRUE(masks.delimiter == 0x2210);
+
+                // every instruction set classifies every block (and partial block) the same way
+                std::string text;
+                const std::string alphabet("=\x01|^0123456789ab=\x01\x00", 19);
+                for (size_t i = 0; i < 256; ++i)
+                    text.push_back(alphabet[(i * 7 + i / 3) % alphabet.size()]);
+
+                for (size_t start = 0; start < 64; ++start)
+                {
+                    for (size_t size = 0; size <= 64; size += 7)
+                    {
+                        fix_helpers::block_masks expected;
+                        fix_helpers::classify_scalar(text.data() + start, size, expected);
+
+                        for (const auto is : instruction_sets)
+                        {
+                            fix_helpers::classify(text.data() + start, size, masks, is);
+                            ASSERT_TRUE(masks.equals == expected.equals);
+                            ASSERT_TRUE(masks.delimiter == expected.delimiter);
+                        }
+                    }
+                }
+
+                // tags decoded all at once are the same as tags decoded one digit at a time
+                for (const char *tag : {"8", "35", "448", "1139", "20000", "123456", "9999999", "12345678", "123456789",
+                                        "1234567890", "0", "007", "12a", "a12", "3:5", "9/", ""})
+                {
+                    char padded[16] = {};
+                    std::memcpy(padded, tag, std::strlen(tag));
+                    ASSERT_TRUE(fix_helpers::decode_tag(padded, std::strlen(tag)) == fix_helpers::decode_tag_digits(padded, std::strlen(tag)));
+                }
+                ASSERT_TRUE(fix_helpers::decode_tag("12345678=", 8) == 12345678);
+                ASSERT_TRUE(fix_helpers::decode_tag("1139=abc", 4) == 1139);
+
+                // the messages read are the same with every instruction set, including for fields
+                // that cross the 64 byte blocks the message is classified in
+                std::vector<std::string> inputs = {
+                    pInput->str3,
+                    "x=1|=2|35|0=3|49=|55==X|12a=4|56=B",
+                    "35=D|453=2|448=A|447=D|452=1|448=B|447=D|452=3|54=1|10=000|",
+                    "49=NO_EQUALS_AT_THE_END|56",
+                };
+                for (size_t pad = 55; pad < 75; ++pad)
+                    inputs.push_back("8=FIX.4.4|58=" + std::string(pad, 'x') + "|5001=a=b|99999=c^55=MSFT|268=2|269=0|269=1|10=1");
+
+                for (const auto &s : inputs)
+                {
+                    simd::set_instruction_set(simd::instruction_set::IS_SCALAR);
+                    const fix_message expected(s);
+
+                    for (const auto is : instruction_sets)
+                    {
+                        simd::set_instruction_set(is);
+                        const fix_message fm(s);
+
+                        ASSERT_EQUAL(fm.to_string(), expected.to_string());
+                        ASSERT_TRUE(fm.size() == expected.size());
+                        ASSERT_TRUE(fm.group_size(453) == expected.group_size(453));
+                        ASSERT_TRUE(fm.group_size(268) == expected.group_size(268));
+                    }
+                }
+
+                simd::set_instruction_set(simd::detect_instruction_set());
+            });
+
+            add_test("benchmark: simd scanning", [](std::shared_ptr<unit_test_input_base> input) {
+                const std::string order =
+                    "8=FIX.4.4\x01" "9=148\x01" "35=D\x01" "34=1080\x01" "49=TESTBUY1\x01" "52=20180920-18:14:19.508\x01" "56="
+                    "TESTSELL1\x01" "11=636730640278898634\x01" "15=USD\x01" "21=2\x01" "38=7000\x01" "40=1\x01" "54=1\x01" "55=MSFT\x01"
+                    "60=20180920-18:14:19.492\x01" "10=092\x01";
+
+                const std::string report =
+                    "8=FIX.4.4\x01" "9=289\x01" "35=8\x01" "34=1090\x01" "49=TESTSELL1\x01" "52=20180920-18:14:19.567\x01" "56="
+                    "TESTBUY1\x01" "6=113.35\x01" "11=636730640278898634\x01" "14=3500\x01" "15=USD\x01" "17=20636730646335310000\x01"
+                    "21=2\x01" "31=113.35\x01" "32=3500\x01" "37=20636730646335310000\x01" "38=7000\x01" "39=1\x01" "40=1\x01" "54=1\x01"
+                    "55=MSFT\x01" "60=20180920-18:14:19.492\x01" "150=F\x01" "151=3500\x01" "453=1\x01" "448=BRK2\x01" "447=D\x01"
+                    "452=1\x01" "10=151\x01";
+
+                const size_t count = 100000;
+
+                for (const auto is : {simd::instruction_set::IS_SCALAR, simd::instruction_set::IS_SSE2, simd::instruction_set::IS_AVX2})
+                {
+                    if (simd::set_instruction_set(is) != is)
+                        continue;
+
+                    const std::string name = simd::instruction_set_name(is);
+
+                    for (const auto &m : {std::make_pair(std::string("NewOrderSingle"), order), std::make_pair(std::string("ExecutionReport"), report)})
+                    {
+                        size_t total = 0;
+                        const auto start = std::chrono::steady_clock::now();
+
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            const fix_message fm(m.second);
+                            total += std::strlen(fm.get_field(55));
+                        }
+
+                        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+                        std::cout << "Benchmark: fix_message " << name << " " << m.first << ": "
+                                  << static_cast<size_t>(elapsed) / count << " ns/message" << std::endl;
+
+                        ASSERT_TRUE(total == count * 4);
+                    }
+                }
+
+                simd::set_instruction_set(simd::detect_instruction_set());
+            });
+
+            add_test("typed field accessors", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_fix_message>(input);
+
+                const fix_message fm(pInput->str3);
+
+                int64_t i = 0;
+                ASSERT_TRUE(fm.get_int(34, i) && i == 1080);
+                ASSERT_TRUE(fm.get_int(38, i) && i == 7000);
+                ASSERT_TRUE(fm.get_int(11, i) && i == 636730640278898634);
+                ASSERT_FALSE(fm.get_int(49, i));
+                ASSERT_FALSE(fm.get_int(900, i));
+
+                char c = 0;
+                ASSERT_TRUE(fm.get_char(35, c) && c == 'D');
+                ASSERT_TRUE(fm.get_char(54, c) && c == '1');
+                ASSERT_FALSE(fm.get_char(49, c));
+                ASSERT_FALSE(fm.get_char(900, c));
+
+                fix_timestamp t;
+                ASSERT_TRUE(fm.get_utc_timestamp(52, t));
+                ASSERT_TRUE(t.year == 2018 && t.month == 9 && t.day == 20);
+                ASSERT_TRUE(t.hour == 18 && t.minute == 14 && t.second == 19 && t.nanosecond == 508000000);
+                ASSERT_TRUE(t.to_epoch_nanoseconds() == 1537467259508000000);
+                ASSERT_TRUE(fm.get_utc_timestamp(60, t) && t.nanosecond == 492000000);
+                ASSERT_FALSE(fm.get_utc_timestamp(49, t));
+
+                // integers: signs, limits and anything that is not an integer
+                const fix_message ints("1=-42|2=9223372036854775807|3=-9223372036854775808|4=9223372036854775808|5=|6=-|7=12a|8=+1|9= 1|");
+                ASSERT_TRUE(ints.get_int(1, i) && i == -42);
+                ASSERT_TRUE(ints.get_int(2, i) && i == INT64_MAX);
+                ASSERT_TRUE(ints.get_int(3, i) && i == INT64_MIN);
+                for (size_t tag = 4; tag <= 9; ++tag)
+                    ASSERT_FALSE(ints.get_int(tag, i));
+
+                // decimals are exact, and kept as written
+                const fix_message prices("44=113.35|6=-0.000001|31=100|32=1.50|99=+7.|100=.5|101=1.2.3|102=.|103=1e5|104=99999999999999999999|");
+                fix_decimal d;
+                ASSERT_TRUE(prices.get_decimal(44, d) && d.mantissa == 11335 && d.exponent == -2);
+                ASSERT_TRUE(prices.get_decimal(6, d) && d.mantissa == -1 && d.exponent == -6);
+                ASSERT_TRUE(prices.get_decimal(31, d) && d.mantissa == 100 && d.exponent == 0);
+                ASSERT_TRUE(prices.get_decimal(32, d) && d.mantissa == 150 && d.exponent == -2);
+                ASSERT_TRUE(prices.get_decimal(99, d) && d.mantissa == 7 && d.exponent == 0);
+                ASSERT_TRUE(prices.get_decimal(100, d) && d.mantissa == 5 && d.exponent == -1);
+                ASSERT_TRUE(d.to_double() == 0.5);
+                for (const size_t tag : {101, 102, 103, 104, 900})
+                    ASSERT_FALSE(prices.get_decimal(tag, d));
+
+                // 0.1 + 0.2 is exactly 0.3 in fixed point
+                fix_decimal a, b;
+                const fix_message sums("1=0.1|2=0.2|3=0.3|");
+                ASSERT_TRUE(sums.get_decimal(1, a) && sums.get_decimal(2, b) && sums.get_decimal(3, d));
+                ASSERT_TRUE(a.exponent == b.exponent && a.mantissa + b.mantissa == d.mantissa);
+
+                // timestamps: precision from seconds to nanoseconds, and invalid dates and times
+                const fix_message times("1=20000229-23:59:60|2=19700101-00:00:00.000001|3=20240101-12:00:00.123456789|"
+                                        "4=20230229-00:00:00|5=20231301-00:00:00|6=20230101-24:00:00|7=20230101-00:00:00.|"
+                                        "8=20230101-00:00:00.1234567890|9=20230101 00:00:00|10=20230101|");
+                ASSERT_TRUE(times.get_utc_timestamp(1, t) && t.day == 29 && t.second == 60);
+                ASSERT_TRUE(times.get_utc_timestamp(2, t) && t.to_epoch_nanoseconds() == 1000);
+                ASSERT_TRUE(times.get_utc_timestamp(3, t) && t.nanosecond == 123456789);
+                for (size_t tag = 4; tag <= 10; ++tag)
+                    ASSERT_FALSE(times.get_utc_timestamp(tag, t));
+
+                // the accessors of a repeating group
+                const fix_message snapshot("35=W|268=2|269=0|270=100.25|271=300|273=12:00:00|269=1|270=100.5|271=200|10=000|");
+                ASSERT_TRUE(snapshot.group(268, 1).get_decimal(270, d) && d.mantissa == 1005 && d.exponent == -1);
+                ASSERT_TRUE(snapshot.group(268, 0).get_int(271, i) && i == 300);
+                ASSERT_TRUE(snapshot.group(268, 1).get_char(269, c) && c == '1');
+                ASSERT_FALSE(snapshot.group(268, 0).get_utc_timestamp(273, t));
+                ASSERT_FALSE(snapshot.group(268, 2).get_int(271, i));
+            });
+
+            add_test("benchmark: typed field accessors", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_fix_message>(input);
+
+                const fix_message fm("8=FIX.4.4|35=8|31=113.35|32=3500|54=1|60=20180920-18:14:19.492|");
+                const size_t count = 100000;
+                double total_converted = 0;
+                double total_typed = 0;
+
+                {
+                    benchmark b("fix_message 100000 reads of 4 fields with atof, atoi and std::string");
+                    for (size_t n = 0; n < count; ++n)
+                    {
+                        total_converted += std::atof(fm.get_field(31)) + std::atoi(fm.get_field(32));
+                        total_converted += std::string(fm.get_field(54))[0] + std::atoi(std::string(fm.get_field(60)).substr(0, 4).c_str());
+                    }
+                }
+
+                {
+                    benchmark b("fix_message 100000 reads of 4 fields with typed accessors");
+                    fix_decimal price;
+                    int64_t qty = 0;
+                    char side = 0;
+                    fix_timestamp time;
+                    for (size_t n = 0; n < count; ++n)
+                    {
+                        fm.get_decimal(31, price);
+                        fm.get_int(32, qty);
+                        fm.get_char(54, side);
+                        fm.get_utc_timestamp(60, time);
+                        total_typed += price.to_double() + static_cast<double>(qty) + side + time.year;
+                    }
+                }
+
+                ASSERT_TRUE(std::abs(total_converted - total_typed) < 1.0);
+            });
+
+            add_test("fix message util - tag and field names", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_fix_message>(input);
+
+                const auto &util = rda::fix::fix_message_util::GetInstance();
+
+                ASSERT_EQUAL(util.tag_name(35), std::string_view("MsgType"));
+                ASSERT_EQUAL(util.tag_name(54), std::string_view("Side"));
+                ASSERT_EQUAL(util.field_name(54, "1"), std::string_view("Buy"));
+                ASSERT_EQUAL(util.field_name(35, "D"), std::string_view("New Order - Single"));
+                ASSERT_TRUE(util.tag_name(0).empty());
+                ASSERT_TRUE(util.field_name(54, "nothing").empty());
+
+                // the tables are usable at compile time
+                static_assert(rda::fix_db::tag_name(8) == "BeginString");
+                static_assert(rda::fix_db::field_name(54, "2") == "Sell");
+                static_assert(rda::fix_db::field_name(54, "Z").empty());
+                ASSERT_TRUE(rda::fix_db::tag_name(rda::fix_db::MAX_TAG + 1).empty());
+                ASSERT_TRUE(rda::fix_db::field_name(0, "1").empty());
+                ASSERT_TRUE(rda::fix_db::field_name(99999, "1").empty());
+                ASSERT_TRUE(rda::fix_db::field_name(54, "").empty());
+                ASSERT_EQUAL(rda::fix_db::FIX_VERSION, std::string_view("FIX.5.0"));
+
+                // every name in the dictionary is found, and matches the json it was generated from
+                fileio file(pInput->fix_db_json_path);
+                if (file.read())
+                {
+                    const auto dictionary = json::parse(std::string(file.get_data(), file.size()));
+
+                    size_t num_tags = 0;
+                    for (const auto &tag : std::dynamic_pointer_cast<json::node_object>((*dictionary)["tags"])->get_data())
+                    {
+                        ASSERT_EQUAL(util.tag_name(std::stoul(tag->get_key())), json::get_value_string_view(tag));
+                        ++num_tags;
+                    }
+                    ASSERT_TRUE(num_tags == 1132);
+
+                    size_t num_values = 0;
+                    for (const auto &field : std::dynamic_pointer_cast<json::node_object>((*dictionary)["fields"])->get_data())
+                        for (const auto &value : std::dynamic_pointer_cast<json::node_object>(field)->get_data())
+                        {
+                            ASSERT_EQUAL(util.field_name(std::stoul(field->get_key()), value->get_key_view()), json::get_value_string_view(value));
+                            ++num_values;
+                        }
+                    ASSERT_TRUE(num_values == rda::fix_db::NUM_FIELD_VALUES);
+                }
+
+                {
+                    benchmark b("fix_message_util 100000 tag_name lookups");
+                    size_t total = 0;
+                    for (size_t i = 0; i < 100000; ++i)
+                        total += util.tag_name(1 + i % fix_message::MAX_FIX_ID).size();
+                    ASSERT_TRUE(total > 0);
+                }
+
+                {
+                    benchmark b("fix_message_util 100000 field_name lookups");
+                    const char *sides[] = { "1", "2", "5", "Z" };
+                    size_t total = 0;
+                    for (size_t i = 0; i < 100000; ++i)
+                        total += util.field_name(54, sides[i % 4]).size();
+                    ASSERT_TRUE(total > 0);
+                }
+            });
+
             add_test("fix message util - print human readable", [](std::shared_ptr<unit_test_input_base> input) {
                 auto pInput = std::dynamic_pointer_cast<unit_test_input_fix_message>(input);
 
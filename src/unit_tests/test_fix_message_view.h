@@ -0,0 +1,189 @@
+#pragma once
+
+//
+// test_fix_message_view.h - Unit tests for fix_message_view.h.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "unit_test_base.h"
+
+#include "../benchmark.h"
+#include "../platform_defs.h"
+
+#include "../fix_message.h"
+#include "../fix_message_view.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE(4100, "-Wunused-parameter")
+WARN_DISABLE_MS(6262) // large stack usage
+
+namespace rda
+{
+    class test_fix_message_view : public unit_test_base
+    {
+    protected:
+        // data structure of inputs that can be re-used by each unit test
+        struct unit_test_input_fix_message_view : public unit_test_input_base
+        {
+            const std::string order =
+                "8=FIX.4.4\x01" "9=148\x01" "35=D\x01" "34=1080\x01" "49=TESTBUY1\x01" "52=20180920-18:14:19.508\x01" "56="
+                "TESTSELL1\x01" "11=636730640278898634\x01" "15=USD\x01" "21=2\x01" "38=7000\x01" "40=1\x01" "54=1\x01" "55=MSFT\x01"
+                "60=20180920-18:14:19.492\x01" "10=092\x01";
+        };
+
+        // returns the name of the module that is being tested
+        std::string get_test_module_name() const override
+        {
+            return "test_fix_message_view";
+        }
+
+        // create and return the data structure of input to be provided to each test
+        std::shared_ptr<unit_test_input_base> create_test_input(const size_t testNum, const std::string &description) override
+        {
+            return std::make_shared<unit_test_input_fix_message_view>();
+        }
+
+        // adds all of the tests that will be run
+        void create_tests() override
+        {
+            add_test("fields of a message", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_fix_message_view>(input);
+
+                const std::string before = pInput->order;
+                const fix_message_view view(pInput->order);
+
+                // the buffer is not changed, and the values point into it
+                ASSERT_EQUAL(pInput->order, before);
+                ASSERT_TRUE(view.get_message().data() == pInput->order.data());
+                ASSERT_TRUE(view.get_field(8).data() == pInput->order.data() + 2);
+
+                ASSERT_TRUE(view.size() == 16);
+                ASSERT_EQUAL(view.get_field(8), std::string_view("FIX.4.4"));
+                ASSERT_EQUAL(view.get_field(56), std::string_view("TESTSELL1"));
+                ASSERT_EQUAL(view.get_field(10), std::string_view("092"));
+                ASSERT_TRUE(view.has_field(55));
+                ASSERT_FALSE(view.has_field(900));
+                ASSERT_TRUE(view.get_field(0).empty());
+                ASSERT_TRUE(view.get_field(900).empty());
+                ASSERT_TRUE(view.get_field(1900).empty());
+                ASSERT_FALSE(view.is_truncated());
+
+                // the same fields as fix_message
+                const fix_message fm(pInput->order);
+                for (const auto &f : view)
+                    ASSERT_EQUAL(view.value_of(f), std::string_view(fm.get_field(f.tag)));
+                ASSERT_EQUAL(view.to_string(), fm.to_string());
+
+                // fields in message order
+                ASSERT_TRUE(view[0].tag == 8 && view[2].tag == 35 && view[15].tag == 10);
+                ASSERT_EQUAL(view.value_of(view[3]), std::string_view("1080"));
+            });
+
+            add_test("delimiters and malformed fields", [](std::shared_ptr<unit_test_input_base> input) {
+                // any of the delimiters that fix_message accepts
+                const fix_message_view pipes("8=FIX.4.4|35=D^49=A|10=1");
+                ASSERT_TRUE(pipes.size() == 4);
+                ASSERT_EQUAL(pipes.get_field(49), std::string_view("A"));
+                ASSERT_EQUAL(pipes.get_field(10), std::string_view("1"));
+
+                // a message that is not null terminated ends at its length
+                const char buffer[] = "35=D|49=ABCDEF|56=XYZ";
+                const fix_message_view partial(buffer, 11);
+                ASSERT_EQUAL(partial.get_field(49), std::string_view("ABC"));
+                ASSERT_FALSE(partial.has_field(56));
+
+                // fields without a numeric tag or an equals sign are skipped, empty values are kept
+                const fix_message_view bad("x=1|=2|35|0=3|49=|55==X|12a=4|56=B");
+                ASSERT_TRUE(bad.size() == 3);
+                ASSERT_TRUE(bad.has_field(49) && bad.get_field(49).empty());
+                ASSERT_EQUAL(bad.get_field(55), std::string_view("=X"));
+                ASSERT_EQUAL(bad.get_field(56), std::string_view("B"));
+
+                // tags above the direct lookup range, and repeated tags
+                const fix_message_view high("9999=a|447=D|447=P|20000=b|9999=c");
+                ASSERT_EQUAL(high.get_field(9999), std::string_view("a"));
+                ASSERT_EQUAL(high.get_field(20000), std::string_view("b"));
+                ASSERT_EQUAL(high.get_field(447), std::string_view("D"));
+                ASSERT_TRUE(high.size() == 5);
+
+                ASSERT_TRUE(fix_message_view("").empty());
+                ASSERT_TRUE(fix_message_view().get_field(8).empty());
+            });
+
+            add_test("re-use of a preallocated view", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_fix_message_view>(input);
+
+                // a view holds no pointers to heap memory of its own
+                ASSERT_TRUE(std::is_trivially_copyable<fix_message_view>::value);
+                ASSERT_TRUE(std::is_trivially_destructible<fix_message_view>::value);
+
+                static fix_message_view view;
+                ASSERT_TRUE(view.parse(pInput->order));
+                ASSERT_EQUAL(view.get_field(55), std::string_view("MSFT"));
+
+                // the fields of the last message are forgotten
+                ASSERT_TRUE(view.parse("35=8|39=2|55=IBM"));
+                ASSERT_TRUE(view.size() == 3);
+                ASSERT_EQUAL(view.get_field(55), std::string_view("IBM"));
+                ASSERT_FALSE(view.has_field(8));
+                ASSERT_FALSE(view.has_field(56));
+
+                view.clear();
+                ASSERT_TRUE(view.empty() && !view.has_field(35));
+
+                // fields past the capacity are not recorded
+                std::string many;
+                for (size_t i = 0; i < fix_message_view::MAX_FIELDS + 10; ++i)
+                    many += std::to_string(1 + i % 1000) + "=" + std::to_string(i) + "|";
+                ASSERT_FALSE(view.parse(many));
+                ASSERT_TRUE(view.is_truncated());
+                ASSERT_TRUE(view.size() == fix_message_view::MAX_FIELDS);
+                ASSERT_EQUAL(view.get_field(1), std::string_view("0"));
+                ASSERT_TRUE(view.parse("35=0"));
+                ASSERT_FALSE(view.is_truncated());
+            });
+
+            add_test("benchmark: fix_message vs fix_message_view", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_fix_message_view>(input);
+
+                const size_t count = 200000;
+                size_t total_copy = 0;
+                size_t total_view = 0;
+
+                {
+                    benchmark b("fix_message: copy and parse 200000 messages");
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        const fix_message fm(pInput->order.c_str());
+                        total_copy += std::string_view(fm.get_field(55)).size();
+                    }
+                }
+
+                {
+                    benchmark b("fix_message_view: parse 200000 messages in place");
+                    fix_message_view view;
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        view.parse(pInput->order);
+                        total_view += view.get_field(55).size();
+                    }
+                }
+
+                ASSERT_TRUE(total_copy == total_view);
+            });
+        }
+
+    }; // class test_fix_message_view
+
+} // namespace rda
+
+POP_WARN_DISABLE
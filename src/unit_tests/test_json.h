@@ -6,14 +6,22 @@
 // Written by Ryan Antkowiak
 //
 
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <cstdlib>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "unit_test_base.h"
 
+#include "../benchmark.h"
 #include "../platform_defs.h"
 
 #include "../json.h"
@@ -91,6 +99,137 @@ namespace rda
             return "test_json";
         }
 
+        // parse an object the original way: tokenize the whole input, then build nodes from the tokens
+        static std::shared_ptr<json::node_object> parse_tokenized(const std::string &input)
+        {
+            size_t parse_index = 0;
+            const auto tokens = json::parse_helpers::tokenize(input, parse_index);
+
+            if (tokens.empty() || !json::data_validators::is_type_object(tokens.front()))
+                return nullptr;
+
+            size_t token_index = 0;
+            return std::make_shared<json::node_object>("", tokens, token_index);
+        }
+
+        // the integer validator as it was before number_helpers, to check that they agree
+        static bool reference_is_type_integer(const std::string &input)
+        {
+            const std::vector<char> INTEGER_START_CHARS = {
+                '-', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
+            const std::vector<char> INTEGER_REMAINING_CHARS = {
+                '0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+            if (input == "0" || input == "-0")
+                return true;
+
+            if (input.empty())
+                return false;
+
+            if (!json::data_validator_helpers::starts_with(input, INTEGER_START_CHARS, 0))
+                return false;
+
+            if (!json::data_validator_helpers::all_chars_match(input, INTEGER_REMAINING_CHARS,
+                                                         1))
+                return false;
+
+            return true;
+        }
+
+        // the floating point validator as it was before number_helpers
+        static bool reference_is_type_float(const std::string &input)
+        {
+            const std::vector<char> E_CHARS = {'e', 'E'};
+            const std::vector<char> DIGIT_CHARS = {'0', '1', '2', '3', '4',
+                                                          '5', '6', '7', '8', '9'};
+            const std::vector<char> DIGIT_OR_E = {'0', '1', '2', '3', '4', '5',
+                                                         '6', '7', '8', '9', 'e', 'E'};
+            const std::vector<char> FLOAT_START_CHARS = {
+                '-', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
+            const std::vector<char> FLOAT_CHARS = {
+                '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '-', '.', 'e', 'E'};
+
+            // empty tokens are not floating point numbers
+            if (input.empty())
+                return false;
+
+            // floating point numbers must start with an appropriate character
+            if (!json::data_validator_helpers::starts_with(input, FLOAT_START_CHARS, 0))
+                return false;
+
+            // if the token starts with a zero, the next character must be the decimal
+            // point, followed by a digit or 'e'
+            if (json::data_validator_helpers::starts_with(input, '0', 0))
+                if (!json::data_validator_helpers::starts_with(input, '.', 1))
+                    if (!json::data_validator_helpers::starts_with(input, DIGIT_OR_E, 2))
+                        return false;
+
+            // if any invalid characters are encountered, not a float
+            if (!json::data_validator_helpers::all_chars_match(input, FLOAT_CHARS, 0))
+                return false;
+
+            // must contain at least one digit
+            if (json::data_validator_helpers::count_matches(input, DIGIT_CHARS, 0) == 0)
+                return false;
+
+            const size_t minus_sign_count =
+                json::data_validator_helpers::count_matches(input, '-', 0);
+            const size_t dot_count = json::data_validator_helpers::count_matches(input, '.', 0);
+            const size_t e_count =
+                json::data_validator_helpers::count_matches(input, E_CHARS, 0);
+
+            // must not contain more than two minus signs
+            if (minus_sign_count > 2)
+                return false;
+
+            // if one minus sign, it must be the first character
+            if (minus_sign_count == 1)
+                if (!json::data_validator_helpers::starts_with(input, '-', 0))
+                    return false;
+
+            // if two minus signs, the second one must be preceded by an 'e'
+            if (minus_sign_count == 2)
+                if (!json::data_validator_helpers::immediately_preceeds(input, '-', E_CHARS, 2))
+                    return false;
+
+            // must not contain more than one dot
+            if (dot_count > 1)
+                return false;
+
+            // must not contain more than one 'e'
+            if (e_count > 1)
+                return false;
+
+            // if there is both a dot and an e, the dot must come before the 'e'
+            if (dot_count == 1 && e_count == 1)
+                if (!json::data_validator_helpers::preceeds(input, '.', E_CHARS, 0))
+                    return false;
+
+            return true;
+        }
+
+        // build a large document of records, for benchmarks
+        static std::string make_large_document(const size_t record_count)
+        {
+            std::stringstream ss;
+
+            ss << "{ \"records\" : [";
+
+            for (size_t i = 0; i < record_count; ++i)
+            {
+                if (i != 0)
+                    ss << ",";
+
+                ss << "{ \"id\" : " << i << ", \"symbol\" : \"SYM" << i % 100 << "\", \"price\" : "
+                   << i << ".25, \"active\" : " << (i % 2 ? "true" : "false")
+                   << ", \"note\" : null, \"tags\" : [\"a\", \"b\\\"c\"] }";
+            }
+
+            ss << "] }";
+
+            return ss.str();
+        }
+
         std::shared_ptr<unit_test_input_base> create_test_input(const size_t testNum, const std::string &description) override
         {
             return std::make_shared<unit_test_input_json>();
@@ -547,6 +686,683 @@ namespace rda
                 ASSERT_TRUE(json::get_value_string(f) == "my text");
 
                 });
+
+            add_test("key index lookups", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json>(input);
+
+                std::stringstream ss;
+                ss << "{";
+                for (size_t i = 0; i < 100; ++i)
+                    ss << (i == 0 ? "" : ",") << "\"k" << i << "\":" << i;
+                ss << ",\"k5\":\"duplicate\",\"sub\":{\"k1\":{\"leaf\":true}}}";
+
+                auto j = json::parse(ss.str());
+
+                for (int64_t i = 0; i < 100; ++i)
+                    ASSERT_EQUAL(j->get_integer_by_path("k" + std::to_string(i)), i);
+
+                // the first child with a key is found
+                ASSERT_EQUAL(j->get_integer_by_path("k5"), static_cast<int64_t>(5));
+                ASSERT_TRUE(j->get_boolean_by_path("sub/k1/leaf"));
+                ASSERT_TRUE(j->get_node_by_path("k1/leaf") == nullptr);
+                ASSERT_TRUE(j->get_node_by_path("missing") == nullptr);
+
+                // removing the first duplicate exposes the second
+                j->remove_child("k5");
+                ASSERT_EQUAL(j->get_string_by_path("k5"), std::string("duplicate"));
+                ASSERT_EQUAL(j->get_integer_by_path("k6"), static_cast<int64_t>(6));
+                ASSERT_EQUAL(j->get_integer_by_path("k99"), static_cast<int64_t>(99));
+
+                // inserting before an existing key takes precedence, and shifts later children
+                j->add_child(std::make_shared<json::node_integer>("k50", -50), 0);
+                ASSERT_EQUAL(j->get_integer_by_path("k50"), static_cast<int64_t>(-50));
+                ASSERT_EQUAL(j->get_integer_by_path("k49"), static_cast<int64_t>(49));
+                ASSERT_EQUAL(j->get_integer_by_path("k51"), static_cast<int64_t>(51));
+
+                j->remove_child(static_cast<size_t>(0));
+                ASSERT_EQUAL(j->get_integer_by_path("k50"), static_cast<int64_t>(50));
+
+                j->add_child(std::make_shared<json::node_integer>("new", 7));
+                ASSERT_EQUAL(j->get_integer_by_path("new"), static_cast<int64_t>(7));
+
+                while (j->size() > 3)
+                    j->remove_child(static_cast<size_t>(0));
+                ASSERT_EQUAL(j->get_string_by_path("k5"), std::string("duplicate"));
+                ASSERT_TRUE(j->get_boolean_by_path("sub/k1/leaf"));
+                ASSERT_EQUAL(j->get_integer_by_path("new"), static_cast<int64_t>(7));
+                ASSERT_TRUE(j->get_node_by_path("k0") == nullptr);
+
+                // copies rebuild their own index
+                json::node_object copy(*j);
+                ASSERT_EQUAL(copy.get_integer_by_path("new"), static_cast<int64_t>(7));
+            });
+
+            add_test("compiled paths", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json>(input);
+
+                static constexpr json::path city("/address//city/");
+                static_assert(city.size() == 2, "path is split at compile time");
+                static_assert(city[1] == "city", "path is split at compile time");
+
+                auto j = json::parse(R"({"name":"John","age":27,"height":1.85,"alive":true,"address":{"city":"New York"},"phones":[1,2],"spouse":null})");
+
+                ASSERT_EQUAL(j->get_string_by_path(city), std::string("New York"));
+                ASSERT_EQUAL(j->get_string_by_path(json::path("name")), std::string("John"));
+                ASSERT_EQUAL(j->get_integer_by_path(json::path("age")), static_cast<int64_t>(27));
+                ASSERT_FLOAT_EQUALS(j->get_float_by_path(json::path("height")), 1.85);
+                ASSERT_FLOAT_EQUALS(j->get_number_by_path(json::path("age")), 27.0);
+                ASSERT_TRUE(j->get_boolean_by_path(json::path("alive")));
+                ASSERT_TRUE(j->get_object_by_path(json::path("address")) != nullptr);
+                ASSERT_TRUE(j->get_array_by_path(json::path("phones"))->size() == 2);
+                ASSERT_EQUAL(j->get_node_type_by_path(json::path("spouse")), json::JsonDataType::JDT_NULL);
+                ASSERT_TRUE(j->does_node_exist(json::path("address/city")));
+
+                // type mismatches and missing nodes give default values
+                ASSERT_EQUAL(j->get_integer_by_path(json::path("name")), static_cast<int64_t>(0));
+                ASSERT_TRUE(j->get_string_by_path(json::path("age")).empty());
+                ASSERT_TRUE(j->get_array_by_path(city) == nullptr);
+                ASSERT_FALSE(j->does_node_exist(json::path("address/city/more")));
+                ASSERT_FALSE(j->does_node_exist(json::path("")));
+                ASSERT_EQUAL(j->get_node_type_by_path(json::path("nothing")), json::JsonDataType::JDT_UNDEFINED);
+
+                // paths deeper than MAX_DEPTH never match, but string paths still do
+                std::string deep_text;
+                std::shared_ptr<json::node> deep = std::make_shared<json::node_string>("leaf", "bottom");
+                for (size_t i = 0; i < json::path::MAX_DEPTH + 1; ++i)
+                {
+                    deep_text = "d/" + deep_text;
+                    deep = std::make_shared<json::node_object>("d", std::vector<std::shared_ptr<json::node>>{deep});
+                }
+                deep_text += "leaf";
+                auto root = std::make_shared<json::node_object>("", std::vector<std::shared_ptr<json::node>>{deep});
+
+                const json::path too_deep(deep_text);
+                ASSERT_TRUE(too_deep.too_deep());
+                ASSERT_TRUE(too_deep.empty());
+                ASSERT_TRUE(root->get_node_by_path(too_deep) == nullptr);
+                ASSERT_EQUAL(root->get_string_by_path(deep_text), std::string("bottom"));
+
+                const std::string text = "a/b/c";
+                size_t segments = 0;
+                for (const auto &segment : json::path(text))
+                    segments += segment.size();
+                ASSERT_TRUE(segments == 3);
+            });
+
+            add_test("single-pass parser matches tokenized parser", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json>(input);
+
+                const std::vector<std::string> inputs = {
+                    pInput->str1,
+                    pInput->str2,
+                    pInput->str3,
+                    R"({{[{[[[{{{"nullObj":null}}}]]]}]}})",
+                    R"({"test1":teststring1,"test2":teststring2, "test3" :  test string3  })",
+                    R"({test1:true,test2:  test string2, test3 : null , test4  : 30.1, test5:789})",
+                    R"({"a" "b", 5 "7", x})",
+                    R"({"a":[1:2}, 3], "b"})",
+                    R"({]})",
+                    R"({"k":True, "f": -1.5e3, "n":null, "i":-0, "e":"", "x" : "a"b })",
+                    R"({ "escape" : { "test": "bs- \ quote- " 
+ tail"}})",
+                    R"({ "open" : "unterminated ")",
+                    R"({ "open" : [ 1, 2)",
+                    "{}",
+                };
+
+                for (const auto &s : inputs)
+                {
+                    auto expected = parse_tokenized(s);
+                    auto actual = json::parse(s);
+
+                    ASSERT_TRUE(expected != nullptr);
+                    ASSERT_TRUE(actual != nullptr);
+                    ASSERT_EQUAL(expected->to_string(), actual->to_string());
+                }
+
+                ASSERT_TRUE(json::parse("") == nullptr);
+                ASSERT_TRUE(json::parse("  [ 1 ]") == nullptr);
+                ASSERT_TRUE(json::parse(R"("{")") == nullptr);
+                ASSERT_TRUE(json::parse_array("  { }") == nullptr);
+                ASSERT_EQUAL(json::parse_array(" [ 1, [2], {\"a\":3} ] ")->to_string(), std::string(R"([1,[2],{"a":3}])"));
+                ASSERT_EQUAL(json::parse("xx{\"a\":1}", 2)->get_integer_by_path("a"), static_cast<int64_t>(1));
+            });
+
+            add_test("benchmark: tokenized vs single-pass parser", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json>(input);
+
+                const std::string document = make_large_document(5000);
+
+                std::shared_ptr<json::node_object> tokenized;
+                std::shared_ptr<json::node_object> single_pass;
+
+                {
+                    benchmark b("json tokenized parse (" + std::to_string(document.size()) + " bytes)");
+                    tokenized = parse_tokenized(document);
+                }
+
+                {
+                    benchmark b("json single-pass parse (" + std::to_string(document.size()) + " bytes)");
+                    single_pass = json::parse(document);
+                }
+
+                ASSERT_EQUAL(tokenized->to_string(), single_pass->to_string());
+                ASSERT_TRUE(single_pass->get_array_by_path("records")->size() == 5000);
+            });
+
+            add_test("string views and retained source", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json>(input);
+
+                auto source = std::make_shared<const std::string>(
+                    R"({"plain":"New York", unquoted : text here, "escaped":"a\\b\"c", "n":{"deep":"value"}, "list":["x", "y\"z"]})");
+
+                const auto j = json::parse_retained(source);
+                ASSERT_TRUE(j != nullptr);
+                ASSERT_EQUAL(j->to_string(), json::parse(*source)->to_string());
+
+                // strings without escapes point into the source text, the rest are copied
+                auto in_source = [&source](const std::string_view view) {
+                    return view.data() >= source->data() && view.data() + view.size() <= source->data() + source->size();
+                };
+
+                ASSERT_TRUE(j->get_string_view_by_path("plain") == "New York");
+                ASSERT_TRUE(in_source(j->get_string_view_by_path("plain")));
+                ASSERT_TRUE(in_source(j->get_string_view_by_path("unquoted")));
+                ASSERT_TRUE(in_source(j->get_string_view_by_path(json::path("n/deep"))));
+                ASSERT_TRUE(j->get_string_view_by_path("escaped") == "a\\b\"c");
+                ASSERT_FALSE(in_source(j->get_string_view_by_path("escaped")));
+                ASSERT_TRUE(json::get_node_string((*j)["plain"])->is_borrowed());
+                ASSERT_FALSE(json::get_node_string((*j)["escaped"])->is_borrowed());
+                ASSERT_TRUE(j->get_string_by_path("n/deep") == "value");
+
+                const auto list = j->get_array_by_path("list");
+                ASSERT_TRUE(json::get_value_string_view((*list)[0]) == "x");
+                ASSERT_TRUE(json::get_value_string_view((*list)[1]) == "y\"z");
+                ASSERT_TRUE(json::try_get_value_string_view((*list)[0]).first);
+                ASSERT_FALSE(json::try_get_value_string_view(j->get_node_by_path("n")).first);
+                ASSERT_TRUE(json::get_value_string_view(nullptr).empty());
+                ASSERT_TRUE(j->get_string_view_by_path("n").empty());
+                ASSERT_TRUE(j->get_string_view_by_path("missing").empty());
+
+                // the tree keeps the source alive
+                const std::weak_ptr<const std::string> weak_source = source;
+                source.reset();
+                ASSERT_FALSE(weak_source.expired());
+                ASSERT_TRUE(j->get_string_view_by_path("plain") == "New York");
+
+                // copied string nodes have views too
+                const auto copied = json::parse(R"({"a":"b"})");
+                ASSERT_TRUE(copied->get_string_view_by_path("a") == "b");
+                ASSERT_FALSE(json::get_node_string((*copied)["a"])->is_borrowed());
+
+                // only borrowed strings pay for the source buffer and the view into it
+                ASSERT_TRUE(std::dynamic_pointer_cast<json::node_borrowed_string>((*j)["plain"]) != nullptr);
+                ASSERT_TRUE(std::dynamic_pointer_cast<json::node_borrowed_string>((*copied)["a"]) == nullptr);
+                ASSERT_TRUE(sizeof(json::node_string) == sizeof(json::node) + sizeof(std::string));
+
+                ASSERT_TRUE(json::parse_retained(nullptr) == nullptr);
+                const auto arr = json::parse_array_retained(std::make_shared<const std::string>("[\"a\", 1]"));
+                ASSERT_EQUAL(arr->to_string(), std::string(R"(["a",1])"));
+            });
+
+            add_test("benchmark: string copies vs string views", [](std::shared_ptr<unit_test_input_base> input) {
+                std::stringstream ss;
+                ss << "{ \"records\" : [";
+                for (size_t i = 0; i < 100; ++i)
+                    ss << (i == 0 ? "" : ",") << "{ \"id\" : " << i << ", \"name\" : \"a name too long for a small string " << i << "\" }";
+                ss << "] }";
+
+                const auto j = json::parse_retained(std::make_shared<const std::string>(ss.str()));
+                const json::path name("name");
+                const auto records = j->get_array_by_path("records");
+                size_t total = 0;
+
+                {
+                    benchmark b("json 100000 string field reads by copy");
+                    for (size_t i = 0; i < 1000; ++i)
+                        for (const auto &record : *records)
+                            total += std::static_pointer_cast<json::node_object>(record)->get_string_by_path(name).size();
+                }
+
+                {
+                    benchmark b("json 100000 string field reads by view");
+                    for (size_t i = 0; i < 1000; ++i)
+                        for (const auto &record : *records)
+                            total -= std::static_pointer_cast<json::node_object>(record)->get_string_view_by_path(name).size();
+                }
+
+                ASSERT_TRUE(total == 0);
+            });
+
+            add_test("structural scanning", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json>(input);
+
+                const std::vector<simd::instruction_set> instruction_sets = {
+                    simd::instruction_set::IS_SCALAR, simd::instruction_set::IS_SSE2, simd::instruction_set::IS_AVX2};
+
+                json::scan_helpers::block_masks masks;
+                json::scan_helpers::classify_scalar("{\"a\\\" : [1,\t2]}\n", 15, masks);
+                ASSERT_TRUE(masks.quote == 0x12);
+                ASSERT_TRUE(masks.backslash == 0x08);
+                ASSERT_TRUE(masks.structural == 0x6541);
+                ASSERT_TRUE(masks.whitespace == 0x08a0);
+
+                // every instruction set classifies every block (and partial block) the same way
+                std::string text;
+                const std::string alphabet = "\"\\:,{}[] \n\t\rab1.\x7b\x5b\xfb\xdb";
+                for (size_t i = 0; i < 256; ++i)
+                    text.push_back(alphabet[(i * 7 + i / 3) % alphabet.size()]);
+
+                for (size_t start = 0; start < 64; ++start)
+                {
+                    for (size_t size = 0; size <= 64; size += 7)
+                    {
+                        json::scan_helpers::block_masks expected;
+                        json::scan_helpers::classify_scalar(text.data() + start, size, expected);
+
+                        for (const auto is : instruction_sets)
+                        {
+                            json::scan_helpers::classify(text.data() + start, size, masks, is);
+                            ASSERT_TRUE(masks.quote == expected.quote);
+                            ASSERT_TRUE(masks.backslash == expected.backslash);
+                            ASSERT_TRUE(masks.structural == expected.structural);
+                            ASSERT_TRUE(masks.whitespace == expected.whitespace);
+                        }
+                    }
+                }
+
+                // the parser builds the same tree with every instruction set, including for
+                // tokens that cross the 64 byte blocks the input is classified in
+                std::vector<std::string> inputs = {
+                    pInput->str1,
+                    make_large_document(20),
+                    R"({test1:true,test2:  test string2, test3 : null , test4  : 30.1, test5:789})",
+                    R"({ "open" : "unterminated \")",
+                };
+                for (size_t pad = 50; pad < 70; ++pad)
+                    inputs.push_back("{" + std::string(pad, ' ') + R"("k\\\"ey" : "va\"lue\\", x  y  z : [  1 , 2])");
+
+                for (const auto &s : inputs)
+                {
+                    json::scan_helpers::set_lexer_instruction_set(simd::instruction_set::IS_SCALAR);
+                    const std::string expected = json::parse(s)->to_string();
+
+                    for (const auto is : instruction_sets)
+                    {
+                        json::scan_helpers::set_lexer_instruction_set(is);
+                        ASSERT_EQUAL(json::parse(s)->to_string(), expected);
+                    }
+                }
+
+                // the lexer tests one character at a time unless told otherwise
+                json::scan_helpers::set_lexer_instruction_set(simd::instruction_set::IS_SCALAR);
+            });
+
+            add_test("benchmark: structural scanning", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json>(input);
+
+                const std::string document = make_large_document(20000);
+
+                for (const auto is : {simd::instruction_set::IS_SCALAR, simd::instruction_set::IS_SSE2, simd::instruction_set::IS_AVX2})
+                {
+                    if (json::scan_helpers::set_lexer_instruction_set(is) != is)
+                        continue;
+
+                    const std::string name = simd::instruction_set_name(is);
+                    uint64_t structural = 0;
+
+                    {
+                        benchmark b("json " + name + " classify (" + std::to_string(document.size()) + " bytes)");
+                        json::scan_helpers::block_masks masks;
+                        for (size_t i = 0; i < document.size(); i += json::scan_helpers::BLOCK_SIZE)
+                        {
+                            json::scan_helpers::classify(document.data() + i, std::min(json::scan_helpers::BLOCK_SIZE, document.size() - i), masks, is);
+                            structural += static_cast<uint64_t>(std::bitset<64>(masks.structural).count());
+                        }
+                    }
+
+                    size_t tokens = 0;
+
+                    {
+                        benchmark b("json " + name + " lexer (" + std::to_string(document.size()) + " bytes)");
+                        json::parse_helpers::lexer lex(document, 0);
+                        while (lex.next().type != json::parse_helpers::token_type::TT_END)
+                            ++tokens;
+                    }
+
+                    ASSERT_TRUE(structural > 0 && tokens > structural);
+                }
+
+                json::scan_helpers::set_lexer_instruction_set(simd::instruction_set::IS_SCALAR);
+            });
+
+            add_test("lazy parsing", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json>(input);
+
+                // arrays that were not lazily parsed only pay for a pointer to the lazy state (and
+                // for their cached hash)
+                ASSERT_TRUE(sizeof(json::node_array) <=
+                            sizeof(json::node) + sizeof(std::vector<std::shared_ptr<json::node>>) + sizeof(void *) + sizeof(json::hash_cache));
+
+                const std::vector<std::string> inputs = {
+                    pInput->str1,
+                    pInput->str2,
+                    pInput->str3,
+                    R"({{[{[[[{{{"nullObj":null}}}]]]}]}})",
+                    R"({"a" "b", 5 "7", x})",
+                    R"({"a":[1:2}, 3], "b"})",
+                    R"({"a" [1, {"b" : 2}], "c" : {"d" : [3]}, { "e" : 4 }, ]})",
+                    R"({]})",
+                    R"({ "open" : [ 1, { "x" : 2)",
+                    "{}",
+                };
+
+                // the lazy tree is the same as the fully parsed one, for mal-formed input too
+                for (const auto &s : inputs)
+                {
+                    const auto lazy = json::parse_lazy(std::make_shared<const std::string>(s));
+                    ASSERT_TRUE(lazy != nullptr);
+                    ASSERT_EQUAL(lazy->to_string(), json::parse(s)->to_string());
+                    ASSERT_EQUAL(json::parse_lazy(std::make_shared<const std::string>(s))->to_pretty_string(),
+                                 json::parse(s)->to_pretty_string());
+                }
+
+                // only the objects and arrays on the way to a node are read
+                const auto j = json::parse_lazy(std::make_shared<const std::string>(
+                    R"({"a" : {"b" : {"c" : 7}, "skip" : [1, 2]}, "other" : {"x" : 1}, "list" : [[1], {"y" : 2}]})"));
+                ASSERT_FALSE(j->is_materialized());
+                ASSERT_EQUAL(j->get_integer_by_path("a/b/c"), static_cast<int64_t>(7));
+                ASSERT_TRUE(j->is_materialized());
+
+                const auto a = std::static_pointer_cast<json::node_object>(j->get_node_by_path("a"));
+                const auto other = std::static_pointer_cast<json::node_object>(j->get_node_by_path("other"));
+                const auto list = j->get_array_by_path("list");
+                ASSERT_TRUE(a->is_materialized());
+                ASSERT_FALSE(other->is_materialized());
+                ASSERT_FALSE(list->is_materialized());
+                ASSERT_FALSE(std::static_pointer_cast<json::node_array>(a->get_node_by_path("skip"))->is_materialized());
+
+                // iteration reads the children too
+                size_t count = 0;
+                for (const auto &child : *list)
+                    count += (child != nullptr ? 1 : 0);
+                ASSERT_TRUE(count == 2 && list->is_materialized());
+                ASSERT_FALSE(std::static_pointer_cast<json::node_array>((*list)[0])->is_materialized());
+
+                // changes and copies work as they do on a fully parsed tree
+                other->add_child(std::make_shared<json::node_integer>("z", 3));
+                ASSERT_EQUAL(other->to_simple_string(), std::string(R"({"x":1,"z":3})"));
+                const json::node_array copied(*std::static_pointer_cast<json::node_array>((*list)[0]));
+                ASSERT_EQUAL(copied.to_string(), std::string("[1]"));
+
+                ASSERT_TRUE(json::parse_lazy(nullptr) == nullptr);
+                ASSERT_TRUE(json::parse_lazy(std::make_shared<const std::string>("[1]")) == nullptr);
+                ASSERT_TRUE(json::parse_array_lazy(std::make_shared<const std::string>("{}")) == nullptr);
+                ASSERT_EQUAL(json::parse_array_lazy(std::make_shared<const std::string>(" [ 1, [2], {\"a\":3} ] "))->to_string(),
+                             std::string(R"([1,[2],{"a":3}])"));
+
+                // concurrent readers each see the children, which are only read once
+                const auto shared = json::parse_lazy(std::make_shared<const std::string>(make_large_document(200)));
+                std::vector<std::thread> threads;
+                std::vector<int64_t> sums(4, 0);
+                for (size_t t = 0; t < sums.size(); ++t)
+                    threads.emplace_back([&shared, &sums, t]() {
+                        for (const auto &record : *shared->get_array_by_path("records"))
+                            sums[t] += std::static_pointer_cast<json::node_object>(record)->get_integer_by_path("id");
+                    });
+                for (auto &t : threads)
+                    t.join();
+                ASSERT_TRUE(std::count(sums.begin(), sums.end(), static_cast<int64_t>(199 * 200 / 2)) == 4);
+            });
+
+            add_test("benchmark: full vs lazy parse", [](std::shared_ptr<unit_test_input_base> input) {
+                const auto document = std::make_shared<const std::string>(make_large_document(20000));
+                int64_t full_id = 0;
+                int64_t lazy_id = 0;
+
+                {
+                    benchmark b("json full parse and one lookup (" + std::to_string(document->size()) + " bytes)");
+                    const auto records = json::parse(*document)->get_array_by_path("records");
+                    full_id = std::static_pointer_cast<json::node_object>((*records)[12345])->get_integer_by_path("id");
+                }
+
+                {
+                    benchmark b("json lazy parse and one lookup (" + std::to_string(document->size()) + " bytes)");
+                    const auto records = json::parse_lazy(document)->get_array_by_path("records");
+                    lazy_id = std::static_pointer_cast<json::node_object>((*records)[12345])->get_integer_by_path("id");
+                }
+
+                ASSERT_TRUE(full_id == 12345 && lazy_id == 12345);
+            });
+
+            add_test("number classification and conversion", [](std::shared_ptr<unit_test_input_base> input) {
+                // every short string over the characters of numbers is classified as before, and
+                // converted to the same value as atoll() and atof()
+                const std::string alphabet = "0-1.eE9+";
+                bool all_agree = true;
+                std::vector<std::string> texts = {""};
+
+                for (size_t length = 1; length <= 5; ++length)
+                {
+                    std::vector<std::string> longer;
+                    for (const auto &t : texts)
+                        if (t.size() + 1 == length)
+                            for (const char c : alphabet)
+                                longer.push_back(t + c);
+                    texts.insert(texts.end(), longer.begin(), longer.end());
+                }
+
+                const std::vector<std::string> edges = {
+                    "9223372036854775807", "-9223372036854775808", "9223372036854775808", "-9223372036854775809",
+                    "99999999999999999999999", "123456789012345678", "-123456789012345678", "12345678",
+                    "0.1", "0.30000000000000004", "1234567890.12345", "12345678.87654321", "123456789012345678.5",
+                    "3.14159265358979323846", "-0.0", "1.7976931348623157e308", "1e309", "-1e400", "0.0000001",
+                    "0.000000000000000000000000001", "1e22", "1e23", "-", "-.5", "5.", "12-e5-", "007", "012"};
+                texts.insert(texts.end(), edges.begin(), edges.end());
+
+                for (const auto &t : texts)
+                {
+                    const bool is_integer = json::data_validators::is_type_integer(t);
+                    const bool is_float = json::data_validators::is_type_float(t);
+
+                    all_agree = all_agree && (is_integer == reference_is_type_integer(t)) && (is_float == reference_is_type_float(t));
+
+                    if (is_integer)
+                        all_agree = all_agree && (json::number_helpers::to_integer(t) == static_cast<int64_t>(atoll(t.c_str())));
+
+                    if (is_float)
+                    {
+                        const double expected = atof(t.c_str());
+                        const double actual = json::number_helpers::to_float(t);
+                        all_agree = all_agree && (actual == expected) && (std::signbit(actual) == std::signbit(expected));
+                    }
+
+                    if (!all_agree)
+                    {
+                        std::cout << "number text disagrees: " << t << std::endl;
+                        break;
+                    }
+                }
+
+                ASSERT_TRUE(all_agree);
+
+                // the parser types and converts numbers the same way
+                const auto arr = json::parse_array("[7, -2.5, 1e5, 0.1, 12345678901234, 9223372036854775807, 1e-5, 012, 5.]");
+                ASSERT_TRUE((*arr)[0]->get_type() == json::JsonDataType::JDT_INTEGER);
+                ASSERT_TRUE(json::get_value_float((*arr)[1]) == -2.5);
+                ASSERT_TRUE(json::get_value_float((*arr)[2]) == 1e5);
+                ASSERT_TRUE(json::get_value_float((*arr)[3]) == 0.1);
+                ASSERT_EQUAL(json::get_value_integer((*arr)[4]), static_cast<int64_t>(12345678901234));
+                ASSERT_EQUAL(json::get_value_integer((*arr)[5]), std::numeric_limits<int64_t>::max());
+                ASSERT_TRUE((*arr)[6]->get_type() == json::JsonDataType::JDT_STRING);
+                ASSERT_TRUE(json::get_value_float((*arr)[7]) == 12.0);
+                ASSERT_TRUE(json::get_value_float((*arr)[8]) == 5.0);
+                ASSERT_TRUE(json::number_helpers::classify("abc") == json::JsonDataType::JDT_UNDEFINED);
+            });
+
+            add_test("benchmark: number parsing", [](std::shared_ptr<unit_test_input_base> input) {
+                std::vector<std::string> numbers;
+                std::stringstream ss;
+
+                ss << "[";
+                for (size_t i = 0; i < 200000; ++i)
+                {
+                    numbers.push_back(i % 4 == 0 ? std::to_string(i * 7919) : std::to_string(i % 100000) + "." + std::to_string(10 + i % 90));
+                    ss << (i == 0 ? "" : ",") << numbers.back();
+                }
+                ss << "]";
+                const std::string text = ss.str();
+
+                double before = 0.0;
+                double after = 0.0;
+
+                {
+                    benchmark b("json number conversion: multi-pass validators and atoll/atof (200000 numbers)");
+                    for (const auto &n : numbers)
+                    {
+                        const std::string copy(n);
+                        if (reference_is_type_integer(copy))
+                            before += static_cast<double>(atoll(copy.c_str()));
+                        else if (reference_is_type_float(copy))
+                            before += atof(copy.c_str());
+                    }
+                }
+
+                {
+                    benchmark b("json number conversion: single-pass number_helpers (200000 numbers)");
+                    for (const auto &n : numbers)
+                    {
+                        const json::JsonDataType type = json::number_helpers::classify(n);
+                        if (type == json::JsonDataType::JDT_INTEGER)
+                            after += static_cast<double>(json::number_helpers::to_integer(n));
+                        else if (type == json::JsonDataType::JDT_FLOAT)
+                            after += json::number_helpers::to_float(n);
+                    }
+                }
+
+                std::shared_ptr<json::node_array> arr;
+
+                {
+                    benchmark b("json parse_array of a numeric array (" + std::to_string(text.size()) + " bytes)");
+                    arr = json::parse_array(text);
+                }
+
+                ASSERT_TRUE(before == after);
+                ASSERT_TRUE(arr->size() == numbers.size());
+                ASSERT_TRUE(json::get_value_float((*arr)[1]) == 1.11);
+            });
+
+            add_test("interned key pool", [](std::shared_ptr<unit_test_input_base> input) {
+                json::key_pool pool;
+                const std::string text = R"({ "id" : 1, "name" : "a", "child" : { "id" : 2, "na\"me" : [ { "id" : 3 } ] }, "id" : 4 })";
+
+                const auto doc1 = json::parse(text, pool);
+                const auto doc2 = json::parse(text, pool);
+
+                // the tree is the same as one parsed without a pool
+                ASSERT_EQUAL(doc1->to_string(), json::parse(text)->to_string());
+                ASSERT_EQUAL(doc1->to_pretty_string(), json::parse(text)->to_pretty_string());
+
+                // each distinct key is stored once, and shared by both documents
+                ASSERT_TRUE(pool.size() == 4);
+                ASSERT_TRUE((*doc1)["id"]->get_pooled_key() == (*doc2)["id"]->get_pooled_key());
+                ASSERT_TRUE((*doc1)["id"]->get_pooled_key() == pool.find("id"));
+                ASSERT_TRUE((*doc1)["id"]->get_key_view().data() == (*doc2)["id"]->get_key_view().data());
+                ASSERT_EQUAL((*doc1)["name"]->get_key(), std::string("name"));
+                ASSERT_TRUE(pool.find("na\"me") != nullptr);
+                ASSERT_TRUE(pool.find("missing") == nullptr);
+                ASSERT_TRUE(json::parse(text)->get_data()[0]->get_pooled_key() == nullptr);
+
+                // a node keeps either its own key name or the handle of one, not both
+                ASSERT_TRUE(sizeof(json::node) <= sizeof(void *) + 8 + sizeof(std::string));
+                const json::node_integer copy(static_cast<const json::node_integer &>(*(*doc1)["id"]));
+                ASSERT_TRUE(copy.get_pooled_key() == pool.find("id"));
+                ASSERT_EQUAL(copy.get_key(), std::string("id"));
+
+                const json::key_pool_stats stats = pool.get_stats();
+                ASSERT_TRUE(stats.lookups == 14);
+                ASSERT_TRUE(stats.hits == 10);
+                ASSERT_TRUE(stats.keys == 4);
+                ASSERT_TRUE(stats.bytes == 16);
+                ASSERT_TRUE(stats.hit_rate() > 0.71 && stats.hit_rate() < 0.72);
+                pool.reset_stats();
+                ASSERT_TRUE(pool.get_stats().lookups == 0 && pool.get_stats().keys == 4);
+
+                // paths resolved against the pool find the same nodes as string paths
+                const json::key_path child_id(pool, "child/id");
+                ASSERT_TRUE(child_id.size() == 2);
+                ASSERT_TRUE(doc1->get_node_by_path(child_id) == doc1->get_node_by_path("child/id"));
+                ASSERT_TRUE(json::get_value_integer(doc2->get_node_by_path(child_id)) == 2);
+                ASSERT_TRUE(json::get_value_integer(doc1->get_node_by_path(json::key_path(pool, "id"))) == 1);
+                ASSERT_TRUE(doc1->does_node_exist(json::key_path(pool, "child/na\"me")));
+                ASSERT_FALSE(doc1->does_node_exist(json::key_path(pool, "child/missing")));
+                ASSERT_FALSE(doc1->does_node_exist(json::key_path(pool, "name/id")));
+
+                // children that were not parsed with the pool are found by key name
+                doc1->add_child(std::make_shared<json::node_integer>("added", 5));
+                ASSERT_TRUE(json::get_value_integer(doc1->get_node_by_path(json::key_path(pool, "added"))) == 5);
+                json::key_pool other;
+                ASSERT_TRUE(json::get_value_integer(json::parse(text, other)->get_node_by_path(child_id)) == 2);
+
+                // large objects are searched with their key index
+                std::stringstream ss;
+                ss << "{";
+                for (size_t i = 0; i < 40; ++i)
+                    ss << (i == 0 ? "" : ",") << "\"k" << i << "\":" << i;
+                ss << "}";
+                const auto wide = json::parse(ss.str(), pool);
+                ASSERT_TRUE(json::get_value_integer(wide->get_node_by_path(json::key_path(pool, "k33"))) == 33);
+
+                const auto arr = json::parse_array(R"([{"id":7},{"id":8}])", pool);
+                ASSERT_TRUE(std::dynamic_pointer_cast<json::node_object>((*arr)[1])->get_data()[0]->get_pooled_key() == pool.find("id"));
+            });
+
+            add_test("benchmark: key lookup with and without a key pool", [](std::shared_ptr<unit_test_input_base> input) {
+                std::stringstream ss;
+                ss << "[";
+                for (size_t i = 0; i < 20000; ++i)
+                    ss << (i == 0 ? "" : ",") << "{ \"instrument_identifier\" : " << i << ", \"instrument_description\" : \"SYM\", "
+                       << "\"settlement\" : { \"settlement_currency_code\" : \"USD\", \"settlement_date_offset\" : " << i % 3 << " } }";
+                ss << "]";
+                const std::string text = ss.str();
+
+                std::shared_ptr<json::node_array> plain;
+                std::shared_ptr<json::node_array> pooled;
+                json::key_pool pool;
+
+                {
+                    benchmark b("json parse_array of 20000 objects with long keys");
+                    plain = json::parse_array(text);
+                }
+
+                {
+                    benchmark b("json parse_array of 20000 objects with long keys, interned in a key pool");
+                    pooled = json::parse_array(text, pool);
+                }
+
+                int64_t sum_plain = 0;
+                int64_t sum_pooled = 0;
+                const json::path p("settlement/settlement_date_offset");
+                const json::key_path kp(pool, "settlement/settlement_date_offset");
+
+                {
+                    benchmark b("json get_node_by_path, comparing key names");
+                    for (size_t r = 0; r < 10; ++r)
+                        for (const auto &n : *plain)
+                            sum_plain += json::get_value_integer(static_cast<const json::node_object &>(*n).get_node_by_path(p));
+                }
+
+                {
+                    benchmark b("json get_node_by_path, comparing interned key handles");
+                    for (size_t r = 0; r < 10; ++r)
+                        for (const auto &n : *pooled)
+                            sum_pooled += json::get_value_integer(static_cast<const json::node_object &>(*n).get_node_by_path(kp));
+                }
+
+                ASSERT_TRUE(sum_plain == sum_pooled);
+                ASSERT_TRUE(pool.size() == 5);
+                std::cout << "key pool hit rate: " << pool.get_stats().hit_rate() << std::endl;
+            });
         }
 
     }; // class test_json
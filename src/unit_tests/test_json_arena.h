@@ -0,0 +1,188 @@
+#pragma once
+
+//
+// test_json_arena.h - Unit tests for json_arena.h.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "unit_test_base.h"
+
+#include "../benchmark.h"
+#include "../platform_defs.h"
+
+#include "../json.h"
+#include "../json_arena.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE(4100, "-Wunused-parameter")
+
+namespace rda
+{
+    class test_json_arena : public unit_test_base
+    {
+    protected:
+        // data structure of inputs that can be re-used by each unit test
+        struct unit_test_input_json_arena : public unit_test_input_base
+        {
+            std::string str1 = R"(
+{
+  "firstName": "John",
+  "lastName": "Smith",
+  "isAlive": true,
+  "age": 27,
+  "height": 1.85,
+  "address": {
+    "streetAddress": "21 2nd Street",
+    "city": "New York"
+  },
+  "phoneNumbers": [
+    { "type": "home", "number": "212 555-1234" },
+    { "type": "office", "number": "646 555-4567" }
+  ],
+  "quote": "bs- \\ quote- \"",
+  "children": [],
+  "spouse": null
+}
+)";
+        };
+
+        // returns the name of the module that is being tested
+        std::string get_test_module_name() const override
+        {
+            return "test_json_arena";
+        }
+
+        // create and return the data structure of input to be provided to each test
+        std::shared_ptr<unit_test_input_base> create_test_input(const size_t testNum, const std::string &description) override
+        {
+            return std::make_shared<unit_test_input_json_arena>();
+        }
+
+        // adds all of the tests that will be run
+        void create_tests() override
+        {
+            add_test("path queries", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_arena>(input);
+
+                auto doc = json::parse_arena(pInput->str1);
+                ASSERT_TRUE(doc != nullptr);
+
+                ASSERT_TRUE(doc->get_string_by_path("firstName") == "John");
+                ASSERT_TRUE(doc->get_string_by_path("address/city") == "New York");
+                ASSERT_TRUE(doc->get_string_by_path("quote") == "bs- \\ quote- \"");
+                ASSERT_TRUE(doc->get_boolean_by_path("isAlive"));
+                ASSERT_EQUAL(doc->get_integer_by_path("age"), static_cast<int64_t>(27));
+                ASSERT_FLOAT_EQUALS(doc->get_float_by_path("height"), 1.85);
+                ASSERT_FLOAT_EQUALS(doc->get_number_by_path("age"), 27.0);
+                ASSERT_EQUAL(doc->get_node_type_by_path("spouse"), json::JsonDataType::JDT_NULL);
+                ASSERT_EQUAL(doc->get_node_type_by_path("missing"), json::JsonDataType::JDT_UNDEFINED);
+                ASSERT_FALSE(doc->does_node_exist("address/city/nothing"));
+                ASSERT_FALSE(doc->does_node_exist(""));
+
+                auto phones = doc->get_array_by_path("phoneNumbers");
+                ASSERT_TRUE(phones != nullptr);
+                ASSERT_TRUE(phones->size() == 2);
+                ASSERT_TRUE((*phones)[1]->get_string_by_path("type") == "office");
+                ASSERT_TRUE((*phones)[2] == nullptr);
+
+                size_t count = 0;
+                for (const auto &child : *doc->get_root())
+                    if (!child.get_key().empty())
+                        ++count;
+                ASSERT_TRUE(count == doc->get_root()->size());
+
+                ASSERT_TRUE(doc->get_object_by_path("children") == nullptr);
+                ASSERT_TRUE(doc->get_array_by_path("children")->empty());
+
+                static constexpr json::path city("address/city");
+                ASSERT_TRUE(doc->get_string_by_path(city) == "New York");
+                ASSERT_TRUE(doc->get_root()->get_string_by_path(city) == "New York");
+                ASSERT_TRUE(doc->get_object_by_path(json::path("address")) != nullptr);
+                ASSERT_TRUE(doc->get_array_by_path(json::path("phoneNumbers"))->size() == 2);
+                ASSERT_EQUAL(doc->get_integer_by_path(json::path("age")), static_cast<int64_t>(27));
+                ASSERT_FALSE(doc->does_node_exist(json::path("address/city/nothing")));
+            });
+
+            add_test("same tree as heap allocated parser", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_arena>(input);
+
+                const std::vector<std::string> inputs = {
+                    pInput->str1,
+                    R"({{[{[[[{{{"nullObj":null}}}]]]}]}})",
+                    R"({test1:true,test2:  test string2, test3 : null , test4  : 30.1, test5:789})",
+                    R"({"a" "b", 5 "7", x})",
+                    R"({ "open" : "unterminated \")",
+                    "{}",
+                };
+
+                for (const auto &s : inputs)
+                {
+                    auto doc = json::parse_arena(s);
+                    ASSERT_TRUE(doc != nullptr);
+                    ASSERT_EQUAL(doc->get_root()->to_node()->to_string(), json::parse(s)->to_string());
+                }
+
+                auto arr = json::parse_arena_array("[1, \"two\", [3.5], {\"four\":4}]");
+                ASSERT_TRUE(arr != nullptr);
+                ASSERT_EQUAL(arr->get_root()->to_node()->to_string(), std::string(R"([1,"two",[3.500000],{"four":4}])"));
+
+                ASSERT_TRUE(json::parse_arena("[1]") == nullptr);
+                ASSERT_TRUE(json::parse_arena_array("{}") == nullptr);
+            });
+
+            add_test("arena reuse and release", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_arena>(input);
+
+                json::arena_document doc(256);
+
+                ASSERT_TRUE(doc.parse_object(pInput->str1));
+                ASSERT_TRUE(doc.get_arena().bytes_used() > 0);
+                ASSERT_TRUE(doc.get_arena().block_count() > 1);
+
+                ASSERT_TRUE(doc.parse_object(R"({"a":{"b":"c"}})"));
+                ASSERT_TRUE(doc.get_string_by_path("a/b") == "c");
+                ASSERT_FALSE(doc.does_node_exist("firstName"));
+
+                doc.clear();
+                ASSERT_TRUE(doc.get_root() == nullptr);
+                ASSERT_TRUE(doc.get_arena().block_count() == 0);
+                ASSERT_TRUE(doc.get_string_by_path("a/b").empty());
+            });
+
+            add_test("benchmark: arena vs shared_ptr document", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_arena>(input);
+
+                std::stringstream ss;
+                ss << "{ \"records\" : [";
+                for (size_t i = 0; i < 20000; ++i)
+                    ss << (i == 0 ? "" : ",") << "{ \"id\" : " << i << ", \"name\" : \"n" << i << "\" }";
+                ss << "] }";
+                const std::string document = ss.str();
+
+                {
+                    benchmark b("json shared_ptr document parse and release");
+                    auto j = json::parse(document);
+                    ASSERT_TRUE(j->get_array_by_path("records")->size() == 20000);
+                }
+
+                {
+                    benchmark b("json arena document parse and release");
+                    auto doc = json::parse_arena(document);
+                    ASSERT_TRUE(doc->get_array_by_path("records")->size() == 20000);
+                }
+            });
+        }
+
+    }; // class test_json_arena
+
+} // namespace rda
+
+POP_WARN_DISABLE
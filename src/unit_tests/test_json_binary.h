@@ -0,0 +1,253 @@
+#pragma once
+
+//
+// test_json_binary.h - Unit tests for json_binary.h.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "unit_test_base.h"
+
+#include "../benchmark.h"
+#include "../platform_defs.h"
+
+#include "../json.h"
+#include "../json_binary.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE(4100, "-Wunused-parameter")
+
+namespace rda
+{
+    class test_json_binary : public unit_test_base
+    {
+    protected:
+        // data structure of inputs that can be re-used by each unit test
+        struct unit_test_input_json_binary : public unit_test_input_base
+        {
+            std::vector<std::string> documents = {
+                R"(
+{
+  "firstName": "John",
+  "lastName": "Smith",
+  "isAlive": true,
+  "age": 27,
+  "height": 1.85,
+  "address": {
+    "streetAddress": "21 2nd Street",
+    "city": "New York"
+  },
+  "phoneNumbers": [
+    { "type": "home", "number": "212 555-1234" },
+    { "type": "office", "number": "646 555-4567" }
+  ],
+  "quote": "bs- \\ quote- \"",
+  "children": [],
+  "spouse": null
+}
+)",
+                R"({{[{[[[{{{"nullObj":null}}}]]]}]}})",
+                R"({"negative":-42, "min":-9223372036854775808, "tiny":0.0000001, "neg":-2.5, "big":1e300, "empty":{}, "list":[null, false, "", [], {}]})",
+                R"({"a" "b", 5 "7", x, "dup" : 1, "dup" : 2})",
+                "{}",
+            };
+
+            // a document of many records
+            std::string large;
+
+            unit_test_input_json_binary()
+            {
+                std::stringstream ss;
+                ss << "{ \"records\" : [";
+                for (size_t i = 0; i < 5000; ++i)
+                    ss << (i == 0 ? "" : ",") << "{ \"id\" : " << i << ", \"symbol\" : \"SYM" << i % 100
+                       << "\", \"price\" : " << i << ".25, \"active\" : " << (i % 2 ? "true" : "false")
+                       << ", \"note\" : null, \"tags\" : [\"a\", \"b\"] }";
+                ss << "], \"count\" : 5000 }";
+                large = ss.str();
+            }
+        };
+
+        // returns the name of the module that is being tested
+        std::string get_test_module_name() const override
+        {
+            return "test_json_binary";
+        }
+
+        // create and return the data structure of input to be provided to each test
+        std::shared_ptr<unit_test_input_base> create_test_input(const size_t testNum, const std::string &description) override
+        {
+            return std::make_shared<unit_test_input_json_binary>();
+        }
+
+        // adds all of the tests that will be run
+        void create_tests() override
+        {
+            add_test("round trip", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_binary>(input);
+
+                for (const auto &document : pInput->documents)
+                {
+                    const auto original = json::parse(document);
+                    const std::string encoded = json::encode_binary(*original);
+
+                    ASSERT_TRUE(json::is_binary(encoded));
+                    const auto decoded = json::decode_binary_object(encoded);
+                    ASSERT_TRUE(decoded != nullptr);
+                    ASSERT_EQUAL(decoded->to_string(), original->to_string());
+                }
+
+                // integers and floats keep their type, even when the float has no fraction
+                json::node_array numbers("", std::vector<std::shared_ptr<json::node>>{
+                    std::make_shared<json::node_integer>("", std::numeric_limits<int64_t>::max()),
+                    std::make_shared<json::node_integer>("", std::numeric_limits<int64_t>::min()),
+                    std::make_shared<json::node_float>("", 3.0),
+                    std::make_shared<json::node_float>("", -0.1)});
+                const auto decoded = json::decode_binary_array(json::encode_binary(numbers));
+                ASSERT_TRUE(decoded != nullptr && decoded->size() == 4);
+                ASSERT_TRUE((*decoded)[0]->get_type() == json::JsonDataType::JDT_INTEGER);
+                ASSERT_EQUAL(json::get_value_integer((*decoded)[0]), std::numeric_limits<int64_t>::max());
+                ASSERT_EQUAL(json::get_value_integer((*decoded)[1]), std::numeric_limits<int64_t>::min());
+                ASSERT_TRUE((*decoded)[2]->get_type() == json::JsonDataType::JDT_FLOAT);
+                ASSERT_TRUE(json::get_value_float((*decoded)[2]) == 3.0);
+                ASSERT_TRUE(json::get_value_float((*decoded)[3]) == -0.1);
+
+                // the encoder re-uses its buffer
+                json::binary_encoder encoder;
+                ASSERT_TRUE(encoder.encode(numbers) == json::encode_binary(numbers));
+                ASSERT_TRUE(encoder.encode(numbers).size() == encoder.size());
+
+                // the body length is 8 bytes, after the header, the tag and the (empty) key name
+                const std::string encoded = json::encode_binary(numbers);
+                uint64_t body_length = 0;
+                for (size_t i = 0; i < 8; ++i)
+                    body_length |= static_cast<uint64_t>(static_cast<uint8_t>(encoded[6 + i])) << (8 * i);
+                ASSERT_TRUE(body_length == encoded.size() - 14);
+
+                // a document of the old version, with 4 byte body lengths, is not read
+                std::string old_version = encoded;
+                old_version[3] = 1;
+                ASSERT_FALSE(json::is_binary(old_version));
+            });
+
+            add_test("read in place", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_binary>(input);
+
+                const std::string encoded = json::encode_binary(*json::parse(pInput->documents[0]));
+                const json::binary_value root = json::read_binary(encoded);
+
+                ASSERT_TRUE(root.is_valid());
+                ASSERT_TRUE(root.get_type() == json::JsonDataType::JDT_OBJECT);
+                ASSERT_TRUE(root.size() == 10);
+                ASSERT_TRUE(root.find("lastName").get_string() == "Smith");
+                ASSERT_TRUE(root.find("isAlive").get_boolean());
+                ASSERT_EQUAL(root.find("age").get_integer(), static_cast<int64_t>(27));
+                ASSERT_TRUE(root.find("height").get_float() == 1.85);
+                ASSERT_TRUE(root.find("spouse").get_type() == json::JsonDataType::JDT_NULL);
+                ASSERT_TRUE(root.get_by_path("address/city").get_string() == "New York");
+                ASSERT_TRUE(root.get_by_path(json::path("address/city")).get_key() == "city");
+                ASSERT_TRUE(root.find("phoneNumbers")[1].find("number").get_string() == "646 555-4567");
+                ASSERT_TRUE(root.find("phoneNumbers").size() == 2);
+                ASSERT_FALSE(root.find("phoneNumbers")[2].is_valid());
+                ASSERT_FALSE(root.find("missing").is_valid());
+                ASSERT_TRUE(root.find("missing").get_type() == json::JsonDataType::JDT_UNDEFINED);
+                ASSERT_FALSE(root.get_by_path("address/missing/city").is_valid());
+                ASSERT_TRUE(root.find("age").get_string().empty());
+                ASSERT_TRUE(root.find("lastName").get_integer() == 0);
+
+                // a sub-tree can be decoded by itself
+                const auto address = root.find("address").to_node();
+                ASSERT_EQUAL(address->to_string(), std::string(R"("address":{"streetAddress":"21 2nd Street","city":"New York"})"));
+
+                // skipping over a value lands on the start of the next one
+                const json::binary_value first = root[0];
+                const json::binary_value second = root[1];
+                ASSERT_TRUE(first.get_key() == "firstName" && second.get_key() == "lastName");
+                ASSERT_TRUE(json::binary_value(encoded, first.end()).end() == second.end());
+            });
+
+            add_test("invalid input", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_binary>(input);
+
+                const std::string encoded = json::encode_binary(*json::parse(pInput->documents[0]));
+
+                ASSERT_TRUE(json::decode_binary("") == nullptr);
+                ASSERT_TRUE(json::decode_binary(pInput->documents[0]) == nullptr);
+                ASSERT_FALSE(json::read_binary("RJB").is_valid());
+                ASSERT_TRUE(json::decode_binary_array(encoded) == nullptr);
+
+                // every truncation fails cleanly, and so does a bad tag
+                bool all_failed = true;
+                for (size_t length = 0; length < encoded.size(); ++length)
+                    all_failed = all_failed && json::decode_binary(encoded.substr(0, length)) == nullptr;
+                ASSERT_TRUE(all_failed);
+
+                std::string bad_tag = encoded;
+                bad_tag[json::binary_helpers::HEADER_SIZE] = static_cast<char>(0x7f);
+                ASSERT_TRUE(json::decode_binary(bad_tag) == nullptr);
+                ASSERT_FALSE(json::read_binary(bad_tag).is_valid());
+
+                // a truncated document can still be read in place up to where it was cut
+                const json::binary_value truncated = json::read_binary(std::string_view(encoded).substr(0, 40));
+                ASSERT_TRUE(truncated.size() == 0);
+                ASSERT_FALSE(truncated.find("firstName").is_valid());
+            });
+
+            add_test("benchmark: text vs binary", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_binary>(input);
+
+                const auto tree = json::parse(pInput->large);
+                std::string text;
+                std::string encoded;
+
+                {
+                    benchmark b("json text encode (to_string)");
+                    text = tree->to_string();
+                }
+
+                {
+                    benchmark b("json binary encode");
+                    encoded = json::encode_binary(*tree);
+                }
+
+                std::shared_ptr<json::node_object> from_text;
+                std::shared_ptr<json::node_object> from_binary;
+
+                {
+                    benchmark b("json text decode (parse)");
+                    from_text = json::parse(text);
+                }
+
+                {
+                    benchmark b("json binary decode");
+                    from_binary = json::decode_binary_object(encoded);
+                }
+
+                int64_t count = 0;
+
+                {
+                    benchmark b("json binary read in place (one value after a skipped sub-tree)");
+                    count = json::read_binary(encoded).find("count").get_integer();
+                }
+
+                std::cout << "json text: " << text.size() << " bytes, binary: " << encoded.size() << " bytes" << std::endl;
+
+                ASSERT_EQUAL(from_binary->to_string(), from_text->to_string());
+                ASSERT_EQUAL(count, static_cast<int64_t>(5000));
+                ASSERT_TRUE(encoded.size() < text.size());
+            });
+        }
+
+    }; // class test_json_binary
+
+} // namespace rda
+
+POP_WARN_DISABLE
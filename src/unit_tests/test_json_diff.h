@@ -0,0 +1,329 @@
+#pragma once
+
+//
+// test_json_diff.h - Unit tests for json_diff.h.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "unit_test_base.h"
+
+#include "../benchmark.h"
+#include "../platform_defs.h"
+
+#include "../json.h"
+#include "../json_diff.h"
+#include "../json_patch.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE(4100, "-Wunused-parameter")
+
+namespace rda
+{
+    class test_json_diff : public unit_test_base
+    {
+    protected:
+        // data structure of inputs that can be re-used by each unit test
+        struct unit_test_input_json_diff : public unit_test_input_base
+        {
+            // pairs of documents to diff
+            std::vector<std::pair<std::string, std::string>> pairs = {
+                { R"({"a":1})", R"({"a":1})" },
+                { R"({"a":1,"b":2})", R"({"a":1,"b":3})" },
+                { R"({"a":1,"b":2})", R"({"a":1})" },
+                { R"({"a":1})", R"({"a":1,"c":{"d":[1,2]}})" },
+                { R"({"a":[1,2,3,4,5]})", R"({"a":[1,2,9,4,5]})" },
+                { R"({"a":[1,2,3,4,5]})", R"({"a":[1,5]})" },
+                { R"({"a":[1,5]})", R"({"a":[1,2,3,4,5]})" },
+                { R"({"a":[1,2,3]})", R"({"a":[7,8,9,10]})" },
+                { R"({"a":[]})", R"({"a":[[],{}]})" },
+                { R"({"a":{"b":{"c":"x"}}})", R"({"a":{"b":{"c":"y"}}})" },
+                { R"({"a":{"b":1}})", R"({"a":[1]})" },
+                { R"({"a":1})", R"({"a":1.0})" },
+                { R"({"a/b":{"m~n":1}})", R"({"a/b":{"m~n":2}})" },
+                { R"({"a":[{"id":1,"v":"x"},{"id":2,"v":"y"}]})", R"({"a":[{"id":1,"v":"x"},{"id":2,"v":"z"},{"id":3}]})" },
+                { R"({})", R"({"x":null,"y":true})" },
+            };
+
+            // returns the text of the document made by applying the diff of two documents
+            // to the first one
+            static std::string round_trip(const std::shared_ptr<json::node_object> &from, const std::shared_ptr<json::node_object> &to)
+            {
+                const json::patch p(*json::diff(from, to));
+                const auto result = p.apply(from);
+                return (result == nullptr ? "null" : result->to_string());
+            }
+
+            // returns a pseudo-random number
+            static uint64_t next(uint64_t &state)
+            {
+                state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+                return (state >> 33);
+            }
+
+            // returns a pseudo-random json value, as text
+            static std::string random_value(uint64_t &state, const size_t depth)
+            {
+                const uint64_t kind = next(state) % (depth > 2 ? 4 : 6);
+
+                if (kind == 0)
+                    return std::to_string(next(state) % 5);
+                if (kind == 1)
+                    return "\"s" + std::to_string(next(state) % 3) + "\"";
+                if (kind == 2)
+                    return (next(state) % 2 ? "true" : "null");
+                if (kind == 3)
+                    return std::to_string(next(state) % 3) + ".5";
+
+                std::stringstream ss;
+                const size_t count = next(state) % 5;
+
+                if (kind == 4)
+                {
+                    ss << "[";
+                    for (size_t i = 0; i < count; ++i)
+                        ss << (i == 0 ? "" : ",") << random_value(state, depth + 1);
+                    ss << "]";
+                }
+                else
+                {
+                    ss << "{";
+                    for (size_t i = 0; i < count; ++i)
+                        ss << (i == 0 ? "" : ",") << "\"k" << i << "\":" << random_value(state, depth + 1);
+                    ss << "}";
+                }
+
+                return ss.str();
+            }
+        };
+
+        // returns the name of the module that is being tested
+        std::string get_test_module_name() const override
+        {
+            return "test_json_diff";
+        }
+
+        // create and return the data structure of input to be provided to each test
+        std::shared_ptr<unit_test_input_base> create_test_input(const size_t testNum, const std::string &description) override
+        {
+            return std::make_shared<unit_test_input_json_diff>();
+        }
+
+        // adds all of the tests that will be run
+        void create_tests() override
+        {
+            add_test("diff round trip", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_diff>(input);
+
+                for (const auto &pair : pInput->pairs)
+                {
+                    const auto from = json::parse(pair.first);
+                    const auto to = json::parse(pair.second);
+                    ASSERT_EQUAL(pInput->round_trip(from, to), to->to_string());
+                    ASSERT_EQUAL(from->to_string(), json::parse(pair.first)->to_string());
+                }
+
+                // random documents, and random changes to them
+                uint64_t state = 12345;
+                for (size_t i = 0; i < 300; ++i)
+                {
+                    const auto from = json::parse("{\"r\":" + pInput->random_value(state, 0) + ",\"s\":" + pInput->random_value(state, 0) + "}");
+                    const auto to = json::parse("{\"r\":" + pInput->random_value(state, 0) + ",\"s\":" + pInput->random_value(state, 0) + "}");
+                    ASSERT_EQUAL(pInput->round_trip(from, to), to->to_string());
+                    ASSERT_EQUAL(pInput->round_trip(to, from), from->to_string());
+                }
+            });
+
+            add_test("diff operations", [](std::shared_ptr<unit_test_input_base> input) {
+                const auto run = [](const std::string &from, const std::string &to) {
+                    return json::diff(json::parse(from), json::parse(to))->to_string();
+                };
+
+                ASSERT_EQUAL(run(R"({"a":1,"b":[1]})", R"({"b":[1],"a":1})"), std::string("[]"));
+                ASSERT_EQUAL(run(R"({"a":1,"b":2})", R"({"a":1,"b":3})"), std::string(R"([{"op":"replace","path":"/b","value":3}])"));
+                ASSERT_EQUAL(run(R"({"a":1,"b":2})", R"({"c":[1]})"),
+                             std::string(R"([{"op":"remove","path":"/a"},{"op":"remove","path":"/b"},{"op":"add","path":"/c","value":[1]}])"));
+                ASSERT_EQUAL(run(R"({"a":[1,2,3,4,5]})", R"({"a":[1,5]})"),
+                             std::string(R"([{"op":"remove","path":"/a/3"},{"op":"remove","path":"/a/2"},{"op":"remove","path":"/a/1"}])"));
+                ASSERT_EQUAL(run(R"({"a":[1,5]})", R"({"a":[1,2,3,5]})"),
+                             std::string(R"([{"op":"add","path":"/a/1","value":2},{"op":"add","path":"/a/2","value":3}])"));
+                ASSERT_EQUAL(run(R"({"a/b":{"m~n":1}})", R"({"a/b":{"m~n":2}})"), std::string(R"([{"op":"replace","path":"/a~1b/m~0n","value":2}])"));
+                ASSERT_EQUAL(run(R"({"a":{"b":1}})", R"({"a":"b"})"), std::string(R"([{"op":"replace","path":"/a","value":"b"}])"));
+
+                ASSERT_TRUE(json::diff(nullptr, json::parse("{}"))->empty());
+            });
+
+            add_test("subtree hashes", [](std::shared_ptr<unit_test_input_base> input) {
+                const auto a = json::parse(R"({"x":{"p":1,"q":[1,2.5,"s",true,null]},"y":-0.0})");
+                const auto b = json::parse(R"({"y":0.0,"x":{"q":[1,2.5,"s",true,null],"p":1}})");
+
+                // equal values have equal hashes, whatever the order of the members of objects
+                ASSERT_TRUE(json::hash(a) == json::hash(b));
+                ASSERT_TRUE(json::hash(json::parse(R"({"a":[1,2]})")) != json::hash(json::parse(R"({"a":[2,1]})")));
+                ASSERT_TRUE(json::hash(json::parse(R"({"a":1})")) != json::hash(json::parse(R"({"b":1})")));
+                ASSERT_TRUE(json::hash(json::parse(R"({"a":1})")) != json::hash(json::parse(R"({"a":1.0})")));
+                ASSERT_TRUE(json::hash(json::parse(R"({"a":"1"})")) != json::hash(json::parse(R"({"a":1})")));
+                ASSERT_TRUE(json::hash(nullptr) == 0);
+
+                // changing an array or object in place changes its hash
+                const auto x = std::dynamic_pointer_cast<json::node_object>((*a)["x"]);
+                const uint64_t before = json::hash(a);
+                x->add_child(std::make_shared<json::node_integer>("r", 3));
+                ASSERT_TRUE(json::hash(a) != before);
+                x->remove_child("r");
+                ASSERT_TRUE(json::hash(a) == before);
+            });
+
+            add_test("trees changed in place between diffs", [](std::shared_ptr<unit_test_input_base> input) {
+                const auto a = json::parse(R"({"a":{"x":1},"b":[1,[2,3]]})");
+                const auto b = json::parse(R"({"a":{"x":1},"b":[1,[2,3]]})");
+                ASSERT_TRUE(json::diff(a, b)->empty());
+
+                // a change deep inside a tree that has been diffed before is still found
+                std::dynamic_pointer_cast<json::node_object>((*a)["a"])->add_child(std::make_shared<json::node_integer>("y", 2));
+                ASSERT_EQUAL(json::diff(a, b)->to_string(), std::string(R"([{"op":"remove","path":"/a/y"}])"));
+
+                const auto inner = std::dynamic_pointer_cast<json::node_array>((*std::dynamic_pointer_cast<json::node_array>((*b)["b"]))[1]);
+                inner->remove_child(0);
+                ASSERT_EQUAL(json::diff(b, a)->to_string(),
+                             std::string(R"([{"op":"add","path":"/a/y","value":2},{"op":"add","path":"/b/1/0","value":2}])"));
+                ASSERT_EQUAL(json::patch(*json::diff(a, b)).apply(a)->to_string(), b->to_string());
+            });
+
+            add_test("diff of patched versions that share sub-trees", [](std::shared_ptr<unit_test_input_base> input) {
+                std::stringstream ss;
+                ss << "{ \"records\" : [";
+                for (size_t i = 0; i < 2000; ++i)
+                    ss << (i == 0 ? "" : ",") << "{ \"id\" : " << i << ", \"price\" : " << i << ".25, \"tags\" : [\"a\", \"b\"] }";
+                ss << "], \"meta\" : { \"version\" : 1 } }";
+                const auto base = json::parse(ss.str());
+
+                // versions made by patching share every unchanged record with the base, so only
+                // the changed paths are walked
+                const auto v2 = json::apply_patch(base, R"([{"op":"replace","path":"/records/1500/price","value":1},{"op":"replace","path":"/meta/version","value":2}])");
+                const auto v3 = json::apply_patch(v2, R"([{"op":"add","path":"/records/-","value":{"id":2000}}])");
+
+                ASSERT_EQUAL(json::diff(base, v2)->to_string(),
+                             std::string(R"([{"op":"replace","path":"/records/1500/price","value":1},{"op":"replace","path":"/meta/version","value":2}])"));
+                ASSERT_EQUAL(json::diff(base, v3)->to_string(),
+                             std::string(R"([{"op":"replace","path":"/records/1500/price","value":1},{"op":"add","path":"/records/2000","value":{"id":2000}},{"op":"replace","path":"/meta/version","value":2}])"));
+
+                const auto records = std::dynamic_pointer_cast<json::node_array>((*v3)["records"]);
+                ASSERT_TRUE((*records)[0] == (*std::dynamic_pointer_cast<json::node_array>((*base)["records"]))[0]);
+                ASSERT_EQUAL(json::patch(*json::diff(base, v3)).apply(base)->to_string(), v3->to_string());
+            });
+
+            add_test("cached hashes of separately parsed versions", [](std::shared_ptr<unit_test_input_base> input) {
+                const auto records = [](const size_t price) {
+                    std::stringstream ss;
+                    ss << "{ \"records\" : [";
+                    for (size_t i = 0; i < 100; ++i)
+                        ss << (i == 0 ? "" : ",") << "{ \"id\" : " << i << ", \"price\" : " << (i == 50 ? price : i) << " }";
+                    ss << "] }";
+                    return json::parse(ss.str());
+                };
+
+                const auto record = [](const std::shared_ptr<json::node_object> &doc, const size_t i) {
+                    return std::dynamic_pointer_cast<json::node_object>((*std::dynamic_pointer_cast<json::node_array>((*doc)["records"]))[i]);
+                };
+
+                const auto base = records(50);
+                const auto v2 = records(7);
+                const auto v3 = records(8);
+
+                uint64_t h0 = 0;
+                uint64_t h1 = 0;
+                ASSERT_FALSE(record(base, 0)->get_hash_cache().get(h0));
+
+                // the first diff hashes both documents, and keeps the hashes on their nodes
+                ASSERT_EQUAL(json::diff(base, v2)->to_string(), std::string(R"([{"op":"replace","path":"/records/50/price","value":7}])"));
+
+                ASSERT_TRUE(record(base, 0)->get_hash_cache().get(h0));
+                ASSERT_TRUE(record(v2, 0)->get_hash_cache().get(h1));
+                ASSERT_TRUE(h0 == h1);
+                ASSERT_TRUE(record(base, 50)->get_hash_cache().get(h0));
+                ASSERT_TRUE(record(v2, 50)->get_hash_cache().get(h1));
+                ASSERT_TRUE(h0 != h1);
+
+                // a diff of another version against the same base re-uses the hashes of the base
+                ASSERT_EQUAL(json::diff(base, v3)->to_string(), std::string(R"([{"op":"replace","path":"/records/50/price","value":8}])"));
+                ASSERT_TRUE(json::diff(v2, v2)->empty());
+                ASSERT_TRUE(json::diff(base, records(50))->empty());
+
+                // changing a hashed tree in place forgets the cached hashes, so the change is found
+                record(v3, 50)->remove_child("price");
+                ASSERT_FALSE(record(base, 0)->get_hash_cache().get(h0));
+                ASSERT_EQUAL(json::diff(base, v3)->to_string(), std::string(R"([{"op":"remove","path":"/records/50/price"}])"));
+
+                // changing a tree that has not been hashed keeps the cached hashes
+                ASSERT_TRUE(record(base, 0)->get_hash_cache().get(h0));
+                auto fresh = std::make_shared<json::node_array>("", std::vector<std::shared_ptr<json::node>>());
+                fresh->add_child(std::make_shared<json::node_integer>("", 1));
+                ASSERT_TRUE(record(base, 0)->get_hash_cache().get(h1));
+                ASSERT_TRUE(h0 == h1);
+            });
+
+            add_test("benchmark: diff of large documents", [](std::shared_ptr<unit_test_input_base> input) {
+                std::stringstream ss;
+                ss << "{ \"records\" : [";
+                for (size_t i = 0; i < 20000; ++i)
+                    ss << (i == 0 ? "" : ",") << "{ \"id\" : " << i << ", \"symbol\" : \"SYM" << i % 100
+                       << "\", \"price\" : " << i << ".25, \"tags\" : [\"a\", \"b\"], \"detail\" : { \"x\" : [1, 2, 3] } }";
+                ss << "] }";
+                const std::string text = ss.str();
+
+                const auto base = json::parse(text);
+                const auto copy = json::parse(text);
+                const auto edited = json::apply_patch(base, R"([{"op":"replace","path":"/records/12345/price","value":0}])");
+
+                std::shared_ptr<json::node_array> first;
+                std::shared_ptr<json::node_array> second;
+                std::shared_ptr<json::node_array> third;
+                std::shared_ptr<json::node_array> fourth;
+
+                {
+                    benchmark b("json diff: separately parsed documents (hashes every node)");
+                    first = json::diff(base, copy);
+                }
+
+                {
+                    benchmark b("json diff: same documents again (hashes cached on the nodes)");
+                    second = json::diff(base, copy);
+                }
+
+                {
+                    benchmark b("json diff: patched version against its base");
+                    third = json::diff(base, edited);
+                }
+
+                // another version, parsed separately, against the same base: only the new version
+                // is hashed, and the records are compared by their cached hashes
+                std::string changed = text;
+                const std::string price = "\"price\" : 777.25";
+                changed.replace(changed.find(price), price.size(), "\"price\" : 777.50");
+                const auto version = json::parse(changed);
+
+                {
+                    benchmark b("json diff: another parsed version against the same base");
+                    fourth = json::diff(base, version);
+                }
+
+                ASSERT_TRUE(first->empty() && second->empty());
+                ASSERT_EQUAL(fourth->to_string(), std::string(R"([{"op":"replace","path":"/records/777/price","value":777.500000}])"));
+                ASSERT_EQUAL(third->to_string(), std::string(R"([{"op":"replace","path":"/records/12345/price","value":0}])"));
+            });
+        }
+
+    }; // class test_json_diff
+
+} // namespace rda
+
+POP_WARN_DISABLE
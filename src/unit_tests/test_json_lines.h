@@ -0,0 +1,197 @@
+#pragma once
+
+//
+// test_json_lines.h - Unit tests for json_lines.h.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "unit_test_base.h"
+
+#include "../benchmark.h"
+#include "../platform_defs.h"
+
+#include "../json.h"
+#include "../json_lines.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE(4100, "-Wunused-parameter")
+
+namespace rda
+{
+    class test_json_lines : public unit_test_base
+    {
+    protected:
+        // data structure of inputs that can be re-used by each unit test
+        struct unit_test_input_json_lines : public unit_test_input_base
+        {
+            std::string lines;
+
+            unit_test_input_json_lines()
+            {
+                std::stringstream ss;
+                for (size_t i = 0; i < 5000; ++i)
+                    ss << "{ \"id\" : " << i << ", \"name\" : \"record " << i << "\", \"tags\" : [ \"a\", \"b\" ] }\n";
+                lines = ss.str();
+            }
+        };
+
+        // returns the name of the module that is being tested
+        std::string get_test_module_name() const override
+        {
+            return "test_json_lines";
+        }
+
+        // create and return the data structure of input to be provided to each test
+        std::shared_ptr<unit_test_input_base> create_test_input(const size_t testNum, const std::string &description) override
+        {
+            return std::make_shared<unit_test_input_json_lines>();
+        }
+
+        // adds all of the tests that will be run
+        void create_tests() override
+        {
+            add_test("split records", [](std::shared_ptr<unit_test_input_base> input) {
+                const auto records = json::ndjson_reader::split_records("{\"a\":1}\r\n\n   \n{\"b\":2}\n{\"c\":3}");
+
+                ASSERT_TRUE(records.size() == 3);
+                ASSERT_TRUE(records[0] == "{\"a\":1}");
+                ASSERT_TRUE(records[1] == "{\"b\":2}");
+                ASSERT_TRUE(records[2] == "{\"c\":3}");
+                ASSERT_TRUE(json::ndjson_reader::split_records("").empty());
+            });
+
+            add_test("ordered results", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_lines>(input);
+
+                // small batches, so that the workers run ahead of the records being handed back
+                json::ndjson_reader reader(4, 7);
+
+                const auto objects = reader.read_all(pInput->lines);
+                ASSERT_TRUE(objects.size() == 5000);
+                for (size_t i = 0; i < objects.size(); ++i)
+                    ASSERT_EQUAL(objects[i]->get_integer_by_path("id"), static_cast<int64_t>(i));
+
+                size_t expected = 0;
+                bool in_order = true;
+                reader.read_ordered(pInput->lines, [&](const size_t index, std::shared_ptr<json::node_object> obj) {
+                    in_order = in_order && index == expected &&
+                               obj->get_integer_by_path("id") == static_cast<int64_t>(expected);
+                    ++expected;
+                });
+                ASSERT_TRUE(in_order);
+                ASSERT_TRUE(expected == 5000);
+                ASSERT_TRUE(reader.get_stats().records == 5000);
+                ASSERT_TRUE(reader.get_stats().failures == 0);
+                ASSERT_TRUE(reader.get_stats().bytes == pInput->lines.size());
+            });
+
+            add_test("unordered results and failures", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_lines>(input);
+
+                json::ndjson_reader reader(3, 10);
+
+                std::vector<int> seen(5000, 0);
+                reader.read_unordered(pInput->lines, [&](const size_t index, std::shared_ptr<json::node_object> obj) {
+                    if (obj->get_integer_by_path("id") == static_cast<int64_t>(index))
+                        ++seen[index];
+                });
+                ASSERT_TRUE(std::count(seen.begin(), seen.end(), 1) == 5000);
+
+                const auto objects = reader.read_all("{\"ok\":true}\n[1,2]\nnot json\n{\"ok\":true}\n");
+                ASSERT_TRUE(objects.size() == 4);
+                ASSERT_TRUE(objects[0] != nullptr && objects[3] != nullptr);
+                ASSERT_TRUE(objects[1] == nullptr && objects[2] == nullptr);
+                ASSERT_TRUE(reader.get_stats().failures == 2);
+
+                ASSERT_TRUE(reader.read_all("").empty());
+
+                // records can share the key names interned in a pool
+                json::key_pool pool;
+                reader.set_key_pool(&pool);
+                const auto pooled = reader.read_all(pInput->lines);
+                ASSERT_TRUE(pooled.size() == 5000);
+                ASSERT_TRUE(pooled[0]->get_data()[0]->get_pooled_key() == pooled[4999]->get_data()[0]->get_pooled_key());
+                ASSERT_EQUAL(pooled[1234]->to_string(), json::parse(std::string(json::ndjson_reader::split_records(pInput->lines)[1234]))->to_string());
+                ASSERT_TRUE(pool.get_stats().hit_rate() > 0.99);
+                reader.set_key_pool(nullptr);
+                ASSERT_FALSE(reader.read_file_ordered("/nonexistent/records.ndjson", [](const size_t, std::shared_ptr<json::node_object>) {}));
+            });
+
+            add_test("exceptions thrown by the callback", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_lines>(input);
+
+                // small batches, so that workers are waiting for room when the calling thread throws
+                json::ndjson_reader reader(4, 3);
+
+                size_t handed_back = 0;
+                bool thrown = false;
+                try
+                {
+                    reader.read_ordered(pInput->lines, [&](const size_t index, std::shared_ptr<json::node_object> obj) {
+                        if (index == 100)
+                            throw std::runtime_error("ordered");
+                        ++handed_back;
+                    });
+                }
+                catch (const std::runtime_error &e)
+                {
+                    thrown = (std::string(e.what()) == "ordered");
+                }
+                ASSERT_TRUE(thrown);
+                ASSERT_TRUE(handed_back == 100);
+
+                // thrown on a worker thread
+                thrown = false;
+                try
+                {
+                    reader.read_unordered(pInput->lines, [&](const size_t index, std::shared_ptr<json::node_object> obj) {
+                        if (index == 2500)
+                            throw std::runtime_error("unordered");
+                    });
+                }
+                catch (const std::runtime_error &e)
+                {
+                    thrown = (std::string(e.what()) == "unordered");
+                }
+                ASSERT_TRUE(thrown);
+
+                // the reader can still be used afterwards
+                ASSERT_TRUE(reader.read_all(pInput->lines).size() == 5000);
+            });
+
+            add_test("benchmark: single thread vs worker pool", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_lines>(input);
+
+                {
+                    benchmark b("ndjson 5000 records, json::parse per line on one thread");
+                    size_t count = 0;
+                    for (const auto &record : json::ndjson_reader::split_records(pInput->lines))
+                        if (json::parse(std::string(record)) != nullptr)
+                            ++count;
+                    ASSERT_TRUE(count == 5000);
+                }
+
+                json::ndjson_reader reader(4);
+                {
+                    benchmark b("ndjson 5000 records, ndjson_reader with 4 threads");
+                    ASSERT_TRUE(reader.read_all(pInput->lines).size() == 5000);
+                }
+                std::cout << "ndjson_reader: " << reader.get_stats().to_string() << std::endl;
+            });
+        }
+
+    }; // class test_json_lines
+
+} // namespace rda
+
+POP_WARN_DISABLE
@@ -15,6 +15,7 @@
 
 #include "unit_test_base.h"
 
+#include "../benchmark.h"
 #include "../platform_defs.h"
 
 #include "../json_model.h"
@@ -215,6 +216,131 @@ namespace rda
 
                 //std::cout << std::endl << s.toPrettyJSON() << std::endl;
                 });
+
+            add_test("typed binding", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_model>(input);
+
+                class ChildModel : public json_model
+                {
+                public:
+                    JSON_MEMBER_INT(ChildModel, childFieldInt, "child_int");
+                };
+
+                class ParentModel : public json_model
+                {
+                public:
+                    JSON_MEMBER_BOOL(         ParentModel,             parentFieldBool,        "parent_bool");
+                    JSON_MEMBER_INT(          ParentModel,             parentFieldInt,         "parent_int");
+                    JSON_MEMBER_FLOAT(        ParentModel,             parentFieldFloat,       "parent_float");
+                    JSON_MEMBER_STRING(       ParentModel,             parentFieldString,      "parent_string");
+                    JSON_MEMBER_OBJECT(       ParentModel, ChildModel, parentFieldChild,       "parent_child");
+                    JSON_MEMBER_ARRAY_INT(    ParentModel,             parentFieldIntArray,    "int_vector_name");
+                    JSON_MEMBER_ARRAY_STRING( ParentModel,             parentFieldStringArray, "str_vector_name");
+                    JSON_MEMBER_ARRAY_OBJECT( ParentModel, ChildModel, parentFieldChildArray,  "child_vector_name");
+                    JSON_MEMBER_INT(          ParentModel,             parentFieldDeep,        "parent_child/child_int");
+                };
+
+                static_assert(json_record<ParentModel>::num_fields == 9, "every member is in the field list");
+                static_assert(json_record<ChildModel>::num_fields == 1, "every member is in the field list");
+
+                // wrong types, duplicate keys and unknown keys are handled as by the getters
+                ParentModel parentModel;
+                parentModel.set_pointer(json::parse(R"({"parent_bool":true, "parent_int":"7", "parent_float":2.5,
+                    "parent_string":"a \"quoted\" name", "parent_child":{"child_int":42}, "int_vector_name":[1, "x", 3],
+                    "str_vector_name":["a", 1, "b"], "child_vector_name":[{"child_int":1}, 5, {"child_int":2}],
+                    "parent_float":9.5, "unknown":[1, 2, 3]})"));
+
+                const json_record<ParentModel> r = json_binding::decode(parentModel);
+                ASSERT_TRUE(r.get<ParentModel::parentFieldBool_field>() == parentModel.parentFieldBool());
+                ASSERT_TRUE(r.get<ParentModel::parentFieldInt_field>() == parentModel.parentFieldInt());
+                ASSERT_TRUE(r.get<ParentModel::parentFieldFloat_field>() == parentModel.parentFieldFloat());
+                ASSERT_TRUE(r.get<ParentModel::parentFieldFloat_field>() == 2.5);
+                ASSERT_TRUE(r.get<ParentModel::parentFieldString_field>() == parentModel.parentFieldString());
+                ASSERT_TRUE(r.get<ParentModel::parentFieldChild_field>().get<ChildModel::childFieldInt_field>() == 42);
+                ASSERT_TRUE(r.get<ParentModel::parentFieldIntArray_field>() == parentModel.parentFieldIntArray());
+                ASSERT_TRUE(r.get<ParentModel::parentFieldStringArray_field>() == parentModel.parentFieldStringArray());
+                ASSERT_TRUE(r.get<ParentModel::parentFieldChildArray_field>().size() == 2);
+                ASSERT_TRUE(r.get<ParentModel::parentFieldChildArray_field>()[1].get<0>() == 2);
+                ASSERT_TRUE(r.get<8>() == 42 && parentModel.parentFieldDeep() == 42);
+                ASSERT_TRUE(std::string(json_record<ParentModel>::name<3>()) == "parent_string");
+
+                // the single pass encoder writes the same text as a model built by the setters
+                json_record<ParentModel> r2 = r;
+                r2.get<ParentModel::parentFieldInt_field>() = -5;
+                const ParentModel encoded = r2.to_model();
+                ASSERT_TRUE(encoded.parentFieldInt() == -5);
+                ASSERT_TRUE(encoded.parentFieldString() == "a \"quoted\" name");
+                ASSERT_TRUE(encoded.parentFieldChildArray().size() == 2);
+                ASSERT_TRUE(r2.to_json() == encoded.toJSON());
+                ASSERT_TRUE(json_binding::decode(encoded).to_json() == r2.to_json());
+
+                // a model without a document decodes to the defaults
+                json_record<ParentModel> empty;
+                ParentModel emptyModel;
+                emptyModel.set_pointer(nullptr);
+                ASSERT_FALSE(empty.decode(emptyModel));
+                ASSERT_TRUE(empty.get<ParentModel::parentFieldString_field>().empty());
+            });
+
+            add_test("benchmark: getters vs typed binding", [](std::shared_ptr<unit_test_input_base> input) {
+                class RecordModel : public json_model
+                {
+                public:
+                    JSON_MEMBER_INT(    RecordModel, f01, "f01");
+                    JSON_MEMBER_INT(    RecordModel, f02, "f02");
+                    JSON_MEMBER_INT(    RecordModel, f03, "f03");
+                    JSON_MEMBER_INT(    RecordModel, f04, "f04");
+                    JSON_MEMBER_INT(    RecordModel, f05, "f05");
+                    JSON_MEMBER_FLOAT(  RecordModel, f06, "f06");
+                    JSON_MEMBER_FLOAT(  RecordModel, f07, "f07");
+                    JSON_MEMBER_FLOAT(  RecordModel, f08, "f08");
+                    JSON_MEMBER_FLOAT(  RecordModel, f09, "f09");
+                    JSON_MEMBER_FLOAT(  RecordModel, f10, "f10");
+                    JSON_MEMBER_STRING( RecordModel, f11, "f11");
+                    JSON_MEMBER_STRING( RecordModel, f12, "f12");
+                    JSON_MEMBER_STRING( RecordModel, f13, "f13");
+                    JSON_MEMBER_STRING( RecordModel, f14, "f14");
+                    JSON_MEMBER_STRING( RecordModel, f15, "f15");
+                    JSON_MEMBER_BOOL(   RecordModel, f16, "f16");
+                    JSON_MEMBER_BOOL(   RecordModel, f17, "f17");
+                    JSON_MEMBER_BOOL(   RecordModel, f18, "f18");
+                    JSON_MEMBER_BOOL(   RecordModel, f19, "f19");
+                    JSON_MEMBER_BOOL(   RecordModel, f20, "f20");
+                };
+
+                RecordModel model;
+                model.f01(1).f02(2).f03(3).f04(4).f05(5);
+                model.f06(6.5).f07(7.5).f08(8.5).f09(9.5).f10(10.5);
+                model.f11("eleven").f12("twelve").f13("thirteen").f14("fourteen").f15("fifteen");
+                model.f16(true).f17(false).f18(true).f19(false).f20(true);
+
+                size_t by_getters = 0;
+                size_t by_record = 0;
+
+                {
+                    benchmark b("json_model 1000 reads of 20 fields by getters");
+                    for (size_t i = 0; i < 1000; ++i)
+                        by_getters += static_cast<size_t>(model.f01() + model.f02() + model.f03() + model.f04() + model.f05()) +
+                                      static_cast<size_t>(model.f06() + model.f07() + model.f08() + model.f09() + model.f10()) +
+                                      model.f11().size() + model.f12().size() + model.f13().size() + model.f14().size() + model.f15().size() +
+                                      model.f16() + model.f17() + model.f18() + model.f19() + model.f20();
+                }
+
+                {
+                    benchmark b("json_model 1000 reads of 20 fields by json_record");
+                    json_record<RecordModel> r;
+                    for (size_t i = 0; i < 1000; ++i)
+                    {
+                        r.decode(model);
+                        by_record += static_cast<size_t>(r.get<0>() + r.get<1>() + r.get<2>() + r.get<3>() + r.get<4>()) +
+                                     static_cast<size_t>(r.get<5>() + r.get<6>() + r.get<7>() + r.get<8>() + r.get<9>()) +
+                                     r.get<10>().size() + r.get<11>().size() + r.get<12>().size() + r.get<13>().size() + r.get<14>().size() +
+                                     r.get<15>() + r.get<16>() + r.get<17>() + r.get<18>() + r.get<19>();
+                    }
+                }
+
+                ASSERT_TRUE(by_getters == by_record);
+            });
         }
     }; // class test_serializable
 
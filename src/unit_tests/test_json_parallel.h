@@ -0,0 +1,172 @@
+#pragma once
+
+//
+// test_json_parallel.h - Unit tests for json_parallel.h.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "unit_test_base.h"
+
+#include "../benchmark.h"
+#include "../platform_defs.h"
+
+#include "../json.h"
+#include "../json_parallel.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE(4100, "-Wunused-parameter")
+
+namespace rda
+{
+    class test_json_parallel : public unit_test_base
+    {
+    protected:
+        // data structure of inputs that can be re-used by each unit test
+        struct unit_test_input_json_parallel : public unit_test_input_base
+        {
+            // small arrays, split into many chunks in the tests, that are not all well formed
+            std::vector<std::string> documents = {
+                R"([1, "two", [3, 4], {"five" : 5}, null, true, 6.5, "x,y]", "q\"[", "b\\", {"a":[1,{"b":"]"}]}, 7])",
+                R"(  [ , 1 , , 2 , "three" , ] )",
+                R"([1, "unterminated, [2, 3], 4, 5, 6, 7])",
+                R"([1, ab"cd, "e", f"g, 2, 3, 4, 5])",
+                R"([1, 2, 3, {"open" : [4, 5, 6, 7, 8, 9)",
+                R"([1, 2], 3, 4, 5, 6, 7)",
+                R"([])",
+                R"([1])",
+            };
+
+            // an array of many records
+            std::string large;
+
+            unit_test_input_json_parallel()
+            {
+                std::stringstream ss;
+                ss << "[";
+                for (size_t i = 0; i < 20000; ++i)
+                    ss << (i == 0 ? "" : ",") << "{ \"id\" : " << i << ", \"symbol\" : \"S,Y]M\\\"" << i % 100
+                       << "\", \"price\" : " << i << ".25, \"active\" : " << (i % 2 ? "true" : "false")
+                       << ", \"tags\" : [\"a\", \"b\", [" << i << "]] }";
+                ss << "]";
+                large = ss.str();
+            }
+        };
+
+        // returns the name of the module that is being tested
+        std::string get_test_module_name() const override
+        {
+            return "test_json_parallel";
+        }
+
+        // create and return the data structure of input to be provided to each test
+        std::shared_ptr<unit_test_input_base> create_test_input(const size_t testNum, const std::string &description) override
+        {
+            return std::make_shared<unit_test_input_json_parallel>();
+        }
+
+        // adds all of the tests that will be run
+        void create_tests() override
+        {
+            add_test("same tree as parse_array", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_parallel>(input);
+
+                for (const auto &document : pInput->documents)
+                {
+                    const std::string expected = json::parse_array(document)->to_string();
+
+                    for (size_t threads = 1; threads <= 8; ++threads)
+                    {
+                        json::parallel_parser p(threads, 1);
+                        const auto arr = p.parse_array(document);
+                        ASSERT_TRUE(arr != nullptr);
+                        ASSERT_EQUAL(arr->to_string(), expected);
+                    }
+                }
+
+                const auto expected = json::parse_array(pInput->large);
+                json::parallel_parser p(4, 1024);
+                const auto arr = p.parse_array(pInput->large);
+
+                ASSERT_TRUE(p.get_stats().chunks == 4);
+                ASSERT_FALSE(p.get_stats().fallback);
+                ASSERT_TRUE(arr->size() == 20000);
+                ASSERT_EQUAL(arr->to_string(), expected->to_string());
+                ASSERT_TRUE(json::get_value_integer((*std::dynamic_pointer_cast<json::node_object>((*arr)[12345]))["id"]) == 12345);
+
+                // a start index after some leading text
+                const std::string prefixed = "xyz" + pInput->documents[0];
+                ASSERT_EQUAL(p.parse_array(prefixed, 3)->to_string(), json::parse_array(pInput->documents[0])->to_string());
+
+                ASSERT_TRUE(p.parse_array("{}") == nullptr);
+                ASSERT_TRUE(p.parse_array("") == nullptr);
+                ASSERT_TRUE(json::parse_array_parallel(pInput->large, 2)->size() == 20000);
+            });
+
+            add_test("chunks and fallback", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_parallel>(input);
+
+                // small input is parsed by one thread
+                json::parallel_parser p(4);
+                ASSERT_TRUE(p.get_num_threads() == 4);
+                p.parse_array(pInput->documents[0]);
+                ASSERT_TRUE(p.get_stats().chunks == 1);
+
+                // splits are only made between elements of the top level array
+                const std::string text = pInput->documents[0];
+                for (const size_t split : json::parallel_helpers::find_split_points(text, 1, 12))
+                {
+                    ASSERT_TRUE(text[split - 1] == ',');
+                    ASSERT_TRUE(text.substr(split, 2) != "y]");
+                }
+                ASSERT_TRUE(json::parallel_helpers::find_split_points(text, 1, 100).size() == 11);
+
+                // a quote inside an unquoted token is not the start of a string to the parser,
+                // so the scan splits inside a string, the chunks do not line up, and the input
+                // is parsed serially
+                const std::string mismatched = R"([a"b, "c, d, e, f, g, h, i"])";
+                json::parallel_parser small(4, 1);
+                ASSERT_EQUAL(small.parse_array(mismatched)->to_string(), json::parse_array(mismatched)->to_string());
+                ASSERT_TRUE(small.get_stats().chunks == 4);
+                ASSERT_TRUE(small.get_stats().fallback);
+                ASSERT_TRUE(json::parse_array(mismatched)->size() == 2);
+
+                ASSERT_TRUE(json::parallel_parser(0).get_num_threads() >= 1);
+            });
+
+            add_test("benchmark: serial vs parallel parse_array", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_parallel>(input);
+
+                std::shared_ptr<json::node_array> serial;
+                std::shared_ptr<json::node_array> parallel;
+
+                {
+                    benchmark b("json parse_array (serial)");
+                    serial = json::parse_array(pInput->large);
+                }
+
+                json::parallel_parser p(4, 16 * 1024);
+
+                {
+                    benchmark b("json parallel_parser parse_array (4 threads)");
+                    parallel = p.parse_array(pInput->large);
+                }
+
+                ASSERT_FALSE(p.get_stats().fallback);
+                ASSERT_TRUE(parallel->size() == serial->size());
+                ASSERT_EQUAL(parallel->to_string(), serial->to_string());
+            });
+        }
+
+    }; // class test_json_parallel
+
+} // namespace rda
+
+POP_WARN_DISABLE
@@ -0,0 +1,216 @@
+#pragma once
+
+//
+// test_json_patch.h - Unit tests for json_patch.h.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "unit_test_base.h"
+
+#include "../platform_defs.h"
+
+#include "../json.h"
+#include "../json_patch.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE(4100, "-Wunused-parameter")
+
+namespace rda
+{
+    class test_json_patch : public unit_test_base
+    {
+    protected:
+        // data structure of inputs that can be re-used by each unit test
+        struct unit_test_input_json_patch : public unit_test_input_base
+        {
+            std::string config = R"({ "name" : "server", "ports" : [80, 443], "limits" : { "cpu" : 2, "memory" : 512 }, "tags" : { "env" : "prod" } })";
+
+            // returns the compact text of the patched document, or "null" if the patch failed
+            static std::string run(const std::string &document, const std::string &patch_text)
+            {
+                const auto result = json::apply_patch(json::parse(document), patch_text);
+                return (result == nullptr ? "null" : result->to_string());
+            }
+
+            // returns the compact text of the document merged with a merge patch
+            static std::string merge(const std::string &document, const std::string &merge_patch_text)
+            {
+                const auto result = json::apply_merge_patch(json::parse(document), merge_patch_text);
+                return (result == nullptr ? "null" : result->to_string());
+            }
+        };
+
+        // returns the name of the module that is being tested
+        std::string get_test_module_name() const override
+        {
+            return "test_json_patch";
+        }
+
+        // create and return the data structure of input to be provided to each test
+        std::shared_ptr<unit_test_input_base> create_test_input(const size_t testNum, const std::string &description) override
+        {
+            return std::make_shared<unit_test_input_json_patch>();
+        }
+
+        // adds all of the tests that will be run
+        void create_tests() override
+        {
+            add_test("json patch operations", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_patch>(input);
+
+                // add
+                ASSERT_EQUAL(pInput->run(R"({"foo":"bar"})", R"([{"op":"add","path":"/baz","value":"qux"}])"), std::string(R"({"foo":"bar","baz":"qux"})"));
+                ASSERT_EQUAL(pInput->run(R"({"foo":["bar","baz"]})", R"([{"op":"add","path":"/foo/1","value":"qux"}])"), std::string(R"({"foo":["bar","qux","baz"]})"));
+                ASSERT_EQUAL(pInput->run(R"({"foo":[1]})", R"([{"op":"add","path":"/foo/-","value":[2]}])"), std::string(R"({"foo":[1,[2]]})"));
+                ASSERT_EQUAL(pInput->run(R"({"foo":[1]})", R"([{"op":"add","path":"/foo/1","value":2}])"), std::string(R"({"foo":[1,2]})"));
+                ASSERT_EQUAL(pInput->run(R"({"foo":1})", R"([{"op":"add","path":"/foo","value":{"a":1}}])"), std::string(R"({"foo":{"a":1}})"));
+                ASSERT_EQUAL(pInput->run(R"({"foo":1})", R"([{"op":"add","path":"","value":{"a":1}}])"), std::string(R"({"a":1})"));
+                ASSERT_EQUAL(pInput->run(R"({"a/b":{}})", R"([{"op":"add","path":"/a~1b/m~0n","value":true}])"), std::string(R"({"a/b":{"m~n":true}})"));
+
+                // remove
+                ASSERT_EQUAL(pInput->run(R"({"baz":"qux","foo":"bar"})", R"([{"op":"remove","path":"/baz"}])"), std::string(R"({"foo":"bar"})"));
+                ASSERT_EQUAL(pInput->run(R"({"foo":["bar","qux","baz"]})", R"([{"op":"remove","path":"/foo/1"}])"), std::string(R"({"foo":["bar","baz"]})"));
+
+                // replace
+                ASSERT_EQUAL(pInput->run(R"({"baz":"qux","foo":"bar"})", R"([{"op":"replace","path":"/baz","value":"boo"}])"), std::string(R"({"baz":"boo","foo":"bar"})"));
+                ASSERT_EQUAL(pInput->run(R"({"a":[1,2]})", R"([{"op":"replace","path":"/a/0","value":null}])"), std::string(R"({"a":[null,2]})"));
+
+                // move
+                ASSERT_EQUAL(pInput->run(R"({"foo":{"bar":"baz","waldo":"fred"},"qux":{"corge":"grault"}})", R"([{"op":"move","from":"/foo/waldo","path":"/qux/thud"}])"),
+                             std::string(R"({"foo":{"bar":"baz"},"qux":{"corge":"grault","thud":"fred"}})"));
+                ASSERT_EQUAL(pInput->run(R"({"foo":["all","grass","cows","eat"]})", R"([{"op":"move","from":"/foo/1","path":"/foo/3"}])"),
+                             std::string(R"({"foo":["all","cows","eat","grass"]})"));
+                ASSERT_EQUAL(pInput->run(R"({"a":1})", R"([{"op":"move","from":"/a","path":"/a"}])"), std::string(R"({"a":1})"));
+
+                // copy
+                ASSERT_EQUAL(pInput->run(R"({"a":{"b":[1,2]}})", R"([{"op":"copy","from":"/a/b","path":"/c"}])"), std::string(R"({"a":{"b":[1,2]},"c":[1,2]})"));
+
+                // test
+                ASSERT_EQUAL(pInput->run(R"({"baz":"qux","foo":["a",2,"c"]})", R"([{"op":"test","path":"/baz","value":"qux"},{"op":"test","path":"/foo/1","value":2}])"),
+                             std::string(R"({"baz":"qux","foo":["a",2,"c"]})"));
+                ASSERT_EQUAL(pInput->run(R"({"a":{"x":1,"y":[2.0]}})", R"([{"op":"test","path":"/a","value":{"y":[2],"x":1.0}}])"), std::string(R"({"a":{"x":1,"y":[2.000000]}})"));
+                ASSERT_EQUAL(pInput->run(R"({"baz":"qux"})", R"([{"op":"test","path":"/baz","value":"bar"}])"), std::string("null"));
+                ASSERT_EQUAL(pInput->run(R"({"/":9,"~1":10})", R"([{"op":"test","path":"/~01","value":10}])"), std::string(R"({"/":9,"~1":10})"));
+
+                // operations that fail
+                ASSERT_EQUAL(pInput->run(R"({"foo":"bar"})", R"([{"op":"add","path":"/baz/bat","value":"qux"}])"), std::string("null"));
+                ASSERT_EQUAL(pInput->run(R"({"foo":[1]})", R"([{"op":"add","path":"/foo/2","value":2}])"), std::string("null"));
+                ASSERT_EQUAL(pInput->run(R"({"foo":[1]})", R"([{"op":"add","path":"/foo/x","value":2}])"), std::string("null"));
+                ASSERT_EQUAL(pInput->run(R"({"foo":"bar"})", R"([{"op":"remove","path":"/baz"}])"), std::string("null"));
+                ASSERT_EQUAL(pInput->run(R"({"foo":"bar"})", R"([{"op":"remove","path":""}])"), std::string("null"));
+                ASSERT_EQUAL(pInput->run(R"({"foo":"bar"})", R"([{"op":"replace","path":"/baz","value":1}])"), std::string("null"));
+                ASSERT_EQUAL(pInput->run(R"({"a":{"b":1}})", R"([{"op":"move","from":"/a","path":"/a/c"}])"), std::string("null"));
+                ASSERT_EQUAL(pInput->run(R"({"a":1})", R"([{"op":"copy","from":"/b","path":"/c"}])"), std::string("null"));
+                ASSERT_EQUAL(pInput->run(R"({"a":1})", R"([{"op":"replace","path":"","value":[1]}])"), std::string("null"));
+
+                // mal-formed patches
+                for (const std::string text : { R"({"op":"add"})", R"([{"op":"nop","path":"/a"}])", R"([{"path":"/a"}])",
+                                                R"([{"op":"add","path":"a","value":1}])", R"([{"op":"add","path":"/a"}])",
+                                                R"([{"op":"move","path":"/a"}])", R"([{"op":"remove","path":"/a~2"}])", R"([1])" })
+                {
+                    ASSERT_FALSE(json::patch(text).is_valid());
+                    ASSERT_EQUAL(pInput->run(R"({"a":1})", text), std::string("null"));
+                }
+
+                const json::patch p(R"([{"op":"add","path":"/a","value":1},{"op":"remove","path":"/b"}])");
+                ASSERT_TRUE(p.is_valid());
+                ASSERT_TRUE(p.get_operations().size() == 2);
+                ASSERT_TRUE(p.get_operations()[1].op == json::patch_op::PO_REMOVE);
+            });
+
+            add_test("json patch is atomic", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_patch>(input);
+                const auto doc = json::parse(pInput->config);
+                const std::string before = doc->to_string();
+
+                // the second operation fails, so the first is not applied either
+                const json::patch p(R"([{"op":"replace","path":"/name","value":"client"},{"op":"remove","path":"/missing"},{"op":"add","path":"/x","value":1}])");
+                size_t failed = 0;
+                ASSERT_TRUE(p.is_valid());
+                ASSERT_TRUE(p.apply(doc, &failed) == nullptr);
+                ASSERT_TRUE(failed == 1);
+                ASSERT_EQUAL(doc->to_string(), before);
+
+                // a successful patch leaves the old version as it was, too
+                const json::patch ok(R"([{"op":"replace","path":"/name","value":"client"},{"op":"remove","path":"/ports/0"}])");
+                const auto updated = ok.apply(doc, &failed);
+                ASSERT_TRUE(updated != nullptr);
+                ASSERT_TRUE(failed == json::patch::NO_FAILURE);
+                ASSERT_EQUAL(doc->to_string(), before);
+                ASSERT_EQUAL(updated->to_string(), std::string(R"({"name":"client","ports":[443],"limits":{"cpu":2,"memory":512},"tags":{"env":"prod"}})"));
+            });
+
+            add_test("json merge patch", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_patch>(input);
+
+                // examples from RFC 7386, with an object as the target
+                ASSERT_EQUAL(pInput->merge(R"({"a":"b"})", R"({"a":"c"})"), std::string(R"({"a":"c"})"));
+                ASSERT_EQUAL(pInput->merge(R"({"a":"b"})", R"({"b":"c"})"), std::string(R"({"a":"b","b":"c"})"));
+                ASSERT_EQUAL(pInput->merge(R"({"a":"b"})", R"({"a":null})"), std::string(R"({})"));
+                ASSERT_EQUAL(pInput->merge(R"({"a":"b","b":"c"})", R"({"a":null})"), std::string(R"({"b":"c"})"));
+                ASSERT_EQUAL(pInput->merge(R"({"a":["b"]})", R"({"a":"c"})"), std::string(R"({"a":"c"})"));
+                ASSERT_EQUAL(pInput->merge(R"({"a":"c"})", R"({"a":["b"]})"), std::string(R"({"a":["b"]})"));
+                ASSERT_EQUAL(pInput->merge(R"({"a":{"b":"c"}})", R"({"a":{"b":"d","c":null}})"), std::string(R"({"a":{"b":"d"}})"));
+                ASSERT_EQUAL(pInput->merge(R"({"a":[{"b":"c"}]})", R"({"a":[1]})"), std::string(R"({"a":[1]})"));
+                ASSERT_EQUAL(pInput->merge(R"({"e":null})", R"({"a":1})"), std::string(R"({"e":null,"a":1})"));
+                ASSERT_EQUAL(pInput->merge(R"({})", R"({"a":{"bb":{"ccc":null}}})"), std::string(R"({"a":{"bb":{}}})"));
+
+                // several removals and additions together
+                ASSERT_EQUAL(pInput->merge(pInput->config, R"({"name":null,"limits":{"cpu":4,"disk":10},"tags":null,"ports":[8080]})"),
+                             std::string(R"({"ports":[8080],"limits":{"cpu":4,"memory":512,"disk":10}})"));
+
+                // a patch that is not an object can not be merged into an object
+                ASSERT_EQUAL(pInput->merge(R"({"a":1})", "[1]"), std::string("null"));
+                ASSERT_TRUE(json::apply_merge_patch(json::parse(R"({"a":1})"), std::make_shared<json::node_integer>("", 1)) == nullptr);
+            });
+
+            add_test("structural sharing", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_patch>(input);
+                const auto doc = json::parse(pInput->config);
+
+                // only the path to the change is new
+                const auto v2 = json::apply_patch(doc, R"([{"op":"replace","path":"/limits/cpu","value":8}])");
+                ASSERT_TRUE(v2 != nullptr && v2 != doc);
+                ASSERT_TRUE((*v2)["limits"] != (*doc)["limits"]);
+                ASSERT_TRUE((*v2)["ports"] == (*doc)["ports"]);
+                ASSERT_TRUE((*v2)["tags"] == (*doc)["tags"]);
+                ASSERT_TRUE((*v2)["name"] == (*doc)["name"]);
+                ASSERT_TRUE(json::get_value_integer((*std::dynamic_pointer_cast<json::node_object>((*doc)["limits"]))["cpu"]) == 2);
+                ASSERT_TRUE(json::get_value_integer((*std::dynamic_pointer_cast<json::node_object>((*v2)["limits"]))["cpu"]) == 8);
+
+                // a copy shares the sub-tree it was copied from (only a node with the new key
+                // name is made, if the key name changes)
+                const auto v3 = json::apply_patch(v2, R"([{"op":"copy","from":"/ports","path":"/tags/ports"},{"op":"copy","from":"/ports","path":"/limits/p"}])");
+                const auto tags = std::dynamic_pointer_cast<json::node_object>((*v3)["tags"]);
+                const auto limits = std::dynamic_pointer_cast<json::node_object>((*v3)["limits"]);
+                ASSERT_TRUE((*tags)["ports"] == (*v2)["ports"]);
+                ASSERT_TRUE((*limits)["p"] != (*v2)["ports"]);
+                ASSERT_TRUE(std::dynamic_pointer_cast<json::node_array>((*limits)["p"])->get_data()[0] ==
+                            std::dynamic_pointer_cast<json::node_array>((*v2)["ports"])->get_data()[0]);
+                ASSERT_TRUE((*v3)["name"] == (*doc)["name"]);
+
+                // a merge patch shares what it does not change, and changes nothing when the
+                // values are already equal
+                const auto v4 = json::apply_merge_patch(doc, std::string(R"({"tags":{"team":"core"}})"));
+                ASSERT_TRUE((*v4)["limits"] == (*doc)["limits"]);
+                ASSERT_TRUE((*v4)["ports"] == (*doc)["ports"]);
+                ASSERT_TRUE((*v4)["tags"] != (*doc)["tags"]);
+                ASSERT_EQUAL(v4->to_string(), std::string(R"({"name":"server","ports":[80,443],"limits":{"cpu":2,"memory":512},"tags":{"env":"prod","team":"core"}})"));
+
+                ASSERT_TRUE(json::apply_merge_patch(doc, std::string(R"({"name":"server","limits":{"cpu":2}})")) == doc);
+                ASSERT_TRUE(json::apply_patch(doc, R"([{"op":"test","path":"/name","value":"server"}])") == doc);
+            });
+        }
+
+    }; // class test_json_patch
+
+} // namespace rda
+
+POP_WARN_DISABLE
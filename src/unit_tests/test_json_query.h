@@ -0,0 +1,215 @@
+#pragma once
+
+//
+// test_json_query.h - Unit tests for json_query.h.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "unit_test_base.h"
+
+#include "../benchmark.h"
+#include "../platform_defs.h"
+
+#include "../json.h"
+#include "../json_query.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE(4100, "-Wunused-parameter")
+
+namespace rda
+{
+    class test_json_query : public unit_test_base
+    {
+    protected:
+        // data structure of inputs that can be re-used by each unit test
+        struct unit_test_input_json_query : public unit_test_input_base
+        {
+            std::string store = R"(
+{
+  "store": {
+    "book": [
+      { "category": "reference", "author": "Nigel Rees", "title": "Sayings of the Century", "price": 8.95 },
+      { "category": "fiction", "author": "Evelyn Waugh", "title": "Sword of Honour", "price": 12.99 },
+      { "category": "fiction", "author": "Herman Melville", "title": "Moby Dick", "isbn": "0-553-21311-3", "price": 8.99 },
+      { "category": "fiction", "author": "J. R. R. Tolkien", "title": "The Lord of the Rings", "isbn": "0-395-19395-8", "price": 22 }
+    ],
+    "bicycle": { "color": "red", "price": 19.95, "in stock": true }
+  },
+  "a/b": 1,
+  "m~n": 2,
+  "nested": { "price": { "price": 3 } }
+}
+)";
+
+            // returns the compact text of each node, joined by spaces
+            static std::string join(const std::vector<std::shared_ptr<json::node>> &nodes)
+            {
+                std::string s;
+                for (const auto &n : nodes)
+                    s += (s.empty() ? "" : " ") + n->to_string();
+                return s;
+            }
+        };
+
+        // returns the name of the module that is being tested
+        std::string get_test_module_name() const override
+        {
+            return "test_json_query";
+        }
+
+        // create and return the data structure of input to be provided to each test
+        std::shared_ptr<unit_test_input_base> create_test_input(const size_t testNum, const std::string &description) override
+        {
+            return std::make_shared<unit_test_input_json_query>();
+        }
+
+        // adds all of the tests that will be run
+        void create_tests() override
+        {
+            add_test("jsonpath", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_query>(input);
+                const auto root = json::parse(pInput->store);
+
+                const auto run = [&](const std::string &text) { return pInput->join(json::select(root, text)); };
+
+                ASSERT_EQUAL(run("$.store.bicycle.color"), std::string(R"("color":"red")"));
+                ASSERT_EQUAL(run("$['store']['bicycle']['in stock']"), std::string(R"("in stock":true)"));
+                ASSERT_EQUAL(run("$.store.book[1].author"), std::string(R"("author":"Evelyn Waugh")"));
+                ASSERT_EQUAL(run("$.store.book[-1].price"), std::string(R"("price":22)"));
+                ASSERT_EQUAL(run("$.store.book[4]"), std::string());
+                ASSERT_EQUAL(run("$.store.book[-5]"), std::string());
+                ASSERT_EQUAL(run("$.store.book[*].isbn"), std::string(R"("isbn":"0-553-21311-3" "isbn":"0-395-19395-8")"));
+                ASSERT_EQUAL(run("$.store.*.color"), std::string(R"("color":"red")"));
+                ASSERT_EQUAL(run("$..author"), std::string(R"("author":"Nigel Rees" "author":"Evelyn Waugh" "author":"Herman Melville" "author":"J. R. R. Tolkien")"));
+                ASSERT_TRUE(json::select(root, "$..price").size() == 7);
+                ASSERT_EQUAL(run("$.nested..price"), std::string(R"("price":{"price":3} "price":3)"));
+                ASSERT_EQUAL(run("$..book[2].title"), std::string(R"("title":"Moby Dick")"));
+                ASSERT_EQUAL(run("$..[0].category"), std::string(R"("category":"reference")"));
+                ASSERT_TRUE(json::select(root, "$").size() == 1);
+                ASSERT_TRUE(json::select(root, "$.store.*").size() == 2);
+                ASSERT_TRUE(json::select(root, "$..*").size() == 33);
+
+                // filters
+                ASSERT_EQUAL(run("$.store.book[?(@.price < 10)].title"), std::string(R"("title":"Sayings of the Century" "title":"Moby Dick")"));
+                ASSERT_EQUAL(run("$.store.book[?(@.isbn)].price"), std::string(R"("price":8.990000 "price":22)"));
+                ASSERT_EQUAL(run("$.store.book[?(@.category == 'fiction' && @.price >= 12.99)].author"), std::string(R"("author":"Evelyn Waugh" "author":"J. R. R. Tolkien")"));
+                ASSERT_EQUAL(run("$.store.book[?(@.price == 22 || @.author == \"Nigel Rees\")].price"), std::string(R"("price":8.950000 "price":22)"));
+                ASSERT_EQUAL(run("$.store.book[?(@.category != 'fiction')].title"), std::string(R"("title":"Sayings of the Century")"));
+                ASSERT_EQUAL(run("$..[?(@['in stock'] == true)].color"), std::string(R"("color":"red")"));
+                ASSERT_EQUAL(run("$..book[?(@.price > 'a')]"), std::string());
+                ASSERT_EQUAL(run("$.store.book[*].price[?(@ > 1)]"), std::string());
+                ASSERT_EQUAL(run("$..*[?(@ >= 19.95)]"), std::string(R"("price":22 "price":19.950000)"));
+            });
+
+            add_test("json pointer", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_query>(input);
+                const auto root = json::parse(pInput->store);
+
+                const auto run = [&](const std::string &text) { return pInput->join(json::select(root, text)); };
+
+                ASSERT_EQUAL(run("/store/book/0/title"), std::string(R"("title":"Sayings of the Century")"));
+                ASSERT_EQUAL(run("/store/bicycle/in stock"), std::string(R"("in stock":true)"));
+                ASSERT_EQUAL(run("/a~1b"), std::string(R"("a/b":1)"));
+                ASSERT_EQUAL(run("/m~0n"), std::string(R"("m~n":2)"));
+                ASSERT_EQUAL(run("/store/book/01"), std::string());
+                ASSERT_EQUAL(run("/store/book/4"), std::string());
+                ASSERT_TRUE(json::select(root, "").size() == 1);
+
+                // invalid queries select nothing
+                for (const std::string text : { "store", "$.", "$[", "$[1", "$['a]", "$[?(@.a ==)]", "$[?(a)]", "$x", "/a~2", "$.a..", "$[99999999999999999999]" })
+                {
+                    const json::query q(text);
+                    ASSERT_FALSE(q.is_valid());
+                    ASSERT_TRUE(q.evaluate(root).empty());
+                    ASSERT_TRUE(q.evaluate(pInput->store).empty());
+                }
+
+                const json::query q("$.store.book[*].author");
+                ASSERT_TRUE(q.is_valid());
+                ASSERT_TRUE(q.get_segments().size() == 4);
+                ASSERT_EQUAL(q.evaluate_first(root)->to_string(), std::string(R"("author":"Nigel Rees")"));
+                ASSERT_TRUE(q.evaluate(root, 2).size() == 2);
+                ASSERT_TRUE(json::query("$.missing").evaluate_first(root) == nullptr);
+            });
+
+            add_test("streaming evaluation", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_query>(input);
+                const auto root = json::parse(pInput->store);
+
+                // reading the text selects the same nodes as evaluating the tree
+                for (const std::string text : { "$.store.bicycle.color", "$.store.book[1]", "$.store.book[-1].price",
+                                                "$.store.book[*].isbn", "$..author", "$..price", "$.nested..price", "$..*",
+                                                "$", "$.store.book[?(@.price < 10)].title", "$..[?(@.price > 10)]",
+                                                "$..book[-2]", "/store/book/2", "", "$..[0].category", "$.store.*" })
+                {
+                    const json::query q(text);
+                    ASSERT_EQUAL(pInput->join(q.evaluate(pInput->store)), pInput->join(q.evaluate(root)));
+
+                    std::stringstream ss(pInput->store);
+                    ASSERT_EQUAL(pInput->join(q.evaluate(ss, 0, 7)), pInput->join(q.evaluate(root)));
+                }
+
+                ASSERT_EQUAL(json::query("$.store.book[*].author").evaluate_first(pInput->store)->to_string(),
+                             std::string(R"("author":"Nigel Rees")"));
+
+                // a handler can be fed a document in pieces, and reset for the next one
+                const json::query q("$..isbn");
+                json::query_handler handler(q.get_segments());
+                json::sax_reader reader(handler);
+                for (const char c : pInput->store)
+                    reader.feed(std::string_view(&c, 1));
+                reader.finish();
+                ASSERT_TRUE(handler.get_results().size() == 2);
+
+                handler.reset();
+                reader.reset();
+                json::parse_sax(std::string_view("[{\"isbn\":1}]"), handler);
+                ASSERT_EQUAL(pInput->join(handler.get_results()), std::string(R"("isbn":1)"));
+
+                // malformed input selects what the tree built from it would
+                const std::string malformed = R"({"a" "b", "c" : [1, 2, {"d" : 3}, "e" : 4 )";
+                for (const std::string text : { "$..*", "$.c[2].d", "$.c[-1]" })
+                    ASSERT_EQUAL(pInput->join(json::query(text).evaluate(malformed)), pInput->join(json::select(json::parse(malformed), text)));
+            });
+
+            add_test("benchmark: parse and query vs streaming query", [](std::shared_ptr<unit_test_input_base> input) {
+                std::stringstream ss;
+                ss << "{ \"records\" : [";
+                for (size_t i = 0; i < 20000; ++i)
+                    ss << (i == 0 ? "" : ",") << "{ \"id\" : " << i << ", \"symbol\" : \"SYM" << i % 100
+                       << "\", \"price\" : " << i << ".25, \"tags\" : [\"a\", \"b\"], \"detail\" : { \"x\" : [1, 2, 3] } }";
+                ss << "], \"summary\" : { \"count\" : 20000 } }";
+                const std::string text = ss.str();
+
+                const json::query q("$.summary.count");
+                std::vector<std::shared_ptr<json::node>> from_tree;
+                std::vector<std::shared_ptr<json::node>> from_stream;
+
+                {
+                    benchmark b("json query: parse the document, then evaluate");
+                    from_tree = q.evaluate(json::parse(text));
+                }
+
+                {
+                    benchmark b("json query: streaming evaluation");
+                    from_stream = q.evaluate(text);
+                }
+
+                ASSERT_TRUE(from_tree.size() == 1 && from_stream.size() == 1);
+                ASSERT_EQUAL(from_stream[0]->to_string(), from_tree[0]->to_string());
+            });
+        }
+
+    }; // class test_json_query
+
+} // namespace rda
+
+POP_WARN_DISABLE
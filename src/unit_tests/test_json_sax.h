@@ -0,0 +1,353 @@
+#pragma once
+
+//
+// test_json_sax.h - Unit tests for json_sax.h.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "unit_test_base.h"
+
+#include "../benchmark.h"
+#include "../platform_defs.h"
+
+#include "../json.h"
+#include "../json_sax.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE(4100, "-Wunused-parameter")
+
+namespace rda
+{
+    class test_json_sax : public unit_test_base
+    {
+    protected:
+        // data structure of inputs that can be re-used by each unit test
+        struct unit_test_input_json_sax : public unit_test_input_base
+        {
+            std::string str1 = R"(
+{
+  "firstName": "John",
+  "lastName": "Smith",
+  "isAlive": true,
+  "age": 27,
+  "height": 1.85,
+  "address": {
+    "streetAddress": "21 2nd Street",
+    "city": "New York"
+  },
+  "phoneNumbers": [
+    { "type": "home", "number": "212 555-1234" },
+    { "type": "office", "number": "646 555-4567" }
+  ],
+  "quote": "bs- \\ quote- \"",
+  "children": [],
+  "spouse": null
+}
+)";
+        };
+
+        // handler that builds a node tree from the events, to compare against the parser
+        class tree_builder : public json::sax_handler
+        {
+        public:
+            // the children of each open object or array, innermost last
+            std::vector<std::vector<std::shared_ptr<json::node>>> levels;
+
+            // key names of the open objects and arrays, innermost last
+            std::vector<std::string> level_keys;
+
+            // whether each open level is an object
+            std::vector<bool> level_objects;
+
+            // key name for the next value
+            std::string next_key;
+
+            // the finished document
+            std::shared_ptr<json::node> root;
+
+            bool on_start_object() override
+            {
+                return start(true);
+            }
+
+            bool on_end_object() override
+            {
+                return end();
+            }
+
+            bool on_start_array() override
+            {
+                return start(false);
+            }
+
+            bool on_end_array() override
+            {
+                return end();
+            }
+
+            bool on_key(const std::string_view key_name) override
+            {
+                next_key.assign(key_name.data(), key_name.size());
+                return true;
+            }
+
+            bool on_string(const std::string_view value) override
+            {
+                return add(std::make_shared<json::node_string>(take_key(), std::string(value)));
+            }
+
+            bool on_integer(const int64_t value) override
+            {
+                return add(std::make_shared<json::node_integer>(take_key(), value));
+            }
+
+            bool on_float(const double value) override
+            {
+                return add(std::make_shared<json::node_float>(take_key(), value));
+            }
+
+            bool on_boolean(const bool value) override
+            {
+                return add(std::make_shared<json::node_boolean>(take_key(), value));
+            }
+
+            bool on_null() override
+            {
+                return add(std::make_shared<json::node_null>(take_key()));
+            }
+
+        private:
+            std::string take_key()
+            {
+                std::string key_name;
+                key_name.swap(next_key);
+                return key_name;
+            }
+
+            bool start(const bool is_object)
+            {
+                level_keys.push_back(take_key());
+                level_objects.push_back(is_object);
+                levels.emplace_back();
+                return true;
+            }
+
+            bool end()
+            {
+                std::shared_ptr<json::node> n;
+
+                if (level_objects.back())
+                    n = std::make_shared<json::node_object>(level_keys.back(), std::move(levels.back()));
+                else
+                    n = std::make_shared<json::node_array>(level_keys.back(), std::move(levels.back()));
+
+                levels.pop_back();
+                level_keys.pop_back();
+                level_objects.pop_back();
+
+                return add(n);
+            }
+
+            bool add(const std::shared_ptr<json::node> &n)
+            {
+                if (levels.empty())
+                    root = n;
+                else
+                    levels.back().push_back(n);
+
+                return true;
+            }
+        };
+
+        // handler that counts events, and stops after a given number of values
+        class counting_handler : public json::sax_handler
+        {
+        public:
+            size_t values = 0;
+            size_t containers = 0;
+            size_t stop_after = 0;
+
+            bool on_start_object() override
+            {
+                ++containers;
+                return true;
+            }
+
+            bool on_start_array() override
+            {
+                ++containers;
+                return true;
+            }
+
+            bool on_string(const std::string_view value) override
+            {
+                return count();
+            }
+
+            bool on_integer(const int64_t value) override
+            {
+                return count();
+            }
+
+            bool on_float(const double value) override
+            {
+                return count();
+            }
+
+            bool on_boolean(const bool value) override
+            {
+                return count();
+            }
+
+            bool on_null() override
+            {
+                return count();
+            }
+
+        private:
+            bool count()
+            {
+                ++values;
+                return (stop_after == 0 || values < stop_after);
+            }
+        };
+
+        // returns the node tree built from the events of the input, fed in chunks of the given size
+        static std::shared_ptr<json::node> build_tree(const std::string &input, const size_t chunk_size)
+        {
+            tree_builder builder;
+            json::sax_reader reader(builder);
+
+            for (size_t i = 0; i < input.size(); i += chunk_size)
+                reader.feed(std::string_view(input).substr(i, chunk_size));
+
+            if (!reader.finish())
+                return nullptr;
+
+            return builder.root;
+        }
+
+        // returns the name of the module that is being tested
+        std::string get_test_module_name() const override
+        {
+            return "test_json_sax";
+        }
+
+        // create and return the data structure of input to be provided to each test
+        std::shared_ptr<unit_test_input_base> create_test_input(const size_t testNum, const std::string &description) override
+        {
+            return std::make_shared<unit_test_input_json_sax>();
+        }
+
+        // adds all of the tests that will be run
+        void create_tests() override
+        {
+            add_test("events describe the parsed tree", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_sax>(input);
+
+                const std::vector<std::string> inputs = {
+                    pInput->str1,
+                    R"({{[{[[[{{{"nullObj":null}}}]]]}]}})",
+                    R"({test1:true,test2:  test string2, test3 : null , test4  : 30.1, test5:789})",
+                    R"({"a" "b", 5 "7", x})",
+                    R"({"k" : , ] : "v", [1, 2], "esc\"aped" : "a\\b\"c"})",
+                    R"({ "open" : "unterminated \")",
+                    R"({ "dangling" )",
+                    R"({ "a" : { "b" : [ 1, 2 )",
+                    "{}",
+                };
+
+                // every chunk size gives the same tree as the parser
+                for (const auto &s : inputs)
+                {
+                    const std::string expected = json::parse(s)->to_string();
+
+                    for (size_t chunk_size = 1; chunk_size <= s.size(); ++chunk_size)
+                    {
+                        auto tree = build_tree(s, chunk_size);
+                        ASSERT_TRUE(tree != nullptr);
+                        ASSERT_EQUAL(tree->to_string(), expected);
+                    }
+                }
+
+                const std::string arr = R"([1, "two", [3.5], {"four":4}, tr ue, null])";
+                for (size_t chunk_size = 1; chunk_size <= arr.size(); ++chunk_size)
+                    ASSERT_EQUAL(build_tree(arr, chunk_size)->to_string(), json::parse_array(arr)->to_string());
+            });
+
+            add_test("failures and early stop", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_sax>(input);
+
+                counting_handler handler;
+                ASSERT_FALSE(json::parse_sax("", handler));
+                ASSERT_FALSE(json::parse_sax("  \"not a document\" ", handler));
+                ASSERT_TRUE(json::parse_sax("  {} trailing text", handler));
+
+                counting_handler stopper;
+                stopper.stop_after = 3;
+                ASSERT_FALSE(json::parse_sax(pInput->str1, stopper));
+                ASSERT_TRUE(stopper.values == 3);
+
+                counting_handler all;
+                ASSERT_TRUE(json::parse_sax(pInput->str1, all));
+                ASSERT_TRUE(all.values == 13);
+                ASSERT_TRUE(all.containers == 6);
+
+                json::sax_reader reader(all);
+                ASSERT_TRUE(reader.feed("{ \"a\" : [ 1, 2"));
+                ASSERT_TRUE(reader.depth() == 2);
+                ASSERT_FALSE(reader.is_done());
+                ASSERT_TRUE(reader.finish());
+                ASSERT_TRUE(reader.depth() == 0);
+
+                reader.reset();
+                ASSERT_TRUE(reader.feed("[]"));
+                ASSERT_TRUE(reader.is_done());
+            });
+
+            add_test("bounded memory for streamed input", [](std::shared_ptr<unit_test_input_base> input) {
+                std::stringstream ss;
+                ss << "{ \"records\" : [";
+                for (size_t i = 0; i < 20000; ++i)
+                    ss << (i == 0 ? "" : ",") << "{ \"id\" : " << i << ", \"name\" : \"n" << i << "\" }";
+                ss << "] }";
+                const std::string document = ss.str();
+
+                counting_handler handler;
+                json::sax_reader reader(handler);
+                size_t max_buffered = 0;
+
+                for (size_t i = 0; i < document.size(); i += 4096)
+                {
+                    ASSERT_TRUE(reader.feed(std::string_view(document).substr(i, 4096)));
+                    max_buffered = std::max(max_buffered, reader.buffered());
+                }
+
+                ASSERT_TRUE(reader.finish());
+                ASSERT_TRUE(handler.values == 40000);
+                ASSERT_TRUE(max_buffered < 64);
+
+                std::istringstream stream(document);
+                counting_handler stream_handler;
+                {
+                    benchmark b("json sax parse of stream in 64k chunks");
+                    ASSERT_TRUE(json::parse_sax(stream, stream_handler));
+                }
+                ASSERT_TRUE(stream_handler.values == 40000);
+            });
+        }
+
+    }; // class test_json_sax
+
+} // namespace rda
+
+POP_WARN_DISABLE
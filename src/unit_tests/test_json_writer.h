@@ -0,0 +1,174 @@
+#pragma once
+
+//
+// test_json_writer.h - Unit tests for json_writer.h.
+//
+// Written by Ryan Antkowiak
+//
+
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "unit_test_base.h"
+
+#include "../benchmark.h"
+#include "../platform_defs.h"
+
+#include "../json.h"
+#include "../json_writer.h"
+
+PUSH_WARN_DISABLE
+WARN_DISABLE(4100, "-Wunused-parameter")
+
+namespace rda
+{
+    class test_json_writer : public unit_test_base
+    {
+    protected:
+        // data structure of inputs that can be re-used by each unit test
+        struct unit_test_input_json_writer : public unit_test_input_base
+        {
+            std::vector<std::string> documents = {
+                R"(
+{
+  "firstName": "John",
+  "lastName": "Smith",
+  "isAlive": true,
+  "age": 27,
+  "height": 1.85,
+  "address": {
+    "streetAddress": "21 2nd Street",
+    "city": "New York"
+  },
+  "phoneNumbers": [
+    { "type": "home", "number": "212 555-1234" },
+    { "type": "office", "number": "646 555-4567" }
+  ],
+  "quote": "bs- \\ quote- \"",
+  "children": [],
+  "spouse": null
+}
+)",
+                R"({{[{[[[{{{"nullObj":null}}}]]]}]}})",
+                R"({"negative":-42, "min":-9223372036854775808, "tiny":0.0000001, "neg":-2.5, "big":1e300, "empty":{}, "list":[null, false, "", [], {}]})",
+                R"({"a" "b", 5 "7", x, "esc\\\"aped" : "\\\\\""})",
+                "{}",
+            };
+        };
+
+        // returns the name of the module that is being tested
+        std::string get_test_module_name() const override
+        {
+            return "test_json_writer";
+        }
+
+        // create and return the data structure of input to be provided to each test
+        std::shared_ptr<unit_test_input_base> create_test_input(const size_t testNum, const std::string &description) override
+        {
+            return std::make_shared<unit_test_input_json_writer>();
+        }
+
+        // adds all of the tests that will be run
+        void create_tests() override
+        {
+            add_test("same text as to_string and to_pretty_string", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_writer>(input);
+
+                json::writer w;
+
+                for (const auto &s : pInput->documents)
+                {
+                    const auto j = json::parse(s);
+
+                    ASSERT_EQUAL(std::string(w.write(*j)), j->to_string());
+                    ASSERT_EQUAL(std::string(w.write_pretty(*j)), j->to_pretty_string());
+                    ASSERT_EQUAL(std::string(w.write_pretty(*j, 2)), j->to_pretty_string(2));
+
+                    for (const auto &child : *j)
+                    {
+                        ASSERT_EQUAL(std::string(w.write(*child)), child->to_string());
+                        ASSERT_EQUAL(std::string(w.write_pretty(*child, 1)), child->to_pretty_string(1));
+                    }
+                }
+
+                const auto arr = json::parse_array("[1, \"two\", [3.5], {\"four\":4}]");
+                ASSERT_EQUAL(std::string(w.write(*arr)), arr->to_string());
+                ASSERT_EQUAL(std::string(w.write_pretty(*arr)), arr->to_pretty_string());
+
+                const json::node_float special("f", std::numeric_limits<double>::infinity());
+                ASSERT_EQUAL(std::string(w.write(special)), special.to_string());
+            });
+
+            add_test("output iterators and buffer re-use", [](std::shared_ptr<unit_test_input_base> input) {
+                auto pInput = std::dynamic_pointer_cast<unit_test_input_json_writer>(input);
+
+                const auto j = json::parse(pInput->documents[0]);
+
+                std::vector<char> chars;
+                json::write(*j, std::back_inserter(chars));
+                ASSERT_EQUAL(std::string(chars.begin(), chars.end()), j->to_string());
+
+                std::stringstream ss;
+                json::write(*j, std::ostreambuf_iterator<char>(ss), json::write_style::WS_PRETTY);
+                ASSERT_EQUAL(ss.str(), j->to_pretty_string());
+
+                char fixed[1024];
+                char *end = json::write(*j, fixed);
+                ASSERT_EQUAL(std::string(fixed, end), j->to_string());
+
+                // once the buffer has grown, writing again does not need more memory
+                json::writer w;
+                w.write(*j);
+                const size_t capacity = w.capacity();
+                for (size_t i = 0; i < 100; ++i)
+                    w.write(*j);
+                ASSERT_TRUE(w.capacity() == capacity);
+
+                w.clear();
+                w.append(*(*j)["age"]);
+                w.append(",");
+                w.append(*(*j)["isAlive"]);
+                ASSERT_EQUAL(std::string(w.get_buffer()), std::string(R"("age":27,"isAlive":true)"));
+                ASSERT_TRUE(w.size() == w.get_buffer().size());
+            });
+
+            add_test("benchmark: writer vs to_string", [](std::shared_ptr<unit_test_input_base> input) {
+                std::stringstream ss;
+                ss << "{ \"records\" : [";
+                for (size_t i = 0; i < 5000; ++i)
+                    ss << (i == 0 ? "" : ",") << "{ \"id\" : " << i << ", \"price\" : " << i << ".25, \"name\" : \"n\\\"" << i
+                       << "\", \"tags\" : [ true, null ] }";
+                ss << "] }";
+                const auto j = json::parse(ss.str());
+
+                std::string compact;
+                std::string pretty;
+
+                {
+                    benchmark b("json to_string and to_pretty_string");
+                    compact = j->to_string();
+                    pretty = j->to_pretty_string();
+                }
+
+                json::writer w;
+                w.write_pretty(*j);
+
+                {
+                    benchmark b("json writer compact and pretty (re-used buffer)");
+                    ASSERT_TRUE(w.write(*j) == compact);
+                    ASSERT_TRUE(w.write_pretty(*j) == pretty);
+                }
+            });
+        }
+
+    }; // class test_json_writer
+
+} // namespace rda
+
+POP_WARN_DISABLE